@@ -62,6 +62,9 @@ GDALRasterInfoAlgorithm::GDALRasterInfoAlgorithm(bool standaloneStep,
         .SetCategory(GAAC_ADVANCED);
     AddArg("checksum", 0, _("Compute pixel checksum"), &m_checksum)
         .SetCategory(GAAC_ADVANCED);
+    AddArg("cache-stats", 0, _("Report block cache statistics"),
+           &m_cacheStats)
+        .SetCategory(GAAC_ADVANCED);
     AddArg("list-mdd", 0,
            _("List all metadata domains available for the dataset"), &m_listMDD)
         .AddAlias("list-metadata-domains")
@@ -126,6 +129,8 @@ bool GDALRasterInfoAlgorithm::RunStep(GDALPipelineStepRunContext &)
         aosOptions.AddString("-nonodata");
     if (m_checksum)
         aosOptions.AddString("-checksum");
+    if (m_cacheStats)
+        aosOptions.AddString("-cache_stats");
     if (m_listMDD)
         aosOptions.AddString("-listmdd");
     if (!m_mdd.empty())
@@ -90,6 +90,9 @@ struct GDALInfoOptions
     /*! force computation of the checksum for each band in the dataset */
     bool bComputeChecksum = false;
 
+    /*! report block cache statistics, after the other computations */
+    bool bReportCacheStatistics = false;
+
     /*! allow or suppress printing of nodata value */
     bool bShowNodata = true;
 
@@ -286,6 +289,12 @@ GDALInfoAppOptionsGetParser(GDALInfoOptions *psOptions,
         .help(_(
             "Force computation of the checksum for each band in the dataset."));
 
+    argParser->add_argument("-cache_stats")
+        .flag()
+        .store_into(psOptions->bReportCacheStatistics)
+        .help(_("Report block cache statistics of the dataset and of the "
+                "process."));
+
     argParser->add_argument("-listmdd")
         .flag()
         .store_into(psOptions->bListMDD)
@@ -1941,6 +1950,81 @@ char *GDALInfo(GDALDatasetH hDataset, const GDALInfoOptions *psOptions)
         }
     }
 
+    if (psOptions->bReportCacheStatistics)
+    {
+        GDALDatasetCacheStatistics sDSStats;
+        GDALCacheStatistics sStats;
+        if (GDALDatasetGetCacheStatistics(hDataset, &sDSStats) &&
+            GDALGetCacheStatistics(&sStats))
+        {
+            if (bJson)
+            {
+                const auto AddInt =
+                    [](json_object *poObj, const char *pszKey, GUIntBig nVal)
+                {
+                    json_object_object_add(
+                        poObj, pszKey,
+                        json_object_new_int64(static_cast<int64_t>(nVal)));
+                };
+
+                json_object *poDSCache = json_object_new_object();
+                AddInt(poDSCache, "blocks", sDSStats.nBlocks);
+                AddInt(poDSCache, "bytes", sDSStats.nUsed);
+                AddInt(poDSCache, "hits", sDSStats.nHits);
+                AddInt(poDSCache, "misses", sDSStats.nMisses);
+                AddInt(poDSCache, "evictions", sDSStats.nEvictions);
+
+                json_object *poGlobalCache = json_object_new_object();
+                AddInt(poGlobalCache, "maxBytes", sStats.nMax);
+                AddInt(poGlobalCache, "bytes", sStats.nUsed);
+                AddInt(poGlobalCache, "blocks", sStats.nBlocks);
+                AddInt(poGlobalCache, "hits", sStats.nHits);
+                AddInt(poGlobalCache, "misses", sStats.nMisses);
+                AddInt(poGlobalCache, "evictions", sStats.nEvictions);
+                AddInt(poGlobalCache, "dirtyBlocksFlushed",
+                       sStats.nDirtyBlocksFlushed);
+                AddInt(poGlobalCache, "dirtyBytesFlushed",
+                       sStats.nDirtyBytesFlushed);
+                AddInt(poGlobalCache, "lockAcquisitions",
+                       sStats.nLockAcquisitions);
+                json_object_object_add(
+                    poGlobalCache, "lockWaitTime",
+                    json_object_new_double(sStats.dfLockWaitTime));
+
+                json_object *poBlockCache = json_object_new_object();
+                json_object_object_add(poBlockCache, "dataset", poDSCache);
+                json_object_object_add(poBlockCache, "global", poGlobalCache);
+                json_object_object_add(poJsonObject, "blockCache",
+                                       poBlockCache);
+            }
+            else
+            {
+                Concat(osStr, psOptions->bStdoutOutput, "Block Cache:\n");
+                Concat(osStr, psOptions->bStdoutOutput,
+                       "  Dataset: " CPL_FRMT_GIB " blocks (" CPL_FRMT_GIB
+                       " bytes), " CPL_FRMT_GUIB " hits, " CPL_FRMT_GUIB
+                       " misses, " CPL_FRMT_GUIB " evictions\n",
+                       sDSStats.nBlocks, sDSStats.nUsed, sDSStats.nHits,
+                       sDSStats.nMisses, sDSStats.nEvictions);
+                Concat(osStr, psOptions->bStdoutOutput,
+                       "  Global: " CPL_FRMT_GIB " blocks (" CPL_FRMT_GIB
+                       " bytes out of " CPL_FRMT_GIB "), " CPL_FRMT_GUIB
+                       " hits, " CPL_FRMT_GUIB " misses, " CPL_FRMT_GUIB
+                       " evictions\n",
+                       sStats.nBlocks, sStats.nUsed, sStats.nMax, sStats.nHits,
+                       sStats.nMisses, sStats.nEvictions);
+                Concat(osStr, psOptions->bStdoutOutput,
+                       "  Dirty blocks flushed: " CPL_FRMT_GUIB
+                       " (" CPL_FRMT_GUIB " bytes)\n",
+                       sStats.nDirtyBlocksFlushed, sStats.nDirtyBytesFlushed);
+                Concat(osStr, psOptions->bStdoutOutput,
+                       "  Lock acquisitions: " CPL_FRMT_GUIB
+                       ", total wait time: %.6f s\n",
+                       sStats.nLockAcquisitions, sStats.dfLockWaitTime);
+            }
+        }
+    }
+
     if (bJson)
     {
         json_object_object_add(poJsonObject, "bands", poBands);
@@ -20,6 +20,7 @@
 #include "gdal_unit_test.h"
 
 #include "cpl_compressor.h"
+#include "cpl_csv.h"
 #include "cpl_error.h"
 #include "cpl_float.h"
 #include "cpl_hash_set.h"
@@ -5643,6 +5644,73 @@ TEST_F(test_cpl, CPLHasPathTraversal)
     }
 }
 
+// Test CSV line splitting when special characters fall at, or around, the
+// boundaries of the 16-byte chunks scanned at once
+TEST_F(test_cpl, CSVReadParseLine3L_chunk_boundaries)
+{
+    const auto Parse = [](const std::string &osLine, const char *pszDelimiter)
+    {
+        const char *pszFilename = "/vsimem/CSVReadParseLine3L.csv";
+        VSIFCloseL(VSIFileFromMemBuffer(
+            pszFilename,
+            reinterpret_cast<GByte *>(const_cast<char *>(osLine.data())),
+            osLine.size(), false));
+        VSILFILE *fp = VSIFOpenL(pszFilename, "rb");
+        CPLStringList aosTokens;
+        if (fp)
+        {
+            aosTokens.Assign(CSVReadParseLine3L(fp, 0, pszDelimiter,
+                                                /* bHonourStrings = */ true,
+                                                false, false, false));
+            VSIFCloseL(fp);
+        }
+        VSIUnlink(pszFilename);
+        return aosTokens;
+    };
+
+    // Lines of 15, 16 and 17 bytes
+    for (int nLen = 15; nLen <= 17; ++nLen)
+    {
+        const std::string osField(nLen, 'x');
+        auto aosTokens = Parse(osField, ",");
+        ASSERT_EQ(aosTokens.size(), 1) << nLen;
+        EXPECT_STREQ(aosTokens[0], osField.c_str()) << nLen;
+
+        const std::string osFirst(nLen - 2, 'x');
+        aosTokens = Parse(osFirst + ",y", ",");
+        ASSERT_EQ(aosTokens.size(), 2) << nLen;
+        EXPECT_STREQ(aosTokens[0], osFirst.c_str()) << nLen;
+        EXPECT_STREQ(aosTokens[1], "y") << nLen;
+
+        aosTokens = Parse(osFirst + "y,", ",");
+        ASSERT_EQ(aosTokens.size(), 2) << nLen;
+        EXPECT_STREQ(aosTokens[0], (osFirst + "y").c_str()) << nLen;
+        EXPECT_STREQ(aosTokens[1], "") << nLen;
+    }
+
+    // Shift delimiters, quotes and escaped quotes over all the positions of
+    // a chunk
+    for (int nPad = 0; nPad < 40; ++nPad)
+    {
+        const std::string osPad(nPad, 'a');
+        auto aosTokens =
+            Parse(osPad + ",\"b\"\"c,d" + osPad + "\"\"\"\"\",e", ",");
+        ASSERT_EQ(aosTokens.size(), 3) << nPad;
+        EXPECT_STREQ(aosTokens[0], osPad.c_str()) << nPad;
+        EXPECT_STREQ(aosTokens[1], ("b\"c,d" + osPad + "\"\"").c_str())
+            << nPad;
+        EXPECT_STREQ(aosTokens[2], "e") << nPad;
+
+        // Multi-character delimiter, and its first character alone
+        aosTokens = Parse(osPad + "|a||\"x||y\"||" + osPad + "||", "||");
+        ASSERT_EQ(aosTokens.size(), 4) << nPad;
+        EXPECT_STREQ(aosTokens[0], (osPad + "|a").c_str()) << nPad;
+        EXPECT_STREQ(aosTokens[1], "x||y") << nPad;
+        EXPECT_STREQ(aosTokens[2], osPad.c_str()) << nPad;
+        EXPECT_STREQ(aosTokens[3], "") << nPad;
+    }
+}
+
 TEST_F(test_cpl, CPLHasUnbalancedPathTraversal)
 {
     EXPECT_FALSE(CPLHasUnbalancedPathTraversal("a"));
@@ -12,6 +12,7 @@
 
 #include "gdal_unit_test.h"
 
+#include "cpl_multiproc.h"
 #include "gdal_alg.h"
 #include "gdal_priv.h"
 #include "gdal_utils.h"
@@ -6319,4 +6320,327 @@ TEST_F(test_gdal, GDALMDArrayRawBlockInfo)
     }
 }
 
+// Test block cache pools
+TEST_F(test_gdal, block_cache_pools)
+{
+    GDALDriver *poGTiffDriver =
+        GetGDALDriverManager()->GetDriverByName("GTiff");
+    if (!poGTiffDriver)
+    {
+        GTEST_SKIP() << "GTiff driver missing";
+    }
+
+    const auto CreateDataset = [poGTiffDriver](const char *pszFilename)
+    {
+        const char *const apszOptions[] = {"TILED=YES", "BLOCKXSIZE=64",
+                                           "BLOCKYSIZE=64", nullptr};
+        std::unique_ptr<GDALDataset> poDS(poGTiffDriver->Create(
+            pszFilename, 64 * 16, 64 * 16, 1, GDT_Byte, apszOptions));
+        poDS->GetRasterBand(1)->Fill(1);
+        poDS.reset();
+        return std::unique_ptr<GDALDataset>(
+            GDALDataset::Open(pszFilename, GDAL_OF_RASTER));
+    };
+
+    const auto ReadBlock = [](GDALDataset *poDS, int i)
+    {
+        GDALRasterBlock *poBlock =
+            poDS->GetRasterBand(1)->GetLockedBlockRef(i % 16, i / 16);
+        ASSERT_NE(poBlock, nullptr);
+        EXPECT_EQ(static_cast<GByte *>(poBlock->GetDataRef())[0], 1);
+        poBlock->DropLock();
+    };
+
+    const auto GetStats = [](const char *pszPool)
+    {
+        GDALCachePoolStatistics sStats;
+        EXPECT_TRUE(GDALGetCachePoolStatistics(pszPool, &sStats));
+        return sStats;
+    };
+
+    // Upper bound of the cost of a 64x64 Byte block in the cache.
+    constexpr GIntBig BLOCK_COST = 64 * 64 + 512;
+
+    {
+        CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+        GDALCachePoolStatistics sStats;
+        EXPECT_FALSE(GDALGetCachePoolStatistics("non_existing", &sStats));
+        EXPECT_FALSE(GDALSetCachePool("invalid", -1, GCPP_NORMAL, nullptr));
+        const char *const apszOptions[] = {"POLICY=invalid", nullptr};
+        EXPECT_FALSE(
+            GDALSetCachePool("invalid", 0, GCPP_NORMAL, apszOptions));
+    }
+
+    // Quota
+    {
+        const char *pszFilename = "/vsimem/block_cache_pools_quota.tif";
+        auto poDS = CreateDataset(pszFilename);
+        ASSERT_NE(poDS, nullptr);
+        EXPECT_STREQ(poDS->GetCachePool(), "default");
+        {
+            CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+            EXPECT_EQ(poDS->SetCachePool("non_existing"), CE_Failure);
+        }
+        ASSERT_TRUE(GDALSetCachePool("test_quota", 10 * BLOCK_COST,
+                                     GCPP_NORMAL, nullptr));
+        ASSERT_EQ(poDS->SetCachePool("test_quota"), CE_None);
+        EXPECT_STREQ(poDS->GetCachePool(), "test_quota");
+
+        for (int i = 0; i < 50; ++i)
+            ReadBlock(poDS.get(), i);
+        auto sStats = GetStats("test_quota");
+        EXPECT_EQ(sStats.nQuota, 10 * BLOCK_COST);
+        EXPECT_LE(sStats.nUsed, sStats.nQuota);
+        EXPECT_EQ(sStats.nBlocks, 10);
+        EXPECT_EQ(sStats.nMisses, 50U);
+        EXPECT_EQ(sStats.nHits, 0U);
+        EXPECT_EQ(sStats.nEvictions, 40U);
+
+        // Most recently used block
+        ReadBlock(poDS.get(), 49);
+        sStats = GetStats("test_quota");
+        EXPECT_EQ(sStats.nHits, 1U);
+        EXPECT_EQ(sStats.nMisses, 50U);
+
+        poDS.reset();
+        sStats = GetStats("test_quota");
+        EXPECT_EQ(sStats.nUsed, 0);
+        EXPECT_EQ(sStats.nBlocks, 0);
+        VSIUnlink(pszFilename);
+    }
+
+    // Priorities
+    {
+        const char *pszFilenameBulk = "/vsimem/block_cache_pools_bulk.tif";
+        const char *pszFilenameInteractive =
+            "/vsimem/block_cache_pools_interactive.tif";
+        auto poDSBulk = CreateDataset(pszFilenameBulk);
+        ASSERT_NE(poDSBulk, nullptr);
+        auto poDSInteractive = CreateDataset(pszFilenameInteractive);
+        ASSERT_NE(poDSInteractive, nullptr);
+        ASSERT_TRUE(GDALSetCachePool("test_bulk", 0, GCPP_BULK, nullptr));
+        ASSERT_TRUE(GDALSetCachePool("test_interactive", 0, GCPP_INTERACTIVE,
+                                     nullptr));
+        ASSERT_EQ(poDSBulk->SetCachePool("test_bulk"), CE_None);
+        ASSERT_EQ(poDSInteractive->SetCachePool("test_interactive"), CE_None);
+
+        while (GDALFlushCacheBlock())
+        {
+        }
+        const GIntBig nOldCacheMax = GDALGetCacheMax64();
+        GDALSetCacheMax64(20 * BLOCK_COST);
+
+        for (int i = 0; i < 8; ++i)
+            ReadBlock(poDSInteractive.get(), i);
+        for (int i = 0; i < 100; ++i)
+            ReadBlock(poDSBulk.get(), i);
+
+        const auto sStatsInteractive = GetStats("test_interactive");
+        EXPECT_EQ(sStatsInteractive.nBlocks, 8);
+        EXPECT_EQ(sStatsInteractive.nEvictions, 0U);
+        const auto sStatsBulk = GetStats("test_bulk");
+        EXPECT_GT(sStatsBulk.nEvictions, 0U);
+        EXPECT_LE(GDALGetCacheUsed64(), 20 * BLOCK_COST);
+
+        GDALSetCacheMax64(nOldCacheMax);
+        poDSBulk.reset();
+        poDSInteractive.reset();
+        VSIUnlink(pszFilenameBulk);
+        VSIUnlink(pszFilenameInteractive);
+    }
+
+    // Scan resistance of the 2Q policy
+    {
+        const char *pszFilename = "/vsimem/block_cache_pools_2q.tif";
+        auto poDS = CreateDataset(pszFilename);
+        ASSERT_NE(poDS, nullptr);
+        const char *const apszOptions[] = {"POLICY=2Q", nullptr};
+        ASSERT_TRUE(GDALSetCachePool("test_2q", 40 * BLOCK_COST, GCPP_NORMAL,
+                                     apszOptions));
+        ASSERT_EQ(poDS->SetCachePool("test_2q"), CE_None);
+
+        // Load the hot blocks, evict them from the probation queue, and load
+        // them again, so that they enter the LRU list.
+        for (int i = 0; i < 5; ++i)
+            ReadBlock(poDS.get(), i);
+        for (int i = 100; i < 200; ++i)
+            ReadBlock(poDS.get(), i);
+        for (int i = 0; i < 5; ++i)
+            ReadBlock(poDS.get(), i);
+
+        // A scan of blocks that have not been recently evicted must not
+        // evict them.
+        for (int i = 5; i < 100; ++i)
+            ReadBlock(poDS.get(), i);
+        for (int i = 200; i < 256; ++i)
+            ReadBlock(poDS.get(), i);
+
+        const auto sStatsBefore = GetStats("test_2q");
+        for (int i = 0; i < 5; ++i)
+            ReadBlock(poDS.get(), i);
+        const auto sStatsAfter = GetStats("test_2q");
+        EXPECT_EQ(sStatsAfter.nHits - sStatsBefore.nHits, 5U);
+        EXPECT_EQ(sStatsAfter.nMisses, sStatsBefore.nMisses);
+
+        poDS.reset();
+        VSIUnlink(pszFilename);
+    }
+}
+
+// Test block cache statistics
+TEST_F(test_gdal, block_cache_statistics)
+{
+    GDALDriver *poGTiffDriver =
+        GetGDALDriverManager()->GetDriverByName("GTiff");
+    if (!poGTiffDriver)
+    {
+        GTEST_SKIP() << "GTiff driver missing";
+    }
+
+    GDALResetCacheStatistics();
+    GDALCacheStatistics sStats;
+    ASSERT_TRUE(GDALGetCacheStatistics(&sStats));
+    EXPECT_EQ(sStats.nHits, 0U);
+    EXPECT_EQ(sStats.nMisses, 0U);
+    EXPECT_EQ(sStats.nDirtyBlocksFlushed, 0U);
+    EXPECT_EQ(sStats.nMax, GDALGetCacheMax64());
+
+    const char *pszFilename = "/vsimem/block_cache_statistics.tif";
+    std::unique_ptr<GDALDataset> poDS(
+        poGTiffDriver->Create(pszFilename, 64, 64, 1, GDT_Byte, nullptr));
+    ASSERT_NE(poDS, nullptr);
+    GDALRasterBand *poBand = poDS->GetRasterBand(1);
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+
+    for (int i = 0; i < 2; ++i)
+    {
+        GDALRasterBlock *poBlock = poBand->GetLockedBlockRef(0, 0);
+        ASSERT_NE(poBlock, nullptr);
+        poBlock->MarkDirty();
+        poBlock->DropLock();
+    }
+
+    GDALDatasetCacheStatistics sDSStats;
+    ASSERT_TRUE(GDALDatasetGetCacheStatistics(GDALDataset::ToHandle(poDS.get()),
+                                              &sDSStats));
+    EXPECT_EQ(sDSStats.nBlocks, 1);
+    EXPECT_GE(sDSStats.nUsed, static_cast<GIntBig>(nBlockXSize) * nBlockYSize);
+    EXPECT_EQ(sDSStats.nHits, 1U);
+    EXPECT_EQ(sDSStats.nMisses, 1U);
+    EXPECT_EQ(sDSStats.nEvictions, 0U);
+
+    EXPECT_EQ(poDS->FlushCache(false), CE_None);
+    ASSERT_TRUE(GDALGetCacheStatistics(&sStats));
+    EXPECT_GE(sStats.nHits, 1U);
+    EXPECT_GE(sStats.nMisses, 1U);
+    EXPECT_GE(sStats.nDirtyBlocksFlushed, 1U);
+    EXPECT_GE(sStats.nDirtyBytesFlushed,
+              static_cast<GUIntBig>(nBlockXSize) * nBlockYSize);
+    EXPECT_GT(sStats.nLockAcquisitions, 0U);
+    EXPECT_GE(sStats.dfLockWaitTime, 0.0);
+
+    ASSERT_TRUE(poDS->GetCacheStatistics(&sDSStats));
+    EXPECT_EQ(sDSStats.nBlocks, 0);
+    EXPECT_EQ(sDSStats.nUsed, 0);
+
+    poDS.reset();
+    VSIUnlink(pszFilename);
+}
+
+// Test the block cache write-behind thread
+TEST_F(test_gdal, block_cache_write_behind)
+{
+    GDALDriver *poGTiffDriver =
+        GetGDALDriverManager()->GetDriverByName("GTiff");
+    if (!poGTiffDriver)
+    {
+        GTEST_SKIP() << "GTiff driver missing";
+    }
+
+    // The cache is large enough for all blocks not to be evicted, so only
+    // the write-behind thread can write them before the dataset is closed:
+    // it is woken up once 1% of the cache (671 KB) is dirty.
+    const GIntBig nOldCacheMax = GDALGetCacheMax64();
+    GDALSetCacheMax64(64 * 1024 * 1024);
+    CPLConfigOptionSetter oSetter("GDAL_CACHE_WRITE_BEHIND_THRESHOLD", "1",
+                                  false);
+
+    constexpr int SIZE = 1024;
+    constexpr int BLOCK_SIZE = 64;
+    constexpr int BLOCK_COUNT = SIZE / BLOCK_SIZE;
+    const char *pszFilename = "/vsimem/block_cache_write_behind.tif";
+    CPLStringList aosOptions;
+    aosOptions.SetNameValue("TILED", "YES");
+    aosOptions.SetNameValue("BLOCKXSIZE", CPLSPrintf("%d", BLOCK_SIZE));
+    aosOptions.SetNameValue("BLOCKYSIZE", CPLSPrintf("%d", BLOCK_SIZE));
+    std::unique_ptr<GDALDataset> poDS(poGTiffDriver->Create(
+        pszFilename, SIZE, SIZE, 1, GDT_Byte, aosOptions.List()));
+    ASSERT_NE(poDS, nullptr);
+
+    const auto GetExpectedValue = [](int nX, int nY)
+    { return static_cast<GByte>(nY / BLOCK_SIZE + nX); };
+
+    // Modify the blocks directly in the cache, without holding the
+    // read-write mutex of the dataset, which the write-behind thread needs.
+    GDALResetCacheStatistics();
+    GDALRasterBand *poBand = poDS->GetRasterBand(1);
+    for (int iYBlock = 0; iYBlock < BLOCK_COUNT; ++iYBlock)
+    {
+        for (int iXBlock = 0; iXBlock < BLOCK_COUNT; ++iXBlock)
+        {
+            GDALRasterBlock *poBlock =
+                poBand->GetLockedBlockRef(iXBlock, iYBlock, TRUE);
+            ASSERT_NE(poBlock, nullptr);
+            GByte *pabyData = static_cast<GByte *>(poBlock->GetDataRef());
+            for (int iY = 0; iY < BLOCK_SIZE; ++iY)
+            {
+                for (int iX = 0; iX < BLOCK_SIZE; ++iX)
+                {
+                    pabyData[iY * BLOCK_SIZE + iX] =
+                        GetExpectedValue(iXBlock * BLOCK_SIZE + iX,
+                                         iYBlock * BLOCK_SIZE + iY);
+                }
+            }
+            poBlock->MarkDirty();
+            poBlock->DropLock();
+        }
+    }
+
+    // Dirty blocks are written by the write-behind thread before the
+    // dataset is flushed.
+    GDALCacheStatistics sStats;
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_TRUE(GDALGetCacheStatistics(&sStats));
+        if (sStats.nDirtyBlocksFlushed > 0)
+            break;
+        CPLSleep(0.1);
+    }
+    EXPECT_GT(sStats.nDirtyBlocksFlushed, 0U);
+    EXPECT_LT(sStats.nDirtyBlocksFlushed,
+              static_cast<GUIntBig>(BLOCK_COUNT) * BLOCK_COUNT);
+
+    poDS.reset();
+    GDALSetCacheMax64(nOldCacheMax);
+
+    poDS.reset(GDALDataset::Open(pszFilename));
+    ASSERT_NE(poDS, nullptr);
+    std::vector<GByte> abyLine(SIZE);
+    for (int iY = 0; iY < SIZE; ++iY)
+    {
+        ASSERT_EQ(poDS->GetRasterBand(1)->RasterIO(
+                      GF_Read, 0, iY, SIZE, 1, abyLine.data(), SIZE, 1,
+                      GDT_Byte, 0, 0, nullptr),
+                  CE_None);
+        for (int iX = 0; iX < SIZE; ++iX)
+        {
+            ASSERT_EQ(abyLine[iX], GetExpectedValue(iX, iY));
+        }
+    }
+    poDS.reset();
+    VSIUnlink(pszFilename);
+}
+
 }  // namespace
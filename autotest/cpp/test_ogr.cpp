@@ -4734,4 +4734,122 @@ TEST_F(test_ogr, OGRPolygon_two_vertex_constructor)
     CPLFree(outWKT);
 }
 
+// Test vectorized code paths of OGRSimpleCurve with odd and even number of
+// points
+TEST_F(test_ogr, OGRSimpleCurve_vectorized_kernels)
+{
+    for (int nPoints = 4; nPoints <= 9; ++nPoints)
+    {
+        // Regular polygon with nPoints-1 vertices, centered on (100, 200),
+        // of radius 10
+        OGRLinearRing oRing;
+        const int nVertices = nPoints - 1;
+        for (int i = 0; i < nVertices; ++i)
+        {
+            const double dfAngle = 2 * M_PI * i / nVertices;
+            oRing.addPoint(100 + 10 * cos(dfAngle), 200 + 10 * sin(dfAngle));
+        }
+        oRing.closeRings();
+        ASSERT_EQ(oRing.getNumPoints(), nPoints);
+
+        OGREnvelope sEnvelope;
+        oRing.getEnvelope(&sEnvelope);
+        double dfMinX = oRing.getX(0);
+        double dfMaxX = oRing.getX(0);
+        double dfMinY = oRing.getY(0);
+        double dfMaxY = oRing.getY(0);
+        for (int i = 1; i < nPoints; ++i)
+        {
+            dfMinX = std::min(dfMinX, oRing.getX(i));
+            dfMaxX = std::max(dfMaxX, oRing.getX(i));
+            dfMinY = std::min(dfMinY, oRing.getY(i));
+            dfMaxY = std::max(dfMaxY, oRing.getY(i));
+        }
+        EXPECT_EQ(sEnvelope.MinX, dfMinX);
+        EXPECT_EQ(sEnvelope.MaxX, dfMaxX);
+        EXPECT_EQ(sEnvelope.MinY, dfMinY);
+        EXPECT_EQ(sEnvelope.MaxY, dfMaxY);
+
+        const double dfSide = 2 * 10 * sin(M_PI / nVertices);
+        EXPECT_NEAR(oRing.get_Length(), nVertices * dfSide, 1e-10);
+
+        const double dfArea =
+            0.5 * nVertices * 10 * 10 * sin(2 * M_PI / nVertices);
+        EXPECT_NEAR(oRing.get_Area(), dfArea, 1e-10);
+        EXPECT_FALSE(oRing.isClockwise());
+        oRing.reversePoints();
+        EXPECT_TRUE(oRing.isClockwise());
+        EXPECT_NEAR(oRing.get_Area(), dfArea, 1e-10);
+
+        OGRLinearRing oRingSwapped(oRing);
+        oRingSwapped.swapXY();
+        for (int i = 0; i < nPoints; ++i)
+        {
+            EXPECT_EQ(oRingSwapped.getX(i), oRing.getY(i));
+            EXPECT_EQ(oRingSwapped.getY(i), oRing.getX(i));
+        }
+    }
+
+    // NaN values after the first point are ignored by getEnvelope()
+    {
+        OGRLineString oLS;
+        oLS.addPoint(0, 1);
+        oLS.addPoint(std::numeric_limits<double>::quiet_NaN(), 2);
+        oLS.addPoint(3, std::numeric_limits<double>::quiet_NaN());
+        oLS.addPoint(-1, -2);
+        oLS.addPoint(4, 5);
+        OGREnvelope sEnvelope;
+        oLS.getEnvelope(&sEnvelope);
+        EXPECT_EQ(sEnvelope.MinX, -1);
+        EXPECT_EQ(sEnvelope.MaxX, 4);
+        EXPECT_EQ(sEnvelope.MinY, -2);
+        EXPECT_EQ(sEnvelope.MaxY, 5);
+    }
+}
+
+// Test Value() and segmentize() on curves whose number of segments spans
+// several chunks of the vectorized segment length computation
+TEST_F(test_ogr, OGRSimpleCurve_Value_segmentize_many_points)
+{
+    for (int nPoints : {2, 3, 256, 257, 258, 600})
+    {
+        // Zigzag line whose segments are alternatively of length 5 and 10
+        OGRLineString oLS;
+        double dfX = 0;
+        for (int i = 0; i < nPoints; ++i)
+        {
+            oLS.addPoint(dfX, (i % 2) == 0 ? 0.0 : 4.0, i);
+            dfX += (i % 2) == 0 ? 3.0 : sqrt(10.0 * 10.0 - 4.0 * 4.0);
+        }
+
+        double dfLength = 0;
+        for (int i = 0; i + 1 < nPoints; ++i)
+        {
+            OGRPoint oPoint;
+            const double dfSegLength = (i % 2) == 0 ? 5.0 : 10.0;
+            oLS.Value(dfLength + dfSegLength / 2, &oPoint);
+            EXPECT_NEAR(oPoint.getX(), (oLS.getX(i) + oLS.getX(i + 1)) / 2,
+                        1e-8);
+            EXPECT_NEAR(oPoint.getY(), 2.0, 1e-8);
+            EXPECT_NEAR(oPoint.getZ(), i + 0.5, 1e-8);
+            dfLength += dfSegLength;
+        }
+        EXPECT_NEAR(oLS.get_Length(), dfLength, 1e-8);
+
+        OGRLineString oSegmentized(oLS);
+        ASSERT_TRUE(oSegmentized.segmentize(2.5));
+        // Segments of length 5 are split in 2, those of length 10 in 4
+        const int nSegments = nPoints - 1;
+        EXPECT_EQ(oSegmentized.getNumPoints(),
+                  1 + 2 * ((nSegments + 1) / 2) + 4 * (nSegments / 2));
+        for (int i = 0; i + 1 < oSegmentized.getNumPoints(); ++i)
+        {
+            const double dfDX = oSegmentized.getX(i + 1) - oSegmentized.getX(i);
+            const double dfDY = oSegmentized.getY(i + 1) - oSegmentized.getY(i);
+            EXPECT_NEAR(sqrt(dfDX * dfDX + dfDY * dfDY), 2.5, 1e-8);
+        }
+        EXPECT_NEAR(oSegmentized.get_Length(), dfLength, 1e-8);
+    }
+}
+
 }  // namespace
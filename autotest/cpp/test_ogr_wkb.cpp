@@ -508,6 +508,119 @@ INSTANTIATE_TEST_SUITE_P(
         OGRWKBIntersectsPessimisticFixture::ParamType> &l_info)
     { return std::get<6>(l_info.param); });
 
+class OGRWKBIntersectsEnvelopeFixture
+    : public test_ogr_wkb,
+      public ::testing::WithParamInterface<std::tuple<
+          const char *, double, double, double, double, int, const char *>>
+{
+  public:
+    // -1 means not handled
+    static std::vector<std::tuple<const char *, double, double, double, double,
+                                  int, const char *>>
+    GetTupleValues()
+    {
+        return {
+            std::make_tuple("POINT(1 2)", 0.9, 1.9, 1.1, 2.1, 1, "POINT_IN"),
+            std::make_tuple("POINT(1 2)", 1.05, 1.9, 1.1, 2.1, 0, "POINT_OUT"),
+            std::make_tuple("POINT(1 2)", 1, 2, 1.1, 2.1, 1, "POINT_TOUCH"),
+            std::make_tuple("POINT EMPTY", 0.9, 1.9, 1.1, 2.1, 0,
+                            "POINT_EMPTY"),
+            std::make_tuple("LINESTRING(0 0.5,2 0.5)", 0.9, 0, 1.1, 1, 1,
+                            "LINESTRING_CROSSING"),
+            std::make_tuple("LINESTRING(-1 1.5,1.5 -1)", 0, 0, 1, 1, 1,
+                            "LINESTRING_DIAGONAL_CROSSING"),
+            std::make_tuple("LINESTRING(-1 3.5,3.5 -1)", 0, 0, 1, 1, 0,
+                            "LINESTRING_DIAGONAL_OUT"),
+            std::make_tuple("LINESTRING(-1 2,2 2)", 0, 0, 1, 2, 1,
+                            "LINESTRING_TOUCH"),
+            std::make_tuple("LINESTRING Z (-1 1.5 0,1.5 -1 0)", 0, 0, 1, 1, 1,
+                            "LINESTRINGZ_DIAGONAL_CROSSING"),
+            std::make_tuple("LINESTRING EMPTY", 0.9, 1.9, 1.1, 2.1, 0,
+                            "LINESTRING_EMPTY"),
+            std::make_tuple("POLYGON((-5 -5,-5 5,5 5,5 -5,-5 -5))", 0, 0, 1, 1,
+                            1, "POLYGON_CONTAINS_ENVELOPE"),
+            std::make_tuple("POLYGON((-5 -5,-5 5,5 5,5 -5,-5 -5),"
+                            "(-2 -2,-2 2,2 2,2 -2,-2 -2))",
+                            0, 0, 1, 1, 0, "POLYGON_ENVELOPE_IN_HOLE"),
+            std::make_tuple("POLYGON((-5 -5,-5 5,5 5,5 -5,-5 -5),"
+                            "(-2 -2,-2 2,2 2,2 -2,-2 -2))",
+                            1, 1, 3, 3, 1, "POLYGON_ENVELOPE_OVERLAPS_HOLE"),
+            std::make_tuple("POLYGON((0 0,10 0,0 10,0 0))", 6, 6, 7, 7, 0,
+                            "POLYGON_IN_BBOX_BUT_OUT"),
+            std::make_tuple("POLYGON EMPTY", 0.9, 1.9, 1.1, 2.1, 0,
+                            "POLYGON_EMPTY"),
+            std::make_tuple("MULTIPOLYGON(((5 5,6 5,5 6,5 5)),"
+                            "((-5 -5,5 -5,-5 5,-5 -5)))",
+                            0, 0, 1, 1, 1, "MULTIPOLYGON_IN"),
+            std::make_tuple("MULTIPOLYGON(((5 5,6 5,5 6,5 5)),"
+                            "((-5 -5,-4 -5,-5 -4,-5 -5)))",
+                            0, 0, 1, 1, 0, "MULTIPOLYGON_OUT"),
+            std::make_tuple("GEOMETRYCOLLECTION(POINT(10 10),"
+                            "LINESTRING(-1 1.5,1.5 -1))",
+                            0, 0, 1, 1, 1, "GEOMETRYCOLLECTION_IN"),
+            std::make_tuple("CIRCULARSTRING(0 10,1 11,2 10)", -0.1, 9.9, 0.1,
+                            10.1, -1, "CIRCULARSTRING"),
+            std::make_tuple("CURVEPOLYGON((1 2,1 3,10 3,1 2))", 0.9, 1.9, 1.1,
+                            2.1, -1, "CURVEPOLYGON"),
+        };
+    }
+};
+
+TEST_P(OGRWKBIntersectsEnvelopeFixture, test)
+{
+    const char *pszInput = std::get<0>(GetParam());
+    const double dfMinX = std::get<1>(GetParam());
+    const double dfMinY = std::get<2>(GetParam());
+    const double dfMaxX = std::get<3>(GetParam());
+    const double dfMaxY = std::get<4>(GetParam());
+    const int nExpected = std::get<5>(GetParam());
+
+    OGRGeometry *poGeom = nullptr;
+    EXPECT_EQ(OGRGeometryFactory::createFromWkt(pszInput, nullptr, &poGeom),
+              OGRERR_NONE);
+    ASSERT_TRUE(poGeom != nullptr);
+    std::vector<GByte> abyWkb(poGeom->WkbSize());
+    poGeom->exportToWkb(wkbNDR, abyWkb.data(), wkbVariantIso);
+
+    OGREnvelope sEnvelope;
+    sEnvelope.MinX = dfMinX;
+    sEnvelope.MinY = dfMinY;
+    sEnvelope.MaxX = dfMaxX;
+    sEnvelope.MaxY = dfMaxY;
+    bool bIntersects = false;
+    const bool bHandled = OGRWKBIntersectsEnvelope(
+        abyWkb.data(), abyWkb.size(), sEnvelope, bIntersects);
+    if (nExpected < 0)
+    {
+        EXPECT_FALSE(bHandled);
+    }
+    else
+    {
+        EXPECT_TRUE(bHandled);
+        EXPECT_EQ(bIntersects, nExpected == 1);
+
+        if (OGRGeometryFactory::haveGEOS() && !poGeom->IsEmpty())
+        {
+            OGRPolygon oPoly(dfMinX, dfMinY, dfMaxX, dfMaxY);
+            EXPECT_EQ(CPL_TO_BOOL(poGeom->Intersects(&oPoly)), bIntersects);
+        }
+    }
+    delete poGeom;
+
+    if (abyWkb.size() > 9)
+    {
+        EXPECT_FALSE(
+            OGRWKBIntersectsEnvelope(abyWkb.data(), 9, sEnvelope, bIntersects));
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    test_ogr_wkb, OGRWKBIntersectsEnvelopeFixture,
+    ::testing::ValuesIn(OGRWKBIntersectsEnvelopeFixture::GetTupleValues()),
+    [](const ::testing::TestParamInfo<
+        OGRWKBIntersectsEnvelopeFixture::ParamType> &l_info)
+    { return std::get<6>(l_info.param); });
+
 class OGRWKBTransformFixture
     : public test_ogr_wkb,
       public ::testing::WithParamInterface<
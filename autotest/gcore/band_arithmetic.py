@@ -896,3 +896,79 @@ def test_band_arithmetic_pow_band_band_error():
     ds2 = gdal.GetDriverByName("MEM").Create("", 2, 1)
     with pytest.raises(Exception, match="Bands do not have the same dimensions"):
         gdal.pow(ds1.GetRasterBand(1), ds2.GetRasterBand(1))
+
+
+def _unpack_with_nan_as_none(data, dt):
+    fmt = {
+        gdal.GDT_Byte: "B",
+        gdal.GDT_Int16: "h",
+        gdal.GDT_UInt16: "H",
+        gdal.GDT_Float32: "f",
+        gdal.GDT_Float64: "d",
+    }[dt]
+    values = struct.unpack(fmt * (len(data) // struct.calcsize(fmt)), data)
+    return [None if math.isnan(x) else x for x in values]
+
+
+@pytest.mark.parametrize("dt", [gdal.GDT_Byte, gdal.GDT_Int16, gdal.GDT_Float32])
+@pytest.mark.parametrize("with_expression", [False, True])
+def test_band_arithmetic_fused_evaluation(dt, with_expression):
+
+    if with_expression and not gdaltest.gdal_has_vrt_expression_dialect("muparser"):
+        pytest.skip("Expression dialect muparser is not available")
+
+    ds = gdal.GetDriverByName("MEM").Create("", 1500, 3, 3, dt)
+    for i in range(3):
+        ds.GetRasterBand(i + 1).WriteRaster(
+            0,
+            0,
+            1500,
+            3,
+            struct.pack("d" * 4500, *[(j * (i + 3)) % 97 - 20 for j in range(4500)]),
+            buf_type=gdal.GDT_Float64,
+        )
+    a = ds.GetRasterBand(1)
+    b = ds.GetRasterBand(2)
+    c = ds.GetRasterBand(3)
+
+    exprs = [
+        (a - b) / (a + b),
+        gdal.minimum(a, 3, b) * 2 - gdal.maximum(a, c) / 3,
+        gdal.mean(a, b, c).astype(gdal.GDT_Byte) + gdal.abs(c),
+        gdal.sqrt(gdal.abs(a * b)) + gdal.log10(c) + gdal.pow(a, 2),
+    ]
+    if with_expression:
+        exprs += [
+            gdal.where(a > b, a + 1, c - 2),
+            gdal.logical_and(a >= 10, b != c) + (a == c),
+            gdal.pow(a, b / 20) + gdal.log(gdal.abs(c) + 1),
+        ]
+
+    for expr in exprs:
+        with gdal.config_option("GDAL_BAND_ARITHMETIC_FUSION", "NO"):
+            expected = expr.ReadRaster()
+            expected_float64 = expr.ReadRaster(buf_type=gdal.GDT_Float64)
+            expected_window = expr.ReadRaster(1000, 1, 400, 2)
+        assert _unpack_with_nan_as_none(
+            expr.ReadRaster(), expr.DataType
+        ) == _unpack_with_nan_as_none(expected, expr.DataType)
+        assert _unpack_with_nan_as_none(
+            expr.ReadRaster(buf_type=gdal.GDT_Float64), gdal.GDT_Float64
+        ) == _unpack_with_nan_as_none(expected_float64, gdal.GDT_Float64)
+        assert _unpack_with_nan_as_none(
+            expr.ReadRaster(1000, 1, 400, 2), expr.DataType
+        ) == _unpack_with_nan_as_none(expected_window, expr.DataType)
+
+
+def test_band_arithmetic_fused_evaluation_nodata():
+
+    ds = gdal.GetDriverByName("MEM").Create("", 2, 1, 2)
+    ds.GetRasterBand(1).WriteRaster(0, 0, 2, 1, b"\x01\x02")
+    ds.GetRasterBand(2).WriteRaster(0, 0, 2, 1, b"\x03\x05")
+    ds.GetRasterBand(1).SetNoDataValue(5)
+    ds.GetRasterBand(2).SetNoDataValue(5)
+
+    # Not handled by the fused evaluator: falls back to the VRT implementation
+    res = ds.GetRasterBand(1) + ds.GetRasterBand(2)
+    assert res.GetNoDataValue() == 5
+    assert struct.unpack("H" * 2, res.ReadRaster()) == (4, 5)
@@ -1150,3 +1150,75 @@ def test_stats_float64_nan_with_nodata(tmp_vsimem, GDAL_STATS_USE_FLOAT64_OPTIM)
         assert got_stats == expected_stats
     else:
         assert got_stats == pytest.approx(expected_stats, rel=1e-15)
+
+
+###############################################################################
+# Test that block-parallel computation of statistics, min/max and histogram
+# gives the same results as the single-threaded one
+
+
+@pytest.mark.parametrize(
+    "datatype,fmt",
+    [
+        (gdal.GDT_Byte, "B"),
+        (gdal.GDT_Int16, "h"),
+        (gdal.GDT_UInt16, "H"),
+        (gdal.GDT_Int32, "i"),
+        (gdal.GDT_Float32, "f"),
+        (gdal.GDT_Float64, "d"),
+    ],
+)
+@pytest.mark.parametrize("nodata", [None, 3])
+@pytest.mark.parametrize("with_mask", [False, True])
+def test_stats_multithreaded(tmp_vsimem, datatype, fmt, nodata, with_mask):
+
+    if nodata is not None and with_mask:
+        pytest.skip("mask band not used when there is a nodata value")
+
+    width = 123
+    height = 77
+    ds = gdal.GetDriverByName("GTiff").Create(
+        tmp_vsimem / "tmp.tif",
+        width,
+        height,
+        1,
+        datatype,
+        options={"TILED": "YES", "BLOCKXSIZE": 16, "BLOCKYSIZE": 16},
+    )
+    offset = 0 if fmt in ("B", "H") else 50
+    values = [((i * 37) % 101) - offset for i in range(width * height)]
+    if fmt in ("f", "d"):
+        values = [v + 0.25 for v in values]
+        values[10] = float("nan")
+    ds.WriteRaster(
+        0, 0, width, height, struct.pack(fmt * (width * height), *values)
+    )
+    if nodata is not None:
+        ds.GetRasterBand(1).SetNoDataValue(nodata)
+    if with_mask:
+        ds.CreateMaskBand(gdal.GMF_PER_DATASET)
+        ds.GetRasterBand(1).GetMaskBand().Fill(255)
+        ds.GetRasterBand(1).GetMaskBand().WriteRaster(
+            10, 10, 20, 30, b"\x00" * (20 * 30)
+        )
+    ds = None
+
+    def compute(num_threads):
+        with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+            ds = gdal.Open(tmp_vsimem / "tmp.tif")
+            band = ds.GetRasterBand(1)
+            stats = band.ComputeStatistics(False)
+            minmax = band.ComputeRasterMinMax(False)
+            hist = band.GetHistogram(-60.5, 100.5, 161, False, False)
+            return stats, minmax, hist
+
+    stats, minmax, hist = compute("1")
+    mt_stats, mt_minmax, mt_hist = compute("4")
+    assert mt_stats[0] == stats[0]
+    assert mt_stats[1] == stats[1]
+    assert mt_stats[2] == pytest.approx(stats[2], rel=1e-12)
+    assert mt_stats[3] == pytest.approx(stats[3], rel=1e-12)
+    assert mt_minmax == minmax
+    assert mt_minmax == (stats[0], stats[1])
+    assert mt_hist == hist
+    gdal.Unlink(tmp_vsimem / "tmp.tif.aux.xml")
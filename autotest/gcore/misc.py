@@ -1167,6 +1167,81 @@ with gdal.{context}():
         assert "Failure" in err
 
 
+###############################################################################
+# Test the radix table band block cache, with and without spilling of
+# evicted blocks
+
+
+@pytest.mark.parametrize("spill_size", [None, "64KB", "2MB"])
+def test_misc_band_block_cache_radix(tmp_vsimem, spill_size):
+
+    filename = tmp_vsimem / "test.tif"
+    data = bytes(i % 251 for i in range(1024 * 1024))
+
+    def expected_block(x, y):
+        return b"".join(
+            data[(y * 16 + j) * 1024 + x * 16 :][:16] for j in range(16)
+        )
+
+    with gdal.config_options(
+        {
+            "GDAL_BAND_BLOCK_CACHE": "RADIX",
+            "GDAL_BAND_BLOCK_CACHE_SPILL_SIZE": spill_size,
+        }
+    ), gdaltest.SetCacheMax(100000):
+        with gdal.GetDriverByName("GTiff").Create(
+            filename,
+            1024,
+            1024,
+            options=["TILED=YES", "BLOCKXSIZE=16", "BLOCKYSIZE=16"],
+        ) as ds:
+            ds.GetRasterBand(1).WriteRaster(0, 0, 1024, 1024, data)
+
+        with gdal.Open(filename) as ds:
+            band = ds.GetRasterBand(1)
+            for _ in range(2):
+                for y in reversed(range(64)):
+                    for x in range(64):
+                        assert band.ReadBlock(x, y) == expected_block(x, y)
+            band.FlushCache()
+            assert band.ReadRaster() == data
+
+
+###############################################################################
+# Test that the radix table band block cache releases the pages of evicted
+# blocks when scanning a raster made of single-row strips
+
+
+def test_misc_band_block_cache_radix_release_pages(tmp_vsimem):
+
+    filename = tmp_vsimem / "test.tif"
+    with gdal.GetDriverByName("GTiff").Create(
+        filename, 256, 32768, options=["BLOCKYSIZE=1"]
+    ) as ds:
+        ds.GetRasterBand(1).Fill(1)
+
+    messages = []
+
+    def handle(ecls, ecode, emsg):
+        messages.append(emsg)
+
+    with gdal.config_options(
+        {"GDAL_BAND_BLOCK_CACHE": "RADIX", "CPL_DEBUG": "ON"}
+    ), gdaltest.SetCacheMax(100000), gdaltest.error_handler(handle):
+        with gdal.Open(filename) as ds:
+            band = ds.GetRasterBand(1)
+            for y in range(32768):
+                assert band.ReadBlock(0, y) == b"\x01" * 256
+
+    max_leaves = [
+        int(msg.split("at most ")[1].split(" ")[0])
+        for msg in messages
+        if "leaves of the radix" in msg
+    ]
+    # 512 leaves would be needed if they were never released
+    assert max_leaves and max_leaves[0] <= 16
+
+
 ###############################################################################
 
 
@@ -3898,3 +3898,44 @@ def test_rasterio_gdt_unknown():
         # Caught at the SWIG level
         with pytest.raises(Exception, match="Illegal value for data type"):
             ds.GetRasterBand(1).ReadRaster(buf_type=gdal.GDT_Unknown)
+
+
+###############################################################################
+# Test that resampled RasterIO() with GDAL_NUM_THREADS gives the same result
+# as single-threaded processing
+
+
+@pytest.mark.parametrize(
+    "resample_alg",
+    [
+        gdal.GRIORA_Average,
+        gdal.GRIORA_Bilinear,
+        gdal.GRIORA_Cubic,
+        gdal.GRIORA_Lanczos,
+    ],
+)
+@pytest.mark.parametrize("nodata", [None, 0])
+def test_rasterio_resampled_multithreaded(resample_alg, nodata):
+
+    width = 2001
+    height = 1999
+    ds = gdal.GetDriverByName("MEM").Create("", width, height, 2)
+    data = (bytes(range(253)) * (width * height // 253 + 1))[0 : width * height]
+    for i in range(2):
+        ds.GetRasterBand(i + 1).WriteRaster(0, 0, width, height, data)
+        if nodata is not None:
+            ds.GetRasterBand(i + 1).SetNoDataValue(nodata)
+
+    def read(obj, **kwargs):
+        return obj.ReadRaster(
+            1, 2, width - 3, height - 5, 333, 222, resample_alg=resample_alg, **kwargs
+        )
+
+    ref_band = read(ds.GetRasterBand(1))
+    ref_band_float = read(ds.GetRasterBand(1), buf_type=gdal.GDT_Float32)
+    ref_ds = read(ds)
+
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        assert read(ds.GetRasterBand(1)) == ref_band
+        assert read(ds.GetRasterBand(1), buf_type=gdal.GDT_Float32) == ref_band_float
+        assert read(ds) == ref_ds
@@ -338,6 +338,170 @@ def test_thread_safe_overview_mem_ds():
     launch_threads(get_band, expected_cs)
 
 
+def test_thread_safe_shared_read_gtiff(tmp_path):
+
+    tmpfilename = str(tmp_path / "rgba.tif")
+    shutil.copy("data/stefan_full_rgba.tif", tmpfilename)
+    with gdal.Open(tmpfilename, gdal.GA_Update) as ds:
+        ds.BuildOverviews("NEAR", [2])
+        expected_cs = [ds.GetRasterBand(i + 1).Checksum() for i in range(4)]
+        expected_ovr_cs = ds.GetRasterBand(1).GetOverview(0).Checksum()
+        expected_mask_cs = ds.GetRasterBand(1).GetMaskBand().Checksum()
+        expected_data = ds.ReadRaster(buf_xsize=40, buf_ysize=30)
+
+    with gdal.config_option("GDAL_THREAD_SAFE_SHARED_READ", "YES"):
+        ds = gdal.OpenEx(tmpfilename, gdal.OF_RASTER | gdal.OF_THREAD_SAFE)
+    with ds:
+        assert ds.IsThreadSafe(gdal.OF_RASTER)
+
+        def get_band():
+            return ds.GetRasterBand(1)
+
+        launch_threads(get_band, expected_cs[0])
+
+        def get_band():
+            return ds.GetRasterBand(1).GetOverview(0)
+
+        launch_threads(get_band, expected_ovr_cs)
+
+        def get_band():
+            return ds.GetRasterBand(1).GetMaskBand()
+
+        launch_threads(get_band, expected_mask_cs)
+
+        # Concurrent reads of the bands of a pixel-interleaved dataset
+        res = [True]
+
+        def check(i):
+            for _ in range(100):
+                if ds.GetRasterBand(i + 1).Checksum() != expected_cs[i]:
+                    res[0] = False
+                if ds.ReadRaster(buf_xsize=40, buf_ysize=30) != expected_data:
+                    res[0] = False
+
+        threads = [threading.Thread(target=check, args=(i,)) for i in range(4)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+        assert res[0]
+
+
+def test_thread_safe_shared_read_block_eviction(tmp_path):
+
+    # Many small blocks and a tiny block cache, so that blocks looked up
+    # without locking are frequently evicted and recycled by other threads.
+    tmpfilename = str(tmp_path / "tiled.tif")
+    size = 256
+    data = bytes((x * 7 + y * 13) % 251 for y in range(size) for x in range(size))
+    with gdal.GetDriverByName("GTiff").Create(
+        tmpfilename,
+        size,
+        size,
+        options=["TILED=YES", "BLOCKXSIZE=16", "BLOCKYSIZE=16"],
+    ) as ds:
+        ds.WriteRaster(0, 0, size, size, data)
+
+    with gdal.config_option("GDAL_THREAD_SAFE_SHARED_READ", "YES"):
+        ds = gdal.OpenEx(tmpfilename, gdal.OF_RASTER | gdal.OF_THREAD_SAFE)
+
+    res = [True]
+
+    def check(i):
+        win = 40
+        for k in range(200):
+            xoff = (i * 53 + k * 31) % (size - win)
+            yoff = (i * 29 + k * 17) % (size - win)
+            got = ds.GetRasterBand(1).ReadRaster(xoff, yoff, win, win)
+            expected = b"".join(
+                data[(yoff + y) * size + xoff : (yoff + y) * size + xoff + win]
+                for y in range(win)
+            )
+            if got != expected:
+                res[0] = False
+
+    with gdaltest.SetCacheMax(16 * 16 * 20), ds:
+        threads = [threading.Thread(target=check, args=(i,)) for i in range(8)]
+        for t in threads:
+            t.start()
+        for t in threads:
+            t.join()
+    assert res[0]
+
+
+def test_thread_safe_shared_read_vrt_in_memory():
+
+    vrt_ds = gdal.BuildVRT("", ["data/byte.tif"])
+
+    # An in-memory VRT cannot be re-opened in each thread...
+    with pytest.raises(Exception, match="cannot be cloned"):
+        vrt_ds.GetThreadSafeDataset(gdal.OF_RASTER)
+
+    # ... but it can be shared
+    with gdal.config_option("GDAL_THREAD_SAFE_SHARED_READ", "YES"):
+        ds = vrt_ds.GetThreadSafeDataset(gdal.OF_RASTER)
+    del vrt_ds
+
+    def get_band():
+        return ds.GetRasterBand(1)
+
+    launch_threads(get_band, 4672)
+
+
+def test_thread_safe_shared_read_mem_ds():
+
+    with gdal.Open("data/byte.tif") as src_ds:
+        ds = gdal.GetDriverByName("MEM").CreateCopy("", src_ds)
+        ds.BuildOverviews("NEAR", [2])
+        expected_ovr_cs = ds.GetRasterBand(1).GetOverview(0).Checksum()
+        expected_data = ds.ReadRaster(buf_xsize=7, buf_ysize=7)
+
+    with gdal.config_option("GDAL_THREAD_SAFE_SHARED_READ", "YES"):
+        ds = ds.GetThreadSafeDataset(gdal.OF_RASTER)
+
+    def get_band():
+        return ds.GetRasterBand(1)
+
+    launch_threads(get_band, 4672)
+
+    def get_band():
+        return ds.GetRasterBand(1).GetOverview(0)
+
+    launch_threads(get_band, expected_ovr_cs)
+
+    res = [True]
+
+    def check():
+        for _ in range(100):
+            if ds.ReadRaster(buf_xsize=7, buf_ysize=7) != expected_data:
+                res[0] = False
+
+    threads = [threading.Thread(target=check) for i in range(4)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    assert res[0]
+
+
+def test_thread_safe_shared_read_not_supported(tmp_vsimem):
+
+    tmpfilename = str(tmp_vsimem / "byte.tif")
+    gdal.Translate(tmpfilename, "data/byte.tif")
+
+    # Datasets opened in update mode are not shared: fall back to per-thread
+    # datasets
+    src_ds = gdal.Open(tmpfilename, gdal.GA_Update)
+    with gdal.config_option("GDAL_THREAD_SAFE_SHARED_READ", "YES"):
+        ds = src_ds.GetThreadSafeDataset(gdal.OF_RASTER)
+    del src_ds
+
+    def get_band():
+        return ds.GetRasterBand(1)
+
+    launch_threads(get_band, 4672)
+
+
 def test_thread_safe_open_options(tmp_path):
 
     tmpfilename = str(tmp_path / "byte.tif")
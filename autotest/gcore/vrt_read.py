@@ -2816,6 +2816,90 @@ def test_vrt_read_multi_threaded_disabled_since_overlapping_sources():
     )
 
 
+###############################################################################
+# Test tiled multi-threaded reading of overlapping ComplexSource
+
+
+@pytest.mark.parametrize("tiled", ["YES", "NO"])
+def test_vrt_read_multi_threaded_overlapping_complex_sources(tmp_vsimem, tiled):
+
+    src_ds = gdal.Translate(
+        "",
+        "../gdrivers/data/small_world.tif",
+        width=1500,
+        height=1500,
+        bandList=[1],
+        format="MEM",
+    )
+    tile_offsets = [(0, 0), (700, 0), (0, 700), (700, 700), (350, 350)]
+    source_options = [
+        "<NODATA>0</NODATA>",
+        "<ScaleOffset>10</ScaleOffset><ScaleRatio>0.5</ScaleRatio>",
+        "<NODATA>255</NODATA><LUT>0:0,128:50,255:100</LUT>",
+        "",
+        "<NODATA>60</NODATA><ScaleRatio>2</ScaleRatio>",
+    ]
+    sources = ""
+    for i, (xoff, yoff) in enumerate(tile_offsets):
+        filename = str(tmp_vsimem / ("%d.tif" % i))
+        gdal.Translate(filename, src_ds, srcWin=[xoff, yoff, 800, 800])
+        sources += f"""<ComplexSource>
+          <SourceFilename>{filename}</SourceFilename>
+          <SourceBand>1</SourceBand>
+          <SrcRect xOff="0" yOff="0" xSize="800" ySize="800"/>
+          <DstRect xOff="{xoff}" yOff="{yoff}" xSize="800" ySize="800"/>
+          {source_options[i]}
+        </ComplexSource>"""
+    # Same dataset referenced twice
+    sources += f"""<ComplexSource>
+          <SourceFilename>{tmp_vsimem / "0.tif"}</SourceFilename>
+          <SourceBand>1</SourceBand>
+          <SrcRect xOff="0" yOff="0" xSize="400" ySize="400"/>
+          <DstRect xOff="1100" yOff="100" xSize="400" ySize="400"/>
+          <NODATA>0</NODATA>
+        </ComplexSource>"""
+    vrt_ds = gdal.Open(f"""<VRTDataset rasterXSize="1500" rasterYSize="1500">
+      <VRTRasterBand dataType="Float32" band="1">
+        <NoDataValue>-1</NoDataValue>
+        {sources}
+      </VRTRasterBand>
+    </VRTDataset>""")
+
+    with gdal.config_option("VRT_NUM_THREADS", "1"):
+        ref_data = vrt_ds.GetRasterBand(1).ReadRaster(1, 2, 1490, 1480)
+    assert (
+        vrt_ds.GetMetadataItem("MULTI_THREADED_RASTERIO_LAST_USED", "__DEBUG__") == "0"
+    )
+
+    pcts = []
+
+    def cbk(pct, msg, user_data):
+        if pcts:
+            assert pct >= pcts[-1]
+        pcts.append(pct)
+        return 1
+
+    with gdal.config_options(
+        {"VRT_NUM_THREADS": "4", "GDAL_VRT_TILED_MULTITHREADING": tiled}
+    ):
+        assert (
+            vrt_ds.GetRasterBand(1).ReadRaster(1, 2, 1490, 1480, callback=cbk)
+            == ref_data
+        )
+    assert pcts[-1] == 1.0
+
+    assert vrt_ds.GetMetadataItem("MULTI_THREADED_RASTERIO_LAST_USED", "__DEBUG__") == (
+        "1" if gdal.GetNumCPUs() >= 2 and tiled == "YES" else "0"
+    )
+
+    # Resampled requests do not use the tiled mode
+    with gdal.config_option("VRT_NUM_THREADS", "4"):
+        vrt_ds.GetRasterBand(1).ReadRaster(buf_xsize=1000, buf_ysize=1000)
+    assert (
+        vrt_ds.GetMetadataItem("MULTI_THREADED_RASTERIO_LAST_USED", "__DEBUG__") == "0"
+    )
+
+
 ###############################################################################
 # Test propagation of errors from threads to main thread in multi-threaded reading
 
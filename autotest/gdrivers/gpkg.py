@@ -4414,3 +4414,56 @@ def test_gpkg_copy_using_get_data_coverage_status(tmp_vsimem):
         == (gdal.GDAL_DATA_COVERAGE_STATUS_DATA | gdal.GDAL_DATA_COVERAGE_STATUS_EMPTY)
         and pct == 25.0
     )
+
+
+###############################################################################
+# Test multi-threaded decoding of the tiles intersecting a RasterIO() request
+
+
+@pytest.mark.parametrize("data_type", [gdal.GDT_Byte, gdal.GDT_Int16])
+def test_gpkg_num_threads(tmp_vsimem, data_type):
+
+    filename = str(tmp_vsimem / "test_gpkg_num_threads.gpkg")
+    if data_type == gdal.GDT_Byte:
+        gdal.Translate(
+            filename,
+            "data/small_world.tif",
+            format="GPKG",
+            creationOptions=["BLOCKSIZE=64", "TILE_FORMAT=PNG"],
+        )
+    else:
+        gdal.Translate(
+            filename,
+            "data/small_world.tif",
+            format="GPKG",
+            bandList=[1],
+            outputType=gdal.GDT_Int16,
+            scaleParams=[[0, 255, -1000, 1000]],
+            creationOptions=["BLOCKSIZE=64"],
+        )
+
+    # Remove a tile to check that missing tiles are handled
+    with gdal.OpenEx(filename, gdal.OF_UPDATE) as ds:
+        ds.ExecuteSQL(
+            "DELETE FROM test_gpkg_num_threads WHERE tile_row = 1 AND tile_column = 2"
+        )
+
+    with gdal.OpenEx(filename, open_options=["NUM_THREADS=1"]) as ds:
+        expected_data = ds.ReadRaster()
+        expected_window = ds.GetRasterBand(1).ReadRaster(30, 20, 250, 150)
+        expected_cs = [
+            ds.GetRasterBand(i + 1).Checksum() for i in range(ds.RasterCount)
+        ]
+
+    with gdal.OpenEx(filename, open_options=["NUM_THREADS=4"]) as ds:
+        assert ds.ReadRaster() == expected_data
+    with gdal.OpenEx(filename, open_options=["NUM_THREADS=ALL_CPUS"]) as ds:
+        assert ds.GetRasterBand(1).ReadRaster(30, 20, 250, 150) == expected_window
+        # Second read served from the block cache
+        assert ds.GetRasterBand(1).ReadRaster(30, 20, 250, 150) == expected_window
+        assert [
+            ds.GetRasterBand(i + 1).Checksum() for i in range(ds.RasterCount)
+        ] == expected_cs
+    with gdaltest.config_option("GDAL_NUM_THREADS", "4"):
+        with gdal.Open(filename) as ds:
+            assert ds.ReadRaster() == expected_data
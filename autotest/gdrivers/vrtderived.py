@@ -14,6 +14,7 @@
 
 import math
 import os
+import struct
 import sys
 import threading
 
@@ -1382,6 +1383,64 @@ def test_vrt_pixelfn_expression_coordinates_no_geotransform():
         gdal.Open(xml).ReadRaster()
 
 
+@pytest.mark.parametrize(
+    "expression",
+    [
+        "(A-B)/(A+B)",
+        "A > B ? 1.5*C : A",
+        "A / sum(BANDS)",
+        "min(A, B, C) + max(A, 2) - avg(A, B)",
+        "sqrt(abs(A - B)) * sign(C) + fmod(A, 3) + ln(A + 1) - exp(-B / 10)",
+        "(A <= B && B != C) || C == 4",
+        "isnan(C) ? -A : A^2 + B^-1",
+        "isnodata(B) ? 100 : B",
+        "-A^2",  # not handled by the batch engine
+    ],
+)
+@pytest.mark.parametrize("propagate_nodata", [False, True])
+def test_vrt_pixelfn_expression_batch(tmp_vsimem, expression, propagate_nodata):
+
+    if not gdaltest.gdal_has_vrt_expression_dialect("muparser"):
+        pytest.skip("muparser not available")
+
+    src_filename = tmp_vsimem / "src.tif"
+    with gdal.GetDriverByName("GTiff").Create(
+        src_filename, 300, 2, 3, gdal.GDT_Float64
+    ) as ds:
+        values = [
+            [i % 7 for i in range(600)],
+            [(3 * i) % 11 for i in range(600)],
+            [float("nan") if i % 13 == 0 else (i % 5) - 1 for i in range(600)],
+        ]
+        for i in range(3):
+            ds.GetRasterBand(i + 1).WriteRaster(
+                0, 0, 300, 2, struct.pack("d" * 600, *values[i])
+            )
+
+    expression = expression.replace("&", "&amp;").replace("<", "&lt;")
+    sources = ""
+    for i, name in enumerate(("A", "B", "C")):
+        sources += f"""<SimpleSource name="{name}">
+              <SourceFilename>{src_filename}</SourceFilename>
+              <SourceBand>{i + 1}</SourceBand>
+            </SimpleSource>"""
+    xml = f"""
+    <VRTDataset rasterXSize="300" rasterYSize="2">
+      <VRTRasterBand dataType="Float64" band="1" subClass="VRTDerivedRasterBand">
+        <NoDataValue>3</NoDataValue>
+        <PixelFunctionType>expression</PixelFunctionType>
+        <PixelFunctionArguments expression="{expression}"
+            propagateNoData="{str(propagate_nodata).lower()}"/>
+        {sources}
+      </VRTRasterBand>
+    </VRTDataset>"""
+
+    with gdal.config_option("GDAL_VRT_EXPRESSION_BATCH", "NO"):
+        expected = struct.unpack("d" * 600, gdal.Open(xml).ReadRaster())
+    got = struct.unpack("d" * 600, gdal.Open(xml).ReadRaster())
+    assert got == pytest.approx(expected, rel=1e-14, nan_ok=True)
+
+
 ###############################################################################
 # Test multiplication / summation by a constant factor
 
@@ -3630,6 +3630,74 @@ def test_ogr_csv_creation_illegal_layer_name(tmp_vsimem):
         ds.CreateLayer("illegal/with/slash")
 
 
+###############################################################################
+# Test NUM_THREADS open option
+
+
+@pytest.mark.parametrize("num_threads", ["2", "ALL_CPUS"])
+def test_ogr_csv_read_num_threads(tmp_vsimem, num_threads):
+
+    filename = tmp_vsimem / "test.csv"
+    content = "id,val,str,WKT\n"
+    for i in range(5003):
+        s = '"multi\nline"' if (i % 1000) == 0 else f"str{i}"
+        content += f'{i},{i * 0.5},{s},"POINT ({i} {-i})"\n'
+    gdal.FileFromMemBuffer(filename, content)
+
+    def get_features(ds):
+        lyr = ds.GetLayer(0)
+        return [
+            (
+                f.GetFID(),
+                f["id"],
+                f["val"],
+                f["str"],
+                f.GetGeometryRef().ExportToWkt(),
+            )
+            for f in lyr
+        ]
+
+    with gdal.OpenEx(filename, open_options=["AUTODETECT_TYPE=YES"]) as ds:
+        expected = get_features(ds)
+    assert len(expected) == 5003
+
+    with gdal.OpenEx(
+        filename,
+        open_options=["AUTODETECT_TYPE=YES", "NUM_THREADS=" + num_threads],
+    ) as ds:
+        assert get_features(ds) == expected
+
+        lyr = ds.GetLayer(0)
+        lyr.ResetReading()
+        f = lyr.GetNextFeature()
+        assert f.GetFID() == 1
+        f = lyr.GetFeature(4000)
+        assert f["id"] == 3999
+        f = lyr.GetNextFeature()
+        assert f["id"] == 4000
+
+        # Sequential GetFeature() calls are served from read-ahead features
+        assert [
+            (
+                f.GetFID(),
+                f["id"],
+                f["val"],
+                f["str"],
+                f.GetGeometryRef().ExportToWkt(),
+            )
+            for f in (lyr.GetFeature(fid) for fid in range(1, 5004))
+        ] == expected
+        assert lyr.GetFeature(5004) is None
+        assert lyr.GetFeature(3)["id"] == 2
+        assert lyr.GetFeature(2)["id"] == 1
+
+        lyr.SetAttributeFilter("id = 2500")
+        lyr.ResetReading()
+        f = lyr.GetNextFeature()
+        assert f["id"] == 2500
+        assert lyr.GetNextFeature() is None
+
+
 ###############################################################################
 
 
@@ -1650,3 +1650,45 @@ def test_ogr_flatgeobuf_write_empty_file_no_spatial_index(tmp_vsimem):
         assert lyr.GetFeatureCount() == 0
         assert lyr.GetExtent(can_return_null=True) is None
         assert lyr.GetSpatialRef().GetAuthorityCode(None) == "32631"
+
+
+###############################################################################
+# Test that the multithreaded Hilbert sort of the spatial index gives the
+# same file as the single threaded one
+
+
+@pytest.mark.slow()
+def test_ogr_flatgeobuf_write_spatial_index_multithreaded(tmp_vsimem):
+
+    def create(filename, num_threads):
+        with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+            ds = ogr.GetDriverByName("FlatGeobuf").CreateDataSource(filename)
+            lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+            for i in range(250000):
+                f = ogr.Feature(lyr.GetLayerDefn())
+                # Some duplicated points, to test ties in Hilbert values
+                f.SetGeometryDirectly(
+                    ogr.CreateGeometryFromWkt(
+                        "POINT(%d %d)" % ((i * 7919) % 1000, (i // 3) % 997)
+                    )
+                )
+                lyr.CreateFeature(f)
+            ds.Close()
+        f = gdal.VSIFOpenL(filename, "rb")
+        data = gdal.VSIFReadL(1, gdal.VSIStatL(filename).size, f)
+        gdal.VSIFCloseL(f)
+        return data
+
+    ref = create(str(tmp_vsimem / "ref.fgb"), "1")
+    got = create(str(tmp_vsimem / "got.fgb"), "4")
+    assert got == ref
+
+    ds = ogr.Open(str(tmp_vsimem / "got.fgb"))
+    lyr = ds.GetLayer(0)
+    assert lyr.GetFeatureCount() == 250000
+    lyr.SetSpatialFilterRect(10, 10, 20, 20)
+    assert lyr.GetFeatureCount() == sum(
+        1
+        for i in range(250000)
+        if 10 <= (i * 7919) % 1000 <= 20 and 10 <= (i // 3) % 997 <= 20
+    )
@@ -3808,6 +3808,51 @@ def test_ogr_geojson_random_reading_without_id(tmp_vsimem):
     ds = None
 
 
+###############################################################################
+# Test random and multithreaded reading through the feature offset index
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_ogr_geojson_feature_index(tmp_vsimem, num_threads):
+
+    features = ",\n".join(
+        '{ "type": "Feature", "properties": { "a": %d, "b": "x\\"}%d" }, '
+        '"geometry": { "type": "Point", "coordinates": [%d, 49] } }' % (i, i, i)
+        for i in range(2500)
+    )
+    json_content = '{"type":"FeatureCollection","features":[\n%s\n]}' % features
+    tmpfilename = tmp_vsimem / "temp.json"
+    # Prefix with a UTF-8 BOM to check that offsets take it into account
+    gdal.FileFromMemBuffer(tmpfilename, b"\xef\xbb\xbf" + json_content.encode())
+
+    ds = gdal.OpenEx(tmpfilename, open_options=["NUM_THREADS=" + num_threads])
+    lyr = ds.GetLayer(0)
+    assert lyr.TestCapability(ogr.OLCFastSetNextByIndex)
+    for i in range(2):
+        count = 0
+        for f in lyr:
+            assert f.GetFID() == count
+            assert f["a"] == count
+            assert f["b"] == 'x"}%d' % count
+            assert f.GetGeometryRef().GetX() == count
+            count += 1
+        assert count == 2500
+        lyr.ResetReading()
+
+    assert lyr.SetNextByIndex(1234) == ogr.OGRERR_NONE
+    assert lyr.GetNextFeature()["a"] == 1234
+    assert lyr.GetNextFeature()["a"] == 1235
+    assert lyr.GetFeature(2499)["a"] == 2499
+    assert lyr.GetNextFeature()["a"] == 1236
+    assert lyr.GetFeature(2500) is None
+    assert lyr.SetNextByIndex(2500) != ogr.OGRERR_NONE
+    assert lyr.GetNextFeature() is None
+
+    lyr.SetAttributeFilter("a >= 2498")
+    assert not lyr.TestCapability(ogr.OLCFastSetNextByIndex)
+    assert [f["a"] for f in lyr] == [2498, 2499]
+
+
 ###############################################################################
 
 
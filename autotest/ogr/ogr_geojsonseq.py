@@ -202,6 +202,58 @@ def test_ogr_geojsonseq_seq_geometries():
             pytest.fail()
 
 
+###############################################################################
+# Test random and multithreaded reading through the feature offset index
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+@pytest.mark.parametrize("rs", [False, True])
+def test_ogr_geojsonseq_feature_index(tmp_vsimem, num_threads, rs):
+
+    sep = "\x1e" if rs else ""
+    content = "".join(
+        '%s{ "type": "Feature", "properties": { "a": %d }, '
+        '"geometry": { "type": "Point", "coordinates": [%d, 49] } }\r\n'
+        % (sep, i, i)
+        for i in range(2500)
+    )
+    tmpfilename = tmp_vsimem / "temp.geojsonl"
+    gdal.FileFromMemBuffer(tmpfilename, content)
+
+    with gdaltest.config_option("OGR_GEOJSONSEQ_CHUNK_SIZE", "1000"):
+        ds = gdal.OpenEx(tmpfilename, open_options=["NUM_THREADS=" + num_threads])
+        lyr = ds.GetLayer(0)
+        assert lyr.TestCapability(ogr.OLCRandomRead)
+        assert lyr.TestCapability(ogr.OLCFastSetNextByIndex)
+        count = 0
+        for f in lyr:
+            assert f.GetFID() == count
+            assert f["a"] == count
+            assert f.GetGeometryRef().GetX() == count
+            count += 1
+        assert count == 2500
+
+        assert lyr.SetNextByIndex(1234) == ogr.OGRERR_NONE
+        assert lyr.GetNextFeature()["a"] == 1234
+        assert lyr.GetFeature(2499)["a"] == 2499
+        assert lyr.GetNextFeature()["a"] == 1235
+        assert lyr.GetFeature(2500) is None
+
+
+def test_ogr_geojsonseq_feature_index_not_usable(tmp_vsimem):
+
+    tmpfilename = tmp_vsimem / "temp.geojsonl"
+    gdal.FileFromMemBuffer(
+        tmpfilename,
+        '{ "type": "Feature", "properties": {}, "geometry": null }\n'
+        '{ "type": "Point", "coordinates": [2, 49] }\n',
+    )
+    ds = ogr.Open(tmpfilename)
+    lyr = ds.GetLayer(0)
+    assert not lyr.TestCapability(ogr.OLCFastSetNextByIndex)
+    assert lyr.GetFeature(1).GetGeometryRef().ExportToWkt() == "POINT (2 49)"
+
+
 @gdaltest.disable_exceptions()
 def test_ogr_geojsonseq_seq_geometries_with_errors():
 
@@ -11247,3 +11247,158 @@ def test_ogr_gpkg_append_to_layer_feature_count_int64_max(tmp_vsimem):
             assert not f.IsFieldSetAndNotNull("feature_count")
         lyr = ds.GetLayer(0)
         assert lyr.GetFeatureCount() == 2
+
+
+###############################################################################
+# Test OGR_GPKG_BULK_INSERT_BATCH_SIZE
+
+
+@gdaltest.enable_exceptions()
+@pytest.mark.parametrize("in_transaction", [False, True])
+def test_ogr_gpkg_bulk_insert(tmp_vsimem, in_transaction):
+
+    filename = tmp_vsimem / "test_ogr_gpkg_bulk_insert.gpkg"
+    with gdaltest.config_option("OGR_GPKG_BULK_INSERT_BATCH_SIZE", "10"):
+        with gdal.GetDriverByName("GPKG").CreateVector(filename) as ds:
+            lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+            lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+            lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+            lyr.CreateField(ogr.FieldDefn("dt", ogr.OFTDateTime))
+            fld_defn = ogr.FieldDefn("with_default", ogr.OFTString)
+            fld_defn.SetDefault("'default'")
+            lyr.CreateField(fld_defn)
+            if in_transaction:
+                lyr.StartTransaction()
+            for i in range(25):
+                f = ogr.Feature(lyr.GetLayerDefn())
+                f["int"] = i
+                f["str"] = "foo%d" % i
+                f["dt"] = "2025/01/02 03:04:%02d" % i
+                if i != 12:
+                    f["with_default"] = "bar"
+                if i == 20:
+                    f.SetFID(100)
+                f.SetGeometry(ogr.CreateGeometryFromWkt("POINT(%d %d)" % (i, i)))
+                lyr.CreateFeature(f)
+                assert f.GetFID() == (100 if i == 20 else i + 1 if i < 20 else i + 80)
+            if in_transaction:
+                lyr.CommitTransaction()
+
+            assert lyr.GetFeatureCount() == 25
+            f = lyr.GetFeature(100)
+            assert f["int"] == 20
+
+            lyr.SetSpatialFilterRect(11.5, 11.5, 12.5, 12.5)
+            f = lyr.GetNextFeature()
+            assert f.GetFID() == 13
+            assert f["str"] == "foo12"
+            assert f["with_default"] == "default"
+            lyr.SetSpatialFilter(None)
+
+            # Check rollback of pending features
+            lyr.StartTransaction()
+            f = ogr.Feature(lyr.GetLayerDefn())
+            f["int"] = 1000
+            lyr.CreateFeature(f)
+            lyr.RollbackTransaction()
+
+    with ogr.Open(filename) as ds:
+        lyr = ds.GetLayer(0)
+        assert lyr.GetFeatureCount() == 25
+        with ds.ExecuteSQL("SELECT COUNT(*) FROM rtree_test_geom") as sql_lyr:
+            assert sql_lyr.GetNextFeature().GetField(0) == 25
+        for f in lyr:
+            i = f["int"]
+            assert f["str"] == "foo%d" % i
+            assert f["dt"] == "2025/01/02 03:04:%02d" % i
+            assert f.GetGeometryRef().GetX() == i
+            assert f["with_default"] == ("default" if i == 12 else "bar")
+
+
+###############################################################################
+# Test OGR_GPKG_BULK_INSERT_BATCH_SIZE with a FID conflict
+
+
+@gdaltest.enable_exceptions()
+def test_ogr_gpkg_bulk_insert_fid_conflict(tmp_vsimem):
+
+    filename = tmp_vsimem / "test_ogr_gpkg_bulk_insert_fid_conflict.gpkg"
+    with gdaltest.config_option("OGR_GPKG_BULK_INSERT_BATCH_SIZE", "10"):
+        with gdal.GetDriverByName("GPKG").CreateVector(filename) as ds:
+            lyr = ds.CreateLayer("test")
+            lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+            for i in range(2):
+                f = ogr.Feature(lyr.GetLayerDefn())
+                f["int"] = i
+                lyr.CreateFeature(f)
+            # The conflict is reported immediately, and the queued features
+            # are kept
+            f = ogr.Feature(lyr.GetLayerDefn())
+            f.SetFID(1)
+            f["int"] = 100
+            with pytest.raises(Exception, match="failed to execute insert"):
+                lyr.CreateFeature(f)
+            f = ogr.Feature(lyr.GetLayerDefn())
+            f["int"] = 2
+            lyr.CreateFeature(f)
+            assert f.GetFID() == 3
+            # Explicit FIDs greater than the existing ones stay in the queue
+            f = ogr.Feature(lyr.GetLayerDefn())
+            f.SetFID(10)
+            f["int"] = 9
+            lyr.CreateFeature(f)
+
+    with ogr.Open(filename) as ds:
+        lyr = ds.GetLayer(0)
+        assert [(f.GetFID(), f["int"]) for f in lyr] == [
+            (1, 0),
+            (2, 1),
+            (3, 2),
+            (10, 9),
+        ]
+
+
+###############################################################################
+# Test that features queued with OGR_GPKG_BULK_INSERT_BATCH_SIZE are seen
+# by reads
+
+
+@gdaltest.enable_exceptions()
+def test_ogr_gpkg_bulk_insert_read_pending(tmp_vsimem):
+
+    filename = tmp_vsimem / "test_ogr_gpkg_bulk_insert_read_pending.gpkg"
+    with gdaltest.config_option("OGR_GPKG_BULK_INSERT_BATCH_SIZE", "10"):
+        with gdal.GetDriverByName("GPKG").CreateVector(filename) as ds:
+            lyr = ds.CreateLayer("test")
+            lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+
+            def add_features(start):
+                for i in range(start, start + 3):
+                    f = ogr.Feature(lyr.GetLayerDefn())
+                    f["int"] = i
+                    lyr.CreateFeature(f)
+
+            add_features(0)
+            # No ResetReading() here on purpose
+            got = []
+            while True:
+                f = lyr.GetNextFeature()
+                if f is None:
+                    break
+                got.append(f["int"])
+            assert got == [0, 1, 2]
+
+            add_features(3)
+            with ds.ExecuteSQL("SELECT COUNT(*) FROM test") as sql_lyr:
+                assert sql_lyr.GetNextFeature().GetField(0) == 6
+
+            add_features(6)
+            with ds.ExecuteSQL("SELECT COUNT(*) FROM test", dialect="DEBUG") as sql_lyr:
+                assert sql_lyr.GetNextFeature().GetField(0) == 9
+
+            add_features(9)
+            stream = lyr.GetArrowStream()
+            array = stream.GetNextRecordBatch()
+            assert array.GetLength() == 12
+            del array
+            del stream
@@ -26,21 +26,12 @@ pytestmark = pytest.mark.require_geos
 # Common usage tests.
 
 
-def is_same(A, B):
+def check_same_features(lyr, lyr_ref):
 
-    A.ResetReading()
-    B.ResetReading()
-    while True:
-        fA = A.GetNextFeature()
-        fB = B.GetNextFeature()
-        if fA is None:
-            if fB is not None:
-                return False
-            return True
-        if fB is None:
-            return False
-        if fA.Equal(fB) != 0:
-            return False
+    # Compare field values and geometries, since OGRFeature::Equal() is always
+    # false for features of layers with distinct feature definitions
+    lyr.ResetReading()
+    ogrtest.compare_layers(lyr, lyr_ref)
 
 
 @pytest.fixture()
@@ -242,7 +233,7 @@ def test_algebra_intersection_3(D1, D2, C):
 
     assert err == 0, "got non-zero result code " + str(err) + " from Layer.Intersection"
 
-    assert is_same(D1, C), "D1 != C"
+    check_same_features(C, D1)
 
 
 def test_algebra_intersection_multipoint():
@@ -366,7 +357,7 @@ def test_algebra_union_3(D1, D2, C):
 
     assert err == 0, "got non-zero result code " + str(err) + " from Layer.Union"
 
-    assert is_same(D1, C), "D1 != C"
+    check_same_features(C, D1)
 
 
 def test_algebra_union_4(B, pointInB, C):
@@ -457,7 +448,7 @@ def test_algebra_identity_3(D1, D2, C):
 
     assert err == 0, "got non-zero result code " + str(err) + " from Layer.Identity"
 
-    assert is_same(D1, C), "D1 != C"
+    check_same_features(C, D1)
 
 
 def test_algebra_update_1(A, B, C):
@@ -492,7 +483,7 @@ def test_algebra_update_3(D1, D2, C):
 
     assert err == 0, "got non-zero result code " + str(err) + " from Layer.Update"
 
-    assert is_same(D1, C), "D1 != C"
+    check_same_features(C, D1)
 
 
 def test_algebra_clip_1(A, B, C):
@@ -527,7 +518,7 @@ def test_algebra_clip_3(D1, D2, C):
 
     assert err == 0, "got non-zero result code " + str(err) + " from Layer.Clip"
 
-    assert is_same(D1, C), "D1 != C"
+    check_same_features(C, D1)
 
 
 def test_algebra_erase_1(A, B, C):
@@ -593,3 +584,62 @@ def test_algebra_erase_5(A, empty, C):
     assert C.GetFeatureCount() == A.GetFeatureCount(), (
         "Layer.Erase returned " + str(C.GetFeatureCount()) + " features"
     )
+
+
+###############################################################################
+# Test INDEX_METHOD_LAYER=YES and NUM_THREADS give the same results as the
+# default code path
+
+
+@pytest.mark.parametrize(
+    "method",
+    ["Intersection", "Union", "SymDifference", "Identity", "Update", "Clip", "Erase"],
+)
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_algebra_index_method_layer(mem_ds, method, num_threads):
+
+    inp = mem_ds.CreateLayer("input")
+    inp.CreateField(ogr.FieldDefn("i", ogr.OFTInteger))
+    for i in range(100):
+        x = (i % 10) * 10
+        y = (i // 10) * 10
+        f = ogr.Feature(inp.GetLayerDefn())
+        f["i"] = i
+        f.SetGeometryDirectly(
+            ogr.Geometry(
+                wkt=f"POLYGON(({x} {y},{x} {y+8},{x+8} {y+8},{x+8} {y},{x} {y}))"
+            )
+        )
+        inp.CreateFeature(f)
+
+    method_lyr = mem_ds.CreateLayer("method")
+    method_lyr.CreateField(ogr.FieldDefn("m", ogr.OFTInteger))
+    for i in range(50):
+        x = (i % 7) * 15 + 3
+        y = (i // 7) * 15 + 3
+        f = ogr.Feature(method_lyr.GetLayerDefn())
+        f["m"] = i
+        f.SetGeometryDirectly(ogr.CreateGeometryFromWkt(f"POINT({x} {y})").Buffer(6))
+        method_lyr.CreateFeature(f)
+    # Feature without geometry, that must be ignored
+    method_lyr.CreateFeature(ogr.Feature(method_lyr.GetLayerDefn()))
+
+    # Method layer with a spatial filter
+    method_lyr.SetSpatialFilterRect(0, 0, 60, 60)
+
+    ref = mem_ds.CreateLayer("ref")
+    assert getattr(inp, method)(method_lyr, ref) == ogr.OGRERR_NONE
+    assert ref.GetFeatureCount() > 0
+
+    got = mem_ds.CreateLayer("got")
+    assert (
+        getattr(inp, method)(
+            method_lyr,
+            got,
+            options=["INDEX_METHOD_LAYER=YES", "NUM_THREADS=" + num_threads],
+        )
+        == ogr.OGRERR_NONE
+    )
+
+    assert method_lyr.GetSpatialFilter() is not None
+    check_same_features(got, ref)
@@ -2967,3 +2967,94 @@ def test_ogr_openfilegdb_vsizip_random_zip_name_and_no_gdb_subdir():
 
     with ogr.Open("/vsizip/data/filegdb/testopenfilegdb.zip") as ds:
         assert ds.GetLayerCount() == 37
+
+
+###############################################################################
+# Test the optimized GetNextArrowArray() implementation against the generic one
+
+
+def _get_arrow_stream_content(lyr, options):
+    import numpy
+
+    stream = lyr.GetArrowStreamAsNumPy(options=["USE_MASKED_ARRAYS=NO"] + options)
+    ret = []
+    for batch in stream:
+        ret.append(
+            {
+                k: [x.tobytes() if isinstance(x, numpy.ndarray) else x for x in v]
+                for k, v in batch.items()
+            }
+        )
+    return ret
+
+
+@pytest.mark.parametrize(
+    "filename",
+    [
+        "data/filegdb/testopenfilegdb.gdb.zip",
+        "data/filegdb/arcgis_pro_32_types.gdb",
+        "data/filegdb/testdatetimeutc.gdb",
+        "data/filegdb/curves.gdb",
+    ],
+)
+@pytest.mark.parametrize(
+    "options", [[], ["MAX_FEATURES_IN_BATCH=2"], ["DATETIME_AS_STRING=YES"]]
+)
+def test_ogr_openfilegdb_arrow_stream(filename, options):
+    gdaltest.importorskip_gdal_array()
+    pytest.importorskip("numpy")
+
+    with ogr.Open(filename) as ds:
+        for lyr in ds:
+            with gdaltest.config_option("OGR_OPENFILEGDB_STREAM_BASE_IMPL", "YES"):
+                expected = _get_arrow_stream_content(lyr, options)
+            got = _get_arrow_stream_content(lyr, options)
+            assert (
+                lyr.GetMetadataItem(
+                    "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
+                )
+                == "YES"
+            )
+            assert got == expected, lyr.GetName()
+
+
+###############################################################################
+# Test that ignored fields are not returned by the optimized GetNextArrowArray()
+
+
+def test_ogr_openfilegdb_arrow_stream_ignored_fields():
+    gdaltest.importorskip_gdal_array()
+    pytest.importorskip("numpy")
+
+    with ogr.Open("data/filegdb/testopenfilegdb.gdb.zip") as ds:
+        lyr = ds.GetLayerByName("point")
+        lyr_defn = lyr.GetLayerDefn()
+        ignored_fields = ["OGR_GEOMETRY"]
+        for i in range(1, lyr_defn.GetFieldCount()):
+            ignored_fields.append(lyr_defn.GetFieldDefn(i).GetName())
+        lyr.SetIgnoredFields(ignored_fields)
+
+        with gdaltest.config_option("OGR_OPENFILEGDB_STREAM_BASE_IMPL", "YES"):
+            expected = _get_arrow_stream_content(lyr, [])
+        got = _get_arrow_stream_content(lyr, [])
+        assert (
+            lyr.GetMetadataItem(
+                "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
+            )
+            == "YES"
+        )
+        assert got == expected
+        assert set(got[0].keys()) == {
+            lyr.GetFIDColumn(),
+            lyr_defn.GetFieldDefn(0).GetName(),
+        }
+
+        # Filtered reads go through the generic implementation
+        lyr.SetAttributeFilter("id > 1")
+        _get_arrow_stream_content(lyr, [])
+        assert (
+            lyr.GetMetadataItem(
+                "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
+            )
+            == "NO"
+        )
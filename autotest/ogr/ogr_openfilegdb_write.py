@@ -1527,6 +1527,53 @@ def test_ogr_openfilegdb_write_spatial_index(
     ds = None
 
 
+###############################################################################
+# Test that index files are the same when they are built by several threads
+
+
+def test_ogr_openfilegdb_write_index_num_threads(tmp_vsimem):
+
+    def create(dirname):
+        ds = ogr.GetDriverByName("OpenFileGDB").CreateDataSource(dirname)
+        lyr = ds.CreateLayer("test", geom_type=ogr.wkbLineString)
+        lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+        lyr.StartTransaction()
+        for i in range(140000):
+            f = ogr.Feature(lyr.GetLayerDefn())
+            f["int"] = (i * 7919) % 1000
+            x = (i * 104729) % 1000
+            y = i % 500
+            f.SetGeometry(
+                ogr.CreateGeometryFromWkt(
+                    "LINESTRING(%d %d,%d %d)" % (x, y, x + i % 3, y + i % 2)
+                )
+            )
+            lyr.CreateFeature(f)
+        lyr.CommitTransaction()
+        ds.ExecuteSQL("CREATE INDEX idx_int ON test(int)")
+        ds = None
+        return {
+            name: gdal.VSIFile(dirname / name, "rb").read()
+            for name in gdal.ReadDir(dirname)
+            if name.endswith(".spx") or name.endswith(".atx")
+        }
+
+    expected = create(tmp_vsimem / "out1.gdb")
+    assert len(expected) >= 2
+
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        got = create(tmp_vsimem / "out4.gdb")
+    assert got == expected
+
+    ds = ogr.Open(tmp_vsimem / "out4.gdb")
+    lyr = ds.GetLayer(0)
+    lyr.SetSpatialFilterRect(10, 10, 10.5, 10.5)
+    assert lyr.GetFeatureCount() > 0
+    lyr.SetSpatialFilter(None)
+    lyr.SetAttributeFilter("int = 123")
+    assert lyr.GetFeatureCount() == 140
+
+
 ###############################################################################
 
 
@@ -569,6 +569,70 @@ def test_ogr_pmtiles_write():
             gdal.Unlink(filename)
 
 
+###############################################################################
+# Test that tiles are directly streamed to the PMTiles file, with
+# deduplication, and without leaving any temporary file behind
+
+
+@pytest.mark.require_driver("SQLite")
+@pytest.mark.require_geos
+def test_ogr_pmtiles_write_streaming_deduplication(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.pmtiles")
+    ds = ogr.GetDriverByName("PMTiles").CreateDataSource(
+        filename, options=["MINZOOM=2", "MAXZOOM=2"]
+    )
+    lyr = ds.CreateLayer("test")
+    f = ogr.Feature(lyr.GetLayerDefn())
+    f.SetGeometry(
+        ogr.CreateGeometryFromWkt(
+            "POLYGON((-20000000 -20000000,-20000000 20000000,20000000 20000000,20000000 -20000000,-20000000 -20000000))"
+        )
+    )
+    lyr.CreateFeature(f)
+    ds = None
+
+    assert gdal.ReadDir(str(tmp_vsimem)) == ["test.pmtiles"]
+
+    f = gdal.VSIFOpenL(f"/vsipmtiles/{filename}/pmtiles_header.json", "rb")
+    assert f
+    try:
+        data = gdal.VSIFReadL(1, 10000, f)
+    finally:
+        gdal.VSIFCloseL(f)
+    got = json.loads(data)
+
+    expected = {
+        "addressed_tiles_count": 16,
+        "clustered": True,
+        "tile_contents_count": 9,
+        "tile_entries_count": 13,
+    }
+
+    for key in expected:
+        assert got[key] == expected[key], (key, got)
+
+    ds = ogr.Open(filename)
+    assert ds.GetMetadataItem("scheme") == "xyz"
+    assert ds.GetLayer(0).GetFeatureCount() > 0
+
+
+###############################################################################
+# PMTiles tile ids are only defined for the Web Mercator tile matrix
+
+
+@pytest.mark.require_driver("SQLite")
+def test_ogr_pmtiles_write_custom_tiling_scheme(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.pmtiles")
+    with pytest.raises(Exception, match="Custom TILING_SCHEME not supported"):
+        ogr.GetDriverByName("PMTiles").CreateDataSource(
+            filename,
+            options=["TILING_SCHEME=EPSG:4326,-180,180,360"],
+        )
+    assert gdal.ReadDir(str(tmp_vsimem)) is None
+
+
 ###############################################################################
 
 
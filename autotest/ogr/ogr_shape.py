@@ -6222,3 +6222,198 @@ def test_ogr_shape_write_check_golden_file(tmp_path, src_directory):
         assert (
             open(src_filename, "rb").read() == open(out_filename, "rb").read()
         ), filename
+
+
+###############################################################################
+# Test NUM_THREADS open option
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4", "ALL_CPUS"])
+def test_ogr_shape_read_num_threads(tmp_vsimem, num_threads):
+
+    filename = str(tmp_vsimem / "test_ogr_shape_read_num_threads.shp")
+    with ogr.GetDriverByName("ESRI Shapefile").CreateDataSource(filename) as ds:
+        lyr = ds.CreateLayer(
+            "test_ogr_shape_read_num_threads", geom_type=ogr.wkbPolygon
+        )
+        lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+        lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+        lyr.CreateField(ogr.FieldDefn("date", ogr.OFTDate))
+        for i in range(5000):
+            f = ogr.Feature(lyr.GetLayerDefn())
+            f["int"] = i
+            if (i % 3) == 0:
+                f["str"] = "foo%d" % i
+            f["date"] = "2025/01/%02d" % (1 + (i % 28))
+            if (i % 10) != 0:
+                f.SetGeometry(
+                    ogr.CreateGeometryFromWkt(
+                        "POLYGON((%d 0,%d 1,%d 1,%d 0,%d 0))" % (i, i, i + 1, i + 1, i)
+                    )
+                )
+            lyr.CreateFeature(f)
+
+    with gdal.OpenEx(
+        filename, gdal.OF_VECTOR | gdal.OF_UPDATE, open_options=["AUTO_REPACK=NO"]
+    ) as ds:
+        lyr = ds.GetLayer(0)
+        for fid in (0, 1234, 4999):
+            lyr.DeleteFeature(fid)
+
+    with gdal.OpenEx(filename, gdal.OF_VECTOR) as ds:
+        expected = [f for f in ds.GetLayer(0)]
+    assert len(expected) == 4997
+
+    with gdal.OpenEx(
+        filename, gdal.OF_VECTOR, open_options=["NUM_THREADS=" + num_threads]
+    ) as ds:
+        lyr = ds.GetLayer(0)
+        got = [f for f in lyr]
+        assert len(got) == len(expected)
+        for f_got, f_expected in zip(got, expected):
+            assert f_got.Equal(f_expected)
+
+        # Restart in the middle of a batch
+        lyr.ResetReading()
+        for _ in range(10):
+            lyr.GetNextFeature()
+        lyr.SetNextByIndex(2000)
+        assert lyr.GetNextFeature().GetFID() == 2000
+
+        lyr.SetSpatialFilterRect(1999.5, 0, 2001.5, 1)
+        assert [f.GetFID() for f in lyr] == [1999, 2001]
+        lyr.SetSpatialFilter(None)
+
+        lyr.SetAttributeFilter("int >= 4990")
+        assert [f.GetFID() for f in lyr] == list(range(4990, 4999))
+        lyr.SetAttributeFilter(None)
+
+
+###############################################################################
+# Test GetArrowStream() with NUM_THREADS open option
+
+
+def test_ogr_shape_arrow_stream_num_threads():
+    gdaltest.importorskip_gdal_array()
+    pytest.importorskip("numpy")
+
+    ds = gdal.OpenEx("data/poly.shp", gdal.OF_VECTOR, open_options=["NUM_THREADS=4"])
+    lyr = ds.GetLayer(0)
+    stream = lyr.GetArrowStreamAsNumPy(options=["USE_MASKED_ARRAYS=NO"])
+    batches = [batch for batch in stream]
+    assert len(batches) == 1
+    assert list(batches[0]["OGC_FID"]) == [0, 1, 2, 3, 4, 5, 6, 7, 8, 9]
+    assert list(batches[0]["EAS_ID"]) == [
+        168,
+        179,
+        171,
+        173,
+        172,
+        169,
+        166,
+        158,
+        165,
+        170,
+    ]
+
+
+###############################################################################
+# Test that the NUM_THREADS option of GetArrowStream() gives the same result
+# as single-threaded reading, including when filters are set (in which case
+# reading is sequential)
+
+
+@pytest.mark.parametrize(
+    "attr_filter,spatial_filter",
+    [(None, None), ("val % 3 = 0", None), (None, (100, 0, 300, 10))],
+)
+def test_ogr_shape_arrow_stream_generic_num_threads(
+    tmp_vsimem, attr_filter, spatial_filter
+):
+    gdaltest.importorskip_gdal_array()
+    pytest.importorskip("numpy")
+
+    filename = str(tmp_vsimem / "test.shp")
+    with ogr.GetDriverByName("ESRI Shapefile").CreateDataSource(filename) as ds:
+        lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+        lyr.CreateField(ogr.FieldDefn("val", ogr.OFTInteger))
+        lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+        for i in range(1000):
+            f = ogr.Feature(lyr.GetLayerDefn())
+            f["val"] = i
+            f["str"] = "foo%d" % i
+            f.SetGeometry(ogr.CreateGeometryFromWkt("POINT(%d %d)" % (i, i % 10)))
+            lyr.CreateFeature(f)
+
+    def get_batches(options):
+        ds = ogr.Open(filename)
+        lyr = ds.GetLayer(0)
+        lyr.SetAttributeFilter(attr_filter)
+        if spatial_filter:
+            lyr.SetSpatialFilterRect(*spatial_filter)
+        stream = lyr.GetArrowStreamAsNumPy(
+            options=["USE_MASKED_ARRAYS=NO", "MAX_FEATURES_IN_BATCH=64"] + options
+        )
+        return [{k: list(v) for k, v in batch.items()} for batch in stream]
+
+    expected = get_batches([])
+    assert expected
+    assert get_batches(["NUM_THREADS=4"]) == expected
+
+
+###############################################################################
+# Test that bulk loading of the .qix spatial index gives the same file as
+# inserting shapes one at a time
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+@pytest.mark.parametrize("depth", [None, 1, 14])
+def test_ogr_shape_create_spatial_index_bulk(tmp_vsimem, num_threads, depth):
+
+    filename = str(tmp_vsimem / "test.shp")
+    with ogr.GetDriverByName("ESRI Shapefile").CreateDataSource(filename) as ds:
+        lyr = ds.CreateLayer("test", geom_type=ogr.wkbLineString)
+        for i in range(20000):
+            f = ogr.Feature(lyr.GetLayerDefn())
+            if (i % 100) != 0:
+                x = (i * 7919) % 1000
+                y = (i * 104729) % 500
+                size = (i % 13) * (i % 7)
+                f.SetGeometry(
+                    ogr.CreateGeometryFromWkt(
+                        "LINESTRING(%d %d,%d %d)" % (x, y, x + size, y + size / 2)
+                    )
+                )
+            lyr.CreateFeature(f)
+
+    sql = "CREATE SPATIAL INDEX ON test"
+    if depth:
+        sql += " DEPTH %d" % depth
+    qix_filename = filename[0:-3] + "qix"
+
+    with gdal.config_option("SHAPE_QIX_BULK_LOAD", "NO"):
+        with gdal.OpenEx(filename, gdal.OF_VECTOR | gdal.OF_UPDATE) as ds:
+            ds.ExecuteSQL(sql)
+    expected = gdal.VSIFile(qix_filename, "rb").read()
+
+    with gdal.OpenEx(
+        filename,
+        gdal.OF_VECTOR | gdal.OF_UPDATE,
+        open_options=["NUM_THREADS=" + num_threads],
+    ) as ds:
+        ds.ExecuteSQL(sql)
+    assert gdal.VSIFile(qix_filename, "rb").read() == expected
+
+    with gdal.OpenEx(filename, gdal.OF_VECTOR) as ds:
+        lyr = ds.GetLayer(0)
+        assert lyr.TestCapability(ogr.OLCFastSpatialFilter)
+        lyr.SetSpatialFilterRect(100, 100, 110, 110)
+        got = set(f.GetFID() for f in lyr)
+    assert got
+
+    gdal.Unlink(qix_filename)
+    with gdal.OpenEx(filename, gdal.OF_VECTOR) as ds:
+        lyr = ds.GetLayer(0)
+        assert not lyr.TestCapability(ogr.OLCFastSpatialFilter)
+        lyr.SetSpatialFilterRect(100, 100, 110, 110)
+        assert got == set(f.GetFID() for f in lyr)
@@ -1587,6 +1587,76 @@ def test_ogr_rfc28_order_by_two_columns():
     ds.ReleaseResultSet(sql_lyr)
 
 
+###############################################################################
+# Test ORDER BY with key values exceeding OGR_SQL_ORDER_BY_MAX_MEMORY, so that
+# sorted runs are spilled to temporary files and merged
+
+
+def test_ogr_rfc28_order_by_external_sort():
+
+    ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+    lyr = ds.CreateLayer("lyr")
+    lyr.CreateField(ogr.FieldDefn("int_val", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("str_val", ogr.OFTString))
+    lyr.CreateField(ogr.FieldDefn("dt_val", ogr.OFTDateTime))
+    for i in range(1000):
+        feat = ogr.Feature(lyr.GetLayerDefn())
+        feat.SetField("int_val", (i * 7919) % 100)
+        if i % 10 != 0:
+            feat.SetField("str_val", "str%03d" % ((i * 104729) % 1000))
+        feat.SetField("dt_val", "2025/01/01 00:00:%02d" % (i % 60))
+        lyr.CreateFeature(feat)
+
+    def get_fids(sql):
+        sql_lyr = ds.ExecuteSQL(sql)
+        fids = [f.GetFID() for f in sql_lyr]
+        ds.ReleaseResultSet(sql_lyr)
+        return fids
+
+    for sql in [
+        "SELECT * FROM lyr ORDER BY int_val",
+        "SELECT * FROM lyr ORDER BY int_val DESC, str_val",
+        "SELECT * FROM lyr ORDER BY str_val DESC",
+        "SELECT * FROM lyr ORDER BY dt_val, FID DESC",
+        "SELECT * FROM lyr ORDER BY OGR_STYLE, FID",
+    ]:
+        expected = get_fids(sql)
+        assert len(expected) == 1000
+        with gdal.config_option("OGR_SQL_ORDER_BY_MAX_MEMORY", "1k"):
+            assert get_fids(sql) == expected, sql
+
+
+###############################################################################
+# Test DISTINCT on values that compare equal without being identical strings
+
+
+@pytest.mark.parametrize("order_by", ["", " ORDER BY val", " ORDER BY val DESC"])
+def test_ogr_rfc28_distinct_equal_values(order_by):
+
+    ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+    lyr = ds.CreateLayer("lyr")
+    lyr.CreateField(ogr.FieldDefn("val", ogr.OFTReal))
+    for val in [1.5, -0.0, 0.0, 2.0, 1.5, 0.0, None]:
+        feat = ogr.Feature(lyr.GetLayerDefn())
+        if val is not None:
+            feat["val"] = val
+        lyr.CreateFeature(feat)
+
+    with ds.ExecuteSQL("SELECT DISTINCT val FROM lyr" + order_by) as sql_lyr:
+        assert sql_lyr.GetFeatureCount() == 4
+        values = [f["val"] for f in sql_lyr]
+    if order_by == "":
+        assert values == [1.5, 0.0, 2.0, None]
+    elif order_by.endswith("DESC"):
+        assert values == [2.0, 1.5, 0.0, None]
+    else:
+        assert values == [None, 0.0, 1.5, 2.0]
+
+    with ds.ExecuteSQL("SELECT COUNT(DISTINCT val) FROM lyr") as sql_lyr:
+        f = sql_lyr.GetNextFeature()
+        assert f.GetField(0) == 3
+
+
 ###############################################################################
 # Test that date fields stored as ISO-8601 can be used with IN operator
 # Test fix for https://github.com/OSGeo/gdal/issues/3977
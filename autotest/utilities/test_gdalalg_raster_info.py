@@ -66,6 +66,14 @@ def test_gdalalg_raster_info_mm_checksum():
     assert "Checksum=" in output_string
 
 
+def test_gdalalg_raster_info_cache_stats():
+    info = get_info_alg()
+    assert info.ParseRunAndFinalize(["--checksum", "--cache-stats", "data/utmsmall.tif"])
+    block_cache = json.loads(info["output-string"])["blockCache"]
+    assert block_cache["dataset"]["misses"] > 0
+    assert block_cache["global"]["misses"] >= block_cache["dataset"]["misses"]
+
+
 def test_gdalalg_raster_info_stats():
     info = get_info_alg()
     ds = gdal.Translate("", "../gcore/data/byte.tif", format="MEM")
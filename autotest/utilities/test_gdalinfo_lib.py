@@ -377,3 +377,34 @@ def test_gdalinfo_lib_no_driver():
     assert ds2.GetDriver() is None
     gdal.Info(ds2)
     gdal.Info(ds2, format="json")
+
+
+###############################################################################
+# Test -cache_stats
+
+
+def test_gdalinfo_lib_cache_stats():
+
+    ds = gdal.Open("../gcore/data/byte.tif")
+
+    ret = gdal.Info(ds, format="json", options="-checksum -cache_stats")
+    gdaltest.validate_json(ret, "gdalinfo_output.schema.json")
+    ds_stats = ret["blockCache"]["dataset"]
+    assert ds_stats["misses"] > 0
+    assert ds_stats["blocks"] > 0
+    assert ds_stats["bytes"] > 0
+    global_stats = ret["blockCache"]["global"]
+    assert global_stats["misses"] >= ds_stats["misses"]
+    assert global_stats["blocks"] >= ds_stats["blocks"]
+    assert global_stats["bytes"] <= global_stats["maxBytes"]
+    assert global_stats["lockAcquisitions"] > 0
+    assert global_stats["lockWaitTime"] >= 0
+
+    # Blocks are now in the cache
+    ret = gdal.Info(ds, format="json", options="-checksum -cache_stats")
+    assert ret["blockCache"]["dataset"]["hits"] > 0
+    assert ret["blockCache"]["dataset"]["misses"] == ds_stats["misses"]
+
+    ret = gdal.Info(ds, options="-cache_stats")
+    assert "Block Cache:" in ret
+    assert "Lock acquisitions:" in ret
@@ -386,6 +386,22 @@ std::tuple<CPLErr, bool> GTiffDataset::Finalize()
     return std::tuple(eErr, bDroppedRef);
 }
 
+/************************************************************************/
+/*                       CanBeSharedForReading()                        */
+/************************************************************************/
+
+/** Implements GDALDataset::CanBeSharedForReading()
+ *
+ * Overview and mask datasets read through the TIFF handle of the main
+ * dataset, which is fine as long as reads are serialized and nothing gets
+ * written.
+ */
+bool GTiffDataset::CanBeSharedForReading(int nScopeFlags) const
+{
+    return nScopeFlags == GDAL_OF_RASTER && eAccess == GA_ReadOnly &&
+           m_poBaseDS == nullptr;
+}
+
 /************************************************************************/
 /*                        CloseDependentDatasets()                      */
 /************************************************************************/
@@ -454,6 +454,7 @@ class GTiffDataset final : public GDALPamDataset
 
   protected:
     int CloseDependentDatasets() override;
+    bool CanBeSharedForReading(int nScopeFlags) const override;
 
   public:
     GTiffDataset();
@@ -112,6 +112,13 @@ class MBTilesDataset final : public GDALPamDataset,
     virtual const char *GetMetadataItem(const char *pszName,
                                         const char *pszDomain = "") override;
 
+    CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
+                     int nYSize, void *pData, int nBufXSize, int nBufYSize,
+                     GDALDataType eBufType, int nBandCount,
+                     BANDMAP_TYPE panBandMap, GSpacing nPixelSpace,
+                     GSpacing nLineSpace, GSpacing nBandSpace,
+                     GDALRasterIOExtraArg *psExtraArg) override;
+
     CPLErr IBuildOverviews(const char *pszResampling, int nOverviews,
                            const int *panOverviewList, int nBandsIn,
                            const int * /* panBandList */,
@@ -1280,6 +1287,7 @@ bool MBTilesDataset::InitRaster(MBTilesDataset *poParentDS, int nZoomLevel,
         m_nQuality = poParentDS->m_nQuality;
         m_nZLevel = poParentDS->m_nZLevel;
         m_bDither = poParentDS->m_bDither;
+        m_nNumThreads = poParentDS->m_nNumThreads;
         m_osWHERE = poParentDS->m_osWHERE;
         SetDescription(CPLSPrintf("%s - zoom_level=%d",
                                   poParentDS->GetDescription(), m_nZoomLevel));
@@ -1288,6 +1296,29 @@ bool MBTilesDataset::InitRaster(MBTilesDataset *poParentDS, int nZoomLevel,
     return true;
 }
 
+/************************************************************************/
+/*                            IRasterIO()                               */
+/************************************************************************/
+
+CPLErr MBTilesDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
+                                 int nXSize, int nYSize, void *pData,
+                                 int nBufXSize, int nBufYSize,
+                                 GDALDataType eBufType, int nBandCount,
+                                 BANDMAP_TYPE panBandMap, GSpacing nPixelSpace,
+                                 GSpacing nLineSpace, GSpacing nBandSpace,
+                                 GDALRasterIOExtraArg *psExtraArg)
+{
+    const bool bPrefetched = PrefetchTiles(eRWFlag, nXOff, nYOff, nXSize,
+                                           nYSize, nBufXSize, nBufYSize);
+    const CPLErr eErr = GDALPamDataset::IRasterIO(
+        eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
+        eBufType, nBandCount, panBandMap, nPixelSpace, nLineSpace, nBandSpace,
+        psExtraArg);
+    if (bPrefetched)
+        ReleasePrefetchedTiles();
+    return eErr;
+}
+
 /************************************************************************/
 /*                         GetSpatialRef()                              */
 /************************************************************************/
@@ -2881,6 +2912,8 @@ GDALDataset *MBTilesDataset::Open(GDALOpenInfo *poOpenInfo)
             poDS->ParseCompressionOptions(poOpenInfo->papszOpenOptions);
         }
 
+        poDS->ParseNumThreadsOption(poOpenInfo->papszOpenOptions);
+
         /* --------------------------------------------------------------------
          */
         /*      Add overview levels as internal datasets */
@@ -3730,6 +3763,9 @@ void GDALRegister_MBTiles()
         "  <Option name='USE_BOUNDS' scope='raster,vector' type='boolean' "
         "description='Whether to use the bounds metadata, when available, to "
         "determine the AOI' default='YES'/>" COMPRESSION_OPTIONS
+        "  <Option name='NUM_THREADS' scope='raster' type='string' "
+        "description='Number of worker threads used to decode tiles when "
+        "reading. Integer or ALL_CPUS' default='1'/>"
         "  <Option name='CLIP' scope='vector' type='boolean' "
         "description='Whether to clip geometries to tile extent' "
         "default='YES'/>"
@@ -1119,6 +1119,19 @@ bool MEMDataset::CanBeCloned(int nScopeFlags, bool bCanShareState) const
            typeid(this) == typeid(const MEMDataset *);
 }
 
+/************************************************************************/
+/*                       CanBeSharedForReading()                        */
+/************************************************************************/
+
+/** Implements GDALDataset::CanBeSharedForReading()
+ *
+ * The implementation of this method must be thread-safe.
+ */
+bool MEMDataset::CanBeSharedForReading(int nScopeFlags) const
+{
+    return nScopeFlags == GDAL_OF_RASTER;
+}
+
 /************************************************************************/
 /*                              Clone()                                 */
 /************************************************************************/
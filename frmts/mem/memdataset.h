@@ -80,6 +80,7 @@ class CPL_DLL MEMDataset CPL_NON_FINAL : public GDALDataset
 
   protected:
     bool CanBeCloned(int nScopeFlags, bool bCanShareState) const override;
+    bool CanBeSharedForReading(int nScopeFlags) const override;
 
     std::unique_ptr<GDALDataset> Clone(int nScopeFlags,
                                        bool bCanShareState) const override;
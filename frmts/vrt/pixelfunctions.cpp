@@ -2939,6 +2939,114 @@ static CPLErr ExprPixelFunc(void **papoSources, int nSources, void *pData,
     if (!padfResults)
         return CE_Failure;
 
+    // Evaluate muparser expressions a line at a time when
+    // BatchMathExpression supports them. muparser is still used to validate
+    // variable names, so that errors are reported as before.
+    std::unique_ptr<gdal::BatchMathExpression> poBatchExpression;
+    if (EQUAL(pszDialect, "muparser") &&
+        CPLTestBool(CPLGetConfigOption("GDAL_VRT_EXPRESSION_BATCH", "YES")))
+    {
+        if (poExpression->Compile() != CE_None)
+            return CE_Failure;
+
+        poBatchExpression =
+            std::make_unique<gdal::BatchMathExpression>(pszExpression);
+        std::vector<int> anBands;
+        for (int iSource = 0; iSource < nSources; ++iSource)
+        {
+            poBatchExpression->RegisterVariable(aosSourceNames[iSource],
+                                                iSource);
+            anBands.push_back(iSource);
+        }
+        poBatchExpression->RegisterVector("BANDS", anBands);
+        if (includeCenterCoords)
+        {
+            poBatchExpression->RegisterVariable("_CENTER_X_", nSources);
+            poBatchExpression->RegisterVariable("_CENTER_Y_", nSources + 1);
+        }
+        if (bHasNoData)
+        {
+            poBatchExpression->RegisterConstant("NODATA", dfNoData);
+        }
+        if (!poBatchExpression->Compile())
+            poBatchExpression.reset();
+    }
+
+    if (poBatchExpression)
+    {
+        const int nInputs = nSources + (includeCenterCoords ? 2 : 0);
+        std::unique_ptr<double, VSIFreeReleaser> padfInputs(
+            static_cast<double *>(
+                VSI_MALLOC3_VERBOSE(nInputs, nXSize, sizeof(double))));
+        if (!padfInputs)
+            return CE_Failure;
+        std::vector<const double *> apadfInputs(nInputs);
+        const int nSrcTypeSize = GDALGetDataTypeSizeBytes(eSrcType);
+
+        for (int iLine = 0; iLine < nYSize; ++iLine)
+        {
+            const size_t nLineOffset = static_cast<size_t>(iLine) * nXSize;
+            for (int iSrc = 0; iSrc < nSources; ++iSrc)
+            {
+                if (eSrcType == GDT_Float64)
+                {
+                    apadfInputs[iSrc] =
+                        static_cast<const double *>(papoSources[iSrc]) +
+                        nLineOffset;
+                }
+                else
+                {
+                    double *padfInput =
+                        padfInputs.get() + static_cast<size_t>(iSrc) * nXSize;
+                    GDALCopyWords64(static_cast<const GByte *>(
+                                        papoSources[iSrc]) +
+                                        nLineOffset * nSrcTypeSize,
+                                    eSrcType, nSrcTypeSize, padfInput,
+                                    GDT_Float64, sizeof(double), nXSize);
+                    apadfInputs[iSrc] = padfInput;
+                }
+            }
+
+            if (includeCenterCoords)
+            {
+                double *padfX =
+                    padfInputs.get() + static_cast<size_t>(nSources) * nXSize;
+                double *padfY = padfX + nXSize;
+                for (int iCol = 0; iCol < nXSize; ++iCol)
+                {
+                    gt.Apply(static_cast<double>(iCol + nXOff) + 0.5,
+                             static_cast<double>(iLine + nYOff) + 0.5,
+                             &padfX[iCol], &padfY[iCol]);
+                }
+                apadfInputs[nSources] = padfX;
+                apadfInputs[nSources + 1] = padfY;
+            }
+
+            poBatchExpression->Evaluate(apadfInputs.data(), nXSize,
+                                        padfResults.get());
+
+            if (bHasNoData && bPropagateNoData)
+            {
+                for (int iSrc = 0; iSrc < nSources; ++iSrc)
+                {
+                    const double *padfInput = apadfInputs[iSrc];
+                    for (int iCol = 0; iCol < nXSize; ++iCol)
+                    {
+                        if (IsNoData(padfInput[iCol], dfNoData))
+                            padfResults.get()[iCol] = dfNoData;
+                    }
+                }
+            }
+
+            GDALCopyWords(padfResults.get(), GDT_Float64, sizeof(double),
+                          static_cast<GByte *>(pData) +
+                              static_cast<GSpacing>(nLineSpace) * iLine,
+                          eBufType, nPixelSpace, nXSize);
+        }
+
+        return CE_None;
+    }
+
     /* ---- Set pixels ---- */
     size_t ii = 0;
     for (int iLine = 0; iLine < nYSize; ++iLine)
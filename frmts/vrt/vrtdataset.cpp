@@ -2151,6 +2151,21 @@ void VRTDataset::SetMaskBand(std::unique_ptr<VRTRasterBand> poMaskBandIn)
     m_poMaskBand->SetIsMaskBand();
 }
 
+/************************************************************************/
+/*                       CanBeSharedForReading()                        */
+/************************************************************************/
+
+/** Implements GDALDataset::CanBeSharedForReading()
+ *
+ * Block reads of a VRT are computed from its sources, which only requires
+ * them not to run concurrently. This also applies to VRT datasets that exist
+ * only in memory, and thus cannot be cloned.
+ */
+bool VRTDataset::CanBeSharedForReading(int nScopeFlags) const
+{
+    return nScopeFlags == GDAL_OF_RASTER;
+}
+
 /************************************************************************/
 /*                        CloseDependentDatasets()                      */
 /************************************************************************/
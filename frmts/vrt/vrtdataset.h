@@ -257,6 +257,7 @@ class CPL_DLL VRTDataset CPL_NON_FINAL : public GDALDataset
     friend class VRTDerivedRasterBand;
     friend class VRTSimpleSource;
     friend struct VRTSourcedRasterBandRasterIOJob;
+    friend struct VRTSourcedRasterBandTiledRasterIOJob;
     friend VRTDatasetH CPL_STDCALL VRTCreate(int nXSize, int nYSize);
 
     std::vector<gdal::GCP> m_asGCPs{};
@@ -325,6 +326,7 @@ class CPL_DLL VRTDataset CPL_NON_FINAL : public GDALDataset
     GDALGeoTransform m_gt{};
 
     int CloseDependentDatasets() override;
+    bool CanBeSharedForReading(int nScopeFlags) const override;
 
   public:
     VRTDataset(int nXSize, int nYSize, int nBlockXSize = 0,
@@ -1066,6 +1068,10 @@ class CPL_DLL VRTSourcedRasterBand CPL_NON_FINAL : public VRTRasterBand
                                 double dfYSize,
                                 int &nContributingSources) const;
 
+    bool CanTiledMultiThreadRasterIO(double dfXOff, double dfYOff,
+                                     double dfXSize, double dfYSize,
+                                     int &nContributingDatasets) const;
+
     CPLErr IReadBlock(int, int, void *) override;
 
     virtual void GetFileList(char ***ppapszFileList, int *pnSize,
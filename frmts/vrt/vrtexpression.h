@@ -14,6 +14,7 @@
 
 #include "cpl_error.h"
 
+#include <memory>
 #include <string_view>
 #include <vector>
 
@@ -201,6 +202,50 @@ MathExpression::Create([[maybe_unused]] const char *pszExpression,
 
 bool MuParserHasDefineFunUserData();
 
+/**
+ * Class to evaluate an expression of the muparser dialect on arrays of
+ * values.
+ *
+ * The expression is compiled into a bytecode whose instructions each
+ * process a chunk of values, which removes the per-pixel dispatch overhead
+ * of MathExpression. Only a subset of the muparser grammar is supported:
+ * Compile() returns false for expressions outside of it, which must then be
+ * evaluated with MathExpression.
+ */
+class BatchMathExpression final
+{
+  public:
+    explicit BatchMathExpression(std::string_view osExpression);
+
+    ~BatchMathExpression();
+
+    /** Register a variable whose values are in the iInput-th array passed
+     * to Evaluate(). */
+    void RegisterVariable(std::string_view osVariable, int iInput);
+
+    /** Register a vector, expanded into the list of its elements when used
+     * as an argument of a function taking a variable number of arguments.
+     */
+    void RegisterVector(std::string_view osVariable,
+                        const std::vector<int> &anInputs);
+
+    /** Register a constant, such as NODATA. */
+    void RegisterConstant(std::string_view osVariable, double dfValue);
+
+    bool Compile();
+
+    void Evaluate(const double *const *papadfInputs, size_t nCount,
+                  double *padfResults) const;
+
+  private:
+    class Impl;
+
+    std::unique_ptr<Impl> m_pImpl;
+
+    BatchMathExpression(const BatchMathExpression &) = delete;
+    BatchMathExpression &operator=(const BatchMathExpression &) = delete;
+};
+
 /*! @endcond */
 
 }  // namespace gdal
@@ -0,0 +1,945 @@
+/******************************************************************************
+ *
+ * Project:  Virtual GDAL Datasets
+ * Purpose:  Implementation of BatchMathExpression
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "vrtexpression.h"
+#include "cpl_conv.h"
+#include "cpl_string.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <string>
+
+namespace gdal
+{
+
+/*! @cond Doxygen_Suppress */
+
+namespace
+{
+
+enum class BatchOp
+{
+    PUSH_INPUT,
+    PUSH_CONST,
+    NEG,
+    ADD,
+    SUB,
+    MUL,
+    DIV,
+    POW,
+    LT,
+    GT,
+    LE,
+    GE,
+    EQ,
+    NE,
+    AND,
+    OR,
+    SELECT,
+    FMOD,
+    ISNODATA,
+    MIN,
+    MAX,
+    SUM,
+    AVG,
+    SIN,
+    COS,
+    TAN,
+    ASIN,
+    ACOS,
+    ATAN,
+    SINH,
+    COSH,
+    TANH,
+    ASINH,
+    ACOSH,
+    ATANH,
+    LOG10,
+    LN,
+    EXP,
+    SQRT,
+    SIGN,
+    ABS,
+    ISNAN,
+};
+
+struct BatchInstr
+{
+    BatchOp eOp = BatchOp::PUSH_CONST;
+    //! Input index for PUSH_INPUT, number of arguments for MIN/MAX/SUM/AVG,
+    //! whether there is a nodata value for ISNODATA.
+    int nArg = 0;
+    //! Value for PUSH_CONST, nodata value for ISNODATA.
+    double dfValue = 0;
+};
+
+//! Value of a slot of the evaluation stack: either a constant, or an array.
+struct BatchSlot
+{
+    const double *padf = nullptr;
+    double dfConst = 0;
+    bool bConst = false;
+
+    double Get(size_t i) const
+    {
+        return bConst ? dfConst : padf[i];
+    }
+};
+
+// Functions with a single argument, named as in muparser.
+constexpr struct
+{
+    const char *pszName;
+    BatchOp eOp;
+} asUnaryFunctions[] = {
+    {"sin", BatchOp::SIN},     {"cos", BatchOp::COS},
+    {"tan", BatchOp::TAN},     {"asin", BatchOp::ASIN},
+    {"acos", BatchOp::ACOS},   {"atan", BatchOp::ATAN},
+    {"sinh", BatchOp::SINH},   {"cosh", BatchOp::COSH},
+    {"tanh", BatchOp::TANH},   {"asinh", BatchOp::ASINH},
+    {"acosh", BatchOp::ACOSH}, {"atanh", BatchOp::ATANH},
+    {"log10", BatchOp::LOG10}, {"ln", BatchOp::LN},
+    {"exp", BatchOp::EXP},     {"sqrt", BatchOp::SQRT},
+    {"sign", BatchOp::SIGN},   {"abs", BatchOp::ABS},
+    {"isnan", BatchOp::ISNAN}, {"isnodata", BatchOp::ISNODATA},
+};
+
+}  // namespace
+
+/************************************************************************/
+/*                      BatchMathExpression::Impl                       */
+/************************************************************************/
+
+class BatchMathExpression::Impl
+{
+  public:
+    explicit Impl(std::string_view osExpression)
+        : m_osExpression(std::string(osExpression))
+    {
+    }
+
+    bool Compile();
+
+    void Evaluate(const double *const *papadfInputs, size_t nCount,
+                  double *padfResults) const;
+
+    //! Number of values processed at once by each instruction.
+    static constexpr size_t CHUNK_SIZE = 256;
+
+    const std::string m_osExpression;
+    std::map<std::string, int> m_oMapVariables{};
+    std::map<std::string, std::vector<int>> m_oMapVectors{};
+    std::map<std::string, double> m_oMapConstants{};
+    std::vector<BatchInstr> m_aoCode{};
+    int m_nMaxStackDepth = 0;
+
+  private:
+    const char *m_pszCur = nullptr;
+    int m_nStackDepth = 0;
+
+    void SkipSpaces();
+    bool Accept(const char *pszToken);
+    bool ParseIdentifier(std::string &osName);
+    void Emit(BatchOp eOp, int nArg = 0, double dfValue = 0);
+    void Pop(int nCount);
+
+    bool ParseTernary();
+    bool ParseLogicalOr();
+    bool ParseLogicalAnd();
+    bool ParseComparison();
+    bool ParseAdditive();
+    bool ParseMultiplicative();
+    bool ParseUnary();
+    bool ParsePower(bool &bHasPower);
+    bool ParsePrimary();
+    bool ParseFunctionArguments(int &nArgs);
+};
+
+/************************************************************************/
+/*                             SkipSpaces()                             */
+/************************************************************************/
+
+void BatchMathExpression::Impl::SkipSpaces()
+{
+    while (*m_pszCur == ' ' || *m_pszCur == '\t' || *m_pszCur == '\n' ||
+           *m_pszCur == '\r')
+        ++m_pszCur;
+}
+
+/************************************************************************/
+/*                               Accept()                               */
+/************************************************************************/
+
+bool BatchMathExpression::Impl::Accept(const char *pszToken)
+{
+    SkipSpaces();
+    const size_t nLen = strlen(pszToken);
+    if (strncmp(m_pszCur, pszToken, nLen) != 0)
+        return false;
+    // Do not take the "<" of "<=", or the ">" of ">=".
+    if (nLen == 1 && (*pszToken == '<' || *pszToken == '>') &&
+        m_pszCur[1] == '=')
+        return false;
+    m_pszCur += nLen;
+    return true;
+}
+
+/************************************************************************/
+/*                          ParseIdentifier()                           */
+/************************************************************************/
+
+/** Parses a name made of letters, digits and underscores, optionally
+ * followed by an index between square brackets, such as the "A[1]" variables
+ * of "gdal raster calc".
+ */
+bool BatchMathExpression::Impl::ParseIdentifier(std::string &osName)
+{
+    SkipSpaces();
+    const char *pszStart = m_pszCur;
+    if (!(isalpha(static_cast<unsigned char>(*m_pszCur)) || *m_pszCur == '_'))
+        return false;
+    while (isalnum(static_cast<unsigned char>(*m_pszCur)) || *m_pszCur == '_')
+        ++m_pszCur;
+    osName.assign(pszStart, m_pszCur - pszStart);
+    if (*m_pszCur == '[')
+    {
+        const char *pszEnd = strchr(m_pszCur, ']');
+        if (pszEnd)
+        {
+            std::string osIndexed(pszStart, pszEnd + 1 - pszStart);
+            if (cpl::contains(m_oMapVariables, osIndexed))
+            {
+                osName = std::move(osIndexed);
+                m_pszCur = pszEnd + 1;
+            }
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                                Emit()                                */
+/************************************************************************/
+
+void BatchMathExpression::Impl::Emit(BatchOp eOp, int nArg, double dfValue)
+{
+    BatchInstr oInstr;
+    oInstr.eOp = eOp;
+    oInstr.nArg = nArg;
+    oInstr.dfValue = dfValue;
+    m_aoCode.push_back(oInstr);
+    if (eOp == BatchOp::PUSH_INPUT || eOp == BatchOp::PUSH_CONST)
+    {
+        ++m_nStackDepth;
+        m_nMaxStackDepth = std::max(m_nMaxStackDepth, m_nStackDepth);
+    }
+}
+
+/************************************************************************/
+/*                                 Pop()                                */
+/************************************************************************/
+
+void BatchMathExpression::Impl::Pop(int nCount)
+{
+    m_nStackDepth -= nCount;
+}
+
+/************************************************************************/
+/*                              Compile()                               */
+/************************************************************************/
+
+bool BatchMathExpression::Impl::Compile()
+{
+    m_aoCode.clear();
+    m_nStackDepth = 0;
+    m_nMaxStackDepth = 0;
+    m_pszCur = m_osExpression.c_str();
+    if (!ParseTernary())
+        return false;
+    SkipSpaces();
+    // Trailing characters, or several comma-separated expressions.
+    return *m_pszCur == 0 && m_nStackDepth == 1;
+}
+
+/************************************************************************/
+/*                            ParseTernary()                            */
+/************************************************************************/
+
+bool BatchMathExpression::Impl::ParseTernary()
+{
+    if (!ParseLogicalOr())
+        return false;
+    if (Accept("?"))
+    {
+        if (!ParseTernary() || !Accept(":") || !ParseTernary())
+            return false;
+        Emit(BatchOp::SELECT);
+        Pop(2);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                           ParseLogicalOr()                           */
+/************************************************************************/
+
+bool BatchMathExpression::Impl::ParseLogicalOr()
+{
+    if (!ParseLogicalAnd())
+        return false;
+    while (Accept("||"))
+    {
+        if (!ParseLogicalAnd())
+            return false;
+        Emit(BatchOp::OR);
+        Pop(1);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                          ParseLogicalAnd()                           */
+/************************************************************************/
+
+bool BatchMathExpression::Impl::ParseLogicalAnd()
+{
+    if (!ParseComparison())
+        return false;
+    while (Accept("&&"))
+    {
+        if (!ParseComparison())
+            return false;
+        Emit(BatchOp::AND);
+        Pop(1);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                          ParseComparison()                           */
+/************************************************************************/
+
+/** As in muparser, all comparison operators have the same precedence */
+bool BatchMathExpression::Impl::ParseComparison()
+{
+    if (!ParseAdditive())
+        return false;
+    while (true)
+    {
+        BatchOp eOp;
+        if (Accept("<="))
+            eOp = BatchOp::LE;
+        else if (Accept(">="))
+            eOp = BatchOp::GE;
+        else if (Accept("=="))
+            eOp = BatchOp::EQ;
+        else if (Accept("!="))
+            eOp = BatchOp::NE;
+        else if (Accept("<"))
+            eOp = BatchOp::LT;
+        else if (Accept(">"))
+            eOp = BatchOp::GT;
+        else
+            break;
+        if (!ParseAdditive())
+            return false;
+        Emit(eOp);
+        Pop(1);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                           ParseAdditive()                            */
+/************************************************************************/
+
+bool BatchMathExpression::Impl::ParseAdditive()
+{
+    if (!ParseMultiplicative())
+        return false;
+    while (true)
+    {
+        BatchOp eOp;
+        if (Accept("+"))
+            eOp = BatchOp::ADD;
+        else if (Accept("-"))
+            eOp = BatchOp::SUB;
+        else
+            break;
+        if (!ParseMultiplicative())
+            return false;
+        Emit(eOp);
+        Pop(1);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                        ParseMultiplicative()                         */
+/************************************************************************/
+
+bool BatchMathExpression::Impl::ParseMultiplicative()
+{
+    if (!ParseUnary())
+        return false;
+    while (true)
+    {
+        BatchOp eOp;
+        if (Accept("*"))
+            eOp = BatchOp::MUL;
+        else if (Accept("/"))
+            eOp = BatchOp::DIV;
+        else
+            break;
+        if (!ParseUnary())
+            return false;
+        Emit(eOp);
+        Pop(1);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                             ParseUnary()                             */
+/************************************************************************/
+
+bool BatchMathExpression::Impl::ParseUnary()
+{
+    bool bNegate = false;
+    bool bHasSign = false;
+    while (true)
+    {
+        if (Accept("-"))
+            bNegate = !bNegate;
+        else if (Accept("+"))
+        {
+        }
+        else
+            break;
+        bHasSign = true;
+    }
+    bool bHasPower = false;
+    if (!ParsePower(bHasPower))
+        return false;
+    // The relative precedence of the sign and of the power operator has
+    // changed across muparser versions: leave "-a^b" to muparser itself.
+    if (bHasSign && bHasPower)
+        return false;
+    if (bNegate)
+        Emit(BatchOp::NEG);
+    return true;
+}
+
+/************************************************************************/
+/*                             ParsePower()                             */
+/************************************************************************/
+
+bool BatchMathExpression::Impl::ParsePower(bool &bHasPower)
+{
+    if (!ParsePrimary())
+        return false;
+    if (Accept("^"))
+    {
+        bHasPower = true;
+        bool bNegate = false;
+        if (Accept("-"))
+            bNegate = true;
+        else
+            Accept("+");
+        if (!ParsePrimary())
+            return false;
+        if (bNegate)
+            Emit(BatchOp::NEG);
+        // Chained powers are not handled, to avoid any ambiguity about
+        // their associativity.
+        if (Accept("^"))
+            return false;
+        Emit(BatchOp::POW);
+        Pop(1);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                       ParseFunctionArguments()                       */
+/************************************************************************/
+
+bool BatchMathExpression::Impl::ParseFunctionArguments(int &nArgs)
+{
+    nArgs = 0;
+    if (!Accept("("))
+        return false;
+    do
+    {
+        // A vector used as an argument is expanded into its elements.
+        const char *pszBefore = m_pszCur;
+        std::string osName;
+        if (ParseIdentifier(osName))
+        {
+            const auto oIter = m_oMapVectors.find(osName);
+            SkipSpaces();
+            if (oIter != m_oMapVectors.end() &&
+                (*m_pszCur == ',' || *m_pszCur == ')'))
+            {
+                for (int iInput : oIter->second)
+                {
+                    Emit(BatchOp::PUSH_INPUT, iInput);
+                    ++nArgs;
+                }
+                continue;
+            }
+        }
+        m_pszCur = pszBefore;
+
+        if (!ParseTernary())
+            return false;
+        ++nArgs;
+    } while (Accept(","));
+    return Accept(")");
+}
+
+/************************************************************************/
+/*                            ParsePrimary()                            */
+/************************************************************************/
+
+bool BatchMathExpression::Impl::ParsePrimary()
+{
+    SkipSpaces();
+    if (Accept("("))
+    {
+        return ParseTernary() && Accept(")");
+    }
+
+    if (isdigit(static_cast<unsigned char>(*m_pszCur)) || *m_pszCur == '.')
+    {
+        const char *pszStart = m_pszCur;
+        while (isdigit(static_cast<unsigned char>(*m_pszCur)) ||
+               *m_pszCur == '.')
+            ++m_pszCur;
+        if ((*m_pszCur == 'e' || *m_pszCur == 'E'))
+        {
+            const char *pszExp = m_pszCur + 1;
+            if (*pszExp == '+' || *pszExp == '-')
+                ++pszExp;
+            if (isdigit(static_cast<unsigned char>(*pszExp)))
+            {
+                m_pszCur = pszExp;
+                while (isdigit(static_cast<unsigned char>(*m_pszCur)))
+                    ++m_pszCur;
+            }
+        }
+        const std::string osNumber(pszStart, m_pszCur - pszStart);
+        char *pszEnd = nullptr;
+        const double dfValue = CPLStrtod(osNumber.c_str(), &pszEnd);
+        if (pszEnd != osNumber.c_str() + osNumber.size())
+            return false;
+        Emit(BatchOp::PUSH_CONST, 0, dfValue);
+        return true;
+    }
+
+    std::string osName;
+    if (!ParseIdentifier(osName))
+        return false;
+
+    SkipSpaces();
+    if (*m_pszCur == '(')
+    {
+        int nArgs = 0;
+        if (!ParseFunctionArguments(nArgs))
+            return false;
+        for (const auto &sFunc : asUnaryFunctions)
+        {
+            if (osName == sFunc.pszName)
+            {
+                if (nArgs != 1)
+                    return false;
+                if (sFunc.eOp == BatchOp::ISNODATA)
+                {
+                    // As in muparser, isnodata() is always false if there
+                    // is no nodata value.
+                    const auto oIter = m_oMapConstants.find("NODATA");
+                    if (oIter == m_oMapConstants.end())
+                        Emit(BatchOp::ISNODATA, 0);
+                    else
+                        Emit(BatchOp::ISNODATA, 1, oIter->second);
+                    return true;
+                }
+                Emit(sFunc.eOp);
+                return true;
+            }
+        }
+        if (osName == "fmod")
+        {
+            if (nArgs != 2)
+                return false;
+            Emit(BatchOp::FMOD);
+            Pop(1);
+            return true;
+        }
+        BatchOp eOp;
+        if (osName == "min")
+            eOp = BatchOp::MIN;
+        else if (osName == "max")
+            eOp = BatchOp::MAX;
+        else if (osName == "sum")
+            eOp = BatchOp::SUM;
+        else if (osName == "avg")
+            eOp = BatchOp::AVG;
+        else
+            return false;
+        if (nArgs == 0)
+            return false;
+        Emit(eOp, nArgs);
+        Pop(nArgs - 1);
+        return true;
+    }
+
+    if (const auto oIter = m_oMapVariables.find(osName);
+        oIter != m_oMapVariables.end())
+    {
+        Emit(BatchOp::PUSH_INPUT, oIter->second);
+        return true;
+    }
+    if (const auto oIter = m_oMapConstants.find(osName);
+        oIter != m_oMapConstants.end())
+    {
+        Emit(BatchOp::PUSH_CONST, 0, oIter->second);
+        return true;
+    }
+    if (osName == "_pi")
+    {
+        Emit(BatchOp::PUSH_CONST, 0, M_PI);
+        return true;
+    }
+    if (osName == "_e")
+    {
+        Emit(BatchOp::PUSH_CONST, 0, M_E);
+        return true;
+    }
+    if (osName == "nan" || osName == "NaN")
+    {
+        Emit(BatchOp::PUSH_CONST, 0, std::numeric_limits<double>::quiet_NaN());
+        return true;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                           ApplyUnary()                               */
+/************************************************************************/
+
+template <class F>
+static void ApplyUnary(BatchSlot &oSlot, double *padfOut, size_t nCount, F f)
+{
+    if (oSlot.bConst)
+    {
+        oSlot.dfConst = f(oSlot.dfConst);
+        return;
+    }
+    const double *padf = oSlot.padf;
+    for (size_t i = 0; i < nCount; ++i)
+        padfOut[i] = f(padf[i]);
+    oSlot.padf = padfOut;
+}
+
+/************************************************************************/
+/*                           ApplyBinary()                              */
+/************************************************************************/
+
+template <class F>
+static void ApplyBinary(BatchSlot &oA, const BatchSlot &oB, double *padfOut,
+                        size_t nCount, F f)
+{
+    if (oA.bConst && oB.bConst)
+    {
+        oA.dfConst = f(oA.dfConst, oB.dfConst);
+        return;
+    }
+    if (oA.bConst)
+    {
+        const double dfA = oA.dfConst;
+        const double *padfB = oB.padf;
+        for (size_t i = 0; i < nCount; ++i)
+            padfOut[i] = f(dfA, padfB[i]);
+    }
+    else if (oB.bConst)
+    {
+        const double *padfA = oA.padf;
+        const double dfB = oB.dfConst;
+        for (size_t i = 0; i < nCount; ++i)
+            padfOut[i] = f(padfA[i], dfB);
+    }
+    else
+    {
+        const double *padfA = oA.padf;
+        const double *padfB = oB.padf;
+        for (size_t i = 0; i < nCount; ++i)
+            padfOut[i] = f(padfA[i], padfB[i]);
+    }
+    oA.bConst = false;
+    oA.padf = padfOut;
+}
+
+/************************************************************************/
+/*                              Evaluate()                              */
+/************************************************************************/
+
+void BatchMathExpression::Impl::Evaluate(const double *const *papadfInputs,
+                                         size_t nCount,
+                                         double *padfResults) const
+{
+    std::vector<BatchSlot> aoStack(m_nMaxStackDepth);
+    std::vector<double> adfBuffers(m_nMaxStackDepth * CHUNK_SIZE);
+
+    for (size_t iStart = 0; iStart < nCount; iStart += CHUNK_SIZE)
+    {
+        const size_t n = std::min(CHUNK_SIZE, nCount - iStart);
+        int iTop = -1;
+        for (const auto &oInstr : m_aoCode)
+        {
+            switch (oInstr.eOp)
+            {
+                case BatchOp::PUSH_INPUT:
+                {
+                    auto &oSlot = aoStack[++iTop];
+                    oSlot.bConst = false;
+                    oSlot.padf = papadfInputs[oInstr.nArg] + iStart;
+                    continue;
+                }
+                case BatchOp::PUSH_CONST:
+                {
+                    auto &oSlot = aoStack[++iTop];
+                    oSlot.bConst = true;
+                    oSlot.dfConst = oInstr.dfValue;
+                    continue;
+                }
+                default:
+                    break;
+            }
+
+            // Results are written in the buffer owned by the slot where
+            // they are stored. Operands of lower slots may point to it only
+            // if they have been computed in place, which is safe.
+            double *padfOut = adfBuffers.data() + iTop * CHUNK_SIZE;
+            auto &oTop = aoStack[iTop];
+
+            switch (oInstr.eOp)
+            {
+                case BatchOp::PUSH_INPUT:
+                case BatchOp::PUSH_CONST:
+                    break;
+
+                case BatchOp::NEG:
+                    ApplyUnary(oTop, padfOut, n, [](double x) { return -x; });
+                    break;
+
+#define BINARY_OP(eOp, expr)                                                   \
+    case BatchOp::eOp:                                                         \
+    {                                                                          \
+        --iTop;                                                                \
+        ApplyBinary(aoStack[iTop], aoStack[iTop + 1],                          \
+                    adfBuffers.data() + iTop * CHUNK_SIZE, n,                  \
+                    [](double a, double b) { return expr; });                  \
+        break;                                                                 \
+    }
+
+                    BINARY_OP(ADD, a + b)
+                    BINARY_OP(SUB, a - b)
+                    BINARY_OP(MUL, a * b)
+                    BINARY_OP(DIV, a / b)
+                    BINARY_OP(POW, std::pow(a, b))
+                    BINARY_OP(LT, a < b ? 1.0 : 0.0)
+                    BINARY_OP(GT, a > b ? 1.0 : 0.0)
+                    BINARY_OP(LE, a <= b ? 1.0 : 0.0)
+                    BINARY_OP(GE, a >= b ? 1.0 : 0.0)
+                    BINARY_OP(EQ, a == b ? 1.0 : 0.0)
+                    BINARY_OP(NE, a != b ? 1.0 : 0.0)
+                    BINARY_OP(AND, a != 0 && b != 0 ? 1.0 : 0.0)
+                    BINARY_OP(OR, a != 0 || b != 0 ? 1.0 : 0.0)
+                    BINARY_OP(FMOD, std::fmod(a, b))
+
+#undef BINARY_OP
+
+                case BatchOp::SELECT:
+                {
+                    iTop -= 2;
+                    const BatchSlot &oCond = aoStack[iTop];
+                    const BatchSlot &oThen = aoStack[iTop + 1];
+                    const BatchSlot &oElse = aoStack[iTop + 2];
+                    double *padfSelect = adfBuffers.data() + iTop * CHUNK_SIZE;
+                    // As in muparser, NaN is considered as true.
+                    for (size_t i = 0; i < n; ++i)
+                    {
+                        padfSelect[i] =
+                            oCond.Get(i) != 0 ? oThen.Get(i) : oElse.Get(i);
+                    }
+                    aoStack[iTop].bConst = false;
+                    aoStack[iTop].padf = padfSelect;
+                    break;
+                }
+
+                case BatchOp::MIN:
+                case BatchOp::MAX:
+                case BatchOp::SUM:
+                case BatchOp::AVG:
+                {
+                    const int nArgs = oInstr.nArg;
+                    iTop -= nArgs - 1;
+                    const BatchSlot *poArgs = aoStack.data() + iTop;
+                    double *padfAgg = adfBuffers.data() + iTop * CHUNK_SIZE;
+                    // Same evaluation order as the muparser implementation.
+                    for (size_t i = 0; i < n; ++i)
+                    {
+                        double dfRes;
+                        if (oInstr.eOp == BatchOp::MIN ||
+                            oInstr.eOp == BatchOp::MAX)
+                        {
+                            dfRes = poArgs[0].Get(i);
+                            for (int j = 0; j < nArgs; ++j)
+                            {
+                                const double dfVal = poArgs[j].Get(i);
+                                if (oInstr.eOp == BatchOp::MIN)
+                                    dfRes = std::min(dfRes, dfVal);
+                                else
+                                    dfRes = std::max(dfRes, dfVal);
+                            }
+                        }
+                        else
+                        {
+                            dfRes = 0;
+                            for (int j = 0; j < nArgs; ++j)
+                                dfRes += poArgs[j].Get(i);
+                            if (oInstr.eOp == BatchOp::AVG)
+                                dfRes /= nArgs;
+                        }
+                        padfAgg[i] = dfRes;
+                    }
+                    aoStack[iTop].bConst = false;
+                    aoStack[iTop].padf = padfAgg;
+                    break;
+                }
+
+                case BatchOp::ISNODATA:
+                {
+                    const double dfNoData = oInstr.dfValue;
+                    if (oInstr.nArg == 0)
+                    {
+                        ApplyUnary(oTop, padfOut, n,
+                                   [](double) { return 0.0; });
+                    }
+                    else if (std::isnan(dfNoData))
+                    {
+                        ApplyUnary(oTop, padfOut, n, [](double x)
+                                   { return std::isnan(x) ? 1.0 : 0.0; });
+                    }
+                    else
+                    {
+                        ApplyUnary(oTop, padfOut, n, [dfNoData](double x)
+                                   { return x == dfNoData ? 1.0 : 0.0; });
+                    }
+                    break;
+                }
+
+#define UNARY_FUNC(eOp, expr)                                                  \
+    case BatchOp::eOp:                                                         \
+        ApplyUnary(oTop, padfOut, n, [](double x) { return expr; });           \
+        break;
+
+                    UNARY_FUNC(SIN, std::sin(x))
+                    UNARY_FUNC(COS, std::cos(x))
+                    UNARY_FUNC(TAN, std::tan(x))
+                    UNARY_FUNC(ASIN, std::asin(x))
+                    UNARY_FUNC(ACOS, std::acos(x))
+                    UNARY_FUNC(ATAN, std::atan(x))
+                    UNARY_FUNC(SINH, std::sinh(x))
+                    UNARY_FUNC(COSH, std::cosh(x))
+                    UNARY_FUNC(TANH, std::tanh(x))
+                    UNARY_FUNC(ASINH, std::asinh(x))
+                    UNARY_FUNC(ACOSH, std::acosh(x))
+                    UNARY_FUNC(ATANH, std::atanh(x))
+                    UNARY_FUNC(LOG10, std::log10(x))
+                    UNARY_FUNC(LN, std::log(x))
+                    UNARY_FUNC(EXP, std::exp(x))
+                    UNARY_FUNC(SQRT, std::sqrt(x))
+                    UNARY_FUNC(SIGN, x < 0 ? -1.0 : x > 0 ? 1.0 : 0.0)
+                    UNARY_FUNC(ABS, x >= 0 ? x : -x)
+                    UNARY_FUNC(ISNAN, std::isnan(x) ? 1.0 : 0.0)
+
+#undef UNARY_FUNC
+            }
+        }
+
+        CPLAssert(iTop == 0);
+        const BatchSlot &oResult = aoStack[0];
+        if (oResult.bConst)
+            std::fill_n(padfResults + iStart, n, oResult.dfConst);
+        else
+            std::copy_n(oResult.padf, n, padfResults + iStart);
+    }
+}
+
+/************************************************************************/
+/*                        BatchMathExpression                           */
+/************************************************************************/
+
+BatchMathExpression::BatchMathExpression(std::string_view osExpression)
+    : m_pImpl(std::make_unique<Impl>(osExpression))
+{
+}
+
+BatchMathExpression::~BatchMathExpression() = default;
+
+void BatchMathExpression::RegisterVariable(std::string_view osVariable,
+                                           int iInput)
+{
+    m_pImpl->m_oMapVariables[std::string(osVariable)] = iInput;
+}
+
+void BatchMathExpression::RegisterVector(std::string_view osVariable,
+                                         const std::vector<int> &anInputs)
+{
+    m_pImpl->m_oMapVectors[std::string(osVariable)] = anInputs;
+}
+
+void BatchMathExpression::RegisterConstant(std::string_view osVariable,
+                                           double dfValue)
+{
+    m_pImpl->m_oMapConstants[std::string(osVariable)] = dfValue;
+}
+
+/** Compile the expression.
+ *
+ * @return false if the expression uses a construct that is not supported.
+ */
+bool BatchMathExpression::Compile()
+{
+    return m_pImpl->Compile();
+}
+
+/** Evaluate the expression on nCount values.
+ *
+ * @param papadfInputs Array of pointers to nCount values, for each input
+ *                     referenced by RegisterVariable() or RegisterVector().
+ * @param nCount Number of values.
+ * @param padfResults Array of nCount values receiving the results.
+ */
+void BatchMathExpression::Evaluate(const double *const *papadfInputs,
+                                   size_t nCount, double *padfResults) const
+{
+    m_pImpl->Evaluate(papadfInputs, nCount, padfResults);
+}
+
+/*! @endcond Doxygen_Suppress */
+
+}  // namespace gdal
@@ -23,9 +23,12 @@
 #include <cstdlib>
 #include <cstring>
 #include <limits>
+#include <map>
 #include <mutex>
 #include <set>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -374,6 +377,46 @@ bool VRTSourcedRasterBand::CanMultiThreadRasterIO(
     return bRet;
 }
 
+/************************************************************************/
+/*                    CanTiledMultiThreadRasterIO()                     */
+/************************************************************************/
+
+/** Returns whether IRasterIO() can be split into tiles processed by worker
+ * threads, each of them compositing all the sources intersecting its tile.
+ *
+ * Contrary to CanMultiThreadRasterIO(), sources may overlap and may reference
+ * the same dataset, since accesses to a given source dataset are serialized.
+ * This is only worth it if at least 2 different datasets contribute to the
+ * window.
+ */
+bool VRTSourcedRasterBand::CanTiledMultiThreadRasterIO(
+    double dfXOff, double dfYOff, double dfXSize, double dfYSize,
+    int &nContributingDatasets) const
+{
+    nContributingDatasets = 0;
+    if (!CPLTestBool(
+            CPLGetConfigOption("GDAL_VRT_TILED_MULTITHREADING", "YES")))
+    {
+        return false;
+    }
+
+    std::set<std::string> oSetDSName;
+    for (const auto &poSource : m_papoSources)
+    {
+        if (!poSource->IsSimpleSource())
+            return false;
+        const auto poSimpleSource =
+            cpl::down_cast<VRTSimpleSource *>(poSource.get());
+        if (poSimpleSource->DstWindowIntersects(dfXOff, dfYOff, dfXSize,
+                                                dfYSize))
+        {
+            oSetDSName.insert(poSimpleSource->GetSourceDatasetName());
+        }
+    }
+    nContributingDatasets = static_cast<int>(oSetDSName.size());
+    return true;
+}
+
 /************************************************************************/
 /*                 VRTSourcedRasterBandRasterIOJob                      */
 /************************************************************************/
@@ -450,6 +493,100 @@ void VRTSourcedRasterBandRasterIOJob::Func(void *pData)
     ++(*psJob->pnCompletedJobs);
 }
 
+/************************************************************************/
+/*               VRTSourcedRasterBandTiledRasterIOJob                   */
+/************************************************************************/
+
+/** Structure used to declare a threaded job to satisfy IRasterIO()
+ * on a given tile of the output window, by compositing in order all the
+ * sources that intersect it.
+ */
+struct VRTSourcedRasterBandTiledRasterIOJob
+{
+    std::atomic<int> *pnCompletedJobs = nullptr;
+    std::atomic<bool> *pbSuccess = nullptr;
+    VRTDataset::QueueWorkingStates *poQueueWorkingStates = nullptr;
+    CPLErrorAccumulator *poErrorAccumulator = nullptr;
+
+    // Contributing sources, in order, with the mutex protecting their dataset
+    const std::vector<std::pair<VRTSimpleSource *, std::mutex *>> *
+        paoSources = nullptr;
+
+    GDALDataType eVRTBandDataType = GDT_Unknown;
+    int nXOff = 0;
+    int nYOff = 0;
+    int nXSize = 0;
+    int nYSize = 0;
+    void *pData = nullptr;  // points to the top-left pixel of the tile
+    GDALDataType eBufType = GDT_Unknown;
+    GSpacing nPixelSpace = 0;
+    GSpacing nLineSpace = 0;
+    GDALRasterIOExtraArg *psExtraArg = nullptr;
+
+    static void Func(void *pData);
+};
+
+/************************************************************************/
+/*              VRTSourcedRasterBandTiledRasterIOJob::Func()            */
+/************************************************************************/
+
+void VRTSourcedRasterBandTiledRasterIOJob::Func(void *pData)
+{
+    auto psJob = std::unique_ptr<VRTSourcedRasterBandTiledRasterIOJob>(
+        static_cast<VRTSourcedRasterBandTiledRasterIOJob *>(pData));
+    if (*psJob->pbSuccess)
+    {
+        GDALRasterIOExtraArg sArg = *(psJob->psExtraArg);
+        sArg.pfnProgress = nullptr;
+        sArg.pProgressData = nullptr;
+        sArg.bFloatingPointWindowValidity = FALSE;
+
+        std::unique_ptr<VRTSource::WorkingState> poWorkingState;
+        {
+            std::lock_guard oLock(psJob->poQueueWorkingStates->oMutex);
+            poWorkingState =
+                std::move(psJob->poQueueWorkingStates->oStates.back());
+            psJob->poQueueWorkingStates->oStates.pop_back();
+            CPLAssert(poWorkingState.get());
+        }
+
+        auto oAccumulator = psJob->poErrorAccumulator->InstallForCurrentScope();
+        CPL_IGNORE_RET_VAL(oAccumulator);
+
+        for (const auto &[poSource, poMutex] : *(psJob->paoSources))
+        {
+            if (!*psJob->pbSuccess)
+                break;
+            if (!poSource->DstWindowIntersects(psJob->nXOff, psJob->nYOff,
+                                               psJob->nXSize, psJob->nYSize))
+            {
+                continue;
+            }
+
+            // A source dataset is not safe to be used by several threads
+            // at the same time.
+            std::lock_guard oLock(*poMutex);
+            if (poSource->RasterIO(
+                    psJob->eVRTBandDataType, psJob->nXOff, psJob->nYOff,
+                    psJob->nXSize, psJob->nYSize, psJob->pData, psJob->nXSize,
+                    psJob->nYSize, psJob->eBufType, psJob->nPixelSpace,
+                    psJob->nLineSpace, &sArg,
+                    *(poWorkingState.get())) != CE_None)
+            {
+                *psJob->pbSuccess = false;
+            }
+        }
+
+        {
+            std::lock_guard oLock(psJob->poQueueWorkingStates->oMutex);
+            psJob->poQueueWorkingStates->oStates.push_back(
+                std::move(poWorkingState));
+        }
+    }
+
+    ++(*psJob->pnCompletedJobs);
+}
+
 /************************************************************************/
 /*                             IRasterIO()                              */
 /************************************************************************/
@@ -635,6 +772,23 @@ CPLErr VRTSourcedRasterBand::IRasterIO(
     if (l_poDS)
         l_poDS->m_bMultiThreadedRasterIOLastUsed = false;
 
+    // Make sure there is one working state per worker thread
+    const auto InitQueueWorkingStates = [l_poDS](int nThreads)
+    {
+        std::lock_guard oLock(l_poDS->m_oQueueWorkingStates.oMutex);
+        if (l_poDS->m_oQueueWorkingStates.oStates.size() <
+            static_cast<size_t>(nThreads))
+        {
+            l_poDS->m_oQueueWorkingStates.oStates.resize(nThreads);
+        }
+        for (int i = 0; i < nThreads; ++i)
+        {
+            if (!l_poDS->m_oQueueWorkingStates.oStates[i])
+                l_poDS->m_oQueueWorkingStates.oStates[i] =
+                    std::make_unique<VRTSource::WorkingState>();
+        }
+    };
+
     int nContributingSources = 0;
     int nMaxThreads = 0;
     constexpr int MINIMUM_PIXEL_COUNT_FOR_THREADED_IO = 1000 * 1000;
@@ -663,20 +817,7 @@ CPLErr VRTSourcedRasterBand::IRasterIO(
                      "Using %d threads",
                      nThreads);
 
-        {
-            std::lock_guard oLock(l_poDS->m_oQueueWorkingStates.oMutex);
-            if (l_poDS->m_oQueueWorkingStates.oStates.size() <
-                static_cast<size_t>(nThreads))
-            {
-                l_poDS->m_oQueueWorkingStates.oStates.resize(nThreads);
-            }
-            for (int i = 0; i < nThreads; ++i)
-            {
-                if (!l_poDS->m_oQueueWorkingStates.oStates[i])
-                    l_poDS->m_oQueueWorkingStates.oStates[i] =
-                        std::make_unique<VRTSource::WorkingState>();
-            }
-        }
+        InitQueueWorkingStates(nThreads);
 
         auto oQueue = psThreadPool->CreateJobQueue();
         std::atomic<int> nCompletedJobs = 0;
@@ -733,6 +874,116 @@ CPLErr VRTSourcedRasterBand::IRasterIO(
         errorAccumulator.ReplayErrors();
         eErr = bSuccess ? CE_None : CE_Failure;
     }
+    else if (l_poDS && nBufXSize == nXSize && nBufYSize == nYSize &&
+             dfXOff == nXOff && dfYOff == nYOff && dfXSize == nXSize &&
+             dfYSize == nYSize &&
+             static_cast<int64_t>(nXSize) * nYSize >=
+                 MINIMUM_PIXEL_COUNT_FOR_THREADED_IO &&
+             CanTiledMultiThreadRasterIO(dfXOff, dfYOff, dfXSize, dfYSize,
+                                         nContributingSources) &&
+             nContributingSources > 1 &&
+             (nMaxThreads = VRTDataset::GetNumThreads(l_poDS)) > 1)
+    {
+        // Overlapping sources: split the request into tiles, and composite
+        // all the sources intersecting a tile, in order, in a worker thread.
+        l_poDS->m_bMultiThreadedRasterIOLastUsed = true;
+        l_poDS->m_oMapSharedSources.InitMutex();
+
+        // Tiles must be small enough to keep all threads busy, but large
+        // enough to amortize the per-source overhead.
+        const auto GetTileCount = [nXSize, nYSize](int nSize)
+        {
+            return static_cast<int64_t>(DIV_ROUND_UP(nXSize, nSize)) *
+                   DIV_ROUND_UP(nYSize, nSize);
+        };
+        constexpr int MIN_TILE_SIZE = 256;
+        int nTileSize = 1024;
+        while (nTileSize > MIN_TILE_SIZE &&
+               GetTileCount(nTileSize) < 4 * static_cast<int64_t>(nMaxThreads))
+        {
+            nTileSize /= 2;
+        }
+        const int64_t nTileCount = GetTileCount(nTileSize);
+
+        // Accesses to a given source dataset are serialized
+        std::map<std::string, std::mutex> oMapMutexes;
+        std::vector<std::pair<VRTSimpleSource *, std::mutex *>> aoSources;
+        for (auto &poSource : m_papoSources)
+        {
+            auto poSimpleSource =
+                cpl::down_cast<VRTSimpleSource *>(poSource.get());
+            if (poSimpleSource->DstWindowIntersects(dfXOff, dfYOff, dfXSize,
+                                                    dfYSize))
+            {
+                aoSources.emplace_back(
+                    poSimpleSource,
+                    &oMapMutexes[poSimpleSource->GetSourceDatasetName()]);
+            }
+        }
+
+        CPLErrorAccumulator errorAccumulator;
+        std::atomic<bool> bSuccess = true;
+        CPLWorkerThreadPool *psThreadPool = GDALGetGlobalThreadPool(
+            static_cast<int>(std::min<int64_t>(nTileCount, nMaxThreads)));
+        const int nThreads = static_cast<int>(
+            std::min<int64_t>(nTileCount, psThreadPool->GetThreadCount()));
+        CPLDebugOnly("VRT",
+                     "IRasterIO(): use tiled multi-threaded code path for "
+                     "mosaic with overlapping sources. "
+                     "Using %d threads and %dx%d tiles",
+                     nThreads, nTileSize, nTileSize);
+
+        InitQueueWorkingStates(nThreads);
+
+        auto oQueue = psThreadPool->CreateJobQueue();
+        std::atomic<int> nCompletedJobs = 0;
+        for (int nTileYOff = 0; bSuccess && nTileYOff < nYSize;
+             nTileYOff += nTileSize)
+        {
+            for (int nTileXOff = 0; nTileXOff < nXSize; nTileXOff += nTileSize)
+            {
+                auto psJob = new VRTSourcedRasterBandTiledRasterIOJob();
+                psJob->pbSuccess = &bSuccess;
+                psJob->pnCompletedJobs = &nCompletedJobs;
+                psJob->poQueueWorkingStates = &(l_poDS->m_oQueueWorkingStates);
+                psJob->poErrorAccumulator = &errorAccumulator;
+                psJob->paoSources = &aoSources;
+                psJob->eVRTBandDataType = eDataType;
+                psJob->nXOff = nXOff + nTileXOff;
+                psJob->nYOff = nYOff + nTileYOff;
+                psJob->nXSize = std::min(nTileSize, nXSize - nTileXOff);
+                psJob->nYSize = std::min(nTileSize, nYSize - nTileYOff);
+                psJob->pData = static_cast<GByte *>(pData) +
+                               nTileYOff * nLineSpace +
+                               nTileXOff * nPixelSpace;
+                psJob->eBufType = eBufType;
+                psJob->nPixelSpace = nPixelSpace;
+                psJob->nLineSpace = nLineSpace;
+                psJob->psExtraArg = psExtraArg;
+
+                if (!oQueue->SubmitJob(
+                        VRTSourcedRasterBandTiledRasterIOJob::Func, psJob))
+                {
+                    delete psJob;
+                    bSuccess = false;
+                    break;
+                }
+            }
+        }
+
+        while (oQueue->WaitEvent())
+        {
+            if (psExtraArg->pfnProgress)
+            {
+                psExtraArg->pfnProgress(
+                    double(nCompletedJobs.load()) / double(nTileCount), "",
+                    psExtraArg->pProgressData);
+            }
+        }
+
+        errorAccumulator.ReplayErrors();
+        eErr = bSuccess ? CE_None : CE_Failure;
+    }
     else
     {
         GDALProgressFunc const pfnProgressGlobal = psExtraArg->pfnProgress;
@@ -2494,6 +2494,100 @@ GIntBig CPL_DLL CPL_STDCALL GDALGetCacheUsed64(void);
 
 int CPL_DLL CPL_STDCALL GDALFlushCacheBlock(void);
 
+/** Eviction priority class of a block cache pool.
+ * @since GDAL 3.13
+ */
+typedef enum
+{
+    /** Blocks are evicted before blocks of any other class */
+    GCPP_BULK = 0,
+    /** Default priority */
+    GCPP_NORMAL = 1,
+    /** Blocks are evicted after blocks of the bulk and normal classes */
+    GCPP_INTERACTIVE = 2,
+    /** Blocks are only evicted when no other block can be */
+    GCPP_PINNED = 3
+} GDALCachePoolPriority;
+
+/** Statistics of a block cache pool, as returned by
+ * GDALGetCachePoolStatistics().
+ * @since GDAL 3.13
+ */
+typedef struct
+{
+    /** Quota in bytes, or 0 if there is none */
+    GIntBig nQuota;
+    /** Memory used by the blocks of the pool, in bytes */
+    GIntBig nUsed;
+    /** Number of blocks in the pool */
+    GIntBig nBlocks;
+    /** Number of requests of blocks that were in the cache */
+    GUIntBig nHits;
+    /** Number of blocks that had to be loaded in the cache */
+    GUIntBig nMisses;
+    /** Number of blocks evicted from the pool */
+    GUIntBig nEvictions;
+} GDALCachePoolStatistics;
+
+int CPL_DLL GDALSetCachePool(const char *pszName, GIntBig nQuota,
+                             GDALCachePoolPriority ePriority,
+                             CSLConstList papszOptions);
+int CPL_DLL GDALGetCachePoolStatistics(const char *pszName,
+                                       GDALCachePoolStatistics *psStats);
+CPLErr CPL_DLL GDALDatasetSetCachePool(GDALDatasetH hDS, const char *pszName);
+const char CPL_DLL *GDALDatasetGetCachePool(GDALDatasetH hDS);
+
+/** Statistics of the block cache, as returned by GDALGetCacheStatistics().
+ * @since GDAL 3.13
+ */
+typedef struct
+{
+    /** Maximum size of the cache, in bytes */
+    GIntBig nMax;
+    /** Memory used by the blocks in the cache, in bytes */
+    GIntBig nUsed;
+    /** Number of blocks in the cache */
+    GIntBig nBlocks;
+    /** Number of requests of blocks that were in the cache */
+    GUIntBig nHits;
+    /** Number of blocks that had to be loaded in the cache */
+    GUIntBig nMisses;
+    /** Number of blocks evicted from the cache */
+    GUIntBig nEvictions;
+    /** Number of dirty blocks written by the cache */
+    GUIntBig nDirtyBlocksFlushed;
+    /** Number of bytes of dirty blocks written by the cache */
+    GUIntBig nDirtyBytesFlushed;
+    /** Number of acquisitions of the global block cache lock */
+    GUIntBig nLockAcquisitions;
+    /** Total time spent acquiring the global block cache lock, in seconds */
+    double dfLockWaitTime;
+} GDALCacheStatistics;
+
+int CPL_DLL GDALGetCacheStatistics(GDALCacheStatistics *psStats);
+void CPL_DLL GDALResetCacheStatistics(void);
+
+/** Block cache statistics of a dataset, as returned by
+ * GDALDatasetGetCacheStatistics().
+ * @since GDAL 3.13
+ */
+typedef struct
+{
+    /** Number of blocks of the dataset in the cache */
+    GIntBig nBlocks;
+    /** Memory used by the blocks of the dataset in the cache, in bytes */
+    GIntBig nUsed;
+    /** Number of requests of blocks that were in the cache */
+    GUIntBig nHits;
+    /** Number of blocks that had to be loaded in the cache */
+    GUIntBig nMisses;
+    /** Number of blocks of the dataset evicted from the cache */
+    GUIntBig nEvictions;
+} GDALDatasetCacheStatistics;
+
+int CPL_DLL GDALDatasetGetCacheStatistics(GDALDatasetH hDS,
+                                          GDALDatasetCacheStatistics *psStats);
+
 /* ==================================================================== */
 /*      GDAL virtual memory                                             */
 /* ==================================================================== */
@@ -18,6 +18,10 @@
 #include "cpl_port.h"
 #include "cpl_error.h"
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+
 typedef struct _CPLCond CPLCond;
 typedef struct _CPLLock CPLLock;
 typedef struct _CPLMutex CPLMutex;
@@ -25,6 +29,22 @@ typedef struct _CPLMutex CPLMutex;
 class GDALRasterBand;
 class GDALRasterBlock;
 
+//! @cond Doxygen_Suppress
+
+/** Block cache counters of a dataset, see GDALDatasetGetCacheStatistics() */
+struct GDALDatasetBlockCacheCounters
+{
+    // Residency, protected by the global block cache lock.
+    GIntBig nBlocks = 0;
+    GIntBig nUsed = 0;
+
+    std::atomic<GUIntBig> nHits{0};
+    std::atomic<GUIntBig> nMisses{0};
+    std::atomic<GUIntBig> nEvictions{0};
+};
+
+//! @endcond
+
 /* ******************************************************************** */
 /*                       GDALAbstractBandBlockCache                     */
 /* ******************************************************************** */
@@ -47,6 +67,11 @@ class GDALAbstractBandBlockCache /* non final */
 
     volatile int m_nDirtyBlocks = 0;
 
+    // Only set when the band may be accessed concurrently by several threads
+    // (see GDALRasterBand::EnableConcurrentBlockAccess()). Serializes cache
+    // misses in GDALRasterBand::GetLockedBlockRef().
+    std::unique_ptr<std::mutex> m_poConcurrentMissMutex{};
+
     CPL_DISALLOW_COPY_ASSIGN(GDALAbstractBandBlockCache)
 
   protected:
@@ -59,7 +84,10 @@ class GDALAbstractBandBlockCache /* non final */
     size_t m_nWriteDirtyBlocksDisabled = 0;
 
     void FreeDanglingBlocks();
+    void FreeDanglingBlocksOnAdopt();
     void UnreferenceBlockBase();
+    bool TakeLockOnStoredBlock(GDALRasterBlock *poBlock, int nXBlockOff,
+                               int nYBlockOff);
 
     void StartDirtyBlockFlushingLog();
     void UpdateDirtyBlockFlushingLog();
@@ -69,10 +97,20 @@ class GDALAbstractBandBlockCache /* non final */
     virtual ~GDALAbstractBandBlockCache();
 
     GDALRasterBlock *CreateBlock(int nXBlockOff, int nYBlockOff);
+    void DiscardBlock(GDALRasterBlock *poBlock);
     void AddBlockToFreeList(GDALRasterBlock *poBlock);
     void IncDirtyBlocks(int nInc);
     void WaitCompletionPendingTasks();
 
+    // Prevent the band from being destroyed until ReleaseKeepAlive() is
+    // called, in the same way as a block that is being evicted.
+    void AddKeepAlive()
+    {
+        UnreferenceBlockBase();
+    }
+
+    void ReleaseKeepAlive();
+
     void EnableDirtyBlockWriting()
     {
         --m_nWriteDirtyBlocksDisabled;
@@ -88,6 +126,17 @@ class GDALAbstractBandBlockCache /* non final */
         return m_nDirtyBlocks > 0;
     }
 
+    void EnableConcurrentAccess()
+    {
+        if (!m_poConcurrentMissMutex)
+            m_poConcurrentMissMutex = std::make_unique<std::mutex>();
+    }
+
+    std::mutex *GetConcurrentMissMutex() const
+    {
+        return m_poConcurrentMissMutex.get();
+    }
+
     virtual bool Init() = 0;
     virtual bool IsInitOK() = 0;
     virtual CPLErr FlushCache() = 0;
@@ -97,12 +146,32 @@ class GDALAbstractBandBlockCache /* non final */
     virtual CPLErr UnreferenceBlock(GDALRasterBlock *poBlock) = 0;
     virtual CPLErr FlushBlock(int nXBlockOff, int nYBlockOff,
                               int bWriteDirtyBlock) = 0;
+
+    // Return the block stored at this position, without locking it.
+    virtual GDALRasterBlock *PeekBlock(int nXBlockOff, int nYBlockOff) = 0;
+
+    // Fill the data of a newly created block from a copy kept by the
+    // cache when it was evicted. Returns false if there is no such copy.
+    virtual bool RestoreSpilledBlock(GDALRasterBlock * /* poBlock */)
+    {
+        return false;
+    }
+
+    // Called for a clean block evicted from the global block cache, once
+    // the cache lock has been released, while its data is still available.
+    virtual void SpillEvictedBlock(GDALRasterBlock * /* poBlock */)
+    {
+    }
 };
 
 GDALAbstractBandBlockCache *
 GDALArrayBandBlockCacheCreate(GDALRasterBand *poBand);
 GDALAbstractBandBlockCache *
 GDALHashSetBandBlockCacheCreate(GDALRasterBand *poBand);
+GDALAbstractBandBlockCache *
+GDALRadixTableBandBlockCacheCreate(GDALRasterBand *poBand);
+bool GDALRadixTableBandBlockCacheCanBeUsed(int nBlocksPerRow,
+                                           int nBlocksPerColumn);
 
 //! @endcond
 
@@ -47,6 +47,8 @@ class GDALRasterBand;
 class GDALRelationship;
 
 //! @cond Doxygen_Suppress
+struct GDALCachePool;
+struct GDALDatasetBlockCacheCounters;
 typedef struct GDALSQLParseInfo GDALSQLParseInfo;
 //! @endcond
 
@@ -186,6 +188,8 @@ class CPL_DLL GDALDataset : public GDALMajorObject
 
     virtual bool CanBeCloned(int nScopeFlags, bool bCanShareState) const;
 
+    virtual bool CanBeSharedForReading(int nScopeFlags) const;
+
     friend class GDALThreadSafeDataset;
     friend class MEMDataset;
     virtual std::unique_ptr<GDALDataset> Clone(int nScopeFlags,
@@ -206,6 +210,7 @@ class CPL_DLL GDALDataset : public GDALMajorObject
     // The below methods related to read write mutex are fragile logic, and
     // should not be used by out-of-tree code if possible.
     int EnterReadWrite(GDALRWFlag eRWFlag);
+    bool TryEnterReadWrite(int &bCallLeaveReadWrite);
     void LeaveReadWrite();
     void InitRWLock();
 
@@ -471,6 +476,16 @@ class CPL_DLL GDALDataset : public GDALMajorObject
         return bSuppressOnClose;
     }
 
+    CPLErr SetCachePool(const char *pszName);
+    const char *GetCachePool() const;
+
+    bool GetCacheStatistics(GDALDatasetCacheStatistics *psStats) const;
+
+    //! @cond Doxygen_Suppress
+    CPL_INTERNAL GDALCachePool *GetBlockCachePool() const;
+    CPL_INTERNAL GDALDatasetBlockCacheCounters *GetBlockCacheCounters();
+    //! @endcond
+
     /** Return open options.
      * @return open options.
      */
@@ -106,6 +106,7 @@ class CPL_DLL GDALRasterBand : public GDALMajorObject
   private:
     friend class GDALArrayBandBlockCache;
     friend class GDALHashSetBandBlockCache;
+    friend class GDALRadixTableBandBlockCache;
     friend class GDALRasterBlock;
     friend class GDALDataset;
 
@@ -226,6 +227,7 @@ class CPL_DLL GDALRasterBand : public GDALMajorObject
                       GDALRasterIOExtraArg *psExtraArg) CPL_WARN_UNUSED_RESULT;
 
     int EnterReadWrite(GDALRWFlag eRWFlag);
+    bool TryEnterReadWrite(int &bCallLeaveReadWrite);
     void LeaveReadWrite();
     void InitRWLock();
     void SetValidPercent(GUIntBig nSampleCount, GUIntBig nValidCount);
@@ -274,6 +276,8 @@ class CPL_DLL GDALRasterBand : public GDALMajorObject
 
     int InitBlockInfo();
 
+    bool EnableConcurrentBlockAccess();
+
     void AddBlockToFreeList(GDALRasterBlock *);
 
     bool HasBlockCache() const
@@ -23,7 +23,10 @@
 /*                           GDALRasterBlock                            */
 /* ******************************************************************** */
 
+class GDALDataset;
 class GDALRasterBand;
+struct GDALCachePool;
+struct GDALDatasetBlockCacheCounters;
 
 /** A single raster block in the block cache.
  *
@@ -32,6 +35,9 @@ class GDALRasterBand;
 class CPL_DLL GDALRasterBlock final
 {
     friend class GDALAbstractBandBlockCache;
+    friend class GDALDataset;
+    friend class GDALEvictionCursor;
+    friend struct GDALCachePool;
 
     GDALDataType eType = GDT_Unknown;
 
@@ -53,11 +59,26 @@ class CPL_DLL GDALRasterBlock final
 
     bool bMustDetach = false;
 
+    GDALCachePool *poPool = nullptr;
+    bool bInProbation = false;
+
     CPL_INTERNAL void Detach_unlocked(void);
     CPL_INTERNAL void Touch_unlocked(void);
+    CPL_INTERNAL void Insert_unlocked(GDALCachePool *poPoolIn);
+    CPL_INTERNAL void RecordEviction_unlocked(void);
+
+    CPL_INTERNAL static GDALCachePool *GetCachePool(const char *pszName);
+    CPL_INTERNAL static const char *GetCachePoolName(GDALCachePool *poPool);
+    CPL_INTERNAL static void
+    GetDatasetResidency(const GDALDatasetBlockCacheCounters &oCounters,
+                        GIntBig &nBlocks, GIntBig &nUsed);
 
     CPL_INTERNAL void RecycleFor(int nXOffIn, int nYOffIn);
 
+    CPL_INTERNAL static void WakeUpWriteBehindThread(GIntBig nTargetDirty);
+    CPL_INTERNAL static bool WriteBehindDirtyBlocks(GIntBig nTargetDirty);
+    CPL_INTERNAL static void StopWriteBehindThread();
+
   public:
     GDALRasterBlock(GDALRasterBand *, int, int);
     GDALRasterBlock(int nXOffIn, int nYOffIn); /* only for lookup purpose */
@@ -16,6 +16,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <new>
+#include <thread>
 
 #include "cpl_atomic_ops.h"
 #include "cpl_error.h"
@@ -97,6 +98,15 @@ void GDALAbstractBandBlockCache::AddBlockToFreeList(GDALRasterBlock *poBlock)
         psListBlocksToFree = poBlock;
     }
 
+    ReleaseKeepAlive();
+}
+
+/************************************************************************/
+/*                          ReleaseKeepAlive()                          */
+/************************************************************************/
+
+void GDALAbstractBandBlockCache::ReleaseKeepAlive()
+{
     // If no more blocks in transient state, then warn
     // WaitCompletionPendingTasks()
     CPLAcquireMutex(hCondMutex, 1000);
@@ -154,6 +164,57 @@ void GDALAbstractBandBlockCache::FreeDanglingBlocks()
     }
 }
 
+/************************************************************************/
+/*                      FreeDanglingBlocksOnAdopt()                     */
+/*                                                                      */
+/*      In concurrent access mode, other threads may still hold stale   */
+/*      pointers to blocks of the free list, got from                   */
+/*      TryGetLockedBlockRef() before they were evicted. So they are    */
+/*      only recycled by CreateBlock(), and freed by FlushCache().      */
+/************************************************************************/
+
+void GDALAbstractBandBlockCache::FreeDanglingBlocksOnAdopt()
+{
+    if (!m_poConcurrentMissMutex)
+        FreeDanglingBlocks();
+}
+
+/************************************************************************/
+/*                        TakeLockOnStoredBlock()                       */
+/************************************************************************/
+
+bool GDALAbstractBandBlockCache::TakeLockOnStoredBlock(GDALRasterBlock *poBlock,
+                                                       int nXBlockOff,
+                                                       int nYBlockOff)
+{
+    if (!m_poConcurrentMissMutex)
+        return poBlock->TakeLock() != FALSE;
+
+    // In concurrent access mode, poBlock may have been evicted by another
+    // thread since it was read from the storage, and even recycled by
+    // CreateBlock() for another cache miss. So never change the lock count
+    // of a block that is being evicted or in the free list (as that would
+    // race with RecycleFor()), and once locked, check that the block is
+    // still the one stored at that position, that is it has been fully read.
+    while (true)
+    {
+        const int nLockVal = poBlock->nLockCount;
+        if (nLockVal < 0)
+            return false;
+        if (CPLAtomicCompareAndExchange(&(poBlock->nLockCount), nLockVal,
+                                        nLockVal + 1))
+            break;
+    }
+    if (PeekBlock(nXBlockOff, nYBlockOff) != poBlock ||
+        poBlock->GetXOff() != nXBlockOff || poBlock->GetYOff() != nYBlockOff)
+    {
+        poBlock->DropLock();
+        return false;
+    }
+    poBlock->Touch();
+    return true;
+}
+
 /************************************************************************/
 /*                            CreateBlock()                             */
 /************************************************************************/
@@ -184,6 +245,36 @@ GDALRasterBlock *GDALAbstractBandBlockCache::CreateBlock(int nXBlockOff,
     return poBlock;
 }
 
+/************************************************************************/
+/*                            DiscardBlock()                            */
+/*                                                                      */
+/*      Release the lock on a block returned by CreateBlock() that      */
+/*      could not be read or adopted, and destroy it.                   */
+/************************************************************************/
+
+void GDALAbstractBandBlockCache::DiscardBlock(GDALRasterBlock *poBlock)
+{
+    if (!m_poConcurrentMissMutex)
+    {
+        poBlock->DropLock();
+        delete poBlock;
+        return;
+    }
+
+    // In concurrent access mode, a recycled block may still be referenced
+    // by threads that got it before its eviction: they only keep a lock for
+    // a short time, and then the block must go back to the free list.
+    // Our own lock is kept until the block is marked as evicted, so that
+    // Internalize() cannot evict it meanwhile.
+    while (!CPLAtomicCompareAndExchange(&(poBlock->nLockCount), 1, -1))
+        std::this_thread::yield();
+    poBlock->Detach();
+    VSIFreeAligned(poBlock->pData);
+    poBlock->pData = nullptr;
+    UnreferenceBlockBase();
+    AddBlockToFreeList(poBlock);
+}
+
 /************************************************************************/
 /*                         IncDirtyBlocks()                             */
 /************************************************************************/
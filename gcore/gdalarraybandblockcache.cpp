@@ -14,6 +14,7 @@
 #include "cpl_port.h"
 #include "gdal_priv.h"
 
+#include <atomic>
 #include <cassert>
 #include <climits>
 #include <cstddef>
@@ -32,6 +33,12 @@ constexpr int SUBBLOCK_SIZE = 64;
 #define TO_SUBBLOCK(x) ((x) >> 6)
 #define WITHIN_SUBBLOCK(x) ((x)&0x3f)
 
+// Slots are atomic since they are read without lock by
+// TryGetLockedBlockRef() when the band is accessed concurrently.
+typedef std::atomic<GDALRasterBlock *> GDALRasterBlockSlot;
+static_assert(sizeof(GDALRasterBlockSlot) == sizeof(GDALRasterBlock *),
+              "sizeof(GDALRasterBlockSlot) == sizeof(GDALRasterBlock *)");
+
 /* ******************************************************************** */
 /*                        GDALArrayBandBlockCache                       */
 /* ******************************************************************** */
@@ -44,8 +51,8 @@ class GDALArrayBandBlockCache final : public GDALAbstractBandBlockCache
 
     union u
     {
-        GDALRasterBlock **papoBlocks;
-        GDALRasterBlock ***papapoBlocks;
+        GDALRasterBlockSlot *papoBlocks;
+        std::atomic<GDALRasterBlockSlot *> *papapoBlocks;
 
         u() : papoBlocks(nullptr)
         {
@@ -67,6 +74,7 @@ class GDALArrayBandBlockCache final : public GDALAbstractBandBlockCache
     CPLErr UnreferenceBlock(GDALRasterBlock *poBlock) override;
     CPLErr FlushBlock(int nXBlockOff, int nYBlockOff,
                       int bWriteDirtyBlock) override;
+    GDALRasterBlock *PeekBlock(int nXBlockOff, int nYBlockOff) override;
 };
 
 /************************************************************************/
@@ -114,7 +122,7 @@ bool GDALArrayBandBlockCache::Init()
 
         if (poBand->nBlocksPerRow < INT_MAX / poBand->nBlocksPerColumn)
         {
-            u.papoBlocks = static_cast<GDALRasterBlock **>(VSICalloc(
+            u.papoBlocks = static_cast<GDALRasterBlockSlot *>(VSICalloc(
                 sizeof(void *), cpl::fits_on<int>(poBand->nBlocksPerRow *
                                                   poBand->nBlocksPerColumn)));
             if (u.papoBlocks == nullptr)
@@ -142,7 +150,8 @@ bool GDALArrayBandBlockCache::Init()
 
         if (nSubBlocksPerRow < INT_MAX / nSubBlocksPerColumn)
         {
-            u.papapoBlocks = static_cast<GDALRasterBlock ***>(VSICalloc(
+            u.papapoBlocks =
+                static_cast<std::atomic<GDALRasterBlockSlot *> *>(VSICalloc(
                 sizeof(void *),
                 cpl::fits_on<int>(nSubBlocksPerRow * nSubBlocksPerColumn)));
             if (u.papapoBlocks == nullptr)
@@ -184,7 +193,7 @@ CPLErr GDALArrayBandBlockCache::AdoptBlock(GDALRasterBlock *poBlock)
     const int nXBlockOff = poBlock->GetXOff();
     const int nYBlockOff = poBlock->GetYOff();
 
-    FreeDanglingBlocks();
+    FreeDanglingBlocksOnAdopt();
 
     /* -------------------------------------------------------------------- */
     /*      Simple case without subblocking.                                */
@@ -211,10 +220,10 @@ CPLErr GDALArrayBandBlockCache::AdoptBlock(GDALRasterBlock *poBlock)
         if (u.papapoBlocks[nSubBlock] == nullptr)
         {
             const int nSubGridSize =
-                sizeof(GDALRasterBlock *) * SUBBLOCK_SIZE * SUBBLOCK_SIZE;
+                sizeof(GDALRasterBlockSlot) * SUBBLOCK_SIZE * SUBBLOCK_SIZE;
 
             u.papapoBlocks[nSubBlock] =
-                static_cast<GDALRasterBlock **>(VSICalloc(1, nSubGridSize));
+                static_cast<GDALRasterBlockSlot *>(VSICalloc(1, nSubGridSize));
             if (u.papapoBlocks[nSubBlock] == nullptr)
             {
                 poBand->ReportError(CE_Failure, CPLE_OutOfMemory,
@@ -228,7 +237,7 @@ CPLErr GDALArrayBandBlockCache::AdoptBlock(GDALRasterBlock *poBlock)
         /*      Check within subblock. */
         /* --------------------------------------------------------------------
          */
-        GDALRasterBlock **papoSubBlockGrid = u.papapoBlocks[nSubBlock];
+        GDALRasterBlockSlot *papoSubBlockGrid = u.papapoBlocks[nSubBlock];
 
         const int nBlockInSubBlock =
             WITHIN_SUBBLOCK(nXBlockOff) +
@@ -286,7 +295,8 @@ CPLErr GDALArrayBandBlockCache::FlushCache()
             {
                 const int nSubBlock = iSBX + iSBY * nSubBlocksPerRow;
 
-                GDALRasterBlock **papoSubBlockGrid = u.papapoBlocks[nSubBlock];
+                GDALRasterBlockSlot *papoSubBlockGrid =
+                    u.papapoBlocks[nSubBlock];
 
                 if (papoSubBlockGrid == nullptr)
                     continue;
@@ -356,7 +366,7 @@ CPLErr GDALArrayBandBlockCache::UnreferenceBlock(GDALRasterBlock *poBlock)
         /*      Check within subblock. */
         /* --------------------------------------------------------------------
          */
-        GDALRasterBlock **papoSubBlockGrid = u.papapoBlocks[nSubBlock];
+        GDALRasterBlockSlot *papoSubBlockGrid = u.papapoBlocks[nSubBlock];
         if (papoSubBlockGrid == nullptr)
             return CE_None;
 
@@ -405,7 +415,7 @@ CPLErr GDALArrayBandBlockCache::FlushBlock(int nXBlockOff, int nYBlockOff,
         /*      Check within subblock. */
         /* --------------------------------------------------------------------
          */
-        GDALRasterBlock **papoSubBlockGrid = u.papapoBlocks[nSubBlock];
+        GDALRasterBlockSlot *papoSubBlockGrid = u.papapoBlocks[nSubBlock];
         if (papoSubBlockGrid == nullptr)
             return CE_None;
 
@@ -446,11 +456,11 @@ CPLErr GDALArrayBandBlockCache::FlushBlock(int nXBlockOff, int nYBlockOff,
 }
 
 /************************************************************************/
-/*                        TryGetLockedBlockRef()                        */
+/*                              PeekBlock()                             */
 /************************************************************************/
 
-GDALRasterBlock *GDALArrayBandBlockCache::TryGetLockedBlockRef(int nXBlockOff,
-                                                               int nYBlockOff)
+GDALRasterBlock *GDALArrayBandBlockCache::PeekBlock(int nXBlockOff,
+                                                    int nYBlockOff)
 
 {
     /* -------------------------------------------------------------------- */
@@ -460,10 +470,7 @@ GDALRasterBlock *GDALArrayBandBlockCache::TryGetLockedBlockRef(int nXBlockOff,
     {
         const int nBlockIndex = nXBlockOff + nYBlockOff * poBand->nBlocksPerRow;
 
-        GDALRasterBlock *poBlock = u.papoBlocks[nBlockIndex];
-        if (poBlock == nullptr || !poBlock->TakeLock())
-            return nullptr;
-        return poBlock;
+        return u.papoBlocks[nBlockIndex];
     }
     else
     {
@@ -480,7 +487,7 @@ GDALRasterBlock *GDALArrayBandBlockCache::TryGetLockedBlockRef(int nXBlockOff,
         /*      Check within subblock. */
         /* --------------------------------------------------------------------
          */
-        GDALRasterBlock **papoSubBlockGrid = u.papapoBlocks[nSubBlock];
+        GDALRasterBlockSlot *papoSubBlockGrid = u.papapoBlocks[nSubBlock];
         if (papoSubBlockGrid == nullptr)
             return nullptr;
 
@@ -488,11 +495,23 @@ GDALRasterBlock *GDALArrayBandBlockCache::TryGetLockedBlockRef(int nXBlockOff,
             WITHIN_SUBBLOCK(nXBlockOff) +
             WITHIN_SUBBLOCK(nYBlockOff) * SUBBLOCK_SIZE;
 
-        GDALRasterBlock *poBlock = papoSubBlockGrid[nBlockInSubBlock];
-        if (poBlock == nullptr || !poBlock->TakeLock())
-            return nullptr;
-        return poBlock;
+        return papoSubBlockGrid[nBlockInSubBlock];
     }
 }
 
+/************************************************************************/
+/*                        TryGetLockedBlockRef()                        */
+/************************************************************************/
+
+GDALRasterBlock *GDALArrayBandBlockCache::TryGetLockedBlockRef(int nXBlockOff,
+                                                               int nYBlockOff)
+
+{
+    GDALRasterBlock *poBlock = PeekBlock(nXBlockOff, nYBlockOff);
+    if (poBlock == nullptr ||
+        !TakeLockOnStoredBlock(poBlock, nXBlockOff, nYBlockOff))
+        return nullptr;
+    return poBlock;
+}
+
 //! @endcond
@@ -13,8 +13,10 @@
 #include "gdal_priv.h"
 #include "vrtdataset.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <optional>
 
 /************************************************************************/
 /*                        GDALComputedDataset                           */
@@ -23,9 +25,14 @@
 class GDALComputedDataset final : public GDALDataset
 {
     friend class GDALComputedRasterBand;
+    friend class GDALComputedFusedEvaluator;
 
     const GDALComputedRasterBand::Operation m_op;
     CPLStringList m_aosOptions{};
+    // Constant operands, if any. A constant passed to the constructor taking
+    // a vector of bands is stored as m_oSecondConstant.
+    std::optional<double> m_oFirstConstant{};
+    std::optional<double> m_oSecondConstant{};
     std::vector<std::unique_ptr<GDALDataset, GDALDatasetUniquePtrReleaser>>
         m_bandDS{};
     std::vector<GDALRasterBand *> m_poBands{};
@@ -116,7 +123,8 @@ static bool IsComparisonOperator(GDALComputedRasterBand::Operation op)
 
 GDALComputedDataset::GDALComputedDataset(const GDALComputedDataset &other)
     : GDALDataset(), m_op(other.m_op), m_aosOptions(other.m_aosOptions),
-      m_poBands(other.m_poBands),
+      m_oFirstConstant(other.m_oFirstConstant),
+      m_oSecondConstant(other.m_oSecondConstant), m_poBands(other.m_poBands),
       m_oVRTDS(other.GetRasterXSize(), other.GetRasterYSize(),
                other.m_oVRTDS.GetBlockXSize(), other.m_oVRTDS.GetBlockYSize())
 {
@@ -164,6 +172,10 @@ GDALComputedDataset::GDALComputedDataset(
         m_poBands.push_back(const_cast<GDALRasterBand *>(firstBand));
     if (secondBand)
         m_poBands.push_back(const_cast<GDALRasterBand *>(secondBand));
+    if (pFirstConstant)
+        m_oFirstConstant = *pFirstConstant;
+    if (pSecondConstant)
+        m_oSecondConstant = *pSecondConstant;
 
     nRasterXSize = nXSize;
     nRasterYSize = nYSize;
@@ -317,6 +329,8 @@ GDALComputedDataset::GDALComputedDataset(
 {
     for (const GDALRasterBand *poIterBand : bands)
         m_poBands.push_back(const_cast<GDALRasterBand *>(poIterBand));
+    if (!std::isnan(constant))
+        m_oSecondConstant = constant;
 
     nRasterXSize = nXSize;
     nRasterYSize = nYSize;
@@ -790,6 +804,560 @@ void GDALComputedRasterBandRelease(GDALComputedRasterBandH hBand)
     delete GDALComputedRasterBand::FromHandle(hBand);
 }
 
+/************************************************************************/
+/*                     GDALComputedFusedEvaluator                       */
+/************************************************************************/
+
+/** Evaluates a tree of GDALComputedRasterBand in a single pass.
+ *
+ * The VRT implementation materializes a full-size buffer for each node of
+ * the tree, and reads a band as many times as it appears in the expression.
+ * This evaluator reads each distinct leaf band once, and then applies the
+ * whole operation tree on chunks of pixels small enough to remain in the
+ * CPU cache.
+ *
+ * Only trees without nodata values, and whose leaves have a real data type
+ * that can be represented exactly as a double, are handled: this is the
+ * domain where the semantics of the pixel functions used by the VRT
+ * implementation can be reproduced exactly.
+ */
+class GDALComputedFusedEvaluator
+{
+  public:
+    static std::unique_ptr<GDALComputedFusedEvaluator>
+    Build(GDALComputedRasterBand *poBand);
+
+    CPLErr Evaluate(int nXOff, int nYOff, int nXSize, int nYSize, void *pData,
+                    GDALDataType eBufType, GSpacing nPixelSpace,
+                    GSpacing nLineSpace) const;
+
+  private:
+    //! Number of pixels processed at once by each node.
+    static constexpr int CHUNK_SIZE = 1024;
+
+    //! Maximum size of the buffers in which leaf bands are read.
+    static constexpr size_t MAX_LEAF_BUFFER_SIZE = 64 * 1024 * 1024;
+
+    struct Node
+    {
+        //! Index in m_apoLeaves for a leaf, or -1 for an operation.
+        int iLeaf = -1;
+        GDALComputedRasterBand::Operation eOp =
+            GDALComputedRasterBand::Operation::OP_ADD;
+        //! Indices in m_aoNodes of the operands.
+        std::vector<int> anChildren{};
+        std::optional<double> oFirstConstant{};
+        std::optional<double> oSecondConstant{};
+        //! Data type through which the value of a OP_CAST node goes, or
+        //! GDT_Unknown if that conversion is not lossy.
+        GDALDataType eCastType = GDT_Unknown;
+        //! Data type in which the VRT implementation hands the output of the
+        //! node to its parent. GDT_Float64 means no conversion.
+        GDALDataType eTransferType = GDT_Float64;
+    };
+
+    //! Nodes, operands being before the operations using them. The root
+    //! is the last one.
+    std::vector<Node> m_aoNodes{};
+    std::vector<GDALRasterBand *> m_apoLeaves{};
+
+    int AddBand(GDALRasterBand *poBand, GDALDataType eTransferType);
+
+    static void EvaluateNode(const Node &oNode,
+                             const double *const *papadfOperands,
+                             double *padfOut, size_t nCount, GByte *pabyTmp);
+};
+
+/************************************************************************/
+/*                GDALComputedFusedEvaluator::Build()                   */
+/************************************************************************/
+
+/** Returns an evaluator for poBand, or nullptr if its tree is not supported */
+/* static */ std::unique_ptr<GDALComputedFusedEvaluator>
+GDALComputedFusedEvaluator::Build(GDALComputedRasterBand *poBand)
+{
+    auto poEvaluator = std::make_unique<GDALComputedFusedEvaluator>();
+    if (poEvaluator->AddBand(poBand, GDT_Float64) < 0)
+        return nullptr;
+    return poEvaluator;
+}
+
+/************************************************************************/
+/*               GDALComputedFusedEvaluator::AddBand()                  */
+/************************************************************************/
+
+/** Adds poBand and its operands to m_aoNodes, and returns its index, or -1
+ * if it cannot be handled.
+ */
+int GDALComputedFusedEvaluator::AddBand(GDALRasterBand *poBand,
+                                        GDALDataType eTransferType)
+{
+    int bHasNoData = FALSE;
+    poBand->GetNoDataValue(&bHasNoData);
+    const GDALDataType eDT = poBand->GetRasterDataType();
+    if (bHasNoData || GDALDataTypeIsComplex(eDT) || eDT == GDT_Int64 ||
+        eDT == GDT_UInt64)
+    {
+        return -1;
+    }
+
+    Node oNode;
+    auto poComputedDS =
+        dynamic_cast<GDALComputedDataset *>(poBand->GetDataset());
+    if (!poComputedDS)
+    {
+        // Leaves are read as Float64, which is lossless for the data types
+        // accepted above, and thus equivalent to the VRT implementation
+        // that reads them in the union of the data types of their siblings.
+        const auto oIter =
+            std::find(m_apoLeaves.begin(), m_apoLeaves.end(), poBand);
+        oNode.iLeaf = static_cast<int>(oIter - m_apoLeaves.begin());
+        if (oIter == m_apoLeaves.end())
+            m_apoLeaves.push_back(poBand);
+    }
+    else
+    {
+        using Op = GDALComputedRasterBand::Operation;
+        oNode.eOp = poComputedDS->m_op;
+        oNode.oFirstConstant = poComputedDS->m_oFirstConstant;
+        oNode.oSecondConstant = poComputedDS->m_oSecondConstant;
+        oNode.eTransferType = eTransferType;
+        if (oNode.eOp == Op::OP_MEAN && oNode.oSecondConstant)
+            return -1;
+
+        // VRTDerivedRasterBand reads its sources in the union of their data
+        // types. VRTSimpleSource, used for OP_CAST, only goes through the
+        // target data type if the conversion to it is lossy, and otherwise
+        // directly reads its source in the type requested by its consumer.
+        GDALDataType eOperandTransferType = GDT_Float64;
+        if (oNode.eOp == Op::OP_CAST)
+        {
+            if (GDALDataTypeIsConversionLossy(
+                    poComputedDS->m_poBands[0]->GetRasterDataType(), eDT))
+                oNode.eCastType = eDT;
+            else
+                eOperandTransferType = eTransferType;
+        }
+        else
+        {
+            eOperandTransferType = GDT_Unknown;
+            for (GDALRasterBand *poOperand : poComputedDS->m_poBands)
+            {
+                eOperandTransferType = GDALDataTypeUnion(
+                    eOperandTransferType, poOperand->GetRasterDataType());
+            }
+        }
+
+        for (GDALRasterBand *poOperand : poComputedDS->m_poBands)
+        {
+            const int iOperand = AddBand(poOperand, eOperandTransferType);
+            if (iOperand < 0)
+                return -1;
+            oNode.anChildren.push_back(iOperand);
+        }
+    }
+
+    m_aoNodes.push_back(std::move(oNode));
+    return static_cast<int>(m_aoNodes.size()) - 1;
+}
+
+/************************************************************************/
+/*                    RoundTripThroughDataType()                        */
+/************************************************************************/
+
+static void RoundTripThroughDataType(double *padfValues, size_t nCount,
+                                     GDALDataType eDT, GByte *pabyTmp)
+{
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
+    GDALCopyWords64(padfValues, GDT_Float64, sizeof(double), pabyTmp, eDT,
+                    nDTSize, nCount);
+    GDALCopyWords64(pabyTmp, eDT, nDTSize, padfValues, GDT_Float64,
+                    sizeof(double), nCount);
+}
+
+/************************************************************************/
+/*                       ApplyBinaryOperator()                          */
+/************************************************************************/
+
+template <class F>
+static void ApplyBinaryOperator(const std::optional<double> &oFirstConstant,
+                                const std::optional<double> &oSecondConstant,
+                                const double *const *papadfOperands,
+                                double *padfOut, size_t nCount, F f)
+{
+    const double *padfA = papadfOperands[0];
+    if (oFirstConstant)
+    {
+        const double dfA = *oFirstConstant;
+        for (size_t i = 0; i < nCount; ++i)
+            padfOut[i] = f(dfA, padfA[i]);
+    }
+    else if (oSecondConstant)
+    {
+        const double dfB = *oSecondConstant;
+        for (size_t i = 0; i < nCount; ++i)
+            padfOut[i] = f(padfA[i], dfB);
+    }
+    else
+    {
+        const double *padfB = papadfOperands[1];
+        for (size_t i = 0; i < nCount; ++i)
+            padfOut[i] = f(padfA[i], padfB[i]);
+    }
+}
+
+/************************************************************************/
+/*             GDALComputedFusedEvaluator::EvaluateNode()               */
+/************************************************************************/
+
+/** Computes nCount values of an operation node, following the semantics of
+ * the pixel functions of frmts/vrt/pixelfunctions.cpp in the absence of
+ * nodata.
+ */
+/* static */ void GDALComputedFusedEvaluator::EvaluateNode(
+    const Node &oNode, const double *const *papadfOperands, double *padfOut,
+    size_t nCount, GByte *pabyTmp)
+{
+    using Op = GDALComputedRasterBand::Operation;
+    const size_t nOperands = oNode.anChildren.size();
+    const double *padfA = papadfOperands[0];
+    switch (oNode.eOp)
+    {
+        case Op::OP_ADD:
+        {
+            std::fill_n(padfOut, nCount, oNode.oSecondConstant.value_or(0.0));
+            for (size_t iOperand = 0; iOperand < nOperands; ++iOperand)
+            {
+                const double *padfOperand = papadfOperands[iOperand];
+                for (size_t i = 0; i < nCount; ++i)
+                    padfOut[i] += padfOperand[i];
+            }
+            break;
+        }
+
+        case Op::OP_MULTIPLY:
+        {
+            std::fill_n(padfOut, nCount, oNode.oSecondConstant.value_or(1.0));
+            for (size_t iOperand = 0; iOperand < nOperands; ++iOperand)
+            {
+                const double *padfOperand = papadfOperands[iOperand];
+                for (size_t i = 0; i < nCount; ++i)
+                    padfOut[i] *= padfOperand[i];
+            }
+            break;
+        }
+
+        case Op::OP_SUBTRACT:
+        {
+            ApplyBinaryOperator(oNode.oFirstConstant, oNode.oSecondConstant,
+                                papadfOperands, padfOut, nCount,
+                                [](double a, double b) { return a - b; });
+            break;
+        }
+
+        case Op::OP_DIVIDE:
+        {
+            if (oNode.oSecondConstant)
+            {
+                // Done as a "mul" pixel function with k = 1 / constant
+                const double dfK = 1.0 / *oNode.oSecondConstant;
+                for (size_t i = 0; i < nCount; ++i)
+                    padfOut[i] = dfK * padfA[i];
+            }
+            else
+            {
+                ApplyBinaryOperator(
+                    oNode.oFirstConstant, oNode.oSecondConstant,
+                    papadfOperands, padfOut, nCount,
+                    [](double a, double b)
+                    {
+                        return b == 0 ? std::numeric_limits<double>::infinity()
+                                      : a / b;
+                    });
+            }
+            break;
+        }
+
+        case Op::OP_MIN:
+        case Op::OP_MAX:
+        {
+            const bool bMin = oNode.eOp == Op::OP_MIN;
+            // Written this way to deal with dfRes being NaN
+            const auto IsBetter = [bMin](double x, double dfRes)
+            { return bMin ? !(x >= dfRes) : !(x <= dfRes); };
+            for (size_t i = 0; i < nCount; ++i)
+            {
+                double dfRes = std::numeric_limits<double>::quiet_NaN();
+                bool bHasNaN = false;
+                for (size_t iOperand = 0; iOperand < nOperands; ++iOperand)
+                {
+                    const double dfVal = papadfOperands[iOperand][i];
+                    if (std::isnan(dfVal))
+                    {
+                        bHasNaN = true;
+                        break;
+                    }
+                    if (IsBetter(dfVal, dfRes))
+                        dfRes = dfVal;
+                }
+                if (bHasNaN)
+                    dfRes = std::numeric_limits<double>::quiet_NaN();
+                else if (oNode.oSecondConstant &&
+                         IsBetter(*oNode.oSecondConstant, dfRes))
+                    dfRes = *oNode.oSecondConstant;
+                padfOut[i] = dfRes;
+            }
+            break;
+        }
+
+        case Op::OP_MEAN:
+        {
+            // Same running mean as the MeanKernel of the "mean" pixel
+            // function.
+            for (size_t i = 0; i < nCount; ++i)
+            {
+                double dfMean = 0;
+                for (size_t iOperand = 0; iOperand < nOperands; ++iOperand)
+                {
+                    const double dfVal = papadfOperands[iOperand][i];
+                    const double dfN = static_cast<double>(iOperand + 1);
+                    if (CPL_UNLIKELY(std::isinf(dfVal)))
+                    {
+                        if (iOperand == 0)
+                            dfMean = dfVal;
+                        else if (dfVal == -dfMean)
+                            dfMean = std::numeric_limits<double>::quiet_NaN();
+                    }
+                    else if (CPL_UNLIKELY(std::isinf(dfMean)))
+                    {
+                        if (!std::isfinite(dfVal))
+                            dfMean = std::numeric_limits<double>::quiet_NaN();
+                    }
+                    else
+                    {
+                        const double dfDelta = dfVal - dfMean;
+                        if (CPL_UNLIKELY(std::isinf(dfDelta)))
+                            dfMean += dfVal / dfN - dfMean / dfN;
+                        else
+                            dfMean += dfDelta / dfN;
+                    }
+                }
+                padfOut[i] = dfMean;
+            }
+            break;
+        }
+
+        case Op::OP_GT:
+            ApplyBinaryOperator(oNode.oFirstConstant, oNode.oSecondConstant,
+                                papadfOperands, padfOut, nCount,
+                                [](double a, double b)
+                                { return a > b ? 1.0 : 0.0; });
+            break;
+
+        case Op::OP_GE:
+            ApplyBinaryOperator(oNode.oFirstConstant, oNode.oSecondConstant,
+                                papadfOperands, padfOut, nCount,
+                                [](double a, double b)
+                                { return a >= b ? 1.0 : 0.0; });
+            break;
+
+        case Op::OP_LT:
+            ApplyBinaryOperator(oNode.oFirstConstant, oNode.oSecondConstant,
+                                papadfOperands, padfOut, nCount,
+                                [](double a, double b)
+                                { return a < b ? 1.0 : 0.0; });
+            break;
+
+        case Op::OP_LE:
+            ApplyBinaryOperator(oNode.oFirstConstant, oNode.oSecondConstant,
+                                papadfOperands, padfOut, nCount,
+                                [](double a, double b)
+                                { return a <= b ? 1.0 : 0.0; });
+            break;
+
+        case Op::OP_EQ:
+            ApplyBinaryOperator(oNode.oFirstConstant, oNode.oSecondConstant,
+                                papadfOperands, padfOut, nCount,
+                                [](double a, double b)
+                                { return a == b ? 1.0 : 0.0; });
+            break;
+
+        case Op::OP_NE:
+            ApplyBinaryOperator(oNode.oFirstConstant, oNode.oSecondConstant,
+                                papadfOperands, padfOut, nCount,
+                                [](double a, double b)
+                                { return a != b ? 1.0 : 0.0; });
+            break;
+
+        case Op::OP_LOGICAL_AND:
+            ApplyBinaryOperator(oNode.oFirstConstant, oNode.oSecondConstant,
+                                papadfOperands, padfOut, nCount,
+                                [](double a, double b)
+                                { return a != 0 && b != 0 ? 1.0 : 0.0; });
+            break;
+
+        case Op::OP_LOGICAL_OR:
+            ApplyBinaryOperator(oNode.oFirstConstant, oNode.oSecondConstant,
+                                papadfOperands, padfOut, nCount,
+                                [](double a, double b)
+                                { return a != 0 || b != 0 ? 1.0 : 0.0; });
+            break;
+
+        case Op::OP_TERNARY:
+        {
+            const double *padfB = papadfOperands[1];
+            const double *padfC = papadfOperands[2];
+            for (size_t i = 0; i < nCount; ++i)
+                padfOut[i] = padfA[i] != 0 ? padfB[i] : padfC[i];
+            break;
+        }
+
+        case Op::OP_CAST:
+        {
+            std::copy_n(padfA, nCount, padfOut);
+            if (oNode.eCastType != GDT_Unknown)
+            {
+                RoundTripThroughDataType(padfOut, nCount, oNode.eCastType,
+                                         pabyTmp);
+            }
+            break;
+        }
+
+        case Op::OP_ABS:
+            for (size_t i = 0; i < nCount; ++i)
+                padfOut[i] = std::fabs(padfA[i]);
+            break;
+
+        case Op::OP_SQRT:
+            for (size_t i = 0; i < nCount; ++i)
+                padfOut[i] = std::sqrt(padfA[i]);
+            break;
+
+        case Op::OP_LOG:
+            for (size_t i = 0; i < nCount; ++i)
+                padfOut[i] = std::log(padfA[i]);
+            break;
+
+        case Op::OP_LOG10:
+            for (size_t i = 0; i < nCount; ++i)
+                padfOut[i] = std::log10(std::fabs(padfA[i]));
+            break;
+
+        case Op::OP_POW:
+            ApplyBinaryOperator(oNode.oFirstConstant, oNode.oSecondConstant,
+                                papadfOperands, padfOut, nCount,
+                                [](double a, double b)
+                                { return std::pow(a, b); });
+            break;
+    }
+}
+
+/************************************************************************/
+/*               GDALComputedFusedEvaluator::Evaluate()                 */
+/************************************************************************/
+
+/** Computes the values of the root band over a window, at full resolution */
+CPLErr GDALComputedFusedEvaluator::Evaluate(int nXOff, int nYOff, int nXSize,
+                                            int nYSize, void *pData,
+                                            GDALDataType eBufType,
+                                            GSpacing nPixelSpace,
+                                            GSpacing nLineSpace) const
+{
+    const size_t nLeaves = m_apoLeaves.size();
+    const size_t nLeafLineSize =
+        static_cast<size_t>(nXSize) * sizeof(double) * nLeaves;
+    const int nLinesPerStrip = static_cast<int>(std::min<size_t>(
+        std::max<size_t>(1, MAX_LEAF_BUFFER_SIZE / nLeafLineSize), nYSize));
+
+    std::vector<double> adfLeaves;
+    std::vector<double> adfScratch;
+    std::vector<GByte> abyTmp;
+    try
+    {
+        adfLeaves.resize(static_cast<size_t>(nXSize) * nLinesPerStrip *
+                         nLeaves);
+        adfScratch.resize(m_aoNodes.size() * CHUNK_SIZE);
+        abyTmp.resize(CHUNK_SIZE * sizeof(double));
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in GDALComputedFusedEvaluator::Evaluate()");
+        return CE_Failure;
+    }
+    std::vector<const double *> apadfValues(m_aoNodes.size());
+    std::vector<const double *> apadfOperands;
+
+    for (int iStripY = 0; iStripY < nYSize; iStripY += nLinesPerStrip)
+    {
+        const int nLines = std::min(nLinesPerStrip, nYSize - iStripY);
+        const size_t nStripPixels = static_cast<size_t>(nXSize) * nLines;
+        for (size_t iLeaf = 0; iLeaf < nLeaves; ++iLeaf)
+        {
+            if (m_apoLeaves[iLeaf]->RasterIO(
+                    GF_Read, nXOff, nYOff + iStripY, nXSize, nLines,
+                    adfLeaves.data() + iLeaf * nStripPixels, nXSize, nLines,
+                    GDT_Float64, 0, 0, nullptr) != CE_None)
+            {
+                return CE_Failure;
+            }
+        }
+
+        for (int iLine = 0; iLine < nLines; ++iLine)
+        {
+            GByte *pabyDstLine = static_cast<GByte *>(pData) +
+                                 (iStripY + iLine) * nLineSpace;
+            for (int iX = 0; iX < nXSize; iX += CHUNK_SIZE)
+            {
+                const size_t nCount = std::min(CHUNK_SIZE, nXSize - iX);
+                const size_t nOffset = static_cast<size_t>(iLine) * nXSize + iX;
+                for (size_t iNode = 0; iNode < m_aoNodes.size(); ++iNode)
+                {
+                    const Node &oNode = m_aoNodes[iNode];
+                    if (oNode.iLeaf >= 0)
+                    {
+                        apadfValues[iNode] = adfLeaves.data() +
+                                             oNode.iLeaf * nStripPixels +
+                                             nOffset;
+                        continue;
+                    }
+
+                    apadfOperands.clear();
+                    for (int iChild : oNode.anChildren)
+                        apadfOperands.push_back(apadfValues[iChild]);
+                    double *padfOut = adfScratch.data() + iNode * CHUNK_SIZE;
+                    EvaluateNode(oNode, apadfOperands.data(), padfOut, nCount,
+                                 abyTmp.data());
+                    if (oNode.eTransferType != GDT_Float64)
+                    {
+                        RoundTripThroughDataType(padfOut, nCount,
+                                                 oNode.eTransferType,
+                                                 abyTmp.data());
+                    }
+                    apadfValues[iNode] = padfOut;
+                }
+
+                GDALCopyWords64(apadfValues.back(), GDT_Float64,
+                                sizeof(double), pabyDstLine + iX * nPixelSpace,
+                                eBufType, static_cast<int>(nPixelSpace),
+                                nCount);
+            }
+        }
+    }
+
+    return CE_None;
+}
+
+/************************************************************************/
+/*                       IsFusedEvaluationEnabled()                     */
+/************************************************************************/
+
+static bool IsFusedEvaluationEnabled()
+{
+    return CPLTestBool(
+        CPLGetConfigOption("GDAL_BAND_ARITHMETIC_FUSION", "YES"));
+}
+
 /************************************************************************/
 /*                           IReadBlock()                               */
 /************************************************************************/
@@ -797,6 +1365,20 @@ void GDALComputedRasterBandRelease(GDALComputedRasterBandH hBand)
 CPLErr GDALComputedRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff,
                                           void *pData)
 {
+    if (IsFusedEvaluationEnabled())
+    {
+        if (auto poEvaluator = GDALComputedFusedEvaluator::Build(this))
+        {
+            const int nXOff = nBlockXOff * nBlockXSize;
+            const int nYOff = nBlockYOff * nBlockYSize;
+            const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+            return poEvaluator->Evaluate(
+                nXOff, nYOff, std::min(nBlockXSize, nRasterXSize - nXOff),
+                std::min(nBlockYSize, nRasterYSize - nYOff), pData, eDataType,
+                nDTSize, static_cast<GSpacing>(nDTSize) * nBlockXSize);
+        }
+    }
+
     auto l_poDS = cpl::down_cast<GDALComputedDataset *>(poDS);
     return l_poDS->m_oVRTDS.GetRasterBand(1)->ReadBlock(nBlockXOff, nBlockYOff,
                                                         pData);
@@ -811,6 +1393,19 @@ CPLErr GDALComputedRasterBand::IRasterIO(
     void *pData, int nBufXSize, int nBufYSize, GDALDataType eBufType,
     GSpacing nPixelSpace, GSpacing nLineSpace, GDALRasterIOExtraArg *psExtraArg)
 {
+    // Requests with resampling are left to the VRT implementation, which
+    // may use overviews of the sources.
+    if (eRWFlag == GF_Read && nXSize == nBufXSize && nYSize == nBufYSize &&
+        !GDALDataTypeIsComplex(eBufType) && nPixelSpace <= INT_MAX &&
+        IsFusedEvaluationEnabled())
+    {
+        if (auto poEvaluator = GDALComputedFusedEvaluator::Build(this))
+        {
+            return poEvaluator->Evaluate(nXOff, nYOff, nXSize, nYSize, pData,
+                                         eBufType, nPixelSpace, nLineSpace);
+        }
+    }
+
     auto l_poDS = cpl::down_cast<GDALComputedDataset *>(poDS);
     return l_poDS->m_oVRTDS.GetRasterBand(1)->RasterIO(
         eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
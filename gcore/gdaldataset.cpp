@@ -14,6 +14,7 @@
 #include "cpl_port.h"
 
 #include <array>
+#include <atomic>
 #include <cassert>
 #include <climits>
 #include <cstdarg>
@@ -118,6 +119,11 @@ class GDALDataset::Private
 
     GDALDataset *poParentDataset = nullptr;
 
+    // Block cache pool of the dataset, or nullptr for the default one.
+    std::atomic<GDALCachePool *> m_poCachePool{nullptr};
+
+    GDALDatasetBlockCacheCounters m_oBlockCacheCounters{};
+
     bool m_bOverviewsEnabled = true;
 
     std::vector<int>
@@ -1948,6 +1954,162 @@ void GDALDataset::UnMarkSuppressOnClose()
     bSuppressOnClose = false;
 }
 
+/************************************************************************/
+/*                            SetCachePool()                            */
+/************************************************************************/
+
+/** Assign the dataset to a block cache pool.
+ *
+ * The pool must have been created with GDALSetCachePool() beforehand,
+ * or be "default". Blocks loaded afterwards in the block cache are accounted
+ * in the pool, and evicted according to its quota and priority. Blocks
+ * already in the cache remain in their previous pool until they are evicted.
+ *
+ * Overview datasets that share their lock with their parent dataset use the
+ * pool of their parent.
+ *
+ * This is the same as C function GDALDatasetSetCachePool()
+ *
+ * @param pszName Pool name.
+ * @return CE_None in case of success.
+ * @since GDAL 3.13
+ */
+CPLErr GDALDataset::SetCachePool(const char *pszName)
+{
+    GDALCachePool *poPool = GDALRasterBlock::GetCachePool(pszName);
+    if (poPool == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Unknown cache pool: %s",
+                 pszName);
+        return CE_Failure;
+    }
+    m_poPrivate->m_poCachePool = poPool;
+    return CE_None;
+}
+
+/************************************************************************/
+/*                      GDALDatasetSetCachePool()                       */
+/************************************************************************/
+
+/** Assign the dataset to a block cache pool.
+ *
+ * This is the same as C++ method GDALDataset::SetCachePool()
+ *
+ * @since GDAL 3.13
+ */
+CPLErr GDALDatasetSetCachePool(GDALDatasetH hDS, const char *pszName)
+{
+    VALIDATE_POINTER1(hDS, "GDALDatasetSetCachePool", CE_Failure);
+    VALIDATE_POINTER1(pszName, "GDALDatasetSetCachePool", CE_Failure);
+
+    return GDALDataset::FromHandle(hDS)->SetCachePool(pszName);
+}
+
+/************************************************************************/
+/*                            GetCachePool()                            */
+/************************************************************************/
+
+/** Return the name of the block cache pool of the dataset.
+ *
+ * This is the same as C function GDALDatasetGetCachePool()
+ *
+ * @return pool name, "default" if the dataset has not been assigned to a pool.
+ * @since GDAL 3.13
+ */
+const char *GDALDataset::GetCachePool() const
+{
+    return GDALRasterBlock::GetCachePoolName(GetBlockCachePool());
+}
+
+/************************************************************************/
+/*                      GDALDatasetGetCachePool()                       */
+/************************************************************************/
+
+/** Return the name of the block cache pool of the dataset.
+ *
+ * This is the same as C++ method GDALDataset::GetCachePool()
+ *
+ * @since GDAL 3.13
+ */
+const char *GDALDatasetGetCachePool(GDALDatasetH hDS)
+{
+    VALIDATE_POINTER1(hDS, "GDALDatasetGetCachePool", nullptr);
+
+    return GDALDataset::FromHandle(hDS)->GetCachePool();
+}
+
+/************************************************************************/
+/*                         GetBlockCachePool()                          */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+GDALCachePool *GDALDataset::GetBlockCachePool() const
+{
+    GDALCachePool *poPool = m_poPrivate ? m_poPrivate->m_poCachePool.load()
+                                        : nullptr;
+    if (poPool == nullptr && m_poPrivate && m_poPrivate->poParentDataset)
+        return m_poPrivate->poParentDataset->GetBlockCachePool();
+    return poPool;
+}
+
+/************************************************************************/
+/*                       GetBlockCacheCounters()                        */
+/************************************************************************/
+
+GDALDatasetBlockCacheCounters *GDALDataset::GetBlockCacheCounters()
+{
+    return m_poPrivate ? &m_poPrivate->m_oBlockCacheCounters : nullptr;
+}
+
+//! @endcond
+
+/************************************************************************/
+/*                         GetCacheStatistics()                         */
+/************************************************************************/
+
+/** Get block cache statistics of the dataset.
+ *
+ * Blocks of overview datasets are accounted in the statistics of the
+ * overview datasets, not in the ones of their parent dataset.
+ *
+ * This is the same as C function GDALDatasetGetCacheStatistics()
+ *
+ * @param psStats Structure filled with the statistics.
+ * @return true in case of success.
+ * @since GDAL 3.13
+ */
+bool GDALDataset::GetCacheStatistics(GDALDatasetCacheStatistics *psStats) const
+{
+    if (!m_poPrivate)
+        return false;
+    const auto &oCounters = m_poPrivate->m_oBlockCacheCounters;
+    GDALRasterBlock::GetDatasetResidency(oCounters, psStats->nBlocks,
+                                         psStats->nUsed);
+    psStats->nHits = oCounters.nHits.load(std::memory_order_relaxed);
+    psStats->nMisses = oCounters.nMisses.load(std::memory_order_relaxed);
+    psStats->nEvictions = oCounters.nEvictions.load(std::memory_order_relaxed);
+    return true;
+}
+
+/************************************************************************/
+/*                    GDALDatasetGetCacheStatistics()                   */
+/************************************************************************/
+
+/** Get block cache statistics of the dataset.
+ *
+ * This is the same as C++ method GDALDataset::GetCacheStatistics()
+ *
+ * @since GDAL 3.13
+ */
+int GDALDatasetGetCacheStatistics(GDALDatasetH hDS,
+                                  GDALDatasetCacheStatistics *psStats)
+{
+    VALIDATE_POINTER1(hDS, "GDALDatasetGetCacheStatistics", FALSE);
+    VALIDATE_POINTER1(psStats, "GDALDatasetGetCacheStatistics", FALSE);
+
+    return GDALDataset::FromHandle(hDS)->GetCacheStatistics(psStats);
+}
+
 /************************************************************************/
 /*                        CleanupPostFileClosing()                      */
 /************************************************************************/
@@ -8629,6 +8791,47 @@ int GDALDataset::EnterReadWrite(GDALRWFlag eRWFlag)
     return FALSE;
 }
 
+/************************************************************************/
+/*                         TryEnterReadWrite()                          */
+/************************************************************************/
+
+// Same as EnterReadWrite(GF_Write), except that it fails instead of
+// waiting if the mutex is held by another thread, and that it also fails
+// when the dataset is not protected by the read/write mutex, since the
+// caller could then run concurrently with the thread owning the dataset.
+// On success, bCallLeaveReadWrite is set to whether LeaveReadWrite() must
+// be called.
+bool GDALDataset::TryEnterReadWrite(int &bCallLeaveReadWrite)
+{
+    bCallLeaveReadWrite = FALSE;
+    if (m_poPrivate == nullptr)
+        return false;
+    if (IsThreadSafe(GDAL_OF_RASTER | (nOpenFlags & GDAL_OF_UPDATE)))
+        return true;
+
+    if (m_poPrivate->poParentDataset)
+        return m_poPrivate->poParentDataset->TryEnterReadWrite(
+            bCallLeaveReadWrite);
+
+    // When the state is still unknown, it is determined by the first
+    // EnterReadWrite() call, and when it is disabled, there is no lock to
+    // take.
+    if (eAccess != GA_Update ||
+        m_poPrivate->eStateReadWriteMutex !=
+            GDALAllowReadWriteMutexState::RW_MUTEX_STATE_ALLOWED)
+    {
+        return false;
+    }
+
+    if (m_poPrivate->hMutex == nullptr ||
+        !CPLTryAcquireMutex(m_poPrivate->hMutex))
+        return false;
+
+    m_poPrivate->oMapThreadToMutexTakenCount[CPLGetPID()]++;
+    bCallLeaveReadWrite = TRUE;
+    return true;
+}
+
 /************************************************************************/
 /*                         LeaveReadWrite()                             */
 /************************************************************************/
@@ -10956,6 +11159,38 @@ bool GDALDataset::CanBeCloned(int nScopeFlags,
 
 //! @endcond
 
+/************************************************************************/
+/*                       CanBeSharedForReading()                        */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+
+/** This method is called by GDALThreadSafeDataset::Create(), when the
+ * shared-read mode is requested, to determine if a single instance of this
+ * dataset may serve the read requests of several threads, instead of
+ * per-thread clones being opened.
+ *
+ * In that mode, the IReadBlock() method of the raster bands of the dataset,
+ * and of their overview and mask bands, is called from several threads, but
+ * never concurrently, and the dataset is not modified.
+ * The base implementation returns false.
+ *
+ * Implementations of this method must be thread-safe.
+ *
+ * @param nScopeFlags Combination of GDAL_OF_RASTER, GDAL_OF_VECTOR, etc. flags,
+ *                    expressing the intended use for thread-safety.
+ *                    Currently, the only valid scope is GDAL_OF_RASTER.
+ * @return true if the dataset can be shared for reading.
+ * @since GDAL 3.13
+ */
+bool GDALDataset::CanBeSharedForReading(
+    [[maybe_unused]] int nScopeFlags) const
+{
+    return false;
+}
+
+//! @endcond
+
 /************************************************************************/
 /*                               Clone()                                */
 /************************************************************************/
@@ -66,6 +66,7 @@ class GDALHashSetBandBlockCache final : public GDALAbstractBandBlockCache
     CPLErr UnreferenceBlock(GDALRasterBlock *poBlock) override;
     CPLErr FlushBlock(int nXBlockOff, int nYBlockOff,
                       int bWriteDirtyBlock) override;
+    GDALRasterBlock *PeekBlock(int nXBlockOff, int nYBlockOff) override;
 };
 
 /************************************************************************/
@@ -124,7 +125,7 @@ bool GDALHashSetBandBlockCache::IsInitOK()
 CPLErr GDALHashSetBandBlockCache::AdoptBlock(GDALRasterBlock *poBlock)
 
 {
-    FreeDanglingBlocks();
+    FreeDanglingBlocksOnAdopt();
 
     CPLLockHolderOptionalLockD(hLock);
     m_oSet.insert(poBlock);
@@ -228,18 +229,27 @@ GDALRasterBlock *GDALHashSetBandBlockCache::TryGetLockedBlockRef(int nXBlockOff,
                                                                  int nYBlockOff)
 
 {
-    GDALRasterBlock oBlockForLookup(nXBlockOff, nYBlockOff);
-    GDALRasterBlock *poBlock;
-    {
-        CPLLockHolderOptionalLockD(hLock);
-        auto oIter = m_oSet.find(&oBlockForLookup);
-        if (oIter == m_oSet.end())
-            return nullptr;
-        poBlock = *oIter;
-    }
-    if (!poBlock->TakeLock())
+    GDALRasterBlock *poBlock = PeekBlock(nXBlockOff, nYBlockOff);
+    if (poBlock == nullptr ||
+        !TakeLockOnStoredBlock(poBlock, nXBlockOff, nYBlockOff))
         return nullptr;
     return poBlock;
 }
 
+/************************************************************************/
+/*                              PeekBlock()                             */
+/************************************************************************/
+
+GDALRasterBlock *GDALHashSetBandBlockCache::PeekBlock(int nXBlockOff,
+                                                      int nYBlockOff)
+
+{
+    GDALRasterBlock oBlockForLookup(nXBlockOff, nYBlockOff);
+    CPLLockHolderOptionalLockD(hLock);
+    auto oIter = m_oSet.find(&oBlockForLookup);
+    if (oIter == m_oSet.end())
+        return nullptr;
+    return *oIter;
+}
+
 //! @endcond
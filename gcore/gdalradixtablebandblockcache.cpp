@@ -0,0 +1,893 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  Store cached blocks in a sparse radix table, with optional
+ *           spilling of evicted blocks to a memory-mapped scratch file
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_port.h"
+#include "gdal_priv.h"
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "cpl_string.h"
+#include "cpl_virtualmem.h"
+#include "cpl_vsi.h"
+
+#include "gdal_abstractbandblockcache.h"
+
+//! @cond Doxygen_Suppress
+
+// Each page of the table (leaf or directory) covers RADIX_SIZE x RADIX_SIZE
+// entries of the level below.
+constexpr int RADIX_BITS = 6;
+constexpr int RADIX_SIZE = 1 << RADIX_BITS;
+constexpr int RADIX_MASK = RADIX_SIZE - 1;
+constexpr int ENTRIES_PER_PAGE = RADIX_SIZE * RADIX_SIZE;
+// Number of blocks along each dimension covered by a directory.
+constexpr int BLOCKS_PER_DIR_SIDE = RADIX_SIZE * RADIX_SIZE;
+
+// Maximum number of entries of the top-level array of directories (8 MB of
+// pointers on 64-bit), that is 2^44 blocks.
+constexpr int MAX_DIRECTORIES = 1024 * 1024;
+
+// Number of counters of lock-free readers, each on its own cache line.
+constexpr int READER_SLOTS = 16;
+
+static int IndexInPage(int nX, int nY)
+{
+    return (nX & RADIX_MASK) + (nY & RADIX_MASK) * RADIX_SIZE;
+}
+
+static int GetReaderSlot()
+{
+    static std::atomic<unsigned> nThreadCounter{0};
+    thread_local const int nSlot =
+        static_cast<int>(nThreadCounter++ % READER_SLOTS);
+    return nSlot;
+}
+
+/* ******************************************************************** */
+/*                     GDALRadixTableBandBlockCache                     */
+/* ******************************************************************** */
+
+// Blocks are stored in a three-level table: a dense top-level array of
+// directories, each directory covering 64x64 leaves, each leaf covering
+// 64x64 blocks. Directories and leaves are only allocated when a block
+// falling into them is adopted, and are released once they no longer hold
+// any block (or spilled block), which makes the memory footprint
+// proportional to the number of cached blocks rather than to the area
+// scanned so far.
+//
+// Pages are modified under m_oMutex, but lookups (TryGetLockedBlockRef())
+// do not take any lock: they are announced in the m_asReaders counters, and
+// unpublished pages are only freed once no lookup is in progress.
+//
+// When GDAL_BAND_BLOCK_CACHE_SPILL_SIZE is set, clean blocks of read-only
+// bands evicted from the global block cache are copied to a memory-mapped
+// scratch file, from which they are restored when requested again instead
+// of being read and decoded by the driver.
+
+class GDALRadixTableBandBlockCache final : public GDALAbstractBandBlockCache
+{
+    struct Leaf
+    {
+        std::atomic<GDALRasterBlock *> apoBlocks[ENTRIES_PER_PAGE];
+
+        // Spill slot of each block, or -1. Protected by m_oMutex.
+        std::unique_ptr<int[]> panSpillSlots{};
+
+        // Number of blocks and spill slots. Protected by m_oMutex.
+        int nLiveEntries = 0;
+
+        Leaf()
+        {
+            for (auto &poBlock : apoBlocks)
+                poBlock.store(nullptr, std::memory_order_relaxed);
+        }
+    };
+
+    struct Directory
+    {
+        std::atomic<Leaf *> apoLeaves[ENTRIES_PER_PAGE];
+
+        // Number of leaves. Protected by m_oMutex.
+        int nLiveLeaves = 0;
+
+        Directory()
+        {
+            for (auto &poLeaf : apoLeaves)
+                poLeaf.store(nullptr, std::memory_order_relaxed);
+        }
+
+        ~Directory()
+        {
+            for (auto &poLeaf : apoLeaves)
+                delete poLeaf.load(std::memory_order_relaxed);
+        }
+    };
+
+    struct alignas(64) ReaderCounter
+    {
+        std::atomic<int> nCount{0};
+    };
+
+    // Scoped announcement of a lock-free lookup in the pages.
+    class ReaderGuard
+    {
+        ReaderCounter &m_oCounter;
+
+        CPL_DISALLOW_COPY_ASSIGN(ReaderGuard)
+
+      public:
+        explicit ReaderGuard(GDALRadixTableBandBlockCache *poCache)
+            : m_oCounter(poCache->m_asReaders[GetReaderSlot()])
+        {
+            m_oCounter.nCount.fetch_add(1, std::memory_order_seq_cst);
+        }
+
+        ~ReaderGuard()
+        {
+            m_oCounter.nCount.fetch_sub(1, std::memory_order_release);
+        }
+    };
+
+    int m_nDirsPerRow = 0;
+    int m_nDirsPerColumn = 0;
+    std::unique_ptr<std::atomic<Directory *>[]> m_papoDirs{};
+
+    ReaderCounter m_asReaders[READER_SLOTS]{};
+
+    // Protects the modifications of the pages and the spill state.
+    std::mutex m_oMutex{};
+    // Pages unpublished but possibly still accessed by lookups.
+    std::vector<Leaf *> m_apoRetiredLeaves{};
+    std::vector<Directory *> m_apoRetiredDirs{};
+    int m_nLiveLeaves = 0;
+    int m_nMaxLiveLeaves = 0;
+
+    std::atomic<bool> m_bSpillEnabled{false};
+    GIntBig m_nSpillMaxSize = 0;
+    size_t m_nSpillBlockSize = 0;
+    VSILFILE *m_fpSpill = nullptr;
+    CPLVirtualMem *m_psSpillMapping = nullptr;
+    GByte *m_pabySpill = nullptr;
+    // For each slot, 1 + index of the block that occupies it, or 0.
+    std::vector<GUIntBig> m_anSlotOwners{};
+    size_t m_nNextSlot = 0;
+
+    size_t GetDirIndex(int nXBlockOff, int nYBlockOff) const;
+    Leaf *GetLeaf(int nXBlockOff, int nYBlockOff) const;
+    Leaf *GetOrCreateLeaf(int nXBlockOff, int nYBlockOff);
+    void ReleaseEntry(Leaf *psLeaf, int nXBlockOff, int nYBlockOff);
+    void FreeRetiredPages();
+    bool CreateSpillFile();
+    void SpillBlock(Leaf *psLeaf, GDALRasterBlock *poBlock);
+    void ResetSpill();
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALRadixTableBandBlockCache)
+
+  public:
+    explicit GDALRadixTableBandBlockCache(GDALRasterBand *poBand);
+    ~GDALRadixTableBandBlockCache() override;
+
+    bool Init() override;
+    bool IsInitOK() override;
+    CPLErr FlushCache() override;
+    CPLErr AdoptBlock(GDALRasterBlock *) override;
+    GDALRasterBlock *TryGetLockedBlockRef(int nXBlockOff,
+                                          int nYBlockYOff) override;
+    CPLErr UnreferenceBlock(GDALRasterBlock *poBlock) override;
+    CPLErr FlushBlock(int nXBlockOff, int nYBlockOff,
+                      int bWriteDirtyBlock) override;
+    bool RestoreSpilledBlock(GDALRasterBlock *poBlock) override;
+    void SpillEvictedBlock(GDALRasterBlock *poBlock) override;
+    GDALRasterBlock *PeekBlock(int nXBlockOff, int nYBlockOff) override;
+};
+
+/************************************************************************/
+/*                GDALRadixTableBandBlockCacheCanBeUsed()               */
+/************************************************************************/
+
+bool GDALRadixTableBandBlockCacheCanBeUsed(int nBlocksPerRow,
+                                           int nBlocksPerColumn)
+{
+    const int nDirsPerRow = DIV_ROUND_UP(nBlocksPerRow, BLOCKS_PER_DIR_SIDE);
+    const int nDirsPerColumn =
+        DIV_ROUND_UP(nBlocksPerColumn, BLOCKS_PER_DIR_SIDE);
+    return nDirsPerRow <= MAX_DIRECTORIES / nDirsPerColumn;
+}
+
+/************************************************************************/
+/*                  GDALRadixTableBandBlockCacheCreate()                */
+/************************************************************************/
+
+GDALAbstractBandBlockCache *
+GDALRadixTableBandBlockCacheCreate(GDALRasterBand *poBand)
+{
+    return new (std::nothrow) GDALRadixTableBandBlockCache(poBand);
+}
+
+/************************************************************************/
+/*                    GDALRadixTableBandBlockCache()                    */
+/************************************************************************/
+
+GDALRadixTableBandBlockCache::GDALRadixTableBandBlockCache(
+    GDALRasterBand *poBandIn)
+    : GDALAbstractBandBlockCache(poBandIn)
+{
+}
+
+/************************************************************************/
+/*                   ~GDALRadixTableBandBlockCache()                    */
+/************************************************************************/
+
+GDALRadixTableBandBlockCache::~GDALRadixTableBandBlockCache()
+{
+    GDALRadixTableBandBlockCache::FlushCache();
+
+    if (m_nMaxLiveLeaves > 0)
+    {
+        CPLDebug("GDAL", "Band %d: at most %d leaves of the radix block cache",
+                 poBand->GetBand(), m_nMaxLiveLeaves);
+    }
+
+    if (m_psSpillMapping)
+        CPLVirtualMemFree(m_psSpillMapping);
+    if (m_fpSpill)
+        VSIFCloseL(m_fpSpill);
+}
+
+/************************************************************************/
+/*                                  Init()                              */
+/************************************************************************/
+
+bool GDALRadixTableBandBlockCache::Init()
+{
+    if (!GDALRadixTableBandBlockCacheCanBeUsed(poBand->nBlocksPerRow,
+                                               poBand->nBlocksPerColumn))
+    {
+        poBand->ReportError(CE_Failure, CPLE_NotSupported,
+                            "Too many blocks : %d x %d", poBand->nBlocksPerRow,
+                            poBand->nBlocksPerColumn);
+        return false;
+    }
+
+    m_nDirsPerRow = DIV_ROUND_UP(poBand->nBlocksPerRow, BLOCKS_PER_DIR_SIDE);
+    m_nDirsPerColumn =
+        DIV_ROUND_UP(poBand->nBlocksPerColumn, BLOCKS_PER_DIR_SIDE);
+    const size_t nDirs = static_cast<size_t>(m_nDirsPerRow) * m_nDirsPerColumn;
+    m_papoDirs.reset(new (std::nothrow) std::atomic<Directory *>[nDirs]);
+    if (!m_papoDirs)
+    {
+        poBand->ReportError(CE_Failure, CPLE_OutOfMemory,
+                            "Out of memory in InitBlockInfo().");
+        return false;
+    }
+    for (size_t i = 0; i < nDirs; ++i)
+        m_papoDirs[i].store(nullptr, std::memory_order_relaxed);
+
+    const char *pszSpillSize =
+        CPLGetConfigOption("GDAL_BAND_BLOCK_CACHE_SPILL_SIZE", nullptr);
+    if (pszSpillSize && poBand->GetAccess() == GA_ReadOnly)
+    {
+        GIntBig nSpillSize = 0;
+        bool bUnitSpecified = false;
+        if (CPLParseMemorySize(pszSpillSize, &nSpillSize, &bUnitSpecified) !=
+            CE_None)
+        {
+            CPLError(CE_Warning, CPLE_NotSupported,
+                     "Invalid value for GDAL_BAND_BLOCK_CACHE_SPILL_SIZE. "
+                     "Spilling of evicted blocks disabled.");
+        }
+        else if (!CPLIsVirtualMemFileMapAvailable())
+        {
+            CPLDebug("GDAL", "Spilling of evicted blocks not available on "
+                             "this platform");
+        }
+        else
+        {
+            if (!bUnitSpecified && nSpillSize < 100000)
+            {
+                // Assume MB
+                nSpillSize *= 1024 * 1024;
+            }
+            m_nSpillMaxSize = nSpillSize;
+            m_bSpillEnabled = nSpillSize > 0;
+            m_nSpillBlockSize = static_cast<size_t>(poBand->nBlockXSize) *
+                                poBand->nBlockYSize *
+                                GDALGetDataTypeSizeBytes(poBand->eDataType);
+        }
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                             IsInitOK()                               */
+/************************************************************************/
+
+bool GDALRadixTableBandBlockCache::IsInitOK()
+{
+    return m_papoDirs != nullptr;
+}
+
+/************************************************************************/
+/*                            GetDirIndex()                             */
+/************************************************************************/
+
+size_t GDALRadixTableBandBlockCache::GetDirIndex(int nXBlockOff,
+                                                 int nYBlockOff) const
+{
+    return static_cast<size_t>(nXBlockOff >> (2 * RADIX_BITS)) +
+           static_cast<size_t>(nYBlockOff >> (2 * RADIX_BITS)) *
+               m_nDirsPerRow;
+}
+
+/************************************************************************/
+/*                              GetLeaf()                               */
+/************************************************************************/
+
+// Must be called with m_oMutex held, or within a ReaderGuard.
+GDALRadixTableBandBlockCache::Leaf *
+GDALRadixTableBandBlockCache::GetLeaf(int nXBlockOff, int nYBlockOff) const
+{
+    // Sequentially consistent loads pair with the reader counters: see
+    // FreeRetiredPages().
+    const Directory *psDir =
+        m_papoDirs[GetDirIndex(nXBlockOff, nYBlockOff)].load(
+            std::memory_order_seq_cst);
+    if (psDir == nullptr)
+        return nullptr;
+    return psDir
+        ->apoLeaves[IndexInPage(nXBlockOff >> RADIX_BITS,
+                                nYBlockOff >> RADIX_BITS)]
+        .load(std::memory_order_seq_cst);
+}
+
+/************************************************************************/
+/*                          GetOrCreateLeaf()                           */
+/************************************************************************/
+
+// Must be called with m_oMutex held.
+GDALRadixTableBandBlockCache::Leaf *
+GDALRadixTableBandBlockCache::GetOrCreateLeaf(int nXBlockOff, int nYBlockOff)
+{
+    auto &oDirPtr = m_papoDirs[GetDirIndex(nXBlockOff, nYBlockOff)];
+    Directory *psDir = oDirPtr.load(std::memory_order_relaxed);
+    if (psDir == nullptr)
+    {
+        psDir = new (std::nothrow) Directory();
+        if (psDir == nullptr)
+            return nullptr;
+        oDirPtr.store(psDir, std::memory_order_release);
+    }
+
+    auto &oLeafPtr = psDir->apoLeaves[IndexInPage(nXBlockOff >> RADIX_BITS,
+                                                  nYBlockOff >> RADIX_BITS)];
+    Leaf *psLeaf = oLeafPtr.load(std::memory_order_relaxed);
+    if (psLeaf == nullptr)
+    {
+        psLeaf = new (std::nothrow) Leaf();
+        if (psLeaf == nullptr)
+        {
+            if (psDir->nLiveLeaves == 0)
+            {
+                oDirPtr.store(nullptr, std::memory_order_seq_cst);
+                m_apoRetiredDirs.push_back(psDir);
+            }
+            return nullptr;
+        }
+        oLeafPtr.store(psLeaf, std::memory_order_release);
+        ++psDir->nLiveLeaves;
+        ++m_nLiveLeaves;
+        m_nMaxLiveLeaves = std::max(m_nMaxLiveLeaves, m_nLiveLeaves);
+    }
+    return psLeaf;
+}
+
+/************************************************************************/
+/*                            ReleaseEntry()                            */
+/************************************************************************/
+
+// Accounts for the removal of a block or spill slot of the leaf, and
+// unpublishes the leaf, and possibly its directory, once empty.
+// Must be called with m_oMutex held.
+void GDALRadixTableBandBlockCache::ReleaseEntry(Leaf *psLeaf, int nXBlockOff,
+                                                int nYBlockOff)
+{
+    CPLAssert(psLeaf->nLiveEntries > 0);
+    if (--psLeaf->nLiveEntries > 0)
+        return;
+
+    auto &oDirPtr = m_papoDirs[GetDirIndex(nXBlockOff, nYBlockOff)];
+    Directory *psDir = oDirPtr.load(std::memory_order_relaxed);
+    psDir
+        ->apoLeaves[IndexInPage(nXBlockOff >> RADIX_BITS,
+                                nYBlockOff >> RADIX_BITS)]
+        .store(nullptr, std::memory_order_seq_cst);
+    m_apoRetiredLeaves.push_back(psLeaf);
+    --m_nLiveLeaves;
+    if (--psDir->nLiveLeaves == 0)
+    {
+        oDirPtr.store(nullptr, std::memory_order_seq_cst);
+        m_apoRetiredDirs.push_back(psDir);
+    }
+
+    FreeRetiredPages();
+}
+
+/************************************************************************/
+/*                          FreeRetiredPages()                          */
+/************************************************************************/
+
+// Frees unpublished pages if no lookup is in progress. A lookup that
+// started before a page was unpublished is still counted at that point, and
+// one that started after cannot reach it anymore.
+// Must be called with m_oMutex held.
+void GDALRadixTableBandBlockCache::FreeRetiredPages()
+{
+    if (m_apoRetiredLeaves.empty() && m_apoRetiredDirs.empty())
+        return;
+    for (const auto &oReader : m_asReaders)
+    {
+        if (oReader.nCount.load(std::memory_order_seq_cst) != 0)
+            return;
+    }
+    for (Leaf *psLeaf : m_apoRetiredLeaves)
+        delete psLeaf;
+    m_apoRetiredLeaves.clear();
+    for (Directory *psDir : m_apoRetiredDirs)
+        delete psDir;
+    m_apoRetiredDirs.clear();
+}
+
+/************************************************************************/
+/*                            AdoptBlock()                              */
+/************************************************************************/
+
+CPLErr GDALRadixTableBandBlockCache::AdoptBlock(GDALRasterBlock *poBlock)
+
+{
+    const int nXBlockOff = poBlock->GetXOff();
+    const int nYBlockOff = poBlock->GetYOff();
+
+    FreeDanglingBlocksOnAdopt();
+
+    std::lock_guard oLock(m_oMutex);
+    FreeRetiredPages();
+
+    Leaf *psLeaf = GetOrCreateLeaf(nXBlockOff, nYBlockOff);
+    if (psLeaf == nullptr)
+    {
+        poBand->ReportError(CE_Failure, CPLE_OutOfMemory,
+                            "Out of memory in AdoptBlock().");
+        return CE_Failure;
+    }
+
+    auto &oBlockPtr = psLeaf->apoBlocks[IndexInPage(nXBlockOff, nYBlockOff)];
+    CPLAssert(oBlockPtr.load() == nullptr);
+    oBlockPtr.store(poBlock, std::memory_order_release);
+    ++psLeaf->nLiveEntries;
+
+    return CE_None;
+}
+
+/************************************************************************/
+/*                            FlushCache()                              */
+/************************************************************************/
+
+CPLErr GDALRadixTableBandBlockCache::FlushCache()
+{
+    FreeDanglingBlocks();
+
+    CPLErr eGlobalErr = poBand->eFlushBlockErr;
+
+    StartDirtyBlockFlushingLog();
+
+    if (m_papoDirs)
+    {
+        // Leaves emptied by FlushBlock() must not be freed while we scan
+        // them.
+        auto poReaderGuard = std::make_unique<ReaderGuard>(this);
+
+        // Blocks are flushed from top to bottom, left to right (as the
+        // hashset block cache does) so that drivers get sequential writes.
+        // For that, process one row of leaves at a time.
+        const int nBlocksPerRow = poBand->nBlocksPerRow;
+        const int nBlocksPerColumn = poBand->nBlocksPerColumn;
+        const int nLeafRows = DIV_ROUND_UP(nBlocksPerColumn, RADIX_SIZE);
+        std::vector<std::pair<int, Leaf *>> aoLeavesInRow;
+        for (int iLeafY = 0; iLeafY < nLeafRows; ++iLeafY)
+        {
+            aoLeavesInRow.clear();
+            for (int iDirX = 0; iDirX < m_nDirsPerRow; ++iDirX)
+            {
+                const Directory *psDir =
+                    m_papoDirs[iDirX + static_cast<size_t>(iLeafY >>
+                                                           RADIX_BITS) *
+                                           m_nDirsPerRow]
+                        .load(std::memory_order_acquire);
+                if (psDir == nullptr)
+                    continue;
+                for (int iX = 0; iX < RADIX_SIZE; ++iX)
+                {
+                    Leaf *psLeaf =
+                        psDir->apoLeaves[IndexInPage(iX, iLeafY)].load(
+                            std::memory_order_acquire);
+                    if (psLeaf)
+                        aoLeavesInRow.emplace_back(
+                            (iDirX << RADIX_BITS) + iX, psLeaf);
+                }
+            }
+
+            const int nYStart = iLeafY << RADIX_BITS;
+            const int nYEnd = std::min(nYStart + RADIX_SIZE, nBlocksPerColumn);
+            for (int iY = nYStart; iY < nYEnd; ++iY)
+            {
+                for (const auto &[nLeafX, psLeaf] : aoLeavesInRow)
+                {
+                    const int nXStart = nLeafX << RADIX_BITS;
+                    const int nXEnd =
+                        std::min(nXStart + RADIX_SIZE, nBlocksPerRow);
+                    for (int iX = nXStart; iX < nXEnd; ++iX)
+                    {
+                        if (psLeaf->apoBlocks[IndexInPage(iX, iY)].load(
+                                std::memory_order_acquire) != nullptr)
+                        {
+                            const CPLErr eErr =
+                                FlushBlock(iX, iY, eGlobalErr == CE_None);
+                            if (eErr != CE_None)
+                                eGlobalErr = eErr;
+                        }
+                    }
+                }
+            }
+        }
+
+        poReaderGuard.reset();
+
+        // We might as well get rid of all pages since we know they are now
+        // empty. Spilled blocks are discarded too. Blocks being evicted by
+        // other threads may still be looked up in the pages.
+        WaitCompletionPendingTasks();
+        std::lock_guard oLock(m_oMutex);
+        const size_t nDirs =
+            static_cast<size_t>(m_nDirsPerRow) * m_nDirsPerColumn;
+        for (size_t i = 0; i < nDirs; ++i)
+            delete m_papoDirs[i].exchange(nullptr, std::memory_order_acq_rel);
+        for (Leaf *psLeaf : m_apoRetiredLeaves)
+            delete psLeaf;
+        m_apoRetiredLeaves.clear();
+        for (Directory *psDir : m_apoRetiredDirs)
+            delete psDir;
+        m_apoRetiredDirs.clear();
+        m_nLiveLeaves = 0;
+        ResetSpill();
+    }
+
+    EndDirtyBlockFlushingLog();
+
+    WaitCompletionPendingTasks();
+
+    return (eGlobalErr);
+}
+
+/************************************************************************/
+/*                        UnreferenceBlock()                            */
+/************************************************************************/
+
+CPLErr GDALRadixTableBandBlockCache::UnreferenceBlock(GDALRasterBlock *poBlock)
+{
+    const int nXBlockOff = poBlock->GetXOff();
+    const int nYBlockOff = poBlock->GetYOff();
+
+    UnreferenceBlockBase();
+
+    std::lock_guard oLock(m_oMutex);
+    Leaf *psLeaf = GetLeaf(nXBlockOff, nYBlockOff);
+    if (psLeaf == nullptr)
+        return CE_None;
+
+    GDALRasterBlock *poExpected = poBlock;
+    if (psLeaf->apoBlocks[IndexInPage(nXBlockOff, nYBlockOff)]
+            .compare_exchange_strong(poExpected, nullptr,
+                                     std::memory_order_acq_rel))
+    {
+        ReleaseEntry(psLeaf, nXBlockOff, nYBlockOff);
+    }
+
+    return CE_None;
+}
+
+/************************************************************************/
+/*                         SpillEvictedBlock()                          */
+/************************************************************************/
+
+void GDALRadixTableBandBlockCache::SpillEvictedBlock(GDALRasterBlock *poBlock)
+{
+    // The band is kept alive by the keep-alive counter until the block is
+    // added to the free list, and FlushCache() waits for it before freeing
+    // the pages.
+    if (!m_bSpillEnabled || poBlock->GetDirty() ||
+        static_cast<size_t>(poBlock->GetBlockSize()) != m_nSpillBlockSize ||
+        poBlock->GetDataRef() == nullptr)
+    {
+        return;
+    }
+
+    // The leaf may have been released when the block was unreferenced.
+    std::lock_guard oLock(m_oMutex);
+    const int nXBlockOff = poBlock->GetXOff();
+    const int nYBlockOff = poBlock->GetYOff();
+    Leaf *psLeaf = GetOrCreateLeaf(nXBlockOff, nYBlockOff);
+    if (psLeaf == nullptr)
+        return;
+    ++psLeaf->nLiveEntries;
+    SpillBlock(psLeaf, poBlock);
+    ReleaseEntry(psLeaf, nXBlockOff, nYBlockOff);
+}
+
+/************************************************************************/
+/*                            FlushBlock()                              */
+/************************************************************************/
+
+CPLErr GDALRadixTableBandBlockCache::FlushBlock(int nXBlockOff, int nYBlockOff,
+                                                int bWriteDirtyBlock)
+
+{
+    GDALRasterBlock *poBlock = nullptr;
+    {
+        std::lock_guard oLock(m_oMutex);
+        Leaf *psLeaf = GetLeaf(nXBlockOff, nYBlockOff);
+        if (psLeaf == nullptr)
+            return CE_None;
+
+        poBlock =
+            psLeaf->apoBlocks[IndexInPage(nXBlockOff, nYBlockOff)].exchange(
+                nullptr, std::memory_order_acq_rel);
+        if (poBlock == nullptr)
+            return CE_None;
+        ReleaseEntry(psLeaf, nXBlockOff, nYBlockOff);
+    }
+
+    if (!poBlock->DropLockForRemovalFromStorage())
+        return CE_None;
+
+    /* -------------------------------------------------------------------- */
+    /*      Is the target block dirty?  If so we need to write it.          */
+    /* -------------------------------------------------------------------- */
+    poBlock->Detach();
+
+    CPLErr eErr = CE_None;
+
+    if (!m_nWriteDirtyBlocksDisabled && bWriteDirtyBlock && poBlock->GetDirty())
+    {
+        UpdateDirtyBlockFlushingLog();
+
+        eErr = poBlock->Write();
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Deallocate the block;                                           */
+    /* -------------------------------------------------------------------- */
+    delete poBlock;
+
+    return eErr;
+}
+
+/************************************************************************/
+/*                        TryGetLockedBlockRef()                        */
+/************************************************************************/
+
+GDALRasterBlock *
+GDALRadixTableBandBlockCache::TryGetLockedBlockRef(int nXBlockOff,
+                                                   int nYBlockOff)
+
+{
+    GDALRasterBlock *poBlock = PeekBlock(nXBlockOff, nYBlockOff);
+    if (poBlock == nullptr ||
+        !TakeLockOnStoredBlock(poBlock, nXBlockOff, nYBlockOff))
+        return nullptr;
+    return poBlock;
+}
+
+/************************************************************************/
+/*                              PeekBlock()                             */
+/************************************************************************/
+
+GDALRasterBlock *GDALRadixTableBandBlockCache::PeekBlock(int nXBlockOff,
+                                                         int nYBlockOff)
+
+{
+    ReaderGuard oReaderGuard(this);
+    const Leaf *psLeaf = GetLeaf(nXBlockOff, nYBlockOff);
+    if (psLeaf == nullptr)
+        return nullptr;
+
+    return psLeaf->apoBlocks[IndexInPage(nXBlockOff, nYBlockOff)].load(
+        std::memory_order_acquire);
+}
+
+/************************************************************************/
+/*                          CreateSpillFile()                           */
+/************************************************************************/
+
+// Must be called with m_oMutex held.
+bool GDALRadixTableBandBlockCache::CreateSpillFile()
+{
+    const GIntBig nSlots = std::min<GIntBig>(
+        m_nSpillMaxSize / std::max<size_t>(1, m_nSpillBlockSize), INT_MAX);
+    if (nSlots == 0)
+        return false;
+
+    // We may be called from the eviction code of any thread, so do not
+    // emit errors: if anything goes wrong, just disable spilling.
+    CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+
+    const std::string osFilename =
+        CPLGenerateTempFilenameSafe("gdal_block_spill");
+    m_fpSpill = VSIFOpenL(osFilename.c_str(), "wb+");
+    if (m_fpSpill == nullptr)
+    {
+        CPLDebug("GDAL", "Cannot create block spill file %s",
+                 osFilename.c_str());
+        return false;
+    }
+
+    m_psSpillMapping = CPLVirtualMemFileMapNew(
+        m_fpSpill, 0, static_cast<vsi_l_offset>(nSlots) * m_nSpillBlockSize,
+        VIRTUALMEM_READWRITE, nullptr, nullptr);
+    // The file remains accessible through the mapping (and the handle)
+    // until we release them.
+    VSIUnlink(osFilename.c_str());
+    if (m_psSpillMapping == nullptr)
+    {
+        CPLDebug("GDAL", "Cannot map block spill file %s",
+                 osFilename.c_str());
+        VSIFCloseL(m_fpSpill);
+        m_fpSpill = nullptr;
+        return false;
+    }
+    m_pabySpill = static_cast<GByte *>(CPLVirtualMemGetAddr(m_psSpillMapping));
+
+    try
+    {
+        m_anSlotOwners.resize(static_cast<size_t>(nSlots));
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLVirtualMemFree(m_psSpillMapping);
+        m_psSpillMapping = nullptr;
+        m_pabySpill = nullptr;
+        VSIFCloseL(m_fpSpill);
+        m_fpSpill = nullptr;
+        return false;
+    }
+
+    CPLDebug("GDAL", "Band %d: spilling evicted blocks to %s (%d slots)",
+             poBand->GetBand(), osFilename.c_str(), static_cast<int>(nSlots));
+    return true;
+}
+
+/************************************************************************/
+/*                            SpillBlock()                              */
+/************************************************************************/
+
+// Must be called with m_oMutex held.
+void GDALRadixTableBandBlockCache::SpillBlock(Leaf *psLeaf,
+                                              GDALRasterBlock *poBlock)
+{
+    if (m_pabySpill == nullptr)
+    {
+        if (!m_bSpillEnabled || !CreateSpillFile())
+        {
+            m_bSpillEnabled = false;
+            return;
+        }
+    }
+
+    if (!psLeaf->panSpillSlots)
+    {
+        psLeaf->panSpillSlots.reset(new (std::nothrow) int[ENTRIES_PER_PAGE]);
+        if (!psLeaf->panSpillSlots)
+            return;
+        std::fill_n(psLeaf->panSpillSlots.get(), ENTRIES_PER_PAGE, -1);
+    }
+
+    const int nXBlockOff = poBlock->GetXOff();
+    const int nYBlockOff = poBlock->GetYOff();
+    int &nSlot = psLeaf->panSpillSlots[IndexInPage(nXBlockOff, nYBlockOff)];
+    // The band is read-only, so a previously spilled copy is still valid.
+    if (nSlot >= 0)
+        return;
+
+    // Slots are recycled in FIFO order.
+    const size_t iSlot = m_nNextSlot;
+    m_nNextSlot = (m_nNextSlot + 1) % m_anSlotOwners.size();
+    if (m_anSlotOwners[iSlot] != 0)
+    {
+        const GUIntBig nPrevBlock = m_anSlotOwners[iSlot] - 1;
+        const int nPrevX = static_cast<int>(nPrevBlock % poBand->nBlocksPerRow);
+        const int nPrevY = static_cast<int>(nPrevBlock / poBand->nBlocksPerRow);
+        Leaf *psPrevLeaf = GetLeaf(nPrevX, nPrevY);
+        int *pnPrevSlot =
+            psPrevLeaf && psPrevLeaf->panSpillSlots
+                ? &(psPrevLeaf->panSpillSlots[IndexInPage(nPrevX, nPrevY)])
+                : nullptr;
+        if (pnPrevSlot && *pnPrevSlot == static_cast<int>(iSlot))
+        {
+            // psPrevLeaf may be psLeaf, which is kept alive by the caller
+            *pnPrevSlot = -1;
+            ReleaseEntry(psPrevLeaf, nPrevX, nPrevY);
+        }
+    }
+
+    memcpy(m_pabySpill + iSlot * m_nSpillBlockSize, poBlock->GetDataRef(),
+           m_nSpillBlockSize);
+    m_anSlotOwners[iSlot] =
+        1 + static_cast<GUIntBig>(nXBlockOff) +
+        static_cast<GUIntBig>(nYBlockOff) * poBand->nBlocksPerRow;
+    nSlot = static_cast<int>(iSlot);
+    ++psLeaf->nLiveEntries;
+}
+
+/************************************************************************/
+/*                        RestoreSpilledBlock()                         */
+/************************************************************************/
+
+bool GDALRadixTableBandBlockCache::RestoreSpilledBlock(
+    GDALRasterBlock *poBlock)
+{
+    if (!m_bSpillEnabled)
+        return false;
+
+    std::lock_guard oLock(m_oMutex);
+    if (m_pabySpill == nullptr)
+        return false;
+
+    const int nXBlockOff = poBlock->GetXOff();
+    const int nYBlockOff = poBlock->GetYOff();
+    const Leaf *psLeaf = GetLeaf(nXBlockOff, nYBlockOff);
+    if (psLeaf == nullptr || !psLeaf->panSpillSlots)
+        return false;
+    const int nSlot =
+        psLeaf->panSpillSlots[IndexInPage(nXBlockOff, nYBlockOff)];
+    if (nSlot < 0)
+        return false;
+
+    memcpy(poBlock->GetDataRef(),
+           m_pabySpill + static_cast<size_t>(nSlot) * m_nSpillBlockSize,
+           m_nSpillBlockSize);
+    return true;
+}
+
+/************************************************************************/
+/*                            ResetSpill()                              */
+/************************************************************************/
+
+// Must be called with m_oMutex held, after the leaves have been freed.
+void GDALRadixTableBandBlockCache::ResetSpill()
+{
+    std::fill(m_anSlotOwners.begin(), m_anSlotOwners.end(), 0);
+    m_nNextSlot = 0;
+}
+
+//! @endcond
@@ -25,9 +25,12 @@
 #include <cstring>
 #include <algorithm>
 #include <limits>
+#include <list>
 #include <memory>
+#include <mutex>
 #include <new>
 #include <type_traits>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -36,6 +39,7 @@
 #include "cpl_string.h"
 #include "cpl_virtualmem.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_abstractbandblockcache.h"
 #include "gdalantirecursion.h"
@@ -44,6 +48,7 @@
 #include "gdal_priv_templates.hpp"
 #include "gdal_interpolateatpoint.h"
 #include "gdal_minmax_element.hpp"
+#include "gdal_thread_pool.h"
 #include "gdalmultidim_priv.h"
 
 #if defined(__AVX2__) || defined(__FMA__)
@@ -1591,7 +1596,13 @@ int GDALRasterBand::InitBlockInfo()
 
     const char *pszBlockStrategy =
         CPLGetConfigOption("GDAL_BAND_BLOCK_CACHE", nullptr);
-    bool bUseArray = true;
+    enum class BlockCacheType
+    {
+        ARRAY,
+        HASHSET,
+        RADIX,
+    };
+    BlockCacheType eType = BlockCacheType::ARRAY;
     if (pszBlockStrategy == nullptr || EQUAL(pszBlockStrategy, "AUTO"))
     {
         if (poDS == nullptr || (poDS->nOpenFlags & GDAL_OF_BLOCK_ACCESS_MASK) ==
@@ -1601,22 +1612,36 @@ int GDALRasterBand::InitBlockInfo()
                 static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
             if (poDS != nullptr)
                 nBlockCount *= poDS->GetRasterCount();
-            bUseArray = (nBlockCount < 1024 * 1024);
+            if (nBlockCount >= 1024 * 1024)
+            {
+                eType = GDALRadixTableBandBlockCacheCanBeUsed(nBlocksPerRow,
+                                                              nBlocksPerColumn)
+                            ? BlockCacheType::RADIX
+                            : BlockCacheType::HASHSET;
+            }
         }
         else if ((poDS->nOpenFlags & GDAL_OF_BLOCK_ACCESS_MASK) ==
                  GDAL_OF_HASHSET_BLOCK_ACCESS)
         {
-            bUseArray = false;
+            eType = BlockCacheType::HASHSET;
         }
     }
     else if (EQUAL(pszBlockStrategy, "HASHSET"))
-        bUseArray = false;
+        eType = BlockCacheType::HASHSET;
+    else if (EQUAL(pszBlockStrategy, "RADIX"))
+        eType = BlockCacheType::RADIX;
     else if (!EQUAL(pszBlockStrategy, "ARRAY"))
         CPLError(CE_Warning, CPLE_AppDefined, "Unknown block cache method: %s",
                  pszBlockStrategy);
 
-    if (bUseArray)
+    if (eType == BlockCacheType::ARRAY)
         poBandBlockCache = GDALArrayBandBlockCacheCreate(this);
+    else if (eType == BlockCacheType::RADIX)
+    {
+        if (nBand == 1)
+            CPLDebug("GDAL", "Use radix table band block cache");
+        poBandBlockCache = GDALRadixTableBandBlockCacheCreate(this);
+    }
     else
     {
         if (nBand == 1)
@@ -1628,6 +1653,28 @@ int GDALRasterBand::InitBlockInfo()
     return poBandBlockCache->Init();
 }
 
+/************************************************************************/
+/*                    EnableConcurrentBlockAccess()                     */
+/************************************************************************/
+
+/** Allow GetLockedBlockRef() and TryGetLockedBlockRef() to be called
+ * concurrently by several threads on this band, for read-only uses.
+ *
+ * Cache misses are then serialized, and a newly read block is only made
+ * visible to other threads once IReadBlock() has returned. IReadBlock() must
+ * itself be safe to call from several threads (one at a time), and must not
+ * request blocks of this band.
+ *
+ * This must be called before the band is shared between threads.
+ */
+bool GDALRasterBand::EnableConcurrentBlockAccess()
+{
+    if (!InitBlockInfo())
+        return false;
+    poBandBlockCache->EnableConcurrentAccess();
+    return true;
+}
+
 //! @endcond
 
 /************************************************************************/
@@ -1996,6 +2043,22 @@ GDALRasterBlock *GDALRasterBand::GetLockedBlockRef(int nXBlockOff,
             return (nullptr);
         }
 
+        // When the band is accessed concurrently, serialize cache misses,
+        // and only make the block visible to other threads (which look it up
+        // without locking) once its content has been read.
+        std::unique_lock<std::mutex> oMissLock;
+        std::mutex *poMissMutex = poBandBlockCache->GetConcurrentMissMutex();
+        if (poMissMutex)
+        {
+            oMissLock = std::unique_lock(*poMissMutex);
+            // Another thread may have loaded it while we were waiting
+            poBlock =
+                poBandBlockCache->TryGetLockedBlockRef(nXBlockOff, nYBlockOff);
+            if (poBlock)
+                return poBlock;
+        }
+        const bool bAdoptAfterRead = poMissMutex != nullptr;
+
         poBlock = poBandBlockCache->CreateBlock(nXBlockOff, nYBlockOff);
         if (poBlock == nullptr)
             return nullptr;
@@ -2022,19 +2085,19 @@ GDALRasterBlock *GDALRasterBand::GetLockedBlockRef(int nXBlockOff,
             poDS->ReacquireReadWriteLock();
         if (eErr != CE_None)
         {
-            poBlock->DropLock();
-            delete poBlock;
+            poBandBlockCache->DiscardBlock(poBlock);
             return nullptr;
         }
 
-        if (poBandBlockCache->AdoptBlock(poBlock) != CE_None)
+        if (!bAdoptAfterRead &&
+            poBandBlockCache->AdoptBlock(poBlock) != CE_None)
         {
-            poBlock->DropLock();
-            delete poBlock;
+            poBandBlockCache->DiscardBlock(poBlock);
             return nullptr;
         }
 
-        if (!bJustInitialize)
+        if (!bJustInitialize &&
+            !poBandBlockCache->RestoreSpilledBlock(poBlock))
         {
             const GUInt32 nErrorCounter = CPLGetErrorCounter();
             int bCallLeaveReadWrite = EnterReadWrite(GF_Read);
@@ -2043,8 +2106,15 @@ GDALRasterBlock *GDALRasterBand::GetLockedBlockRef(int nXBlockOff,
                 LeaveReadWrite();
             if (eErr != CE_None)
             {
-                poBlock->DropLock();
-                FlushBlock(nXBlockOff, nYBlockOff);
+                if (bAdoptAfterRead)
+                {
+                    poBandBlockCache->DiscardBlock(poBlock);
+                }
+                else
+                {
+                    poBlock->DropLock();
+                    FlushBlock(nXBlockOff, nYBlockOff);
+                }
                 ReportError(CE_Failure, CPLE_AppDefined,
                             "IReadBlock failed at X offset %d, Y offset %d%s",
                             nXBlockOff, nYBlockOff,
@@ -2064,6 +2134,13 @@ GDALRasterBlock *GDALRasterBand::GetLockedBlockRef(int nXBlockOff,
                          poDS->GetDescription());
             }
         }
+
+        if (bAdoptAfterRead &&
+            poBandBlockCache->AdoptBlock(poBlock) != CE_None)
+        {
+            poBandBlockCache->DiscardBlock(poBlock);
+            return nullptr;
+        }
     }
 
     return poBlock;
@@ -4143,6 +4220,350 @@ inline bool ARE_REAL_EQUAL(GFloat16 dfVal1, GFloat16 dfVal2, int ulp = 2)
                                       abs(dfVal1 + dfVal2) * ulp;
 }
 
+/************************************************************************/
+/*                 GDALGetNumThreadsForBlockStatistics()                */
+/************************************************************************/
+
+// Number of threads used by ComputeStatistics(), ComputeRasterMinMax() and
+// GetHistogram() to process the nSampledBlocks blocks they read.
+static int GDALGetNumThreadsForBlockStatistics(GIntBig nSampledBlocks)
+{
+    const char *pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    const int nThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                             ? CPLGetNumCPUs()
+                             : atoi(pszNumThreads);
+    return static_cast<int>(std::min<GIntBig>(
+        std::max(1, std::min(128, nThreads)), nSampledBlocks));
+}
+
+/************************************************************************/
+/*                      GDALProcessSampledBlocks()                      */
+/************************************************************************/
+
+// Fetch one block every nSampleRate blocks of poBand, and the corresponding
+// area of poMaskBand if it is not null, and call
+// fnProcessBlock(iSample, pData, pabyMaskData, nXCheck, nYCheck) on it from
+// a worker thread of the global thread pool, iSample being the index of the
+// block in the sampling sequence. The line stride of pData and pabyMaskData
+// is the block width.
+// Blocks are fetched from the calling thread, as IReadBlock()
+// implementations are not required to be re-entrant. Only the processing is
+// dispatched, with a bounded number of blocks locked at the same time.
+template <class ProcessBlockFunc>
+static bool GDALProcessSampledBlocks(GDALRasterBand *poBand,
+                                     GDALRasterBand *poMaskBand,
+                                     int nSampleRate, int nThreads,
+                                     const char *pszProgressMsg,
+                                     GDALProgressFunc pfnProgress,
+                                     void *pProgressData, bool &bInterrupted,
+                                     const ProcessBlockFunc &fnProcessBlock)
+{
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    const int nBlocksPerRow = DIV_ROUND_UP(poBand->GetXSize(), nBlockXSize);
+    const int nBlocksPerColumn = DIV_ROUND_UP(poBand->GetYSize(), nBlockYSize);
+    const GIntBig nTotalBlocks =
+        static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
+
+    auto poQueue = GDALGetGlobalThreadPool(nThreads)->CreateJobQueue();
+    const int nMaxPendingJobs = 2 * nThreads;
+
+    bInterrupted = false;
+    bool bRet = true;
+    GIntBig iSample = 0;
+    for (GIntBig iSampleBlock = 0; iSampleBlock < nTotalBlocks;
+         iSampleBlock += nSampleRate, ++iSample)
+    {
+        if (!pfnProgress(static_cast<double>(iSampleBlock) /
+                             static_cast<double>(nTotalBlocks),
+                         pszProgressMsg, pProgressData))
+        {
+            bInterrupted = true;
+            bRet = false;
+            break;
+        }
+
+        const int iYBlock = static_cast<int>(iSampleBlock / nBlocksPerRow);
+        const int iXBlock = static_cast<int>(iSampleBlock % nBlocksPerRow);
+
+        int nXCheck = 0, nYCheck = 0;
+        poBand->GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
+
+        std::vector<GByte> abyMaskData;
+        if (poMaskBand)
+        {
+            try
+            {
+                abyMaskData.resize(static_cast<size_t>(nBlockXSize) * nYCheck);
+            }
+            catch (const std::exception &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Out of memory allocating mask buffer");
+                bRet = false;
+                break;
+            }
+            if (poMaskBand->RasterIO(GF_Read, iXBlock * nBlockXSize,
+                                     iYBlock * nBlockYSize, nXCheck, nYCheck,
+                                     abyMaskData.data(), nXCheck, nYCheck,
+                                     GDT_Byte, 0, nBlockXSize,
+                                     nullptr) != CE_None)
+            {
+                bRet = false;
+                break;
+            }
+        }
+
+        GDALRasterBlock *poBlock = poBand->GetLockedBlockRef(iXBlock, iYBlock);
+        if (poBlock == nullptr)
+        {
+            bRet = false;
+            break;
+        }
+
+        poQueue->SubmitJob(
+            [&fnProcessBlock, poBlock, iSample, nXCheck, nYCheck,
+             abyMaskData = std::move(abyMaskData)]()
+            {
+                fnProcessBlock(iSample, poBlock->GetDataRef(),
+                               abyMaskData.empty() ? nullptr
+                                                   : abyMaskData.data(),
+                               nXCheck, nYCheck);
+                poBlock->DropLock();
+            });
+
+        poQueue->WaitCompletion(nMaxPendingJobs);
+    }
+    poQueue->WaitCompletion();
+
+    return bRet;
+}
+
+/************************************************************************/
+/*                          MergeMeanAndM2()                            */
+/************************************************************************/
+
+// Update the global mean and M2 (the sum of squares of differences to the
+// mean) from the ones of a subset of the samples, using
+// https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Parallel_algorithm
+static void MergeMeanAndM2(double dfBlockMean, double dfBlockM2,
+                           GUIntBig nBlockValidCount, double &dfMean,
+                           double &dfM2, GUIntBig &nValidCount)
+{
+    if (nBlockValidCount == 0)
+        return;
+    const auto nNewValidCount = nValidCount + nBlockValidCount;
+    if (nValidCount == 0)
+    {
+        dfMean = dfBlockMean;
+        dfM2 = dfBlockM2;
+    }
+    else
+    {
+        const double dfBlockValidCount = static_cast<double>(nBlockValidCount);
+        const double dfDelta = dfBlockMean - dfMean;
+        const double dfNewValidCount = static_cast<double>(nNewValidCount);
+        dfMean += dfDelta * (dfBlockValidCount / dfNewValidCount);
+        dfM2 += dfBlockM2 + dfDelta * dfDelta *
+                                static_cast<double>(nValidCount) *
+                                dfBlockValidCount / dfNewValidCount;
+    }
+    nValidCount = nNewValidCount;
+}
+
+/************************************************************************/
+/*                        AddBlockToHistogram()                         */
+/************************************************************************/
+
+// Accumulate the values of a block (whose line stride is nBlockXSize) into
+// panHistogram.
+static void AddBlockToHistogram(GDALDataType eDataType, bool bSignedByte,
+                                void *pData, const GByte *pabyMaskData,
+                                int nXCheck, int nYCheck, int nBlockXSize,
+                                int nBlockYSize,
+                                const GDALNoDataValues &sNoDataValues,
+                                double dfMin, double dfScale, int nBuckets,
+                                int bIncludeOutOfRange, GUIntBig *panHistogram)
+{
+    // this is a special case for a common situation.
+    if (eDataType == GDT_Byte && !bSignedByte && dfScale == 1.0 &&
+        (dfMin >= -0.5 && dfMin <= 0.5) && nYCheck == nBlockYSize &&
+        nXCheck == nBlockXSize && nBuckets == 256)
+    {
+        const GPtrDiff_t nPixels = static_cast<GPtrDiff_t>(nXCheck) * nYCheck;
+        GByte *pabyData = static_cast<GByte *>(pData);
+
+        for (GPtrDiff_t i = 0; i < nPixels; i++)
+        {
+            if (pabyMaskData && pabyMaskData[i] == 0)
+                continue;
+            if (!(sNoDataValues.bGotNoDataValue &&
+                  (pabyData[i] ==
+                   static_cast<GByte>(sNoDataValues.dfNoDataValue))))
+            {
+                panHistogram[pabyData[i]]++;
+            }
+        }
+
+        return;
+    }
+
+    // This isn't the fastest way to do this, but is easier for now.
+    for (int iY = 0; iY < nYCheck; iY++)
+    {
+        for (int iX = 0; iX < nXCheck; iX++)
+        {
+            const GPtrDiff_t iOffset =
+                iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
+
+            if (pabyMaskData && pabyMaskData[iOffset] == 0)
+                continue;
+
+            double dfValue = 0.0;
+
+            switch (eDataType)
+            {
+                case GDT_Byte:
+                {
+                    if (bSignedByte)
+                        dfValue = static_cast<signed char *>(pData)[iOffset];
+                    else
+                        dfValue = static_cast<GByte *>(pData)[iOffset];
+                    break;
+                }
+                case GDT_Int8:
+                    dfValue = static_cast<GInt8 *>(pData)[iOffset];
+                    break;
+                case GDT_UInt16:
+                    dfValue = static_cast<GUInt16 *>(pData)[iOffset];
+                    break;
+                case GDT_Int16:
+                    dfValue = static_cast<GInt16 *>(pData)[iOffset];
+                    break;
+                case GDT_UInt32:
+                    dfValue = static_cast<GUInt32 *>(pData)[iOffset];
+                    break;
+                case GDT_Int32:
+                    dfValue = static_cast<GInt32 *>(pData)[iOffset];
+                    break;
+                case GDT_UInt64:
+                    dfValue = static_cast<double>(
+                        static_cast<GUInt64 *>(pData)[iOffset]);
+                    break;
+                case GDT_Int64:
+                    dfValue = static_cast<double>(
+                        static_cast<GInt64 *>(pData)[iOffset]);
+                    break;
+                case GDT_Float16:
+                {
+                    using namespace std;
+                    const GFloat16 hfValue =
+                        static_cast<GFloat16 *>(pData)[iOffset];
+                    if (isnan(hfValue) ||
+                        (sNoDataValues.bGotFloat16NoDataValue &&
+                         ARE_REAL_EQUAL(hfValue, sNoDataValues.hfNoDataValue)))
+                        continue;
+                    dfValue = hfValue;
+                    break;
+                }
+                case GDT_Float32:
+                {
+                    const float fValue = static_cast<float *>(pData)[iOffset];
+                    if (std::isnan(fValue) ||
+                        (sNoDataValues.bGotFloatNoDataValue &&
+                         ARE_REAL_EQUAL(fValue, sNoDataValues.fNoDataValue)))
+                        continue;
+                    dfValue = double(fValue);
+                    break;
+                }
+                case GDT_Float64:
+                    dfValue = static_cast<double *>(pData)[iOffset];
+                    if (std::isnan(dfValue))
+                        continue;
+                    break;
+                case GDT_CInt16:
+                {
+                    double dfReal = static_cast<GInt16 *>(pData)[iOffset * 2];
+                    double dfImag =
+                        static_cast<GInt16 *>(pData)[iOffset * 2 + 1];
+                    dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
+                    break;
+                }
+                case GDT_CInt32:
+                {
+                    double dfReal = static_cast<GInt32 *>(pData)[iOffset * 2];
+                    double dfImag =
+                        static_cast<GInt32 *>(pData)[iOffset * 2 + 1];
+                    dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
+                    break;
+                }
+                case GDT_CFloat16:
+                {
+                    double dfReal =
+                        static_cast<GFloat16 *>(pData)[iOffset * 2];
+                    double dfImag =
+                        static_cast<GFloat16 *>(pData)[iOffset * 2 + 1];
+                    if (std::isnan(dfReal) || std::isnan(dfImag))
+                        continue;
+                    dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
+                    break;
+                }
+                case GDT_CFloat32:
+                {
+                    double dfReal =
+                        double(static_cast<float *>(pData)[iOffset * 2]);
+                    double dfImag =
+                        double(static_cast<float *>(pData)[iOffset * 2 + 1]);
+                    if (std::isnan(dfReal) || std::isnan(dfImag))
+                        continue;
+                    dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
+                    break;
+                }
+                case GDT_CFloat64:
+                {
+                    double dfReal = static_cast<double *>(pData)[iOffset * 2];
+                    double dfImag =
+                        static_cast<double *>(pData)[iOffset * 2 + 1];
+                    if (std::isnan(dfReal) || std::isnan(dfImag))
+                        continue;
+                    dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
+                    break;
+                }
+                case GDT_Unknown:
+                case GDT_TypeCount:
+                    CPLAssert(false);
+                    return;
+            }
+
+            if (eDataType != GDT_Float16 && eDataType != GDT_Float32 &&
+                sNoDataValues.bGotNoDataValue &&
+                ARE_REAL_EQUAL(dfValue, sNoDataValues.dfNoDataValue))
+                continue;
+
+            // Given that dfValue and dfMin are not NaN, and dfScale > 0
+            // and finite, the result of the multiplication cannot be
+            // NaN
+            const double dfIndex = floor((dfValue - dfMin) * dfScale);
+
+            if (dfIndex < 0)
+            {
+                if (bIncludeOutOfRange)
+                    panHistogram[0]++;
+            }
+            else if (dfIndex >= nBuckets)
+            {
+                if (bIncludeOutOfRange)
+                    ++panHistogram[nBuckets - 1];
+            }
+            else
+            {
+                ++panHistogram[static_cast<int>(dfIndex)];
+            }
+        }
+    }
+}
+
 /************************************************************************/
 /*                            GetHistogram()                            */
 /************************************************************************/
@@ -4519,252 +4940,147 @@ CPLErr GDALRasterBand::GetHistogram(double dfMin, double dfMax, int nBuckets,
                 nSampleRate += 1;
         }
 
-        GByte *pabyMaskData = nullptr;
-        if (poMaskBand)
-        {
-            pabyMaskData = static_cast<GByte *>(
-                VSI_MALLOC2_VERBOSE(nBlockXSize, nBlockYSize));
-            if (!pabyMaskData)
+        const GIntBig nSampledBlocks = DIV_ROUND_UP(
+            static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn,
+            nSampleRate);
+        const int nThreads =
+            GDALGetNumThreadsForBlockStatistics(nSampledBlocks);
+        if (nThreads > 1)
+        {
+            // Each job accumulates into a histogram taken from a pool, so
+            // that there are no more histograms than jobs running at the
+            // same time. They are summed at the end.
+            std::mutex oMutex;
+            std::list<std::vector<GUIntBig>> aanHistograms;
+            std::vector<std::vector<GUIntBig> *> apanFreeHistograms;
+            bool bOutOfMemory = false;
+
+            bool bInterrupted = false;
+            const bool bOK = GDALProcessSampledBlocks(
+                this, poMaskBand, nSampleRate, nThreads, "Compute Histogram",
+                pfnProgress, pProgressData, bInterrupted,
+                [this, bSignedByte, &sNoDataValues, dfMin, dfScale, nBuckets,
+                 bIncludeOutOfRange, &oMutex, &aanHistograms,
+                 &apanFreeHistograms, &bOutOfMemory](
+                    GIntBig, void *pData, const GByte *pabyMaskData,
+                    int nXCheck, int nYCheck)
+                {
+                    std::vector<GUIntBig> *panJobHistogram = nullptr;
+                    {
+                        std::lock_guard oLock(oMutex);
+                        if (!apanFreeHistograms.empty())
+                        {
+                            panJobHistogram = apanFreeHistograms.back();
+                            apanFreeHistograms.pop_back();
+                        }
+                        else
+                        {
+                            try
+                            {
+                                aanHistograms.emplace_back(nBuckets);
+                            }
+                            catch (const std::exception &)
+                            {
+                                bOutOfMemory = true;
+                                return;
+                            }
+                            panJobHistogram = &aanHistograms.back();
+                        }
+                    }
+
+                    AddBlockToHistogram(eDataType, bSignedByte, pData,
+                                        pabyMaskData, nXCheck, nYCheck,
+                                        nBlockXSize, nBlockYSize,
+                                        sNoDataValues, dfMin, dfScale, nBuckets,
+                                        bIncludeOutOfRange,
+                                        panJobHistogram->data());
+
+                    std::lock_guard oLock(oMutex);
+                    apanFreeHistograms.push_back(panJobHistogram);
+                });
+            if (bOutOfMemory)
             {
+                ReportError(CE_Failure, CPLE_OutOfMemory,
+                            "Out of memory allocating histogram");
                 return CE_Failure;
             }
-        }
+            if (!bOK)
+                return CE_Failure;
 
-        /* --------------------------------------------------------------------
-         */
-        /*      Read the blocks, and add to histogram. */
-        /* --------------------------------------------------------------------
-         */
-        for (GIntBig iSampleBlock = 0;
-             iSampleBlock <
-             static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
-             iSampleBlock += nSampleRate)
-        {
-            if (!pfnProgress(
-                    static_cast<double>(iSampleBlock) /
-                        (static_cast<double>(nBlocksPerRow) * nBlocksPerColumn),
-                    "Compute Histogram", pProgressData))
+            for (const auto &anHistogram : aanHistograms)
             {
-                CPLFree(pabyMaskData);
-                return CE_Failure;
+                for (int i = 0; i < nBuckets; ++i)
+                    panHistogram[i] += anHistogram[i];
             }
-
-            const int iYBlock = static_cast<int>(iSampleBlock / nBlocksPerRow);
-            const int iXBlock = static_cast<int>(iSampleBlock % nBlocksPerRow);
-
-            int nXCheck = 0, nYCheck = 0;
-            GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
-
-            if (poMaskBand &&
-                poMaskBand->RasterIO(GF_Read, iXBlock * nBlockXSize,
-                                     iYBlock * nBlockYSize, nXCheck, nYCheck,
-                                     pabyMaskData, nXCheck, nYCheck, GDT_Byte,
-                                     0, nBlockXSize, nullptr) != CE_None)
+        }
+        else
+        {
+            GByte *pabyMaskData = nullptr;
+            if (poMaskBand)
             {
-                CPLFree(pabyMaskData);
-                return CE_Failure;
+                pabyMaskData = static_cast<GByte *>(
+                    VSI_MALLOC2_VERBOSE(nBlockXSize, nBlockYSize));
+                if (!pabyMaskData)
+                {
+                    return CE_Failure;
+                }
             }
 
-            GDALRasterBlock *poBlock = GetLockedBlockRef(iXBlock, iYBlock);
-            if (poBlock == nullptr)
+            /* ----------------------------------------------------------------
+             */
+            /*      Read the blocks, and add to histogram. */
+            /* ----------------------------------------------------------------
+             */
+            for (GIntBig iSampleBlock = 0;
+                 iSampleBlock <
+                 static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
+                 iSampleBlock += nSampleRate)
             {
-                CPLFree(pabyMaskData);
-                return CE_Failure;
-            }
+                if (!pfnProgress(static_cast<double>(iSampleBlock) /
+                                     (static_cast<double>(nBlocksPerRow) *
+                                      nBlocksPerColumn),
+                                 "Compute Histogram", pProgressData))
+                {
+                    CPLFree(pabyMaskData);
+                    return CE_Failure;
+                }
+
+                const int iYBlock =
+                    static_cast<int>(iSampleBlock / nBlocksPerRow);
+                const int iXBlock =
+                    static_cast<int>(iSampleBlock % nBlocksPerRow);
 
-            void *pData = poBlock->GetDataRef();
+                int nXCheck = 0, nYCheck = 0;
+                GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
 
-            // this is a special case for a common situation.
-            if (eDataType == GDT_Byte && !bSignedByte && dfScale == 1.0 &&
-                (dfMin >= -0.5 && dfMin <= 0.5) && nYCheck == nBlockYSize &&
-                nXCheck == nBlockXSize && nBuckets == 256)
-            {
-                const GPtrDiff_t nPixels =
-                    static_cast<GPtrDiff_t>(nXCheck) * nYCheck;
-                GByte *pabyData = static_cast<GByte *>(pData);
+                if (poMaskBand &&
+                    poMaskBand->RasterIO(
+                        GF_Read, iXBlock * nBlockXSize, iYBlock * nBlockYSize,
+                        nXCheck, nYCheck, pabyMaskData, nXCheck, nYCheck,
+                        GDT_Byte, 0, nBlockXSize, nullptr) != CE_None)
+                {
+                    CPLFree(pabyMaskData);
+                    return CE_Failure;
+                }
 
-                for (GPtrDiff_t i = 0; i < nPixels; i++)
+                GDALRasterBlock *poBlock = GetLockedBlockRef(iXBlock, iYBlock);
+                if (poBlock == nullptr)
                 {
-                    if (pabyMaskData && pabyMaskData[i] == 0)
-                        continue;
-                    if (!(sNoDataValues.bGotNoDataValue &&
-                          (pabyData[i] ==
-                           static_cast<GByte>(sNoDataValues.dfNoDataValue))))
-                    {
-                        panHistogram[pabyData[i]]++;
-                    }
+                    CPLFree(pabyMaskData);
+                    return CE_Failure;
                 }
 
+                AddBlockToHistogram(eDataType, bSignedByte,
+                                    poBlock->GetDataRef(), pabyMaskData,
+                                    nXCheck, nYCheck, nBlockXSize, nBlockYSize,
+                                    sNoDataValues, dfMin, dfScale, nBuckets,
+                                    bIncludeOutOfRange, panHistogram);
+
                 poBlock->DropLock();
-                continue;  // To next sample block.
             }
 
-            // This isn't the fastest way to do this, but is easier for now.
-            for (int iY = 0; iY < nYCheck; iY++)
-            {
-                for (int iX = 0; iX < nXCheck; iX++)
-                {
-                    const GPtrDiff_t iOffset =
-                        iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
-
-                    if (pabyMaskData && pabyMaskData[iOffset] == 0)
-                        continue;
-
-                    double dfValue = 0.0;
-
-                    switch (eDataType)
-                    {
-                        case GDT_Byte:
-                        {
-                            if (bSignedByte)
-                                dfValue =
-                                    static_cast<signed char *>(pData)[iOffset];
-                            else
-                                dfValue = static_cast<GByte *>(pData)[iOffset];
-                            break;
-                        }
-                        case GDT_Int8:
-                            dfValue = static_cast<GInt8 *>(pData)[iOffset];
-                            break;
-                        case GDT_UInt16:
-                            dfValue = static_cast<GUInt16 *>(pData)[iOffset];
-                            break;
-                        case GDT_Int16:
-                            dfValue = static_cast<GInt16 *>(pData)[iOffset];
-                            break;
-                        case GDT_UInt32:
-                            dfValue = static_cast<GUInt32 *>(pData)[iOffset];
-                            break;
-                        case GDT_Int32:
-                            dfValue = static_cast<GInt32 *>(pData)[iOffset];
-                            break;
-                        case GDT_UInt64:
-                            dfValue = static_cast<double>(
-                                static_cast<GUInt64 *>(pData)[iOffset]);
-                            break;
-                        case GDT_Int64:
-                            dfValue = static_cast<double>(
-                                static_cast<GInt64 *>(pData)[iOffset]);
-                            break;
-                        case GDT_Float16:
-                        {
-                            using namespace std;
-                            const GFloat16 hfValue =
-                                static_cast<GFloat16 *>(pData)[iOffset];
-                            if (isnan(hfValue) ||
-                                (sNoDataValues.bGotFloat16NoDataValue &&
-                                 ARE_REAL_EQUAL(hfValue,
-                                                sNoDataValues.hfNoDataValue)))
-                                continue;
-                            dfValue = hfValue;
-                            break;
-                        }
-                        case GDT_Float32:
-                        {
-                            const float fValue =
-                                static_cast<float *>(pData)[iOffset];
-                            if (std::isnan(fValue) ||
-                                (sNoDataValues.bGotFloatNoDataValue &&
-                                 ARE_REAL_EQUAL(fValue,
-                                                sNoDataValues.fNoDataValue)))
-                                continue;
-                            dfValue = double(fValue);
-                            break;
-                        }
-                        case GDT_Float64:
-                            dfValue = static_cast<double *>(pData)[iOffset];
-                            if (std::isnan(dfValue))
-                                continue;
-                            break;
-                        case GDT_CInt16:
-                        {
-                            double dfReal =
-                                static_cast<GInt16 *>(pData)[iOffset * 2];
-                            double dfImag =
-                                static_cast<GInt16 *>(pData)[iOffset * 2 + 1];
-                            dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
-                            break;
-                        }
-                        case GDT_CInt32:
-                        {
-                            double dfReal =
-                                static_cast<GInt32 *>(pData)[iOffset * 2];
-                            double dfImag =
-                                static_cast<GInt32 *>(pData)[iOffset * 2 + 1];
-                            dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
-                            break;
-                        }
-                        case GDT_CFloat16:
-                        {
-                            double dfReal =
-                                static_cast<GFloat16 *>(pData)[iOffset * 2];
-                            double dfImag =
-                                static_cast<GFloat16 *>(pData)[iOffset * 2 + 1];
-                            if (std::isnan(dfReal) || std::isnan(dfImag))
-                                continue;
-                            dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
-                            break;
-                        }
-                        case GDT_CFloat32:
-                        {
-                            double dfReal = double(
-                                static_cast<float *>(pData)[iOffset * 2]);
-                            double dfImag = double(
-                                static_cast<float *>(pData)[iOffset * 2 + 1]);
-                            if (std::isnan(dfReal) || std::isnan(dfImag))
-                                continue;
-                            dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
-                            break;
-                        }
-                        case GDT_CFloat64:
-                        {
-                            double dfReal =
-                                static_cast<double *>(pData)[iOffset * 2];
-                            double dfImag =
-                                static_cast<double *>(pData)[iOffset * 2 + 1];
-                            if (std::isnan(dfReal) || std::isnan(dfImag))
-                                continue;
-                            dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
-                            break;
-                        }
-                        case GDT_Unknown:
-                        case GDT_TypeCount:
-                            CPLAssert(false);
-                            CPLFree(pabyMaskData);
-                            return CE_Failure;
-                    }
-
-                    if (eDataType != GDT_Float16 && eDataType != GDT_Float32 &&
-                        sNoDataValues.bGotNoDataValue &&
-                        ARE_REAL_EQUAL(dfValue, sNoDataValues.dfNoDataValue))
-                        continue;
-
-                    // Given that dfValue and dfMin are not NaN, and dfScale > 0
-                    // and finite, the result of the multiplication cannot be
-                    // NaN
-                    const double dfIndex = floor((dfValue - dfMin) * dfScale);
-
-                    if (dfIndex < 0)
-                    {
-                        if (bIncludeOutOfRange)
-                            panHistogram[0]++;
-                    }
-                    else if (dfIndex >= nBuckets)
-                    {
-                        if (bIncludeOutOfRange)
-                            ++panHistogram[nBuckets - 1];
-                    }
-                    else
-                    {
-                        ++panHistogram[static_cast<int>(dfIndex)];
-                    }
-                }
-            }
-
-            poBlock->DropLock();
+            CPLFree(pabyMaskData);
         }
-
-        CPLFree(pabyMaskData);
     }
 
     pfnProgress(1.0, "Compute Histogram", pProgressData);
@@ -6868,6 +7184,321 @@ ComputeStatisticsFloat64_SSE2(const double *padfData,
 
 #endif
 
+/************************************************************************/
+/*                   ComputeBlockStatisticsFloat32()                    */
+/************************************************************************/
+
+// Update fMin, fMax and compute the mean and M2 (the sum of squares of
+// differences to the mean) of the valid values of a Float32 block.
+static void ComputeBlockStatisticsFloat32(
+    const void *pData, int nXCheck, int nYCheck, int nBlockXSize,
+    bool bHasNoData, float fNoDataValue, float &fMin, float &fMax,
+    float &fBlockMean, float &fBlockM2, int &nBlockValidCount)
+{
+    for (int iY = 0; iY < nYCheck; iY++)
+    {
+        const int iOffset = iY * nBlockXSize;
+        if (nBlockValidCount && fMin != fMax)
+        {
+            int iX = 0;
+#if (defined(__x86_64__) || defined(_M_X64))
+            if (bHasNoData)
+            {
+                iX = ComputeStatisticsFloat32_SSE2</* bCheckMinEqMax = */ false,
+                                                   /* bHasNoData = */ true>(
+                    static_cast<const float *>(pData) + iOffset, fNoDataValue,
+                    iX, nXCheck, fMin, fMax, fBlockMean, fBlockM2,
+                    nBlockValidCount);
+            }
+            else
+            {
+                iX = ComputeStatisticsFloat32_SSE2</* bCheckMinEqMax = */ false,
+                                                   /* bHasNoData = */ false>(
+                    static_cast<const float *>(pData) + iOffset, fNoDataValue,
+                    iX, nXCheck, fMin, fMax, fBlockMean, fBlockM2,
+                    nBlockValidCount);
+            }
+#endif
+            for (; iX < nXCheck; iX++)
+            {
+                const float fValue =
+                    static_cast<const float *>(pData)[iOffset + iX];
+                if (std::isnan(fValue) ||
+                    (bHasNoData && fValue == fNoDataValue))
+                    continue;
+                fMin = std::min(fMin, fValue);
+                fMax = std::max(fMax, fValue);
+                ++nBlockValidCount;
+                const float fDelta = fValue - fBlockMean;
+                fBlockMean += fDelta / static_cast<float>(nBlockValidCount);
+                fBlockM2 += fDelta * (fValue - fBlockMean);
+            }
+        }
+        else
+        {
+            int iX = 0;
+            if (nBlockValidCount == 0)
+            {
+                for (; iX < nXCheck; iX++)
+                {
+                    const float fValue =
+                        static_cast<const float *>(pData)[iOffset + iX];
+                    if (std::isnan(fValue) ||
+                        (bHasNoData && fValue == fNoDataValue))
+                        continue;
+                    fMin = std::min(fMin, fValue);
+                    fMax = std::max(fMax, fValue);
+                    nBlockValidCount = 1;
+                    fBlockMean = fValue;
+                    iX++;
+                    break;
+                }
+            }
+#if (defined(__x86_64__) || defined(_M_X64))
+            if (bHasNoData)
+            {
+                iX = ComputeStatisticsFloat32_SSE2</* bCheckMinEqMax = */ true,
+                                                   /* bHasNoData = */ true>(
+                    static_cast<const float *>(pData) + iOffset, fNoDataValue,
+                    iX, nXCheck, fMin, fMax, fBlockMean, fBlockM2,
+                    nBlockValidCount);
+            }
+            else
+            {
+                iX = ComputeStatisticsFloat32_SSE2</* bCheckMinEqMax = */ true,
+                                                   /* bHasNoData = */ false>(
+                    static_cast<const float *>(pData) + iOffset, fNoDataValue,
+                    iX, nXCheck, fMin, fMax, fBlockMean, fBlockM2,
+                    nBlockValidCount);
+            }
+#endif
+            for (; iX < nXCheck; iX++)
+            {
+                const float fValue =
+                    static_cast<const float *>(pData)[iOffset + iX];
+                if (std::isnan(fValue) ||
+                    (bHasNoData && fValue == fNoDataValue))
+                    continue;
+                fMin = std::min(fMin, fValue);
+                fMax = std::max(fMax, fValue);
+                ++nBlockValidCount;
+                if (fMin != fMax)
+                {
+                    const float fDelta = fValue - fBlockMean;
+                    fBlockMean += fDelta / static_cast<float>(nBlockValidCount);
+                    fBlockM2 += fDelta * (fValue - fBlockMean);
+                }
+            }
+        }
+    }
+}
+
+#if (defined(__x86_64__) || defined(_M_X64))
+
+/************************************************************************/
+/*                   ComputeBlockStatisticsFloat64()                    */
+/************************************************************************/
+
+// Update dfMin, dfMax and compute the mean and M2 (the sum of squares of
+// differences to the mean) of the valid values of a Float64 block.
+static void ComputeBlockStatisticsFloat64(
+    const void *pData, int nXCheck, int nYCheck, int nBlockXSize,
+    bool bHasNoData, double dfNoDataValue, double &dfMin, double &dfMax,
+    double &dfBlockMean, double &dfBlockM2, double &dfBlockValidCount)
+{
+    for (int iY = 0; iY < nYCheck; iY++)
+    {
+        const int iOffset = iY * nBlockXSize;
+        if (dfBlockValidCount != 0 && dfMin != dfMax)
+        {
+            int iX = 0;
+            if (bHasNoData)
+            {
+                iX = ComputeStatisticsFloat64_SSE2</* bCheckMinEqMax = */ false,
+                                                   /* bHasNoData = */ true>(
+                    static_cast<const double *>(pData) + iOffset,
+                    dfNoDataValue, iX, nXCheck, dfMin, dfMax, dfBlockMean,
+                    dfBlockM2, dfBlockValidCount);
+            }
+            else
+            {
+                iX = ComputeStatisticsFloat64_SSE2</* bCheckMinEqMax = */ false,
+                                                   /* bHasNoData = */ false>(
+                    static_cast<const double *>(pData) + iOffset,
+                    dfNoDataValue, iX, nXCheck, dfMin, dfMax, dfBlockMean,
+                    dfBlockM2, dfBlockValidCount);
+            }
+            for (; iX < nXCheck; iX++)
+            {
+                const double dfValue =
+                    static_cast<const double *>(pData)[iOffset + iX];
+                if (std::isnan(dfValue) ||
+                    (bHasNoData && dfValue == dfNoDataValue))
+                    continue;
+                dfMin = std::min(dfMin, dfValue);
+                dfMax = std::max(dfMax, dfValue);
+                dfBlockValidCount += 1.0;
+                const double dfDelta = dfValue - dfBlockMean;
+                dfBlockMean += dfDelta / dfBlockValidCount;
+                dfBlockM2 += dfDelta * (dfValue - dfBlockMean);
+            }
+        }
+        else
+        {
+            int iX = 0;
+            if (dfBlockValidCount == 0)
+            {
+                for (; iX < nXCheck; iX++)
+                {
+                    const double dfValue =
+                        static_cast<const double *>(pData)[iOffset + iX];
+                    if (std::isnan(dfValue) ||
+                        (bHasNoData && dfValue == dfNoDataValue))
+                        continue;
+                    dfMin = std::min(dfMin, dfValue);
+                    dfMax = std::max(dfMax, dfValue);
+                    dfBlockValidCount = 1;
+                    dfBlockMean = dfValue;
+                    iX++;
+                    break;
+                }
+            }
+            if (bHasNoData)
+            {
+                iX = ComputeStatisticsFloat64_SSE2</* bCheckMinEqMax = */ true,
+                                                   /* bHasNoData = */ true>(
+                    static_cast<const double *>(pData) + iOffset,
+                    dfNoDataValue, iX, nXCheck, dfMin, dfMax, dfBlockMean,
+                    dfBlockM2, dfBlockValidCount);
+            }
+            else
+            {
+                iX = ComputeStatisticsFloat64_SSE2</* bCheckMinEqMax = */ true,
+                                                   /* bHasNoData = */ false>(
+                    static_cast<const double *>(pData) + iOffset,
+                    dfNoDataValue, iX, nXCheck, dfMin, dfMax, dfBlockMean,
+                    dfBlockM2, dfBlockValidCount);
+            }
+            for (; iX < nXCheck; iX++)
+            {
+                const double dfValue =
+                    static_cast<const double *>(pData)[iOffset + iX];
+                if (std::isnan(dfValue) ||
+                    (bHasNoData && dfValue == dfNoDataValue))
+                    continue;
+                dfMin = std::min(dfMin, dfValue);
+                dfMax = std::max(dfMax, dfValue);
+                dfBlockValidCount += 1.0;
+                if (dfMin != dfMax)
+                {
+                    const double dfDelta = dfValue - dfBlockMean;
+                    dfBlockMean += dfDelta / dfBlockValidCount;
+                    dfBlockM2 += dfDelta * (dfValue - dfBlockMean);
+                }
+            }
+        }
+    }
+}
+
+#endif  // (defined(__x86_64__) || defined(_M_X64))
+
+/************************************************************************/
+/*                   ComputeBlockStatisticsGeneric()                    */
+/************************************************************************/
+
+// Update the running dfMin, dfMax, dfMean, dfM2 and nValidCount with the
+// valid values of a block of any data type.
+static void ComputeBlockStatisticsGeneric(
+    GDALDataType eDataType, bool bSignedByte, const void *pData,
+    const GByte *pabyMaskData, int nXCheck, int nYCheck, int nBlockXSize,
+    const GDALNoDataValues &sNoDataValues, double &dfMin, double &dfMax,
+    double &dfMean, double &dfM2, GUIntBig &nValidCount)
+{
+    // This isn't the fastest way to do this, but is easier for now.
+    for (int iY = 0; iY < nYCheck; iY++)
+    {
+        if (nValidCount && dfMin != dfMax)
+        {
+            for (int iX = 0; iX < nXCheck; iX++)
+            {
+                const GPtrDiff_t iOffset =
+                    iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
+                if (pabyMaskData && pabyMaskData[iOffset] == 0)
+                    continue;
+
+                bool bValid = true;
+                double dfValue = GetPixelValue(eDataType, bSignedByte, pData,
+                                               iOffset, sNoDataValues, bValid);
+
+                if (!bValid)
+                    continue;
+
+                dfMin = std::min(dfMin, dfValue);
+                dfMax = std::max(dfMax, dfValue);
+
+                nValidCount++;
+                const double dfDelta = dfValue - dfMean;
+                dfMean += dfDelta / nValidCount;
+                dfM2 += dfDelta * (dfValue - dfMean);
+            }
+        }
+        else
+        {
+            int iX = 0;
+            if (nValidCount == 0)
+            {
+                for (; iX < nXCheck; iX++)
+                {
+                    const GPtrDiff_t iOffset =
+                        iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
+                    if (pabyMaskData && pabyMaskData[iOffset] == 0)
+                        continue;
+
+                    bool bValid = true;
+                    double dfValue =
+                        GetPixelValue(eDataType, bSignedByte, pData, iOffset,
+                                      sNoDataValues, bValid);
+
+                    if (!bValid)
+                        continue;
+
+                    dfMin = dfValue;
+                    dfMax = dfValue;
+                    dfMean = dfValue;
+                    nValidCount = 1;
+                    iX++;
+                    break;
+                }
+            }
+            for (; iX < nXCheck; iX++)
+            {
+                const GPtrDiff_t iOffset =
+                    iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
+                if (pabyMaskData && pabyMaskData[iOffset] == 0)
+                    continue;
+
+                bool bValid = true;
+                double dfValue = GetPixelValue(eDataType, bSignedByte, pData,
+                                               iOffset, sNoDataValues, bValid);
+
+                if (!bValid)
+                    continue;
+
+                dfMin = std::min(dfMin, dfValue);
+                dfMax = std::max(dfMax, dfValue);
+
+                nValidCount++;
+                if (dfMin != dfMax)
+                {
+                    const double dfDelta = dfValue - dfMean;
+                    dfMean += dfDelta / nValidCount;
+                    dfM2 += dfDelta * (dfValue - dfMean);
+                }
+            }
+        }
+    }
+}
+
 /************************************************************************/
 /*                         ComputeStatistics()                          */
 /************************************************************************/
@@ -7124,16 +7755,26 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
         if (nSampleRate == 1)
             bApproxOK = false;
 
-        // Particular case for GDT_Byte and GUInt16 that only use integral types
-        // for each block, and possibly for the whole raster.
+        const GIntBig nSampledBlocks = DIV_ROUND_UP(
+            static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn,
+            nSampleRate);
+        // When several threads are used, the statistics of each sampled
+        // block are stored, and merged in block order afterwards, so that the
+        // result does not depend on the number of threads.
+        int nThreads = GDALGetNumThreadsForBlockStatistics(nSampledBlocks);
+
+        // Particular case for GDT_Byte, GDT_UInt16 and GDT_Int16 that only
+        // use integral types for each block, and possibly for the whole
+        // raster.
+        // GDT_Int16 values are shifted by 32768 to be processed as GUInt16.
         if (!poMaskBand && ((eDataType == GDT_Byte && !bSignedByte) ||
-                            eDataType == GDT_UInt16))
+                            eDataType == GDT_UInt16 || eDataType == GDT_Int16))
         {
             // We can do integer computation on the whole raster in the Byte case
             // only if the number of pixels explored is lower than
             // GUINTBIG_MAX / (255*255), so that nSumSquare can fit on a uint64.
             // Should be 99.99999% of cases.
-            // For GUInt16, this limits to raster of 4 giga pixels
+            // For GUInt16 and GInt16, this limits to raster of 4 giga pixels
 
             const bool bIntegerStats =
                 ((eDataType == GDT_Byte &&
@@ -7142,7 +7783,7 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                       GUINTBIG_MAX / (255U * 255U) /
                           (static_cast<GUInt64>(nBlockXSize) *
                            static_cast<GUInt64>(nBlockYSize))) ||
-                 (eDataType == GDT_UInt16 &&
+                 (eDataType != GDT_Byte &&
                   static_cast<GUIntBig>(nBlocksPerRow) * nBlocksPerColumn /
                           nSampleRate <
                       GUINTBIG_MAX / (65535U * 65535U) /
@@ -7154,117 +7795,206 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                     CPLGetConfigOption("GDAL_STATS_USE_INTEGER_STATS", "YES"));
 
             const GUInt32 nMaxValueType = (eDataType == GDT_Byte) ? 255 : 65535;
+            const GUInt32 nShift = (eDataType == GDT_Int16) ? 32768 : 0;
             GUInt32 nMin = nMaxValueType;
             GUInt32 nMax = 0;
             GUIntBig nSum = 0;
             GUIntBig nSumSquare = 0;
             // If no valid nodata, map to invalid value (256 for Byte)
+            const double dfNoDataValue = sNoDataValues.dfNoDataValue + nShift;
             const GUInt32 nNoDataValue =
-                (sNoDataValues.bGotNoDataValue &&
-                 sNoDataValues.dfNoDataValue >= 0 &&
-                 sNoDataValues.dfNoDataValue <= nMaxValueType &&
-                 fabs(sNoDataValues.dfNoDataValue -
-                      static_cast<GUInt32>(sNoDataValues.dfNoDataValue +
-                                           1e-10)) < 1e-10)
-                    ? static_cast<GUInt32>(sNoDataValues.dfNoDataValue + 1e-10)
+                (sNoDataValues.bGotNoDataValue && dfNoDataValue >= 0 &&
+                 dfNoDataValue <= nMaxValueType &&
+                 fabs(dfNoDataValue -
+                      static_cast<GUInt32>(dfNoDataValue + 1e-10)) < 1e-10)
+                    ? static_cast<GUInt32>(dfNoDataValue + 1e-10)
                     : nMaxValueType + 1;
 
-            for (GIntBig iSampleBlock = 0;
-                 iSampleBlock <
-                 static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
-                 iSampleBlock += nSampleRate)
+            struct IntegerBlockStats
             {
-                const int iYBlock =
-                    static_cast<int>(iSampleBlock / nBlocksPerRow);
-                const int iXBlock =
-                    static_cast<int>(iSampleBlock % nBlocksPerRow);
-
-                GDALRasterBlock *const poBlock =
-                    GetLockedBlockRef(iXBlock, iYBlock);
-                if (poBlock == nullptr)
-                    return CE_Failure;
-
-                void *const pData = poBlock->GetDataRef();
-
-                int nXCheck = 0, nYCheck = 0;
-                GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
-
-                GUIntBig nBlockSum = 0;
-                GUIntBig nBlockSumSquare = 0;
-                GUIntBig nBlockSampleCount = 0;
-                GUIntBig nBlockValidCount = 0;
-                GUIntBig &nBlockSumRef = bIntegerStats ? nSum : nBlockSum;
-                GUIntBig &nBlockSumSquareRef =
-                    bIntegerStats ? nSumSquare : nBlockSumSquare;
-                GUIntBig &nBlockSampleCountRef =
-                    bIntegerStats ? nSampleCount : nBlockSampleCount;
-                GUIntBig &nBlockValidCountRef =
-                    bIntegerStats ? nValidCount : nBlockValidCount;
-
+                GUInt32 nMin;
+                GUInt32 nMax;
+                GUIntBig nSum;
+                GUIntBig nSumSquare;
+                GUIntBig nSampleCount;
+                GUIntBig nValidCount;
+            };
+
+            const IntegerBlockStats sInitBlockStats{nMaxValueType, 0, 0, 0,
+                                                    0,             0};
+
+            const auto ComputeIntegerBlockStats =
+                [this, nMaxValueType, nNoDataValue](
+                    const void *pData, int nXCheck, int nYCheck,
+                    IntegerBlockStats &sBlockStats)
+            {
+                const bool bHasNoData = nNoDataValue <= nMaxValueType;
                 if (eDataType == GDT_Byte)
                 {
                     ComputeStatisticsInternal<
                         GByte, /* COMPUTE_OTHER_STATS = */ true>::
                         f(nXCheck, nBlockXSize, nYCheck,
-                          static_cast<const GByte *>(pData),
-                          nNoDataValue <= nMaxValueType, nNoDataValue, nMin,
-                          nMax, nBlockSumRef, nBlockSumSquareRef,
-                          nBlockSampleCountRef, nBlockValidCountRef);
+                          static_cast<const GByte *>(pData), bHasNoData,
+                          nNoDataValue, sBlockStats.nMin, sBlockStats.nMax,
+                          sBlockStats.nSum, sBlockStats.nSumSquare,
+                          sBlockStats.nSampleCount, sBlockStats.nValidCount);
                 }
-                else
+                else if (eDataType == GDT_UInt16)
                 {
                     ComputeStatisticsInternal<
                         GUInt16, /* COMPUTE_OTHER_STATS = */ true>::
                         f(nXCheck, nBlockXSize, nYCheck,
-                          static_cast<const GUInt16 *>(pData),
-                          nNoDataValue <= nMaxValueType, nNoDataValue, nMin,
-                          nMax, nBlockSumRef, nBlockSumSquareRef,
-                          nBlockSampleCountRef, nBlockValidCountRef);
+                          static_cast<const GUInt16 *>(pData), bHasNoData,
+                          nNoDataValue, sBlockStats.nMin, sBlockStats.nMax,
+                          sBlockStats.nSum, sBlockStats.nSumSquare,
+                          sBlockStats.nSampleCount, sBlockStats.nValidCount);
+                }
+                else
+                {
+                    // Flip the sign bit of GInt16 values, chunk by chunk, so
+                    // that they can go through the GUInt16 code path.
+                    constexpr int CHUNK_SIZE = 4096;
+                    GUInt16 anChunk[CHUNK_SIZE];
+                    for (int iY = 0; iY < nYCheck; iY++)
+                    {
+                        const GUInt16 *panLine =
+                            static_cast<const GUInt16 *>(pData) +
+                            static_cast<size_t>(iY) * nBlockXSize;
+                        for (int iX = 0; iX < nXCheck; iX += CHUNK_SIZE)
+                        {
+                            const int nChunkSize =
+                                std::min(CHUNK_SIZE, nXCheck - iX);
+                            for (int i = 0; i < nChunkSize; ++i)
+                            {
+                                anChunk[i] =
+                                    static_cast<GUInt16>(panLine[iX + i] ^
+                                                         0x8000U);
+                            }
+                            ComputeStatisticsInternal<
+                                GUInt16, /* COMPUTE_OTHER_STATS = */ true>::
+                                f(nChunkSize, nChunkSize, 1, anChunk,
+                                  bHasNoData, nNoDataValue, sBlockStats.nMin,
+                                  sBlockStats.nMax, sBlockStats.nSum,
+                                  sBlockStats.nSumSquare,
+                                  sBlockStats.nSampleCount,
+                                  sBlockStats.nValidCount);
+                        }
+                    }
                 }
+            };
 
-                poBlock->DropLock();
+            const auto MergeIntegerBlockStats =
+                [bIntegerStats, &nMin, &nMax, &nSum, &nSumSquare, &nSampleCount,
+                 &nValidCount, &dfMean,
+                 &dfM2](const IntegerBlockStats &sBlockStats)
+            {
+                nMin = std::min(nMin, sBlockStats.nMin);
+                nMax = std::max(nMax, sBlockStats.nMax);
+                nSampleCount += sBlockStats.nSampleCount;
+                if (bIntegerStats)
+                {
+                    nSum += sBlockStats.nSum;
+                    nSumSquare += sBlockStats.nSumSquare;
+                    nValidCount += sBlockStats.nValidCount;
+                }
+                else if (sBlockStats.nValidCount)
+                {
+                    const double dfBlockValidCount =
+                        static_cast<double>(sBlockStats.nValidCount);
+                    const double dfBlockMean =
+                        static_cast<double>(sBlockStats.nSum) /
+                        dfBlockValidCount;
+                    const double dfBlockM2 =
+                        static_cast<double>(
+                            GDALUInt128::Mul(sBlockStats.nSumSquare,
+                                             sBlockStats.nValidCount) -
+                            GDALUInt128::Mul(sBlockStats.nSum,
+                                             sBlockStats.nSum)) /
+                        dfBlockValidCount;
+                    MergeMeanAndM2(dfBlockMean, dfBlockM2,
+                                   sBlockStats.nValidCount, dfMean, dfM2,
+                                   nValidCount);
+                }
+            };
+
+            std::vector<IntegerBlockStats> asBlockStats;
+            if (nThreads > 1)
+            {
+                try
+                {
+                    asBlockStats.resize(static_cast<size_t>(nSampledBlocks),
+                                        sInitBlockStats);
+                }
+                catch (const std::exception &)
+                {
+                    nThreads = 1;
+                }
+            }
 
-                if (!bIntegerStats)
+            if (nThreads > 1)
+            {
+                bool bInterrupted = false;
+                if (!GDALProcessSampledBlocks(
+                        this, nullptr, nSampleRate, nThreads,
+                        "Compute Statistics", pfnProgress, pProgressData,
+                        bInterrupted,
+                        [&ComputeIntegerBlockStats, &asBlockStats](
+                            GIntBig iSample, void *pData, const GByte *,
+                            int nXCheck, int nYCheck)
+                        {
+                            ComputeIntegerBlockStats(
+                                pData, nXCheck, nYCheck,
+                                asBlockStats[static_cast<size_t>(iSample)]);
+                        }))
                 {
-                    nSampleCount += nBlockSampleCount;
-                    if (nBlockValidCount)
+                    if (bInterrupted)
                     {
-                        // Update the global mean and M2 (the difference of the
-                        // square to the mean) from the values of the block
-                        // using https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Parallel_algorithm
-                        const double dfBlockValidCount =
-                            static_cast<double>(nBlockValidCount);
-                        const double dfBlockMean =
-                            static_cast<double>(nBlockSum) / dfBlockValidCount;
-                        const double dfBlockM2 =
-                            static_cast<double>(
-                                GDALUInt128::Mul(nBlockSumSquare,
-                                                 nBlockValidCount) -
-                                GDALUInt128::Mul(nBlockSum, nBlockSum)) /
-                            dfBlockValidCount;
-                        const double dfDelta = dfBlockMean - dfMean;
-                        const auto nNewValidCount =
-                            nValidCount + nBlockValidCount;
-                        const double dfNewValidCount =
-                            static_cast<double>(nNewValidCount);
-                        dfMean +=
-                            dfDelta * (dfBlockValidCount / dfNewValidCount);
-                        dfM2 +=
-                            dfBlockM2 + dfDelta * dfDelta *
-                                            static_cast<double>(nValidCount) *
-                                            dfBlockValidCount / dfNewValidCount;
-                        nValidCount = nNewValidCount;
+                        ReportError(CE_Failure, CPLE_UserInterrupt,
+                                    "User terminated");
                     }
+                    return CE_Failure;
                 }
 
-                if (!pfnProgress(static_cast<double>(iSampleBlock) /
-                                     (static_cast<double>(nBlocksPerRow) *
-                                      nBlocksPerColumn),
-                                 "Compute Statistics", pProgressData))
+                for (const auto &sBlockStats : asBlockStats)
+                    MergeIntegerBlockStats(sBlockStats);
+            }
+            else
+            {
+                for (GIntBig iSampleBlock = 0;
+                     iSampleBlock <
+                     static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
+                     iSampleBlock += nSampleRate)
                 {
-                    ReportError(CE_Failure, CPLE_UserInterrupt,
-                                "User terminated");
-                    return CE_Failure;
+                    const int iYBlock =
+                        static_cast<int>(iSampleBlock / nBlocksPerRow);
+                    const int iXBlock =
+                        static_cast<int>(iSampleBlock % nBlocksPerRow);
+
+                    GDALRasterBlock *const poBlock =
+                        GetLockedBlockRef(iXBlock, iYBlock);
+                    if (poBlock == nullptr)
+                        return CE_Failure;
+
+                    int nXCheck = 0, nYCheck = 0;
+                    GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
+
+                    IntegerBlockStats sBlockStats = sInitBlockStats;
+                    ComputeIntegerBlockStats(poBlock->GetDataRef(), nXCheck,
+                                             nYCheck, sBlockStats);
+
+                    poBlock->DropLock();
+
+                    MergeIntegerBlockStats(sBlockStats);
+
+                    if (!pfnProgress(static_cast<double>(iSampleBlock) /
+                                         (static_cast<double>(nBlocksPerRow) *
+                                          nBlocksPerColumn),
+                                     "Compute Statistics", pProgressData))
+                    {
+                        ReportError(CE_Failure, CPLE_UserInterrupt,
+                                    "User terminated");
+                        return CE_Failure;
+                    }
                 }
             }
 
@@ -7296,6 +8026,19 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                 dfStdDev = sqrt(dfM2 / static_cast<double>(nValidCount));
             }
 
+            // Undo the shift of GDT_Int16 values
+            if (nValidCount > 0)
+            {
+                dfMin = static_cast<double>(nMin) - nShift;
+                dfMax = static_cast<double>(nMax) - nShift;
+                dfMean -= nShift;
+            }
+            else
+            {
+                dfMin = 0;
+                dfMax = 0;
+            }
+
             /// Save computed information
             if (nValidCount > 0)
             {
@@ -7307,7 +8050,7 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                 {
                     SetMetadataItem("STATISTICS_APPROXIMATE", nullptr);
                 }
-                SetStatistics(nMin, nMax, dfMean, dfStdDev);
+                SetStatistics(dfMin, dfMax, dfMean, dfStdDev);
             }
 
             SetValidPercent(nSampleCount, nValidCount);
@@ -7318,9 +8061,9 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
             /* --------------------------------------------------------------------
              */
             if (pdfMin != nullptr)
-                *pdfMin = nValidCount ? nMin : 0;
+                *pdfMin = dfMin;
             if (pdfMax != nullptr)
-                *pdfMax = nValidCount ? nMax : 0;
+                *pdfMax = dfMax;
 
             if (pdfMean != nullptr)
                 *pdfMean = dfMean;
@@ -7337,468 +8080,236 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
             return CE_Failure;
         }
 
-        GByte *pabyMaskData = nullptr;
-        if (poMaskBand)
-        {
-            pabyMaskData = static_cast<GByte *>(
-                VSI_MALLOC2_VERBOSE(nBlockXSize, nBlockYSize));
-            if (!pabyMaskData)
-            {
-                return CE_Failure;
-            }
-        }
-
         float fMin = std::numeric_limits<float>::infinity();
         float fMax = -std::numeric_limits<float>::infinity();
         const bool bFloat32Optim =
-            eDataType == GDT_Float32 && !pabyMaskData &&
+            eDataType == GDT_Float32 && !poMaskBand &&
             nBlockXSize < std::numeric_limits<int>::max() / nBlockYSize &&
             CPLTestBool(
                 CPLGetConfigOption("GDAL_STATS_USE_FLOAT32_OPTIM", "YES"));
+        const bool bFloat32HasNoData = sNoDataValues.bGotFloatNoDataValue &&
+                                       !std::isnan(sNoDataValues.fNoDataValue);
 
 #if (defined(__x86_64__) || defined(_M_X64))
         const bool bFloat64Optim =
-            eDataType == GDT_Float64 && !pabyMaskData &&
+            eDataType == GDT_Float64 && !poMaskBand &&
             nBlockXSize < std::numeric_limits<int>::max() / nBlockYSize &&
             CPLTestBool(
                 CPLGetConfigOption("GDAL_STATS_USE_FLOAT64_OPTIM", "YES"));
+        const bool bFloat64HasNoData = sNoDataValues.bGotNoDataValue &&
+                                       !std::isnan(sNoDataValues.dfNoDataValue);
 #endif
 
-        for (GIntBig iSampleBlock = 0;
-             iSampleBlock <
-             static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
-             iSampleBlock += nSampleRate)
+        struct BlockStats
         {
-            const int iYBlock = static_cast<int>(iSampleBlock / nBlocksPerRow);
-            const int iXBlock = static_cast<int>(iSampleBlock % nBlocksPerRow);
-
-            int nXCheck = 0, nYCheck = 0;
-            GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
+            double dfMin;
+            double dfMax;
+            double dfMean;
+            double dfM2;
+            GUIntBig nSampleCount;
+            GUIntBig nValidCount;
+        };
 
-            if (poMaskBand &&
-                poMaskBand->RasterIO(GF_Read, iXBlock * nBlockXSize,
-                                     iYBlock * nBlockYSize, nXCheck, nYCheck,
-                                     pabyMaskData, nXCheck, nYCheck, GDT_Byte,
-                                     0, nBlockXSize, nullptr) != CE_None)
+        std::vector<BlockStats> asBlockStats;
+        if (nThreads > 1)
+        {
+            try
             {
-                CPLFree(pabyMaskData);
-                return CE_Failure;
+                asBlockStats.resize(
+                    static_cast<size_t>(nSampledBlocks),
+                    BlockStats{std::numeric_limits<double>::infinity(),
+                               -std::numeric_limits<double>::infinity(), 0.0,
+                               0.0, 0, 0});
             }
-
-            GDALRasterBlock *const poBlock =
-                GetLockedBlockRef(iXBlock, iYBlock);
-            if (poBlock == nullptr)
+            catch (const std::exception &)
             {
-                CPLFree(pabyMaskData);
-                return CE_Failure;
+                nThreads = 1;
             }
+        }
 
-            const void *const pData = poBlock->GetDataRef();
-
-            if (bFloat32Optim)
-            {
-                const bool bHasNoData = sNoDataValues.bGotFloatNoDataValue &&
-                                        !std::isnan(sNoDataValues.fNoDataValue);
-                float fBlockMean = 0.0f;
-                float fBlockM2 = 0.0f;
-                int nBlockValidCount = 0;
-                for (int iY = 0; iY < nYCheck; iY++)
-                {
-                    const int iOffset = iY * nBlockXSize;
-                    if (nBlockValidCount && fMin != fMax)
-                    {
-                        int iX = 0;
-#if (defined(__x86_64__) || defined(_M_X64))
-                        if (bHasNoData)
-                        {
-                            iX = ComputeStatisticsFloat32_SSE2<
-                                /* bCheckMinEqMax = */ false,
-                                /* bHasNoData = */ true>(
-                                static_cast<const float *>(pData) + iOffset,
-                                sNoDataValues.fNoDataValue, iX, nXCheck, fMin,
-                                fMax, fBlockMean, fBlockM2, nBlockValidCount);
-                        }
-                        else
-                        {
-                            iX = ComputeStatisticsFloat32_SSE2<
-                                /* bCheckMinEqMax = */ false,
-                                /* bHasNoData = */ false>(
-                                static_cast<const float *>(pData) + iOffset,
-                                sNoDataValues.fNoDataValue, iX, nXCheck, fMin,
-                                fMax, fBlockMean, fBlockM2, nBlockValidCount);
-                        }
-#endif
-                        for (; iX < nXCheck; iX++)
-                        {
-                            const float fValue =
-                                static_cast<const float *>(pData)[iOffset + iX];
-                            if (std::isnan(fValue) ||
-                                (bHasNoData &&
-                                 fValue == sNoDataValues.fNoDataValue))
-                                continue;
-                            fMin = std::min(fMin, fValue);
-                            fMax = std::max(fMax, fValue);
-                            ++nBlockValidCount;
-                            const float fDelta = fValue - fBlockMean;
-                            fBlockMean +=
-                                fDelta / static_cast<float>(nBlockValidCount);
-                            fBlockM2 += fDelta * (fValue - fBlockMean);
-                        }
-                    }
-                    else
+        if (nThreads > 1)
+        {
+            bool bInterrupted = false;
+            if (!GDALProcessSampledBlocks(
+                    this, poMaskBand, nSampleRate, nThreads,
+                    "Compute Statistics", pfnProgress, pProgressData,
+                    bInterrupted,
+                    [&](GIntBig iSample, void *pData, const GByte *pabyMaskData,
+                        int nXCheck, int nYCheck)
                     {
-                        int iX = 0;
-                        if (nBlockValidCount == 0)
+                        BlockStats &sBlockStats =
+                            asBlockStats[static_cast<size_t>(iSample)];
+                        sBlockStats.nSampleCount =
+                            static_cast<GUIntBig>(nXCheck) * nYCheck;
+                        if (bFloat32Optim)
                         {
-                            for (; iX < nXCheck; iX++)
-                            {
-                                const float fValue = static_cast<const float *>(
-                                    pData)[iOffset + iX];
-                                if (std::isnan(fValue) ||
-                                    (bHasNoData &&
-                                     fValue == sNoDataValues.fNoDataValue))
-                                    continue;
-                                fMin = std::min(fMin, fValue);
-                                fMax = std::max(fMax, fValue);
-                                nBlockValidCount = 1;
-                                fBlockMean = fValue;
-                                iX++;
-                                break;
-                            }
+                            float fBlockMin =
+                                std::numeric_limits<float>::infinity();
+                            float fBlockMax =
+                                -std::numeric_limits<float>::infinity();
+                            float fBlockMean = 0.0f;
+                            float fBlockM2 = 0.0f;
+                            int nBlockValidCount = 0;
+                            ComputeBlockStatisticsFloat32(
+                                pData, nXCheck, nYCheck, nBlockXSize,
+                                bFloat32HasNoData, sNoDataValues.fNoDataValue,
+                                fBlockMin, fBlockMax, fBlockMean, fBlockM2,
+                                nBlockValidCount);
+                            sBlockStats.dfMin = static_cast<double>(fBlockMin);
+                            sBlockStats.dfMax = static_cast<double>(fBlockMax);
+                            sBlockStats.dfMean =
+                                static_cast<double>(fBlockMean);
+                            sBlockStats.dfM2 = static_cast<double>(fBlockM2);
+                            sBlockStats.nValidCount = nBlockValidCount;
                         }
 #if (defined(__x86_64__) || defined(_M_X64))
-                        if (bHasNoData)
+                        else if (bFloat64Optim)
                         {
-                            iX = ComputeStatisticsFloat32_SSE2<
-                                /* bCheckMinEqMax = */ true,
-                                /* bHasNoData = */ true>(
-                                static_cast<const float *>(pData) + iOffset,
-                                sNoDataValues.fNoDataValue, iX, nXCheck, fMin,
-                                fMax, fBlockMean, fBlockM2, nBlockValidCount);
-                        }
-                        else
-                        {
-                            iX = ComputeStatisticsFloat32_SSE2<
-                                /* bCheckMinEqMax = */ true,
-                                /* bHasNoData = */ false>(
-                                static_cast<const float *>(pData) + iOffset,
-                                sNoDataValues.fNoDataValue, iX, nXCheck, fMin,
-                                fMax, fBlockMean, fBlockM2, nBlockValidCount);
+                            double dfBlockValidCount = 0;
+                            ComputeBlockStatisticsFloat64(
+                                pData, nXCheck, nYCheck, nBlockXSize,
+                                bFloat64HasNoData, sNoDataValues.dfNoDataValue,
+                                sBlockStats.dfMin, sBlockStats.dfMax,
+                                sBlockStats.dfMean, sBlockStats.dfM2,
+                                dfBlockValidCount);
+                            sBlockStats.nValidCount =
+                                static_cast<GUIntBig>(dfBlockValidCount);
                         }
 #endif
-                        for (; iX < nXCheck; iX++)
-                        {
-                            const float fValue =
-                                static_cast<const float *>(pData)[iOffset + iX];
-                            if (std::isnan(fValue) ||
-                                (bHasNoData &&
-                                 fValue == sNoDataValues.fNoDataValue))
-                                continue;
-                            fMin = std::min(fMin, fValue);
-                            fMax = std::max(fMax, fValue);
-                            ++nBlockValidCount;
-                            if (fMin != fMax)
-                            {
-                                const float fDelta = fValue - fBlockMean;
-                                fBlockMean += fDelta / static_cast<float>(
-                                                           nBlockValidCount);
-                                fBlockM2 += fDelta * (fValue - fBlockMean);
-                            }
-                        }
-                    }
-                }
-
-                if (nBlockValidCount)
-                {
-                    // Update the global mean and M2 (the difference of the
-                    // square to the mean) from the values of the block
-                    // using https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Parallel_algorithm
-                    const auto nNewValidCount = nValidCount + nBlockValidCount;
-                    const double dfBlockMean = static_cast<double>(fBlockMean);
-                    if (dfBlockMean != dfMean)
-                    {
-                        const double dfBlockM2 = static_cast<double>(fBlockM2);
-                        if (nValidCount == 0)
-                        {
-                            dfMean = dfBlockMean;
-                            dfM2 = dfBlockM2;
-                        }
                         else
                         {
-                            const double dfBlockValidCount =
-                                static_cast<double>(nBlockValidCount);
-                            const double dfDelta = dfBlockMean - dfMean;
-                            const double dfNewValidCount =
-                                static_cast<double>(nNewValidCount);
-                            dfMean +=
-                                dfDelta * (dfBlockValidCount / dfNewValidCount);
-                            dfM2 += dfBlockM2 +
-                                    dfDelta * dfDelta *
-                                        static_cast<double>(nValidCount) *
-                                        dfBlockValidCount / dfNewValidCount;
+                            ComputeBlockStatisticsGeneric(
+                                eDataType, bSignedByte, pData, pabyMaskData,
+                                nXCheck, nYCheck, nBlockXSize, sNoDataValues,
+                                sBlockStats.dfMin, sBlockStats.dfMax,
+                                sBlockStats.dfMean, sBlockStats.dfM2,
+                                sBlockStats.nValidCount);
                         }
-                    }
-                    nValidCount = nNewValidCount;
-                }
-            }
-
-#if (defined(__x86_64__) || defined(_M_X64))
-            else if (bFloat64Optim)
+                    }))
             {
-                const bool bHasNoData =
-                    sNoDataValues.bGotNoDataValue &&
-                    !std::isnan(sNoDataValues.dfNoDataValue);
-                double dfBlockMean = 0;
-                double dfBlockM2 = 0;
-                double dfBlockValidCount = 0;
-                for (int iY = 0; iY < nYCheck; iY++)
+                if (bInterrupted)
                 {
-                    const int iOffset = iY * nBlockXSize;
-                    if (dfBlockValidCount != 0 && dfMin != dfMax)
-                    {
-                        int iX = 0;
-                        if (bHasNoData)
-                        {
-                            iX = ComputeStatisticsFloat64_SSE2<
-                                /* bCheckMinEqMax = */ false,
-                                /* bHasNoData = */ true>(
-                                static_cast<const double *>(pData) + iOffset,
-                                sNoDataValues.dfNoDataValue, iX, nXCheck, dfMin,
-                                dfMax, dfBlockMean, dfBlockM2,
-                                dfBlockValidCount);
-                        }
-                        else
-                        {
-                            iX = ComputeStatisticsFloat64_SSE2<
-                                /* bCheckMinEqMax = */ false,
-                                /* bHasNoData = */ false>(
-                                static_cast<const double *>(pData) + iOffset,
-                                sNoDataValues.dfNoDataValue, iX, nXCheck, dfMin,
-                                dfMax, dfBlockMean, dfBlockM2,
-                                dfBlockValidCount);
-                        }
-                        for (; iX < nXCheck; iX++)
-                        {
-                            const double dfValue = static_cast<const double *>(
-                                pData)[iOffset + iX];
-                            if (std::isnan(dfValue) ||
-                                (bHasNoData &&
-                                 dfValue == sNoDataValues.dfNoDataValue))
-                                continue;
-                            dfMin = std::min(dfMin, dfValue);
-                            dfMax = std::max(dfMax, dfValue);
-                            dfBlockValidCount += 1.0;
-                            const double dfDelta = dfValue - dfBlockMean;
-                            dfBlockMean += dfDelta / dfBlockValidCount;
-                            dfBlockM2 += dfDelta * (dfValue - dfBlockMean);
-                        }
-                    }
-                    else
-                    {
-                        int iX = 0;
-                        if (dfBlockValidCount == 0)
-                        {
-                            for (; iX < nXCheck; iX++)
-                            {
-                                const double dfValue =
-                                    static_cast<const double *>(
-                                        pData)[iOffset + iX];
-                                if (std::isnan(dfValue) ||
-                                    (bHasNoData &&
-                                     dfValue == sNoDataValues.dfNoDataValue))
-                                    continue;
-                                dfMin = std::min(dfMin, dfValue);
-                                dfMax = std::max(dfMax, dfValue);
-                                dfBlockValidCount = 1;
-                                dfBlockMean = dfValue;
-                                iX++;
-                                break;
-                            }
-                        }
-                        if (bHasNoData)
-                        {
-                            iX = ComputeStatisticsFloat64_SSE2<
-                                /* bCheckMinEqMax = */ true,
-                                /* bHasNoData = */ true>(
-                                static_cast<const double *>(pData) + iOffset,
-                                sNoDataValues.dfNoDataValue, iX, nXCheck, dfMin,
-                                dfMax, dfBlockMean, dfBlockM2,
-                                dfBlockValidCount);
-                        }
-                        else
-                        {
-                            iX = ComputeStatisticsFloat64_SSE2<
-                                /* bCheckMinEqMax = */ true,
-                                /* bHasNoData = */ false>(
-                                static_cast<const double *>(pData) + iOffset,
-                                sNoDataValues.dfNoDataValue, iX, nXCheck, dfMin,
-                                dfMax, dfBlockMean, dfBlockM2,
-                                dfBlockValidCount);
-                        }
-                        for (; iX < nXCheck; iX++)
-                        {
-                            const double dfValue = static_cast<const double *>(
-                                pData)[iOffset + iX];
-                            if (std::isnan(dfValue) ||
-                                (bHasNoData &&
-                                 dfValue == sNoDataValues.dfNoDataValue))
-                                continue;
-                            dfMin = std::min(dfMin, dfValue);
-                            dfMax = std::max(dfMax, dfValue);
-                            dfBlockValidCount += 1.0;
-                            if (dfMin != dfMax)
-                            {
-                                const double dfDelta = dfValue - dfBlockMean;
-                                dfBlockMean += dfDelta / dfBlockValidCount;
-                                dfBlockM2 += dfDelta * (dfValue - dfBlockMean);
-                            }
-                        }
-                    }
+                    ReportError(CE_Failure, CPLE_UserInterrupt,
+                                "User terminated");
                 }
+                return CE_Failure;
+            }
 
-                if (dfBlockValidCount > 0)
+            for (const auto &sBlockStats : asBlockStats)
+            {
+                dfMin = std::min(dfMin, sBlockStats.dfMin);
+                dfMax = std::max(dfMax, sBlockStats.dfMax);
+                MergeMeanAndM2(sBlockStats.dfMean, sBlockStats.dfM2,
+                               sBlockStats.nValidCount, dfMean, dfM2,
+                               nValidCount);
+                nSampleCount += sBlockStats.nSampleCount;
+            }
+        }
+        else
+        {
+            GByte *pabyMaskData = nullptr;
+            if (poMaskBand)
+            {
+                pabyMaskData = static_cast<GByte *>(
+                    VSI_MALLOC2_VERBOSE(nBlockXSize, nBlockYSize));
+                if (!pabyMaskData)
                 {
-                    // Update the global mean and M2 (the difference of the
-                    // square to the mean) from the values of the block
-                    // using https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Parallel_algorithm
-                    const auto nNewValidCount =
-                        nValidCount + static_cast<int>(dfBlockValidCount);
-                    if (dfBlockMean != dfMean)
-                    {
-                        if (nValidCount == 0)
-                        {
-                            dfMean = dfBlockMean;
-                            dfM2 = dfBlockM2;
-                        }
-                        else
-                        {
-                            const double dfDelta = dfBlockMean - dfMean;
-                            const double dfNewValidCount =
-                                static_cast<double>(nNewValidCount);
-                            dfMean +=
-                                dfDelta * (dfBlockValidCount / dfNewValidCount);
-                            dfM2 += dfBlockM2 +
-                                    dfDelta * dfDelta *
-                                        static_cast<double>(nValidCount) *
-                                        dfBlockValidCount / dfNewValidCount;
-                        }
-                    }
-                    nValidCount = nNewValidCount;
+                    return CE_Failure;
                 }
             }
-#endif  // (defined(__x86_64__) || defined(_M_X64))
 
-            else
+            for (GIntBig iSampleBlock = 0;
+                 iSampleBlock <
+                 static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
+                 iSampleBlock += nSampleRate)
             {
-                // This isn't the fastest way to do this, but is easier for now.
-                for (int iY = 0; iY < nYCheck; iY++)
-                {
-                    if (nValidCount && dfMin != dfMax)
-                    {
-                        for (int iX = 0; iX < nXCheck; iX++)
-                        {
-                            const GPtrDiff_t iOffset =
-                                iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
-                            if (pabyMaskData && pabyMaskData[iOffset] == 0)
-                                continue;
+                const int iYBlock =
+                    static_cast<int>(iSampleBlock / nBlocksPerRow);
+                const int iXBlock =
+                    static_cast<int>(iSampleBlock % nBlocksPerRow);
 
-                            bool bValid = true;
-                            double dfValue =
-                                GetPixelValue(eDataType, bSignedByte, pData,
-                                              iOffset, sNoDataValues, bValid);
+                int nXCheck = 0, nYCheck = 0;
+                GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
 
-                            if (!bValid)
-                                continue;
+                if (poMaskBand &&
+                    poMaskBand->RasterIO(
+                        GF_Read, iXBlock * nBlockXSize, iYBlock * nBlockYSize,
+                        nXCheck, nYCheck, pabyMaskData, nXCheck, nYCheck,
+                        GDT_Byte, 0, nBlockXSize, nullptr) != CE_None)
+                {
+                    CPLFree(pabyMaskData);
+                    return CE_Failure;
+                }
 
-                            dfMin = std::min(dfMin, dfValue);
-                            dfMax = std::max(dfMax, dfValue);
+                GDALRasterBlock *const poBlock =
+                    GetLockedBlockRef(iXBlock, iYBlock);
+                if (poBlock == nullptr)
+                {
+                    CPLFree(pabyMaskData);
+                    return CE_Failure;
+                }
 
-                            nValidCount++;
-                            const double dfDelta = dfValue - dfMean;
-                            dfMean += dfDelta / nValidCount;
-                            dfM2 += dfDelta * (dfValue - dfMean);
-                        }
-                    }
-                    else
-                    {
-                        int iX = 0;
-                        if (nValidCount == 0)
-                        {
-                            for (; iX < nXCheck; iX++)
-                            {
-                                const GPtrDiff_t iOffset =
-                                    iX +
-                                    static_cast<GPtrDiff_t>(iY) * nBlockXSize;
-                                if (pabyMaskData && pabyMaskData[iOffset] == 0)
-                                    continue;
-
-                                bool bValid = true;
-                                double dfValue = GetPixelValue(
-                                    eDataType, bSignedByte, pData, iOffset,
-                                    sNoDataValues, bValid);
-
-                                if (!bValid)
-                                    continue;
-
-                                dfMin = dfValue;
-                                dfMax = dfValue;
-                                dfMean = dfValue;
-                                nValidCount = 1;
-                                iX++;
-                                break;
-                            }
-                        }
-                        for (; iX < nXCheck; iX++)
-                        {
-                            const GPtrDiff_t iOffset =
-                                iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
-                            if (pabyMaskData && pabyMaskData[iOffset] == 0)
-                                continue;
+                const void *const pData = poBlock->GetDataRef();
 
-                            bool bValid = true;
-                            double dfValue =
-                                GetPixelValue(eDataType, bSignedByte, pData,
-                                              iOffset, sNoDataValues, bValid);
+                if (bFloat32Optim)
+                {
+                    float fBlockMean = 0.0f;
+                    float fBlockM2 = 0.0f;
+                    int nBlockValidCount = 0;
+                    ComputeBlockStatisticsFloat32(
+                        pData, nXCheck, nYCheck, nBlockXSize, bFloat32HasNoData,
+                        sNoDataValues.fNoDataValue, fMin, fMax, fBlockMean,
+                        fBlockM2, nBlockValidCount);
+                    MergeMeanAndM2(static_cast<double>(fBlockMean),
+                                   static_cast<double>(fBlockM2),
+                                   nBlockValidCount, dfMean, dfM2, nValidCount);
+                }
+#if (defined(__x86_64__) || defined(_M_X64))
+                else if (bFloat64Optim)
+                {
+                    double dfBlockMean = 0;
+                    double dfBlockM2 = 0;
+                    double dfBlockValidCount = 0;
+                    ComputeBlockStatisticsFloat64(
+                        pData, nXCheck, nYCheck, nBlockXSize, bFloat64HasNoData,
+                        sNoDataValues.dfNoDataValue, dfMin, dfMax, dfBlockMean,
+                        dfBlockM2, dfBlockValidCount);
+                    MergeMeanAndM2(dfBlockMean, dfBlockM2,
+                                   static_cast<GUIntBig>(dfBlockValidCount),
+                                   dfMean, dfM2, nValidCount);
+                }
+#endif
+                else
+                {
+                    ComputeBlockStatisticsGeneric(
+                        eDataType, bSignedByte, pData, pabyMaskData, nXCheck,
+                        nYCheck, nBlockXSize, sNoDataValues, dfMin, dfMax,
+                        dfMean, dfM2, nValidCount);
+                }
 
-                            if (!bValid)
-                                continue;
+                nSampleCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
 
-                            dfMin = std::min(dfMin, dfValue);
-                            dfMax = std::max(dfMax, dfValue);
+                poBlock->DropLock();
 
-                            nValidCount++;
-                            if (dfMin != dfMax)
-                            {
-                                const double dfDelta = dfValue - dfMean;
-                                dfMean += dfDelta / nValidCount;
-                                dfM2 += dfDelta * (dfValue - dfMean);
-                            }
-                        }
-                    }
+                if (!pfnProgress(static_cast<double>(iSampleBlock) /
+                                     (static_cast<double>(nBlocksPerRow) *
+                                      nBlocksPerColumn),
+                                 "Compute Statistics", pProgressData))
+                {
+                    ReportError(CE_Failure, CPLE_UserInterrupt,
+                                "User terminated");
+                    CPLFree(pabyMaskData);
+                    return CE_Failure;
                 }
             }
 
-            nSampleCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
-
-            poBlock->DropLock();
-
-            if (!pfnProgress(
-                    static_cast<double>(iSampleBlock) /
-                        (static_cast<double>(nBlocksPerRow) * nBlocksPerColumn),
-                    "Compute Statistics", pProgressData))
+            if (bFloat32Optim)
             {
-                ReportError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                CPLFree(pabyMaskData);
-                return CE_Failure;
+                dfMin = static_cast<double>(fMin);
+                dfMax = static_cast<double>(fMax);
             }
+            CPLFree(pabyMaskData);
         }
-
-        if (bFloat32Optim)
-        {
-            dfMin = static_cast<double>(fMin);
-            dfMax = static_cast<double>(fMax);
-        }
-        CPLFree(pabyMaskData);
     }
 
     if (!pfnProgress(1.0, "Compute Statistics", pProgressData))
@@ -8134,13 +8645,35 @@ static bool ComputeMinMaxGenericIterBlocks(
     GDALRasterBand *poBand, GDALDataType eDataType, bool bSignedByte,
     GIntBig nTotalBlocks, int nSampleRate, int nBlocksPerRow,
     const GDALNoDataValues &sNoDataValues, GDALRasterBand *poMaskBand,
-    double &dfMin, double &dfMax)
+    int nThreads, double &dfMin, double &dfMax)
 
 {
     GByte *pabyMaskData = nullptr;
     int nBlockXSize, nBlockYSize;
     poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
 
+    if (nThreads > 1)
+    {
+        std::mutex oMutex;
+        bool bInterrupted = false;
+        return GDALProcessSampledBlocks(
+            poBand, poMaskBand, nSampleRate, nThreads, "", GDALDummyProgress,
+            nullptr, bInterrupted,
+            [eDataType, bSignedByte, nBlockXSize, &sNoDataValues, &oMutex,
+             &dfMin, &dfMax](GIntBig, void *pData, const GByte *pabyJobMaskData,
+                             int nXCheck, int nYCheck)
+            {
+                double dfBlockMin = std::numeric_limits<double>::infinity();
+                double dfBlockMax = -std::numeric_limits<double>::infinity();
+                ComputeMinMaxGeneric(pData, eDataType, bSignedByte, nXCheck,
+                                     nYCheck, nBlockXSize, sNoDataValues,
+                                     pabyJobMaskData, dfBlockMin, dfBlockMax);
+                std::lock_guard oLock(oMutex);
+                dfMin = std::min(dfMin, dfBlockMin);
+                dfMax = std::max(dfMax, dfBlockMax);
+            });
+    }
+
     if (poMaskBand)
     {
         pabyMaskData =
@@ -8274,26 +8807,42 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
     GDALRasterIOExtraArg sExtraArg;
     INIT_RASTERIO_EXTRA_ARG(sExtraArg);
 
-    GUInt32 nMin = (eDataType == GDT_Byte)
-                       ? 255
-                       : 65535;  // used for GByte & GUInt16 cases
-    GUInt32 nMax = 0;            // used for GByte & GUInt16 cases
-    GInt16 nMinInt16 =
-        std::numeric_limits<GInt16>::max();  // used for GInt16 case
-    GInt16 nMaxInt16 =
-        std::numeric_limits<GInt16>::lowest();  // used for GInt16 case
+    // Accumulators of the optimized code path
+    struct MinMaxAccumulator
+    {
+        GUInt32 nMin;      // used for GByte & GUInt16 cases
+        GUInt32 nMax;      // used for GByte & GUInt16 cases
+        GInt16 nMinInt16;  // used for GInt16 case
+        GInt16 nMaxInt16;  // used for GInt16 case
+        double dfMin;      // used for Float32 & Float64 cases
+        double dfMax;      // used for Float32 & Float64 cases
+    };
+
+    const MinMaxAccumulator sInitAcc{(eDataType == GDT_Byte) ? 255U : 65535U,
+                                     0,
+                                     std::numeric_limits<GInt16>::max(),
+                                     std::numeric_limits<GInt16>::lowest(),
+                                     std::numeric_limits<double>::infinity(),
+                                     -std::numeric_limits<double>::infinity()};
+    MinMaxAccumulator sAcc = sInitAcc;
     double dfMin =
         std::numeric_limits<double>::infinity();  // used for generic code path
     double dfMax =
         -std::numeric_limits<double>::infinity();  // used for generic code path
+    // Float32 and Float64 only when there is no nodata value, as
+    // gdal::minmax_element() does exact comparisons with it, whereas the
+    // generic code path uses ARE_REAL_EQUAL()
     const bool bUseOptimizedPath =
-        !poMaskBand && ((eDataType == GDT_Byte && !bSignedByte) ||
-                        eDataType == GDT_Int16 || eDataType == GDT_UInt16);
+        !poMaskBand &&
+        ((eDataType == GDT_Byte && !bSignedByte) || eDataType == GDT_Int16 ||
+         eDataType == GDT_UInt16 ||
+         ((eDataType == GDT_Float32 || eDataType == GDT_Float64) &&
+          !sNoDataValues.bGotNoDataValue));
 
     const auto ComputeMinMaxForBlock =
-        [this, bSignedByte, &sNoDataValues, &nMin, &nMax, &nMinInt16,
-         &nMaxInt16](const void *pData, int nXCheck, int nBufferWidth,
-                     int nYCheck)
+        [this, bSignedByte, &sNoDataValues](const void *pData, int nXCheck,
+                                            int nBufferWidth, int nYCheck,
+                                            MinMaxAccumulator &sBlockAcc)
     {
         if (eDataType == GDT_Byte && !bSignedByte)
         {
@@ -8310,7 +8859,8 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                                       /* COMPUTE_OTHER_STATS = */ false>::
                 f(nXCheck, nBufferWidth, nYCheck,
                   static_cast<const GByte *>(pData), bHasNoData, nNoDataValue,
-                  nMin, nMax, nSum, nSumSquare, nSampleCount, nValidCount);
+                  sBlockAcc.nMin, sBlockAcc.nMax, nSum, nSumSquare,
+                  nSampleCount, nValidCount);
         }
         else if (eDataType == GDT_UInt16)
         {
@@ -8327,7 +8877,8 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                                       /* COMPUTE_OTHER_STATS = */ false>::
                 f(nXCheck, nBufferWidth, nYCheck,
                   static_cast<const GUInt16 *>(pData), bHasNoData, nNoDataValue,
-                  nMin, nMax, nSum, nSumSquare, nSampleCount, nValidCount);
+                  sBlockAcc.nMin, sBlockAcc.nMax, nSum, nSumSquare,
+                  nSampleCount, nValidCount);
         }
         else if (eDataType == GDT_Int16)
         {
@@ -8345,7 +8896,8 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                     ComputeMinMax<int16_t, true>(
                         static_cast<const int16_t *>(pData) +
                             static_cast<size_t>(iY) * nBufferWidth,
-                        nXCheck, nNoDataValue, &nMinInt16, &nMaxInt16);
+                        nXCheck, nNoDataValue, &sBlockAcc.nMinInt16,
+                        &sBlockAcc.nMaxInt16);
                 }
             }
             else
@@ -8355,12 +8907,64 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                     ComputeMinMax<int16_t, false>(
                         static_cast<const int16_t *>(pData) +
                             static_cast<size_t>(iY) * nBufferWidth,
-                        nXCheck, 0, &nMinInt16, &nMaxInt16);
+                        nXCheck, 0, &sBlockAcc.nMinInt16,
+                        &sBlockAcc.nMaxInt16);
+                }
+            }
+        }
+        else if (eDataType == GDT_Float32 || eDataType == GDT_Float64)
+        {
+            const auto GetValue = [this](const void *pBuffer, size_t i)
+            {
+                return eDataType == GDT_Float32
+                           ? static_cast<double>(
+                                 static_cast<const float *>(pBuffer)[i])
+                           : static_cast<const double *>(pBuffer)[i];
+            };
+            const auto UpdateMinMax =
+                [this, &GetValue, &sBlockAcc](const void *pBuffer, size_t nElts)
+            {
+                const auto [iMin, iMax] = gdal::minmax_element(
+                    pBuffer, nElts, eDataType, false, 0);
+                const double dfBufferMin = GetValue(pBuffer, iMin);
+                // NaN values are skipped, unless they are all NaN
+                if (!std::isnan(dfBufferMin))
+                {
+                    sBlockAcc.dfMin = std::min(sBlockAcc.dfMin, dfBufferMin);
+                    sBlockAcc.dfMax =
+                        std::max(sBlockAcc.dfMax, GetValue(pBuffer, iMax));
+                }
+            };
+            if (nXCheck == nBufferWidth)
+            {
+                UpdateMinMax(pData, static_cast<size_t>(nXCheck) * nYCheck);
+            }
+            else
+            {
+                const size_t nLineSize =
+                    static_cast<size_t>(nBufferWidth) *
+                    GDALGetDataTypeSizeBytes(eDataType);
+                for (int iY = 0; iY < nYCheck; iY++)
+                {
+                    UpdateMinMax(static_cast<const GByte *>(pData) +
+                                     iY * nLineSize,
+                                 nXCheck);
                 }
             }
         }
     };
 
+    const auto MergeMinMax =
+        [](MinMaxAccumulator &sDstAcc, const MinMaxAccumulator &sBlockAcc)
+    {
+        sDstAcc.nMin = std::min(sDstAcc.nMin, sBlockAcc.nMin);
+        sDstAcc.nMax = std::max(sDstAcc.nMax, sBlockAcc.nMax);
+        sDstAcc.nMinInt16 = std::min(sDstAcc.nMinInt16, sBlockAcc.nMinInt16);
+        sDstAcc.nMaxInt16 = std::max(sDstAcc.nMaxInt16, sBlockAcc.nMaxInt16);
+        sDstAcc.dfMin = std::min(sDstAcc.dfMin, sBlockAcc.dfMin);
+        sDstAcc.dfMax = std::max(sDstAcc.dfMax, sBlockAcc.dfMax);
+    };
+
     if (bApproxOK && HasArbitraryOverviews())
     {
         /* --------------------------------------------------------------------
@@ -8421,7 +9025,8 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
 
         if (bUseOptimizedPath)
         {
-            ComputeMinMaxForBlock(pData, nXReduced, nXReduced, nYReduced);
+            ComputeMinMaxForBlock(pData, nXReduced, nXReduced, nYReduced,
+                                  sAcc);
         }
         else
         {
@@ -8459,7 +9064,34 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                 nSampleRate += 1;
         }
 
-        if (bUseOptimizedPath)
+        const GIntBig nSampledBlocks = DIV_ROUND_UP(
+            static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn,
+            nSampleRate);
+        const int nThreads =
+            GDALGetNumThreadsForBlockStatistics(nSampledBlocks);
+
+        if (bUseOptimizedPath && nThreads > 1)
+        {
+            std::mutex oMutex;
+            bool bInterrupted = false;
+            if (!GDALProcessSampledBlocks(
+                    this, nullptr, nSampleRate, nThreads, "", GDALDummyProgress,
+                    nullptr, bInterrupted,
+                    [&ComputeMinMaxForBlock, &MergeMinMax, &sInitAcc, &sAcc,
+                     &oMutex, this](GIntBig, void *pData, const GByte *,
+                                    int nXCheck, int nYCheck)
+                    {
+                        MinMaxAccumulator sBlockAcc = sInitAcc;
+                        ComputeMinMaxForBlock(pData, nXCheck, nBlockXSize,
+                                              nYCheck, sBlockAcc);
+                        std::lock_guard oLock(oMutex);
+                        MergeMinMax(sAcc, sBlockAcc);
+                    }))
+            {
+                return CE_Failure;
+            }
+        }
+        else if (bUseOptimizedPath)
         {
             for (GIntBig iSampleBlock = 0;
                  iSampleBlock <
@@ -8480,12 +9112,13 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                 int nXCheck = 0, nYCheck = 0;
                 GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
 
-                ComputeMinMaxForBlock(pData, nXCheck, nBlockXSize, nYCheck);
+                ComputeMinMaxForBlock(pData, nXCheck, nBlockXSize, nYCheck,
+                                      sAcc);
 
                 poBlock->DropLock();
 
-                if (eDataType == GDT_Byte && !bSignedByte && nMin == 0 &&
-                    nMax == 255)
+                if (eDataType == GDT_Byte && !bSignedByte && sAcc.nMin == 0 &&
+                    sAcc.nMax == 255)
                     break;
             }
         }
@@ -8495,7 +9128,8 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                 static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
             if (!ComputeMinMaxGenericIterBlocks(
                     this, eDataType, bSignedByte, nTotalBlocks, nSampleRate,
-                    nBlocksPerRow, sNoDataValues, poMaskBand, dfMin, dfMax))
+                    nBlocksPerRow, sNoDataValues, poMaskBand, nThreads, dfMin,
+                    dfMax))
             {
                 return CE_Failure;
             }
@@ -8506,13 +9140,18 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
     {
         if ((eDataType == GDT_Byte && !bSignedByte) || eDataType == GDT_UInt16)
         {
-            dfMin = nMin;
-            dfMax = nMax;
+            dfMin = sAcc.nMin;
+            dfMax = sAcc.nMax;
         }
         else if (eDataType == GDT_Int16)
         {
-            dfMin = nMinInt16;
-            dfMax = nMaxInt16;
+            dfMin = sAcc.nMinInt16;
+            dfMax = sAcc.nMaxInt16;
+        }
+        else
+        {
+            dfMin = sAcc.dfMin;
+            dfMax = sAcc.dfMax;
         }
     }
 
@@ -10269,6 +10908,19 @@ int GDALRasterBand::EnterReadWrite(GDALRWFlag eRWFlag)
     return FALSE;
 }
 
+/************************************************************************/
+/*                         TryEnterReadWrite()                          */
+/************************************************************************/
+
+bool GDALRasterBand::TryEnterReadWrite(int &bCallLeaveReadWrite)
+{
+    bCallLeaveReadWrite = FALSE;
+    if (poDS != nullptr)
+        return poDS->TryEnterReadWrite(bCallLeaveReadWrite);
+    // No read/write mutex can protect the band
+    return false;
+}
+
 /************************************************************************/
 /*                         LeaveReadWrite()                             */
 /************************************************************************/
@@ -17,9 +17,19 @@
 #include "gdal_priv.h"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <climits>
+#include <condition_variable>
 #include <cstring>
+#include <deque>
+#include <memory>
 #include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
 
 #include "cpl_atomic_ops.h"
 #include "cpl_conv.h"
@@ -27,16 +37,27 @@
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "gdal_abstractbandblockcache.h"
 
 // Will later be overridden by the default 5% if GDAL_CACHEMAX not defined.
 static GIntBig nCacheMax = 40 * 1024 * 1024;
 static GIntBig nCacheUsed = 0;
 
-static GDALRasterBlock *poOldest = nullptr;  // Tail.
-static GDALRasterBlock *poNewest = nullptr;  // Head.
-
 static int nDisableDirtyBlockFlushCounter = 0;
 
+// Total size of the dirty blocks, used to wake up the write-behind thread.
+static std::atomic<GIntBig> nCacheDirty{0};
+
+// Cumulative statistics, reported by GDALGetCacheStatistics(). They are
+// updated with relaxed atomic operations so that they can be always enabled.
+static std::atomic<GUIntBig> nStatsHits{0};
+static std::atomic<GUIntBig> nStatsMisses{0};
+static std::atomic<GUIntBig> nStatsEvictions{0};
+static std::atomic<GUIntBig> nStatsDirtyBlocksFlushed{0};
+static std::atomic<GUIntBig> nStatsDirtyBytesFlushed{0};
+static std::atomic<GUIntBig> nStatsLockAcquisitions{0};
+static std::atomic<GUIntBig> nStatsLockWaitNanoSec{0};
+
 #if 0
 static CPLMutex *hRBLock = nullptr;
 #define INITIALIZE_LOCK CPLMutexHolderD(&hRBLock)
@@ -75,16 +96,315 @@ static CPLLockType GetLockType()
     return static_cast<CPLLockType>(nLockType);
 }
 
+namespace
+{
+// Same as CPLLockHolderOptionalLockD(), but also accumulates the time spent
+// acquiring the lock.
+class GDALRBLockHolder
+{
+    CPLLock *m_hLock = nullptr;
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALRBLockHolder)
+
+  public:
+    explicit GDALRBLockHolder(CPLLock *hLock) : m_hLock(hLock)
+    {
+        if (m_hLock == nullptr)
+            return;
+        const auto nStart = std::chrono::steady_clock::now();
+        if (!CPLAcquireLock(m_hLock))
+        {
+            CPLDebug("GDAL", "GDALRBLockHolder: Failed to acquire lock!");
+            m_hLock = nullptr;
+            return;
+        }
+        const auto nWait = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - nStart);
+        nStatsLockAcquisitions.fetch_add(1, std::memory_order_relaxed);
+        nStatsLockWaitNanoSec.fetch_add(static_cast<GUIntBig>(nWait.count()),
+                                        std::memory_order_relaxed);
+    }
+
+    ~GDALRBLockHolder()
+    {
+        if (m_hLock)
+            CPLReleaseLock(m_hLock);
+    }
+};
+}  // namespace
+
 #define INITIALIZE_LOCK                                                        \
     CPLLockHolderD(&hRBLock, GetLockType());                                   \
     CPLLockSetDebugPerf(hRBLock, bDebugContention)
-#define TAKE_LOCK CPLLockHolderOptionalLockD(hRBLock)
+#define TAKE_LOCK GDALRBLockHolder oHolder(hRBLock)
 #define DESTROY_LOCK CPLDestroyLock(hRBLock)
 
 #endif
 
 // #define ENABLE_DEBUG
 
+/************************************************************************/
+/*                            GDALCachePool                             */
+/************************************************************************/
+
+// A subset of the block cache, with its own lists of blocks, an optional
+// quota and an eviction priority. Blocks of datasets that have not been
+// assigned to a pool belong to the default pool. Except for the statistics
+// counters, members are protected by hRBLock.
+struct GDALCachePool
+{
+    std::string osName{};
+    GIntBig nQuota = 0;  // 0 means no quota.
+    GDALCachePoolPriority ePriority = GCPP_NORMAL;
+    bool bScanResistant = false;
+
+    // Blocks in least recently used order.
+    GDALRasterBlock *poNewest = nullptr;  // Head.
+    GDALRasterBlock *poOldest = nullptr;  // Tail.
+
+    // For scan-resistant pools (2Q policy), blocks that have not been loaded
+    // again since they were evicted, in first-in-first-out order. Accessing
+    // them does not move them to the LRU list.
+    GDALRasterBlock *poProbationNewest = nullptr;  // Head.
+    GDALRasterBlock *poProbationOldest = nullptr;  // Tail.
+    GIntBig nProbationUsed = 0;
+
+    // Identity of the blocks recently evicted from the probation queue.
+    // The band pointer is only used as a key and never dereferenced.
+    using GhostKey = std::tuple<const GDALRasterBand *, int, int>;
+    std::deque<GhostKey> aoGhosts{};
+    std::set<GhostKey> oSetGhosts{};
+
+    GIntBig nUsed = 0;
+    GIntBig nBlocks = 0;
+    std::atomic<GUIntBig> nHits{0};
+    std::atomic<GUIntBig> nMisses{0};
+    std::atomic<GUIntBig> nEvictions{0};
+
+    // Whether the probation queue should be considered first for eviction.
+    bool IsProbationOverTarget(GIntBig nCurCacheMax) const
+    {
+        return bScanResistant &&
+               (poOldest == nullptr ||
+                nProbationUsed > (nQuota > 0 ? nQuota : nCurCacheMax) / 4);
+    }
+
+    void RememberEvicted(GDALRasterBlock *poBlock)
+    {
+        GhostKey oKey(poBlock->GetBand(), poBlock->GetXOff(),
+                      poBlock->GetYOff());
+        if (!oSetGhosts.insert(oKey).second)
+            return;
+        aoGhosts.push_back(std::move(oKey));
+        const size_t nMaxGhosts =
+            std::max<size_t>(1024, static_cast<size_t>(nBlocks) / 2);
+        while (aoGhosts.size() > nMaxGhosts)
+        {
+            oSetGhosts.erase(aoGhosts.front());
+            aoGhosts.pop_front();
+        }
+    }
+
+    // Returns whether the block was recently evicted from the probation
+    // queue.
+    bool ForgetEvicted(GDALRasterBlock *poBlock)
+    {
+        // Entries of aoGhosts that are no longer in oSetGhosts are just
+        // skipped when they are popped.
+        return oSetGhosts.erase(GhostKey(poBlock->GetBand(),
+                                         poBlock->GetXOff(),
+                                         poBlock->GetYOff())) > 0;
+    }
+};
+
+// Pools are never destroyed, so that pointers to them remain valid.
+// Must be accessed with hRBLock held.
+static std::vector<std::unique_ptr<GDALCachePool>> &GetCachePools()
+{
+    static auto *papoPools = []()
+    {
+        auto papoNewPools = new std::vector<std::unique_ptr<GDALCachePool>>();
+        papoNewPools->push_back(std::make_unique<GDALCachePool>());
+        papoNewPools->back()->osName = "default";
+        return papoNewPools;
+    }();
+    return *papoPools;
+}
+
+// Must be called with hRBLock held.
+static GDALCachePool *GetCachePoolOfBand(GDALRasterBand *poBand)
+{
+    GDALDataset *poDS = poBand->GetDataset();
+    GDALCachePool *poPool = poDS ? poDS->GetBlockCachePool() : nullptr;
+    return poPool ? poPool : GetCachePools().front().get();
+}
+
+static GDALDatasetBlockCacheCounters *
+GetDatasetCounters(GDALRasterBand *poBand)
+{
+    GDALDataset *poDS = poBand ? poBand->GetDataset() : nullptr;
+    return poDS ? poDS->GetBlockCacheCounters() : nullptr;
+}
+
+// Must be called with hRBLock held.
+static GDALCachePool *FindCachePool(const char *pszName)
+{
+    for (const auto &poPool : GetCachePools())
+    {
+        if (EQUAL(poPool->osName.c_str(), pszName))
+            return poPool.get();
+    }
+    return nullptr;
+}
+
+/************************************************************************/
+/*                            GetCachePool()                            */
+/************************************************************************/
+
+//! @cond Doxygen_Suppress
+GDALCachePool *GDALRasterBlock::GetCachePool(const char *pszName)
+{
+    // Make sure hRBLock is initialized.
+    GDALGetCacheMax64();
+
+    TAKE_LOCK;
+    return FindCachePool(pszName);
+}
+
+/************************************************************************/
+/*                          GetCachePoolName()                          */
+/************************************************************************/
+
+const char *GDALRasterBlock::GetCachePoolName(GDALCachePool *poPool)
+{
+    if (poPool == nullptr)
+        return "default";
+    // Pool names are never modified after the creation of the pool.
+    return poPool->osName.c_str();
+}
+
+/************************************************************************/
+/*                        GetDatasetResidency()                         */
+/************************************************************************/
+
+void GDALRasterBlock::GetDatasetResidency(
+    const GDALDatasetBlockCacheCounters &oCounters, GIntBig &nBlocks,
+    GIntBig &nUsed)
+{
+    // Make sure hRBLock is initialized.
+    GDALGetCacheMax64();
+
+    TAKE_LOCK;
+    nBlocks = oCounters.nBlocks;
+    nUsed = oCounters.nUsed;
+}
+
+//! @endcond
+
+/************************************************************************/
+/*                          GDALEvictionCursor                          */
+/************************************************************************/
+
+// Iterates over cached blocks, from the best to the worst candidate for
+// eviction: pools are visited by increasing priority (so blocks of pinned
+// pools come last), and the blocks of a pool from the oldest to the newest,
+// starting with the probation queue of scan-resistant pools if it is over
+// its target size. Must be used with hRBLock held.
+class GDALEvictionCursor
+{
+    GDALCachePool *m_poOnlyPool = nullptr;
+    GIntBig m_nCacheMax = 0;
+    int m_nPriority = GCPP_BULK;
+    size_t m_iPool = 0;
+    int m_iList = 0;
+    bool m_bProbationFirst = false;
+    GDALRasterBlock *m_poCur = nullptr;
+
+    void Settle();
+
+  public:
+    // If poOnlyPool is not null, only blocks of that pool are visited.
+    GDALEvictionCursor(GDALCachePool *poOnlyPool, GIntBig nCurCacheMax)
+        : m_poOnlyPool(poOnlyPool), m_nCacheMax(nCurCacheMax)
+    {
+        Rewind();
+    }
+
+    void Reset(GDALCachePool *poOnlyPool)
+    {
+        m_poOnlyPool = poOnlyPool;
+        Rewind();
+    }
+
+    void Rewind()
+    {
+        m_nPriority = GCPP_BULK;
+        m_iPool = 0;
+        m_iList = 0;
+        m_poCur = nullptr;
+        Settle();
+    }
+
+    GDALRasterBlock *Get() const
+    {
+        return m_poCur;
+    }
+
+    void Advance()
+    {
+        m_poCur = m_poCur->poPrevious;
+        if (m_poCur == nullptr)
+            Settle();
+    }
+};
+
+// Position the cursor on the oldest block of the next non-empty list.
+void GDALEvictionCursor::Settle()
+{
+    const auto &apoPools = GetCachePools();
+    while (true)
+    {
+        GDALCachePool *poPool = nullptr;
+        if (m_poOnlyPool)
+        {
+            if (m_iPool > 0)
+                return;
+            poPool = m_poOnlyPool;
+        }
+        else
+        {
+            if (m_iPool == apoPools.size())
+            {
+                if (m_nPriority == GCPP_PINNED)
+                    return;
+                ++m_nPriority;
+                m_iPool = 0;
+                continue;
+            }
+            poPool = apoPools[m_iPool].get();
+            if (poPool->ePriority != m_nPriority)
+            {
+                ++m_iPool;
+                continue;
+            }
+        }
+
+        if (m_iList == 2)
+        {
+            m_iList = 0;
+            ++m_iPool;
+            continue;
+        }
+        if (m_iList == 0)
+            m_bProbationFirst = poPool->IsProbationOverTarget(m_nCacheMax);
+        const bool bProbation = (m_iList == 0) == m_bProbationFirst;
+        ++m_iList;
+        m_poCur = bProbation ? poPool->poProbationOldest : poPool->poOldest;
+        if (m_poCur)
+            return;
+    }
+}
+
 /************************************************************************/
 /*                          GDALSetCacheMax()                           */
 /************************************************************************/
@@ -318,6 +638,196 @@ int CPL_STDCALL GDALFlushCacheBlock()
     return GDALRasterBlock::FlushCacheBlock();
 }
 
+/************************************************************************/
+/*                          GDALSetCachePool()                          */
+/************************************************************************/
+
+/**
+ * \brief Create or update a named block cache pool.
+ *
+ * Datasets are assigned to a pool with GDALDatasetSetCachePool(). Blocks
+ * of datasets that have not been assigned to a pool belong to the
+ * "default" pool, whose priority is GCPP_NORMAL and which has no quota,
+ * unless changed with this function.
+ *
+ * When a block must be loaded in a pool whose quota is exceeded, blocks of
+ * that pool are evicted first. When the global cache size limit
+ * (see GDALSetCacheMax64()) is reached, blocks of GCPP_BULK pools are
+ * evicted first, then blocks of GCPP_NORMAL pools, then blocks of
+ * GCPP_INTERACTIVE pools. Blocks of GCPP_PINNED pools are only evicted to
+ * honor the quota of their pool, or if no other block can be evicted.
+ *
+ * Lowering the quota of an existing pool does not evict blocks immediately:
+ * the new quota is honored as new blocks are loaded in the pool.
+ *
+ * The following options are supported:
+ * <ul>
+ * <li>POLICY=LRU/2Q: eviction policy within the pool. Defaults to LRU,
+ * where the least recently used blocks are evicted first. 2Q is
+ * scan-resistant: newly loaded blocks are put in a probation queue, from
+ * which they are evicted in first-in-first-out order, and only blocks that
+ * are loaded again shortly after having been evicted from it enter the LRU
+ * list. This prevents a large sequential read from evicting the frequently
+ * used blocks of the pool.</li>
+ * </ul>
+ *
+ * @param pszName Pool name.
+ * @param nQuota Maximum memory used by blocks of the pool, in bytes, or 0
+ *               for no quota.
+ * @param ePriority Eviction priority class of the pool.
+ * @param papszOptions NULL terminated list of options, or NULL.
+ * @return TRUE in case of success.
+ * @since GDAL 3.13
+ */
+int GDALSetCachePool(const char *pszName, GIntBig nQuota,
+                     GDALCachePoolPriority ePriority,
+                     CSLConstList papszOptions)
+{
+    VALIDATE_POINTER1(pszName, "GDALSetCachePool", FALSE);
+
+    if (pszName[0] == '\0' || nQuota < 0 || ePriority < GCPP_BULK ||
+        ePriority > GCPP_PINNED)
+    {
+        CPLError(CE_Failure, CPLE_IllegalArg,
+                 "GDALSetCachePool(): invalid argument");
+        return FALSE;
+    }
+
+    const char *pszPolicy = CSLFetchNameValueDef(papszOptions, "POLICY", "LRU");
+    if (!EQUAL(pszPolicy, "LRU") && !EQUAL(pszPolicy, "2Q"))
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "GDALSetCachePool(): unsupported POLICY=%s", pszPolicy);
+        return FALSE;
+    }
+
+    // Make sure hRBLock is initialized.
+    GDALGetCacheMax64();
+
+    TAKE_LOCK;
+    GDALCachePool *poPool = FindCachePool(pszName);
+    if (poPool == nullptr)
+    {
+        GetCachePools().push_back(std::make_unique<GDALCachePool>());
+        poPool = GetCachePools().back().get();
+        poPool->osName = pszName;
+    }
+    poPool->nQuota = nQuota;
+    poPool->ePriority = ePriority;
+    // Blocks already in the probation queue stay there until evicted.
+    poPool->bScanResistant = EQUAL(pszPolicy, "2Q");
+
+    return TRUE;
+}
+
+/************************************************************************/
+/*                     GDALGetCachePoolStatistics()                     */
+/************************************************************************/
+
+/**
+ * \brief Get statistics about a block cache pool.
+ *
+ * @param pszName Pool name (see GDALSetCachePool()), or "default".
+ * @param psStats Structure filled with the statistics.
+ * @return TRUE in case of success, FALSE if there is no such pool.
+ * @since GDAL 3.13
+ */
+int GDALGetCachePoolStatistics(const char *pszName,
+                               GDALCachePoolStatistics *psStats)
+{
+    VALIDATE_POINTER1(pszName, "GDALGetCachePoolStatistics", FALSE);
+    VALIDATE_POINTER1(psStats, "GDALGetCachePoolStatistics", FALSE);
+
+    // Make sure hRBLock is initialized.
+    GDALGetCacheMax64();
+
+    TAKE_LOCK;
+    const GDALCachePool *poPool = FindCachePool(pszName);
+    if (poPool == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Unknown cache pool: %s",
+                 pszName);
+        return FALSE;
+    }
+    psStats->nQuota = poPool->nQuota;
+    psStats->nUsed = poPool->nUsed;
+    psStats->nBlocks = poPool->nBlocks;
+    psStats->nHits = poPool->nHits;
+    psStats->nMisses = poPool->nMisses;
+    psStats->nEvictions = poPool->nEvictions;
+    return TRUE;
+}
+
+/************************************************************************/
+/*                       GDALGetCacheStatistics()                       */
+/************************************************************************/
+
+/**
+ * \brief Get statistics about the block cache.
+ *
+ * Counters are cumulative since the start of the process, or since the last
+ * call to GDALResetCacheStatistics(). They are always collected, at a
+ * negligible cost.
+ *
+ * Per-dataset statistics can be retrieved with
+ * GDALDatasetGetCacheStatistics(), and per-pool statistics with
+ * GDALGetCachePoolStatistics().
+ *
+ * @param psStats Structure filled with the statistics.
+ * @return TRUE in case of success.
+ * @since GDAL 3.13
+ */
+int GDALGetCacheStatistics(GDALCacheStatistics *psStats)
+{
+    VALIDATE_POINTER1(psStats, "GDALGetCacheStatistics", FALSE);
+
+    psStats->nMax = GDALGetCacheMax64();
+    {
+        TAKE_LOCK;
+        psStats->nUsed = nCacheUsed;
+        psStats->nBlocks = 0;
+        for (const auto &poPool : GetCachePools())
+            psStats->nBlocks += poPool->nBlocks;
+    }
+    psStats->nHits = nStatsHits.load(std::memory_order_relaxed);
+    psStats->nMisses = nStatsMisses.load(std::memory_order_relaxed);
+    psStats->nEvictions = nStatsEvictions.load(std::memory_order_relaxed);
+    psStats->nDirtyBlocksFlushed =
+        nStatsDirtyBlocksFlushed.load(std::memory_order_relaxed);
+    psStats->nDirtyBytesFlushed =
+        nStatsDirtyBytesFlushed.load(std::memory_order_relaxed);
+    psStats->nLockAcquisitions =
+        nStatsLockAcquisitions.load(std::memory_order_relaxed);
+    psStats->dfLockWaitTime =
+        static_cast<double>(
+            nStatsLockWaitNanoSec.load(std::memory_order_relaxed)) *
+        1e-9;
+    return TRUE;
+}
+
+/************************************************************************/
+/*                      GDALResetCacheStatistics()                      */
+/************************************************************************/
+
+/**
+ * \brief Reset the cumulative counters of the block cache statistics.
+ *
+ * The counters returned by GDALGetCacheStatistics() are reset to zero.
+ * Per-dataset and per-pool counters are not affected.
+ *
+ * @since GDAL 3.13
+ */
+void GDALResetCacheStatistics()
+{
+    nStatsHits = 0;
+    nStatsMisses = 0;
+    nStatsEvictions = 0;
+    nStatsDirtyBlocksFlushed = 0;
+    nStatsDirtyBytesFlushed = 0;
+    nStatsLockAcquisitions = 0;
+    nStatsLockWaitNanoSec = 0;
+}
+
 /************************************************************************/
 /* ==================================================================== */
 /*                           GDALRasterBlock                            */
@@ -378,9 +888,9 @@ int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
 
     {
         INITIALIZE_LOCK;
-        poTarget = poOldest;
+        GDALEvictionCursor oCursor(nullptr, nCacheMax);
 
-        while (poTarget != nullptr)
+        while ((poTarget = oCursor.Get()) != nullptr)
         {
             if (!bDirtyBlocksOnly ||
                 (poTarget->GetDirty() && nDisableDirtyBlockFlushCounter == 0))
@@ -388,7 +898,7 @@ int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
                 if (CPLAtomicCompareAndExchange(&(poTarget->nLockCount), 0, -1))
                     break;
             }
-            poTarget = poTarget->poPrevious;
+            oCursor.Advance();
         }
 
         if (poTarget == nullptr)
@@ -405,6 +915,7 @@ int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
         }
 #endif
 
+        poTarget->RecordEviction_unlocked();
         poTarget->Detach_unlocked();
         poTarget->GetBand()->UnreferenceBlock(poTarget);
     }
@@ -430,6 +941,10 @@ int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
             poTarget->GetBand()->SetFlushBlockErr(eErr);
         }
     }
+    else
+    {
+        poTarget->GetBand()->poBandBlockCache->SpillEvictedBlock(poTarget);
+    }
 
     VSIFreeAligned(poTarget->pData);
     poTarget->pData = nullptr;
@@ -505,6 +1020,253 @@ void GDALRasterBlock::LeaveDisableDirtyBlockFlush()
     CPLAtomicDec(&nDisableDirtyBlockFlushCounter);
 }
 
+/************************************************************************/
+/*                        GDALWriteBehindState                          */
+/************************************************************************/
+
+// State of the write-behind thread, that writes the least recently used
+// dirty blocks when their total size exceeds
+// GDAL_CACHE_WRITE_BEHIND_THRESHOLD, so that the threads that need room in
+// the cache do not have to do it.
+// Members that are not atomic are protected by oMutex.
+struct GDALWriteBehindState
+{
+    std::mutex oMutex{};
+    std::condition_variable oCV{};
+    std::thread *poThread = nullptr;
+    bool bWakeUp = false;
+    GIntBig nTargetDirty = 0;
+    std::atomic<bool> bStop{false};
+    // Whether the thread has been woken up and has not finished its pass.
+    std::atomic<bool> bRequested{false};
+};
+
+// Never destroyed, as the thread may still run at process exit if
+// GDALDestroy() is not called.
+static GDALWriteBehindState &GetWriteBehindState()
+{
+    static auto *poState = new GDALWriteBehindState();
+    return *poState;
+}
+
+// Size of the dirty blocks above which the write-behind thread is woken up,
+// or 0 if it is disabled.
+static GIntBig GetWriteBehindThreshold()
+{
+    const char *pszThreshold =
+        CPLGetConfigOption("GDAL_CACHE_WRITE_BEHIND_THRESHOLD", nullptr);
+    if (pszThreshold == nullptr)
+        return 0;
+    const double dfPct = CPLAtof(pszThreshold);
+    if (!(dfPct > 0 && dfPct <= 100))
+        return 0;
+    // Blocks are written under the read-write mutex of their dataset.
+    if (!CPLTestBool(CPLGetConfigOption("GDAL_ENABLE_READ_WRITE_MUTEX", "YES")))
+        return 0;
+    return static_cast<GIntBig>(static_cast<double>(nCacheMax) * dfPct / 100);
+}
+
+// Whether a cached block can be written by the write-behind thread.
+static bool IsWriteBehindCandidate(GDALRasterBlock *poBlock)
+{
+    if (!poBlock->GetDirty())
+        return false;
+    GDALDataset *poDS = poBlock->GetBand()->GetDataset();
+    return poDS != nullptr && poDS->GetAccess() == GA_Update;
+}
+
+/************************************************************************/
+/*                      WakeUpWriteBehindThread()                       */
+/************************************************************************/
+
+// Start the write-behind thread if needed, and ask it to write dirty blocks
+// until their total size is below nTargetDirty.
+void GDALRasterBlock::WakeUpWriteBehindThread(GIntBig nTargetDirty)
+{
+    auto &oState = GetWriteBehindState();
+    if (oState.bRequested.exchange(true))
+        return;
+
+    std::lock_guard oLock(oState.oMutex);
+    oState.nTargetDirty = nTargetDirty;
+    oState.bWakeUp = true;
+    if (oState.poThread)
+    {
+        oState.oCV.notify_one();
+        return;
+    }
+
+    try
+    {
+        oState.poThread = new std::thread(
+            [&oState]()
+            {
+                std::unique_lock oThreadLock(oState.oMutex);
+                while (true)
+                {
+                    oState.oCV.wait(oThreadLock, [&oState]
+                                    { return oState.bWakeUp || oState.bStop; });
+                    if (oState.bStop)
+                        break;
+                    oState.bWakeUp = false;
+                    const GIntBig nTarget = oState.nTargetDirty;
+                    oThreadLock.unlock();
+                    while (!oState.bStop && WriteBehindDirtyBlocks(nTarget))
+                    {
+                        // go on
+                    }
+                    oState.bRequested = false;
+                    oThreadLock.lock();
+                }
+            });
+    }
+    catch (const std::exception &e)
+    {
+        // bRequested is left set, so that we do not try again.
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Cannot start block cache write-behind thread: %s", e.what());
+    }
+}
+
+/************************************************************************/
+/*                       WriteBehindDirtyBlocks()                       */
+/************************************************************************/
+
+// Write (and evict) least recently used dirty blocks of a dataset, until
+// the total size of dirty blocks is below nTargetDirty.
+// Returns whether blocks have been written, in which case dirty blocks of
+// other datasets may remain to be written.
+bool GDALRasterBlock::WriteBehindDirtyBlocks(GIntBig nTargetDirty)
+{
+    if (nCacheDirty <= nTargetDirty)
+        return false;
+
+    // Select the dataset of the least recently used dirty block, and keep
+    // one of its bands alive while we do not hold the lock.
+    GDALRasterBand *poPinnedBand = nullptr;
+    {
+        TAKE_LOCK;
+        if (nDisableDirtyBlockFlushCounter > 0)
+            return false;
+        GDALEvictionCursor oCursor(nullptr, nCacheMax);
+        for (GDALRasterBlock *poBlock = oCursor.Get(); poBlock != nullptr;
+             oCursor.Advance(), poBlock = oCursor.Get())
+        {
+            if (IsWriteBehindCandidate(poBlock))
+            {
+                poPinnedBand = poBlock->poBand;
+                poPinnedBand->poBandBlockCache->AddKeepAlive();
+                break;
+            }
+        }
+    }
+    if (poPinnedBand == nullptr)
+        return false;
+    GDALDataset *poDS = poPinnedBand->GetDataset();
+
+    // Blocks are detached and written while we hold the read-write mutex of
+    // the dataset, so that the thread that uses it cannot read them again
+    // from the file before they have been written. We must not wait for
+    // it, as the thread that holds it may be waiting in FlushCache() for
+    // the band we keep alive to be released: the blocks of that dataset
+    // are left to the regular eviction in that case.
+    int bCallLeaveReadWrite = FALSE;
+    if (!poPinnedBand->TryEnterReadWrite(bCallLeaveReadWrite))
+    {
+        poPinnedBand->poBandBlockCache->ReleaseKeepAlive();
+        return false;
+    }
+
+    std::vector<GDALRasterBlock *> apoBlocks;
+    {
+        TAKE_LOCK;
+        GIntBig nToWrite = nCacheDirty - nTargetDirty;
+        // Only one block per position, so that IWriteBlock() of
+        // pixel-interleaved drivers can write the blocks of the other bands
+        // at the same position at the same time (see Internalize()).
+        std::set<std::pair<int, int>> oSetPositions;
+        GDALEvictionCursor oCursor(nullptr, nCacheMax);
+        GDALRasterBlock *poBlock = nullptr;
+        while (nToWrite > 0 && apoBlocks.size() < 64 &&
+               nDisableDirtyBlockFlushCounter == 0 &&
+               (poBlock = oCursor.Get()) != nullptr)
+        {
+            // Move the cursor away from the block before detaching it.
+            oCursor.Advance();
+            const std::pair<int, int> oPosition(poBlock->nXOff,
+                                                poBlock->nYOff);
+            if (poBlock->poBand->GetDataset() == poDS &&
+                IsWriteBehindCandidate(poBlock) &&
+                oSetPositions.find(oPosition) == oSetPositions.end() &&
+                CPLAtomicCompareAndExchange(&(poBlock->nLockCount), 0, -1))
+            {
+                poBlock->RecordEviction_unlocked();
+                poBlock->Detach_unlocked();
+                poBlock->poBand->UnreferenceBlock(poBlock);
+                oSetPositions.insert(oPosition);
+                apoBlocks.push_back(poBlock);
+                nToWrite -= poBlock->GetBlockSize();
+            }
+        }
+    }
+
+    // Write them in the order of the blocks in the file for the usual
+    // (pixel-interleaved) layouts.
+    std::sort(apoBlocks.begin(), apoBlocks.end(),
+              [](const GDALRasterBlock *poA, const GDALRasterBlock *poB)
+              {
+                  return std::make_tuple(poA->nYOff, poA->nXOff,
+                                         poA->poBand->GetBand()) <
+                         std::make_tuple(poB->nYOff, poB->nXOff,
+                                         poB->poBand->GetBand());
+              });
+    for (GDALRasterBlock *poBlock : apoBlocks)
+    {
+        // Write() marks the block as clean, even on failure.
+        const CPLErr eErr = poBlock->Write();
+        if (eErr != CE_None)
+        {
+            // Save the error for later reporting.
+            poBlock->poBand->SetFlushBlockErr(eErr);
+        }
+        CPLAssert(!poBlock->GetDirty());
+        VSIFreeAligned(poBlock->pData);
+        poBlock->pData = nullptr;
+        poBlock->poBand->AddBlockToFreeList(poBlock);
+    }
+
+    if (bCallLeaveReadWrite)
+        poPinnedBand->LeaveReadWrite();
+    poPinnedBand->poBandBlockCache->ReleaseKeepAlive();
+
+    return !apoBlocks.empty();
+}
+
+/************************************************************************/
+/*                       StopWriteBehindThread()                        */
+/************************************************************************/
+
+void GDALRasterBlock::StopWriteBehindThread()
+{
+    auto &oState = GetWriteBehindState();
+    std::thread *poThread = nullptr;
+    {
+        std::lock_guard oLock(oState.oMutex);
+        std::swap(poThread, oState.poThread);
+        oState.bStop = true;
+    }
+    if (poThread)
+    {
+        oState.oCV.notify_one();
+        poThread->join();
+        delete poThread;
+    }
+    std::lock_guard oLock(oState.oMutex);
+    oState.bStop = false;
+    oState.bWakeUp = false;
+    oState.bRequested = false;
+}
+
 /************************************************************************/
 /*                          GDALRasterBlock()                           */
 /************************************************************************/
@@ -577,11 +1339,15 @@ void GDALRasterBlock::RecycleFor(int nXOffIn, int nYOffIn)
 {
     CPLAssert(pData == nullptr);
     pData = nullptr;
+    if (bDirty && poBand)
+        nCacheDirty -= GetBlockSize();
     bDirty = false;
     nLockCount = 0;
 
     poNext = nullptr;
     poPrevious = nullptr;
+    poPool = nullptr;
+    bInProbation = false;
 
     nXOff = nXOffIn;
     nYOff = nYOffIn;
@@ -603,6 +1369,9 @@ GDALRasterBlock::~GDALRasterBlock()
 {
     Detach();
 
+    if (bDirty && poBand)
+        nCacheDirty -= GetBlockSize();
+
     if (pData != nullptr)
     {
         VSIFreeAligned(pData);
@@ -655,12 +1424,35 @@ void GDALRasterBlock::Detach()
 
 void GDALRasterBlock::Detach_unlocked()
 {
-    if (poOldest == this)
-        poOldest = poPrevious;
-
-    if (poNewest == this)
+    if (poPool)
     {
-        poNewest = poNext;
+        GDALRasterBlock *&poListNewest =
+            bInProbation ? poPool->poProbationNewest : poPool->poNewest;
+        GDALRasterBlock *&poListOldest =
+            bInProbation ? poPool->poProbationOldest : poPool->poOldest;
+
+        if (poListOldest == this)
+            poListOldest = poPrevious;
+
+        if (poListNewest == this)
+            poListNewest = poNext;
+
+        GDALDatasetBlockCacheCounters *psDSCounters =
+            GetDatasetCounters(poBand);
+        poPool->nBlocks--;
+        if (psDSCounters)
+            psDSCounters->nBlocks--;
+        if (pData)
+        {
+            const GIntBig nSize = GetEffectiveBlockSize(GetBlockSize());
+            poPool->nUsed -= nSize;
+            if (bInProbation)
+                poPool->nProbationUsed -= nSize;
+            if (psDSCounters)
+                psDSCounters->nUsed -= nSize;
+        }
+        poPool = nullptr;
+        bInProbation = false;
     }
 
     if (poPrevious != nullptr)
@@ -696,24 +1488,37 @@ void GDALRasterBlock::Verify()
 {
     TAKE_LOCK;
 
-    CPLAssert((poNewest == nullptr && poOldest == nullptr) ||
-              (poNewest != nullptr && poOldest != nullptr));
-
-    if (poNewest != nullptr)
+    for (const auto &poPool : GetCachePools())
     {
-        CPLAssert(poNewest->poPrevious == nullptr);
-        CPLAssert(poOldest->poNext == nullptr);
-
-        GDALRasterBlock *poLast = nullptr;
-        for (GDALRasterBlock *poBlock = poNewest; poBlock != nullptr;
-             poBlock = poBlock->poNext)
+        for (int iList = 0; iList < 2; ++iList)
         {
-            CPLAssert(poBlock->poPrevious == poLast);
+            GDALRasterBlock *poNewest =
+                iList == 0 ? poPool->poNewest : poPool->poProbationNewest;
+            GDALRasterBlock *poOldest =
+                iList == 0 ? poPool->poOldest : poPool->poProbationOldest;
 
-            poLast = poBlock;
-        }
+            CPLAssert((poNewest == nullptr && poOldest == nullptr) ||
+                      (poNewest != nullptr && poOldest != nullptr));
+
+            if (poNewest != nullptr)
+            {
+                CPLAssert(poNewest->poPrevious == nullptr);
+                CPLAssert(poOldest->poNext == nullptr);
+
+                GDALRasterBlock *poLast = nullptr;
+                for (GDALRasterBlock *poBlock = poNewest; poBlock != nullptr;
+                     poBlock = poBlock->poNext)
+                {
+                    CPLAssert(poBlock->poPrevious == poLast);
+                    CPLAssert(poBlock->poPool == poPool.get());
+                    CPLAssert(poBlock->bInProbation == (iList == 1));
 
-        CPLAssert(poOldest == poLast);
+                    poLast = poBlock;
+                }
+
+                CPLAssert(poOldest == poLast);
+            }
+        }
     }
 }
 
@@ -727,23 +1532,29 @@ void GDALRasterBlock::Verify()
 void GDALRasterBlock::CheckNonOrphanedBlocks(GDALRasterBand *poBand)
 {
     TAKE_LOCK;
-    for (GDALRasterBlock *poBlock = poNewest; poBlock != nullptr;
-         poBlock = poBlock->poNext)
+    for (const auto &poPool : GetCachePools())
     {
-        if (poBlock->GetBand() == poBand)
+        for (GDALRasterBlock *poNewest :
+             {poPool->poNewest, poPool->poProbationNewest})
         {
-            printf("Cache has still blocks of band %p\n", poBand); /*ok*/
-            printf("Band : %d\n", poBand->GetBand());              /*ok*/
-            printf("nRasterXSize = %d\n", poBand->GetXSize());     /*ok*/
-            printf("nRasterYSize = %d\n", poBand->GetYSize());     /*ok*/
-            int nBlockXSize, nBlockYSize;
-            poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
-            printf("nBlockXSize = %d\n", nBlockXSize);      /*ok*/
-            printf("nBlockYSize = %d\n", nBlockYSize);      /*ok*/
-            printf("Dataset : %p\n", poBand->GetDataset()); /*ok*/
-            if (poBand->GetDataset())
-                printf("Dataset : %s\n", /*ok*/
-                       poBand->GetDataset()->GetDescription());
+            for (GDALRasterBlock *poBlock = poNewest; poBlock != nullptr;
+                 poBlock = poBlock->poNext)
+            {
+                if (poBlock->GetBand() != poBand)
+                    continue;
+                printf("Cache has still blocks of band %p\n", poBand); /*ok*/
+                printf("Band : %d\n", poBand->GetBand());              /*ok*/
+                printf("nRasterXSize = %d\n", poBand->GetXSize());     /*ok*/
+                printf("nRasterYSize = %d\n", poBand->GetYSize());     /*ok*/
+                int nBlockXSize, nBlockYSize;
+                poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+                printf("nBlockXSize = %d\n", nBlockXSize);      /*ok*/
+                printf("nBlockYSize = %d\n", nBlockYSize);      /*ok*/
+                printf("Dataset : %p\n", poBand->GetDataset()); /*ok*/
+                if (poBand->GetDataset())
+                    printf("Dataset : %s\n", /*ok*/
+                           poBand->GetDataset()->GetDescription());
+            }
         }
     }
 }
@@ -776,6 +1587,10 @@ CPLErr GDALRasterBlock::Write()
 
     if (poBand->eFlushBlockErr == CE_None)
     {
+        nStatsDirtyBlocksFlushed.fetch_add(1, std::memory_order_relaxed);
+        nStatsDirtyBytesFlushed.fetch_add(
+            static_cast<GUIntBig>(GetBlockSize()), std::memory_order_relaxed);
+
         int bCallLeaveReadWrite = poBand->EnterReadWrite(GF_Write);
         CPLErr eErr = poBand->IWriteBlock(nXOff, nYOff, pData);
         if (bCallLeaveReadWrite)
@@ -800,9 +1615,20 @@ CPLErr GDALRasterBlock::Write()
 void GDALRasterBlock::Touch()
 
 {
+    nStatsHits.fetch_add(1, std::memory_order_relaxed);
+    if (GDALDatasetBlockCacheCounters *psDSCounters =
+            GetDatasetCounters(poBand))
+        psDSCounters->nHits.fetch_add(1, std::memory_order_relaxed);
+
     // Can be safely tested outside the lock
-    if (poNewest == this)
-        return;
+    GDALCachePool *poCurPool = poPool;
+    if (poCurPool)
+    {
+        poCurPool->nHits++;
+        // Accessing a block of the probation queue does not promote it.
+        if (bInProbation || poCurPool->poNewest == this)
+            return;
+    }
 
     TAKE_LOCK;
     Touch_unlocked();
@@ -817,15 +1643,15 @@ void GDALRasterBlock::Touch_unlocked()
     // 1. Thread 1 calls Touch() and poNewest != this at that point
     // 2. Thread 2 detaches poNewest
     // 3. Thread 1 arrives here
-    if (poNewest == this)
+    if (poPool == nullptr || bInProbation || poPool->poNewest == this)
         return;
 
     // We should not try to touch a block that has been detached.
     // If that happen, corruption has already occurred.
     CPLAssert(bMustDetach);
 
-    if (poOldest == this)
-        poOldest = this->poPrevious;
+    if (poPool->poOldest == this)
+        poPool->poOldest = this->poPrevious;
 
     if (poPrevious != nullptr)
         poPrevious->poNext = poNext;
@@ -834,25 +1660,81 @@ void GDALRasterBlock::Touch_unlocked()
         poNext->poPrevious = poPrevious;
 
     poPrevious = nullptr;
-    poNext = poNewest;
+    poNext = poPool->poNewest;
 
-    if (poNewest != nullptr)
+    if (poPool->poNewest != nullptr)
     {
-        CPLAssert(poNewest->poPrevious == nullptr);
-        poNewest->poPrevious = this;
+        CPLAssert(poPool->poNewest->poPrevious == nullptr);
+        poPool->poNewest->poPrevious = this;
     }
-    poNewest = this;
+    poPool->poNewest = this;
 
-    if (poOldest == nullptr)
+    if (poPool->poOldest == nullptr)
     {
         CPLAssert(poPrevious == nullptr && poNext == nullptr);
-        poOldest = this;
+        poPool->poOldest = this;
     }
 #ifdef ENABLE_DEBUG
     Verify();
 #endif
 }
 
+/************************************************************************/
+/*                           Insert_unlocked()                          */
+/************************************************************************/
+
+// Add a newly loaded block to the lists of its pool.
+void GDALRasterBlock::Insert_unlocked(GDALCachePool *poPoolIn)
+{
+    CPLAssert(poPool == nullptr && poPrevious == nullptr && poNext == nullptr);
+
+    poPool = poPoolIn;
+    poPool->nBlocks++;
+    if (GDALDatasetBlockCacheCounters *psDSCounters =
+            GetDatasetCounters(poBand))
+    {
+        psDSCounters->nBlocks++;
+        psDSCounters->nUsed += GetEffectiveBlockSize(GetBlockSize());
+    }
+    bInProbation = poPool->bScanResistant && !poPool->ForgetEvicted(this);
+    if (bInProbation)
+        poPool->nProbationUsed += GetEffectiveBlockSize(GetBlockSize());
+
+    GDALRasterBlock *&poListNewest =
+        bInProbation ? poPool->poProbationNewest : poPool->poNewest;
+    GDALRasterBlock *&poListOldest =
+        bInProbation ? poPool->poProbationOldest : poPool->poOldest;
+
+    poNext = poListNewest;
+    if (poListNewest != nullptr)
+        poListNewest->poPrevious = this;
+    poListNewest = this;
+    if (poListOldest == nullptr)
+        poListOldest = this;
+#ifdef ENABLE_DEBUG
+    Verify();
+#endif
+}
+
+/************************************************************************/
+/*                      RecordEviction_unlocked()                       */
+/************************************************************************/
+
+// Update the statistics of the pool of a block that is about to be evicted
+// from the cache.
+void GDALRasterBlock::RecordEviction_unlocked()
+{
+    nStatsEvictions.fetch_add(1, std::memory_order_relaxed);
+    if (GDALDatasetBlockCacheCounters *psDSCounters =
+            GetDatasetCounters(poBand))
+        psDSCounters->nEvictions.fetch_add(1, std::memory_order_relaxed);
+    if (poPool == nullptr)
+        return;
+    poPool->nEvictions++;
+    if (bInProbation)
+        poPool->RememberEvicted(this);
+}
+
 /************************************************************************/
 /*                            Internalize()                             */
 /************************************************************************/
@@ -888,6 +1770,7 @@ CPLErr GDALRasterBlock::Internalize()
     bool bFirstIter = true;
     bool bLoopAgain = false;
     GDALDataset *poThisDS = poBand->GetDataset();
+    GDALCachePool *poNewPool = nullptr;
     do
     {
         bLoopAgain = false;
@@ -897,10 +1780,42 @@ CPLErr GDALRasterBlock::Internalize()
             TAKE_LOCK;
 
             if (bFirstIter)
-                nCacheUsed += GetEffectiveBlockSize(nSizeInBytes);
-            GDALRasterBlock *poTarget = poOldest;
-            while (nCacheUsed > nCurCacheMax)
             {
+                poNewPool = GetCachePoolOfBand(poBand);
+                const GIntBig nEffectiveSize =
+                    GetEffectiveBlockSize(nSizeInBytes);
+                nCacheUsed += nEffectiveSize;
+                poNewPool->nUsed += nEffectiveSize;
+                poNewPool->nMisses++;
+                nStatsMisses.fetch_add(1, std::memory_order_relaxed);
+                if (GDALDatasetBlockCacheCounters *psDSCounters =
+                        GetDatasetCounters(poBand))
+                    psDSCounters->nMisses.fetch_add(1,
+                                                    std::memory_order_relaxed);
+            }
+
+            // First evict blocks of the pool of this block while it is over
+            // its quota, and then blocks of any pool while the cache is over
+            // its maximum size.
+            bool bHonorQuota = poNewPool->nQuota > 0;
+            const auto MustEvict = [&bHonorQuota, poNewPool, nCurCacheMax]()
+            {
+                return (bHonorQuota && poNewPool->nUsed > poNewPool->nQuota) ||
+                       nCacheUsed > nCurCacheMax;
+            };
+            GDALEvictionCursor oCursor(bHonorQuota ? poNewPool : nullptr,
+                                       nCurCacheMax);
+            while (true)
+            {
+                if (bHonorQuota && poNewPool->nUsed <= poNewPool->nQuota)
+                {
+                    bHonorQuota = false;
+                    oCursor.Reset(nullptr);
+                }
+                if (!MustEvict())
+                    break;
+
+                GDALRasterBlock *poTarget = nullptr;
                 GDALRasterBlock *poDirtyBlockOtherDataset = nullptr;
                 // In this first pass, only discard dirty blocks of this
                 // dataset. We do this to decrease significantly the likelihood
@@ -911,7 +1826,7 @@ CPLErr GDALRasterBlock::Internalize()
                 //    this block. As it has been removed from the block cache
                 //    array/set, thread 1 now tries to read block B from disk,
                 //    so gets the old value.
-                while (poTarget != nullptr)
+                while ((poTarget = oCursor.Get()) != nullptr)
                 {
                     if (!poTarget->GetDirty())
                     {
@@ -932,10 +1847,11 @@ CPLErr GDALRasterBlock::Internalize()
                             poDirtyBlockOtherDataset = poTarget;
                         }
                     }
-                    poTarget = poTarget->poPrevious;
+                    oCursor.Advance();
                 }
                 if (poTarget == nullptr && poDirtyBlockOtherDataset)
                 {
+                    oCursor.Rewind();
                     if (CPLAtomicCompareAndExchange(
                             &(poDirtyBlockOtherDataset->nLockCount), 0, -1))
                     {
@@ -945,8 +1861,7 @@ CPLErr GDALRasterBlock::Internalize()
                     }
                     else
                     {
-                        poTarget = poOldest;
-                        while (poTarget != nullptr)
+                        while ((poTarget = oCursor.Get()) != nullptr)
                         {
                             if (CPLAtomicCompareAndExchange(
                                     &(poTarget->nLockCount), 0, -1))
@@ -956,49 +1871,58 @@ CPLErr GDALRasterBlock::Internalize()
                                     "Evicting dirty block of another dataset");
                                 break;
                             }
-                            poTarget = poTarget->poPrevious;
+                            oCursor.Advance();
                         }
                     }
                 }
 
-                if (poTarget != nullptr)
+                if (poTarget == nullptr)
                 {
+                    if (!bHonorQuota)
+                        break;
+                    // Nothing can be evicted from the pool of this block:
+                    // only honor the global limit.
+                    bHonorQuota = false;
+                    oCursor.Reset(nullptr);
+                    continue;
+                }
+
 #ifndef __COVERITY__
-                    // Disabled to avoid complains about sleeping under locks,
-                    // that are only true for debug/testing code
-                    if (bSleepsForBockCacheDebug)
-                    {
-                        const double dfDelay = CPLAtof(CPLGetConfigOption(
-                            "GDAL_RB_INTERNALIZE_SLEEP_AFTER_DROP_LOCK", "0"));
-                        if (dfDelay > 0)
-                            CPLSleep(dfDelay);
-                    }
+                // Disabled to avoid complains about sleeping under locks,
+                // that are only true for debug/testing code
+                if (bSleepsForBockCacheDebug)
+                {
+                    const double dfDelay = CPLAtof(CPLGetConfigOption(
+                        "GDAL_RB_INTERNALIZE_SLEEP_AFTER_DROP_LOCK", "0"));
+                    if (dfDelay > 0)
+                        CPLSleep(dfDelay);
+                }
 #endif
 
-                    GDALRasterBlock *_poPrevious = poTarget->poPrevious;
+                // Move the cursor away from the block before detaching it.
+                const bool bCursorOnTarget = oCursor.Get() == poTarget;
+                if (bCursorOnTarget)
+                    oCursor.Advance();
 
-                    poTarget->Detach_unlocked();
-                    poTarget->GetBand()->UnreferenceBlock(poTarget);
+                poTarget->RecordEviction_unlocked();
+                poTarget->Detach_unlocked();
+                poTarget->GetBand()->UnreferenceBlock(poTarget);
 
-                    apoBlocksToFree[nBlocksToFree++] = poTarget;
-                    if (poTarget->GetDirty())
-                    {
-                        // Only free one dirty block at a time so that
-                        // other dirty blocks of other bands with the same
-                        // coordinates can be found with TryGetLockedBlock()
-                        bLoopAgain = nCacheUsed > nCurCacheMax;
-                        break;
-                    }
-                    if (nBlocksToFree == 64)
-                    {
-                        bLoopAgain = (nCacheUsed > nCurCacheMax);
-                        break;
-                    }
+                if (!bCursorOnTarget)
+                    oCursor.Rewind();
 
-                    poTarget = _poPrevious;
+                apoBlocksToFree[nBlocksToFree++] = poTarget;
+                if (poTarget->GetDirty())
+                {
+                    // Only free one dirty block at a time so that
+                    // other dirty blocks of other bands with the same
+                    // coordinates can be found with TryGetLockedBlock()
+                    bLoopAgain = MustEvict();
+                    break;
                 }
-                else
+                if (nBlocksToFree == 64)
                 {
+                    bLoopAgain = MustEvict();
                     break;
                 }
             }
@@ -1009,7 +1933,7 @@ CPLErr GDALRasterBlock::Internalize()
             /* ------------------------------------------------------------------
              */
             if (!bLoopAgain)
-                Touch_unlocked();
+                Insert_unlocked(poNewPool);
         }
 
         bFirstIter = false;
@@ -1041,6 +1965,11 @@ CPLErr GDALRasterBlock::Internalize()
                     poBlock->GetBand()->SetFlushBlockErr(eErr);
                 }
             }
+            else
+            {
+                poBlock->GetBand()->poBandBlockCache->SpillEvictedBlock(
+                    poBlock);
+            }
 
             // Try to recycle the data of an existing block.
             void *pDataBlock = poBlock->pData;
@@ -1090,7 +2019,14 @@ void GDALRasterBlock::MarkDirty()
     {
         poBand->InitRWLock();
         if (!bDirty)
+        {
             poBand->IncDirtyBlocks(1);
+            const GIntBig nSize = GetBlockSize();
+            const GIntBig nDirty = nCacheDirty.fetch_add(nSize) + nSize;
+            const GIntBig nThreshold = GetWriteBehindThreshold();
+            if (nThreshold > 0 && nDirty > nThreshold)
+                WakeUpWriteBehindThread(nThreshold / 2);
+        }
     }
     bDirty = true;
 }
@@ -1109,7 +2045,10 @@ void GDALRasterBlock::MarkDirty()
 void GDALRasterBlock::MarkClean()
 {
     if (bDirty && poBand)
+    {
         poBand->IncDirtyBlocks(-1);
+        nCacheDirty -= GetBlockSize();
+    }
     bDirty = false;
 }
 
@@ -1120,6 +2059,7 @@ void GDALRasterBlock::MarkClean()
 /*! @cond Doxygen_Suppress */
 void GDALRasterBlock::DestroyRBMutex()
 {
+    StopWriteBehindThread();
     if (hRBLock != nullptr)
         DESTROY_LOCK;
     hRBLock = nullptr;
@@ -1214,14 +2154,21 @@ int GDALRasterBlock::DropLockForRemovalFromStorage()
 void GDALRasterBlock::DumpAll()
 {
     int iBlock = 0;
-    for( GDALRasterBlock *poBlock = poNewest;
-         poBlock != nullptr;
-         poBlock = poBlock->poNext )
+    for( const auto &poPool : GetCachePools() )
     {
-        printf("Block %d\n", iBlock);/*ok*/
-        poBlock->DumpBlock();
-        printf("\n");/*ok*/
-        iBlock++;
+        for( GDALRasterBlock *poNewest :
+             { poPool->poNewest, poPool->poProbationNewest } )
+        {
+            for( GDALRasterBlock *poBlock = poNewest;
+                 poBlock != nullptr;
+                 poBlock = poBlock->poNext )
+            {
+                printf("Block %d\n", iBlock);/*ok*/
+                poBlock->DumpBlock();
+                printf("\n");/*ok*/
+                iBlock++;
+            }
+        }
     }
 }
 
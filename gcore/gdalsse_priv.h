@@ -754,6 +754,14 @@ class XMMReg2Double
         return reg;
     }
 
+    static inline XMMReg2Double Max(const XMMReg2Double &expr1,
+                                    const XMMReg2Double &expr2)
+    {
+        XMMReg2Double reg;
+        reg.xmm = _mm_max_pd(expr1.xmm, expr2.xmm);
+        return reg;
+    }
+
     inline void nsLoad1ValHighAndLow(const double *ptr)
     {
         xmm = _mm_load1_pd(ptr);
@@ -923,6 +931,21 @@ class XMMReg2Double
         return _mm_cvtsd_f64(_mm_add_sd(xmm, xmm2));
     }
 
+    /* Exchange low and high words */
+    inline XMMReg2Double swap_adjacent() const
+    {
+        XMMReg2Double ret;
+        ret.xmm = _mm_shuffle_pd(xmm, xmm, _MM_SHUFFLE2(0, 1));
+        return ret;
+    }
+
+    inline XMMReg2Double sqrt() const
+    {
+        XMMReg2Double ret;
+        ret.xmm = _mm_sqrt_pd(xmm);
+        return ret;
+    }
+
     inline void Store2Val(double *ptr) const
     {
         _mm_storeu_pd(ptr, xmm);
@@ -977,6 +1000,8 @@ class XMMReg2Double
 #warning "Software emulation of SSE2 !"
 #endif
 
+#include <cmath>
+
 class XMMReg2Double
 {
   public:
@@ -1116,6 +1141,15 @@ class XMMReg2Double
         return reg;
     }
 
+    static inline XMMReg2Double Max(const XMMReg2Double &expr1,
+                                    const XMMReg2Double &expr2)
+    {
+        XMMReg2Double reg;
+        reg.low = (expr1.low > expr2.low) ? expr1.low : expr2.low;
+        reg.high = (expr1.high > expr2.high) ? expr1.high : expr2.high;
+        return reg;
+    }
+
     static inline XMMReg2Double Load2Val(const double *ptr)
     {
         XMMReg2Double reg;
@@ -1314,6 +1348,23 @@ class XMMReg2Double
         return low + high;
     }
 
+    /* Exchange low and high words */
+    inline XMMReg2Double swap_adjacent() const
+    {
+        XMMReg2Double ret;
+        ret.low = high;
+        ret.high = low;
+        return ret;
+    }
+
+    inline XMMReg2Double sqrt() const
+    {
+        XMMReg2Double ret;
+        ret.low = std::sqrt(low);
+        ret.high = std::sqrt(high);
+        return ret;
+    }
+
     inline void Store2Val(double *ptr) const
     {
         ptr[0] = low;
@@ -1594,6 +1645,14 @@ class XMMReg4Double
         return reg;
     }
 
+    static inline XMMReg4Double Max(const XMMReg4Double &expr1,
+                                    const XMMReg4Double &expr2)
+    {
+        XMMReg4Double reg;
+        reg.ymm = _mm256_max_pd(expr1.ymm, expr2.ymm);
+        return reg;
+    }
+
     inline XMMReg4Double &operator=(const XMMReg4Double &other)
     {
         ymm = other.ymm;
@@ -1656,6 +1715,21 @@ class XMMReg4Double
         return _mm_cvtsd_f64(_mm256_castpd256_pd128(ymm_tmp1));
     }
 
+    /* Exchange words 0 and 1, and words 2 and 3 */
+    inline XMMReg4Double swap_adjacent() const
+    {
+        XMMReg4Double ret;
+        ret.ymm = _mm256_permute_pd(ymm, 0x5);
+        return ret;
+    }
+
+    inline XMMReg4Double sqrt() const
+    {
+        XMMReg4Double ret;
+        ret.ymm = _mm256_sqrt_pd(ymm);
+        return ret;
+    }
+
     inline XMMReg4Double approx_inv_sqrt(const XMMReg4Double &one,
                                          const XMMReg4Double &half) const
     {
@@ -1926,6 +2000,15 @@ class XMMReg4Double
         return reg;
     }
 
+    static inline XMMReg4Double Max(const XMMReg4Double &expr1,
+                                    const XMMReg4Double &expr2)
+    {
+        XMMReg4Double reg;
+        reg.low = XMMReg2Double::Max(expr1.low, expr2.low);
+        reg.high = XMMReg2Double::Max(expr1.high, expr2.high);
+        return reg;
+    }
+
     inline XMMReg4Double &operator=(const XMMReg4Double &other)
     {
         low = other.low;
@@ -1989,6 +2072,23 @@ class XMMReg4Double
         return (low + high).GetHorizSum();
     }
 
+    /* Exchange words 0 and 1, and words 2 and 3 */
+    inline XMMReg4Double swap_adjacent() const
+    {
+        XMMReg4Double ret;
+        ret.low = low.swap_adjacent();
+        ret.high = high.swap_adjacent();
+        return ret;
+    }
+
+    inline XMMReg4Double sqrt() const
+    {
+        XMMReg4Double ret;
+        ret.low = low.sqrt();
+        ret.high = high.sqrt();
+        return ret;
+    }
+
 #if !defined(USE_SSE2_EMULATION)
     inline XMMReg4Double approx_inv_sqrt(const XMMReg4Double &one,
                                          const XMMReg4Double &half) const
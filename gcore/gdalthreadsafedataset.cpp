@@ -39,6 +39,20 @@ bool GDALThreadLocalDatasetCacheIsInDestruction();
  *   them in a thread-safe way.
  * - GDALThreadLocalDatasetCache which is an internal class, which holds the
  *   thread-local datasets.
+ *
+ * When the shared-read mode is requested (SHARED_READ=YES option of
+ * GDALGetThreadSafeDataset(), or GDAL_THREAD_SAFE_SHARED_READ=YES config
+ * option), and the prototype dataset accepts it
+ * (GDALDataset::CanBeSharedForReading()), no thread-local dataset is opened.
+ * Instead:
+ * - GDALThreadSafeRasterBand instances use their own block cache, shared by
+ *   all threads, through the base GDALRasterBand::IRasterIO() implementation.
+ *   Cache hits do not take any lock.
+ * - Cache misses end up in GDALThreadSafeRasterBand::IReadBlock(), which
+ *   reads the block from the prototype band while holding
+ *   m_oPrototypeDSMutex.
+ * - All other methods forwarded to the underlying dataset or band act on the
+ *   prototype objects, under m_oPrototypeDSMutex.
  */
 
 /************************************************************************/
@@ -163,13 +177,15 @@ class GDALThreadSafeDataset final : public GDALProxyDataset
 {
   public:
     GDALThreadSafeDataset(std::unique_ptr<GDALDataset> poPrototypeDSUniquePtr,
-                          GDALDataset *poPrototypeDS);
+                          GDALDataset *poPrototypeDS, bool bSharedRead);
     ~GDALThreadSafeDataset() override;
 
     static std::unique_ptr<GDALDataset>
-    Create(std::unique_ptr<GDALDataset> poPrototypeDS, int nScopeFlags);
+    Create(std::unique_ptr<GDALDataset> poPrototypeDS, int nScopeFlags,
+           CSLConstList papszOptions);
 
-    static GDALDataset *Create(GDALDataset *poPrototypeDS, int nScopeFlags);
+    static GDALDataset *Create(GDALDataset *poPrototypeDS, int nScopeFlags,
+                               CSLConstList papszOptions);
 
     /* All below public methods override GDALDataset methods, and instead of
      * forwarding to a thread-local dataset, they act on the prototype dataset,
@@ -236,6 +252,8 @@ class GDALThreadSafeDataset final : public GDALProxyDataset
         return nullptr;
     }
 
+    CPLErr FlushCache(bool bAtClosing) override;
+
   protected:
     GDALDataset *RefUnderlyingDataset() const override;
 
@@ -244,12 +262,37 @@ class GDALThreadSafeDataset final : public GDALProxyDataset
 
     int CloseDependentDatasets() override;
 
+    CPLErr IRasterIO(GDALRWFlag, int, int, int, int, void *, int, int,
+                     GDALDataType, int, BANDMAP_TYPE, GSpacing, GSpacing,
+                     GSpacing, GDALRasterIOExtraArg *psExtraArg) override;
+    CPLErr BlockBasedRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
+                              int nXSize, int nYSize, void *pData,
+                              int nBufXSize, int nBufYSize,
+                              GDALDataType eBufType, int nBandCount,
+                              const int *panBandMap, GSpacing nPixelSpace,
+                              GSpacing nLineSpace, GSpacing nBandSpace,
+                              GDALRasterIOExtraArg *psExtraArg) override;
+
   private:
     friend class GDALThreadSafeRasterBand;
     friend class GDALThreadLocalDatasetCache;
 
-    /** Mutex that protects accesses to m_poPrototypeDS */
-    mutable std::mutex m_oPrototypeDSMutex{};
+    /** Mutex that protects accesses to m_poPrototypeDS. It is recursive
+     * because, in shared-read mode, it is held between RefUnderlyingDataset()
+     * and UnrefUnderlyingDataset() calls, which might be nested.
+     */
+    mutable std::recursive_mutex m_oPrototypeDSMutex{};
+
+    /** Whether m_poPrototypeDS is directly used by all threads, instead of
+     * per-thread datasets.
+     */
+    const bool m_bSharedRead;
+
+    /** In shared-read mode, thread-local config options of the caller, saved
+     * by RefUnderlyingDataset() and restored by UnrefUnderlyingDataset().
+     * Protected by m_oPrototypeDSMutex.
+     */
+    mutable std::vector<CPLStringList> m_aosSharedReadTLConfigOptions{};
 
     /** "Prototype" dataset, that is the dataset that was passed to the
      * GDALThreadSafeDataset constructor. All calls on to it should be on
@@ -312,6 +355,11 @@ class GDALThreadSafeDataset final : public GDALProxyDataset
     void UnrefUnderlyingDataset(GDALDataset *poUnderlyingDataset,
                                 GDALThreadLocalDatasetCache *poCache) const;
 
+    CPLStringList ActivateThreadLocalConfigOptions() const;
+
+    static bool UseSharedRead(const GDALDataset *poPrototypeDS,
+                              int nScopeFlags, CSLConstList papszOptions);
+
     GDALThreadSafeDataset(const GDALThreadSafeDataset &) = delete;
     GDALThreadSafeDataset &operator=(const GDALThreadSafeDataset &) = delete;
 };
@@ -382,11 +430,25 @@ class GDALThreadSafeRasterBand final : public GDALProxyRasterBand
         return nullptr;
     }
 
+    /* Below methods use our own block cache in shared-read mode. */
+    GDALRasterBlock *GetLockedBlockRef(int nXBlockOff, int nYBlockOff,
+                                       int bJustInitialize) override;
+    GDALRasterBlock *TryGetLockedBlockRef(int nXBlockOff,
+                                          int nYBlockYOff) override;
+    CPLErr FlushBlock(int nXBlockOff, int nYBlockOff,
+                      int bWriteDirtyBlock) override;
+    CPLErr FlushCache(bool bAtClosing) override;
+
   protected:
     GDALRasterBand *RefUnderlyingRasterBand(bool bForceOpen) const override;
     void UnrefUnderlyingRasterBand(
         GDALRasterBand *poUnderlyingRasterBand) const override;
 
+    CPLErr IReadBlock(int, int, void *) override;
+    CPLErr IRasterIO(GDALRWFlag, int, int, int, int, void *, int, int,
+                     GDALDataType, GSpacing, GSpacing,
+                     GDALRasterIOExtraArg *psExtraArg) override;
+
   private:
     /** Pointer to the thread-safe dataset from which this band has been
      *created */
@@ -527,8 +589,8 @@ bool GDALThreadLocalDatasetCacheIsInDestruction()
  */
 GDALThreadSafeDataset::GDALThreadSafeDataset(
     std::unique_ptr<GDALDataset> poPrototypeDSUniquePtr,
-    GDALDataset *poPrototypeDS)
-    : m_poPrototypeDS(poPrototypeDS),
+    GDALDataset *poPrototypeDS, bool bSharedRead)
+    : m_bSharedRead(bSharedRead), m_poPrototypeDS(poPrototypeDS),
       m_aosThreadLocalConfigOptions(CPLGetThreadLocalConfigOptions())
 {
     CPLAssert(poPrototypeDS != nullptr);
@@ -555,6 +617,40 @@ GDALThreadSafeDataset::GDALThreadSafeDataset(
     // dataset, let's increase its reference counter though.
     if (!m_poPrototypeDSUniquePtr)
         const_cast<GDALDataset *>(m_poPrototypeDS)->Reference();
+
+    if (m_bSharedRead)
+    {
+        CPLDebug("GDAL", "Sharing %s between threads for reading",
+                 GetDescription());
+    }
+}
+
+/************************************************************************/
+/*                          UseSharedRead()                             */
+/************************************************************************/
+
+/** Determine whether the shared-read mode has been requested, and can be
+ * used for the prototype dataset.
+ */
+
+/* static */ bool
+GDALThreadSafeDataset::UseSharedRead(const GDALDataset *poPrototypeDS,
+                                     int nScopeFlags,
+                                     CSLConstList papszOptions)
+{
+    const char *pszSharedRead = CSLFetchNameValueDef(
+        papszOptions, "SHARED_READ",
+        CPLGetConfigOption("GDAL_THREAD_SAFE_SHARED_READ", "NO"));
+    if (!CPLTestBool(pszSharedRead))
+        return false;
+    if (!poPrototypeDS->CanBeSharedForReading(nScopeFlags))
+    {
+        CPLDebug("GDAL",
+                 "%s cannot be shared for reading. Using per-thread datasets",
+                 poPrototypeDS->GetDescription());
+        return false;
+    }
+    return true;
 }
 
 /************************************************************************/
@@ -568,7 +664,7 @@ GDALThreadSafeDataset::GDALThreadSafeDataset(
 
 /* static */ std::unique_ptr<GDALDataset>
 GDALThreadSafeDataset::Create(std::unique_ptr<GDALDataset> poPrototypeDS,
-                              int nScopeFlags)
+                              int nScopeFlags, CSLConstList papszOptions)
 {
     if (nScopeFlags != GDAL_OF_RASTER)
     {
@@ -581,7 +677,10 @@ GDALThreadSafeDataset::Create(std::unique_ptr<GDALDataset> poPrototypeDS,
     {
         return poPrototypeDS;
     }
-    if (!poPrototypeDS->CanBeCloned(nScopeFlags, /* bCanShareState = */ true))
+    const bool bSharedRead =
+        UseSharedRead(poPrototypeDS.get(), nScopeFlags, papszOptions);
+    if (!bSharedRead &&
+        !poPrototypeDS->CanBeCloned(nScopeFlags, /* bCanShareState = */ true))
     {
         CPLError(CE_Failure, CPLE_NotSupported,
                  "GDALGetThreadSafeDataset(): Source dataset cannot be "
@@ -589,8 +688,8 @@ GDALThreadSafeDataset::Create(std::unique_ptr<GDALDataset> poPrototypeDS,
         return nullptr;
     }
     auto poPrototypeDSRaw = poPrototypeDS.get();
-    return std::make_unique<GDALThreadSafeDataset>(std::move(poPrototypeDS),
-                                                   poPrototypeDSRaw);
+    return std::make_unique<GDALThreadSafeDataset>(
+        std::move(poPrototypeDS), poPrototypeDSRaw, bSharedRead);
 }
 
 /************************************************************************/
@@ -603,7 +702,8 @@ GDALThreadSafeDataset::Create(std::unique_ptr<GDALDataset> poPrototypeDS,
  */
 
 /* static */ GDALDataset *
-GDALThreadSafeDataset::Create(GDALDataset *poPrototypeDS, int nScopeFlags)
+GDALThreadSafeDataset::Create(GDALDataset *poPrototypeDS, int nScopeFlags,
+                              CSLConstList papszOptions)
 {
     if (nScopeFlags != GDAL_OF_RASTER)
     {
@@ -617,14 +717,18 @@ GDALThreadSafeDataset::Create(GDALDataset *poPrototypeDS, int nScopeFlags)
         poPrototypeDS->Reference();
         return poPrototypeDS;
     }
-    if (!poPrototypeDS->CanBeCloned(nScopeFlags, /* bCanShareState = */ true))
+    const bool bSharedRead =
+        UseSharedRead(poPrototypeDS, nScopeFlags, papszOptions);
+    if (!bSharedRead &&
+        !poPrototypeDS->CanBeCloned(nScopeFlags, /* bCanShareState = */ true))
     {
         CPLError(CE_Failure, CPLE_NotSupported,
                  "GDALGetThreadSafeDataset(): Source dataset cannot be "
                  "cloned");
         return nullptr;
     }
-    return std::make_unique<GDALThreadSafeDataset>(nullptr, poPrototypeDS)
+    return std::make_unique<GDALThreadSafeDataset>(nullptr, poPrototypeDS,
+                                                   bSharedRead)
         .release();
 }
 
@@ -698,6 +802,105 @@ int GDALThreadSafeDataset::CloseDependentDatasets()
     return bRet;
 }
 
+/************************************************************************/
+/*                             FlushCache()                             */
+/************************************************************************/
+
+/** Implements GDALDataset::FlushCache()
+ *
+ * In shared-read mode, our bands have their own block cache, which must be
+ * flushed in addition to the one of the prototype dataset.
+ */
+CPLErr GDALThreadSafeDataset::FlushCache(bool bAtClosing)
+{
+    if (!m_bSharedRead)
+        return GDALProxyDataset::FlushCache(bAtClosing);
+
+    CPLErr eErr = GDALDataset::FlushCache(bAtClosing);
+    if (GDALProxyDataset::FlushCache(bAtClosing) != CE_None)
+        eErr = CE_Failure;
+    return eErr;
+}
+
+/************************************************************************/
+/*                             IRasterIO()                              */
+/************************************************************************/
+
+/** Implements GDALDataset::IRasterIO()
+ *
+ * In shared-read mode, requests are served by our bands, instead of being
+ * forwarded to the prototype dataset.
+ */
+CPLErr GDALThreadSafeDataset::IRasterIO(
+    GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
+    void *pData, int nBufXSize, int nBufYSize, GDALDataType eBufType,
+    int nBandCount, BANDMAP_TYPE panBandMap, GSpacing nPixelSpace,
+    GSpacing nLineSpace, GSpacing nBandSpace, GDALRasterIOExtraArg *psExtraArg)
+{
+    if (m_bSharedRead)
+    {
+        return GDALDataset::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
+                                      pData, nBufXSize, nBufYSize, eBufType,
+                                      nBandCount, panBandMap, nPixelSpace,
+                                      nLineSpace, nBandSpace, psExtraArg);
+    }
+    return GDALProxyDataset::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
+                                       pData, nBufXSize, nBufYSize, eBufType,
+                                       nBandCount, panBandMap, nPixelSpace,
+                                       nLineSpace, nBandSpace, psExtraArg);
+}
+
+/************************************************************************/
+/*                         BlockBasedRasterIO()                         */
+/************************************************************************/
+
+/** Implements GDALDataset::BlockBasedRasterIO()
+ *
+ * In shared-read mode, requests are served by our bands, instead of being
+ * forwarded to the prototype dataset.
+ */
+CPLErr GDALThreadSafeDataset::BlockBasedRasterIO(
+    GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
+    void *pData, int nBufXSize, int nBufYSize, GDALDataType eBufType,
+    int nBandCount, const int *panBandMap, GSpacing nPixelSpace,
+    GSpacing nLineSpace, GSpacing nBandSpace, GDALRasterIOExtraArg *psExtraArg)
+{
+    if (m_bSharedRead)
+    {
+        return GDALDataset::BlockBasedRasterIO(
+            eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
+            eBufType, nBandCount, panBandMap, nPixelSpace, nLineSpace,
+            nBandSpace, psExtraArg);
+    }
+    return GDALProxyDataset::BlockBasedRasterIO(
+        eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
+        eBufType, nBandCount, panBandMap, nPixelSpace, nLineSpace, nBandSpace,
+        psExtraArg);
+}
+
+/************************************************************************/
+/*                  ActivateThreadLocalConfigOptions()                  */
+/************************************************************************/
+
+/** Make active the thread-local config options that were valid when this
+ * instance was created, merged with the current ones of the calling thread.
+ *
+ * Returns the thread-local config options of the calling thread before the
+ * call, so that the caller can restore them.
+ */
+CPLStringList GDALThreadSafeDataset::ActivateThreadLocalConfigOptions() const
+{
+    CPLStringList aosTLConfigOptionsBackup(CPLGetThreadLocalConfigOptions());
+
+    const CPLStringList aosMerged(
+        CSLMerge(CSLDuplicate(m_aosThreadLocalConfigOptions.List()),
+                 aosTLConfigOptionsBackup.List()));
+
+    CPLSetThreadLocalConfigOptions(aosMerged.List());
+
+    return aosTLConfigOptionsBackup;
+}
+
 /************************************************************************/
 /*                       RefUnderlyingDataset()                         */
 /************************************************************************/
@@ -714,17 +917,26 @@ int GDALThreadSafeDataset::CloseDependentDatasets()
  */
 GDALDataset *GDALThreadSafeDataset::RefUnderlyingDataset() const
 {
-    // Back-up thread-local config options at the time we are called
-    CPLStringList aosTLConfigOptionsBackup(CPLGetThreadLocalConfigOptions());
-
-    // Now merge the thread-local config options at the time where this
-    // instance has been created with the current ones.
-    const CPLStringList aosMerged(
-        CSLMerge(CSLDuplicate(m_aosThreadLocalConfigOptions.List()),
-                 aosTLConfigOptionsBackup.List()));
-
-    // And make that merged list active
-    CPLSetThreadLocalConfigOptions(aosMerged.List());
+    // Back-up thread-local config options at the time we are called, and
+    // make active the ones at the time where this instance has been created,
+    // merged with the current ones.
+    CPLStringList aosTLConfigOptionsBackup(ActivateThreadLocalConfigOptions());
+
+    // In shared-read mode, lock the prototype dataset until
+    // UnrefUnderlyingDataset() is called.
+    if (m_bSharedRead)
+    {
+        m_oPrototypeDSMutex.lock();
+        if (!m_poPrototypeDS)
+        {
+            m_oPrototypeDSMutex.unlock();
+            CPLSetThreadLocalConfigOptions(aosTLConfigOptionsBackup.List());
+            return nullptr;
+        }
+        m_aosSharedReadTLConfigOptions.push_back(
+            std::move(aosTLConfigOptionsBackup));
+        return const_cast<GDALDataset *>(m_poPrototypeDS);
+    }
 
     std::shared_ptr<GDALDataset> poTLSDS;
 
@@ -820,6 +1032,15 @@ GDALDataset *GDALThreadSafeDataset::RefUnderlyingDataset() const
 void GDALThreadSafeDataset::UnrefUnderlyingDataset(
     GDALDataset *poUnderlyingDataset) const
 {
+    if (m_bSharedRead)
+    {
+        CPLSetThreadLocalConfigOptions(
+            m_aosSharedReadTLConfigOptions.back().List());
+        m_aosSharedReadTLConfigOptions.pop_back();
+        m_oPrototypeDSMutex.unlock();
+        return;
+    }
+
     GDALThreadLocalDatasetCache *poCache = tl_poCache.get();
     CPLAssert(poCache);
     std::unique_lock oLock(poCache->m_oMutex);
@@ -892,6 +1113,10 @@ GDALThreadSafeRasterBand::GDALThreadSafeRasterBand(
             poTSDS, nullptr, 0, poPrototypeBand->GetMaskBand(),
             -nBaseBandOfMaskBand, nOvrIdx);
     }
+
+    // In shared-read mode, our block cache is used by all threads.
+    if (poTSDS->m_bSharedRead)
+        CPL_IGNORE_RET_VAL(EnableConcurrentBlockAccess());
 }
 
 /************************************************************************/
@@ -907,6 +1132,15 @@ GDALThreadSafeRasterBand::GDALThreadSafeRasterBand(
 GDALRasterBand *
 GDALThreadSafeRasterBand::RefUnderlyingRasterBand(bool /*bForceOpen*/) const
 {
+    // In shared-read mode, use the prototype band, which remains locked until
+    // UnrefUnderlyingRasterBand() is called.
+    if (m_poTSDS->m_bSharedRead)
+    {
+        if (!m_poTSDS->RefUnderlyingDataset())
+            return nullptr;
+        return const_cast<GDALRasterBand *>(m_poPrototypeBand);
+    }
+
     // Get a thread-local dataset
     auto poTLDS = m_poTSDS->RefUnderlyingDataset();
     if (!poTLDS)
@@ -1010,6 +1244,13 @@ void GDALThreadSafeRasterBand::UnrefUnderlyingRasterBand(
 {
     // CPLDebug("GDAL", "%p->UnrefUnderlyingRasterBand(%p)", this, poUnderlyingRasterBand);
 
+    if (m_poTSDS->m_bSharedRead)
+    {
+        m_poTSDS->UnrefUnderlyingDataset(
+            const_cast<GDALDataset *>(m_poTSDS->m_poPrototypeDS));
+        return;
+    }
+
     // Unregisters the association between the thread-local band and the
     // thread-local dataset
     {
@@ -1026,6 +1267,147 @@ void GDALThreadSafeRasterBand::UnrefUnderlyingRasterBand(
     }
 }
 
+/************************************************************************/
+/*                             IReadBlock()                             */
+/************************************************************************/
+
+/** Implements GDALRasterBand::IReadBlock
+ *
+ * In shared-read mode, this is only called on misses of our block cache, and
+ * reads the block from the prototype band, with the prototype dataset locked.
+ */
+CPLErr GDALThreadSafeRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff,
+                                            void *pImage)
+{
+    if (!m_poTSDS->m_bSharedRead)
+        return GDALProxyRasterBand::IReadBlock(nBlockXOff, nBlockYOff, pImage);
+
+    GDALRasterBand *poSrcBand = RefUnderlyingRasterBand(true);
+    if (!poSrcBand)
+        return CE_Failure;
+
+    // Some drivers load blocks of several bands at once in the cache of the
+    // prototype bands (e.g. GTiff for pixel-interleaved datasets). Move such
+    // a block into our cache rather than reading it again.
+    CPLErr eErr = CE_None;
+    GDALRasterBlock *poSrcBlock =
+        poSrcBand->TryGetLockedBlockRef(nBlockXOff, nBlockYOff);
+    if (poSrcBlock)
+    {
+        memcpy(pImage, poSrcBlock->GetDataRef(), poSrcBlock->GetBlockSize());
+        poSrcBlock->DropLock();
+        CPL_IGNORE_RET_VAL(
+            poSrcBand->FlushBlock(nBlockXOff, nBlockYOff, FALSE));
+    }
+    else
+    {
+        eErr =
+            GDALProxyRasterBand::IReadBlock(nBlockXOff, nBlockYOff, pImage);
+    }
+
+    UnrefUnderlyingRasterBand(poSrcBand);
+    return eErr;
+}
+
+/************************************************************************/
+/*                             IRasterIO()                              */
+/************************************************************************/
+
+/** Implements GDALRasterBand::IRasterIO
+ *
+ * In shared-read mode, requests go through our block cache.
+ */
+CPLErr GDALThreadSafeRasterBand::IRasterIO(
+    GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
+    void *pData, int nBufXSize, int nBufYSize, GDALDataType eBufType,
+    GSpacing nPixelSpace, GSpacing nLineSpace, GDALRasterIOExtraArg *psExtraArg)
+{
+    if (m_poTSDS->m_bSharedRead)
+    {
+        return GDALRasterBand::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
+                                         pData, nBufXSize, nBufYSize, eBufType,
+                                         nPixelSpace, nLineSpace, psExtraArg);
+    }
+    return GDALProxyRasterBand::IRasterIO(
+        eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
+        eBufType, nPixelSpace, nLineSpace, psExtraArg);
+}
+
+/************************************************************************/
+/*                         GetLockedBlockRef()                          */
+/************************************************************************/
+
+/** Implements GDALRasterBand::GetLockedBlockRef
+ */
+GDALRasterBlock *GDALThreadSafeRasterBand::GetLockedBlockRef(
+    int nXBlockOff, int nYBlockOff, int bJustInitialize)
+{
+    if (m_poTSDS->m_bSharedRead)
+    {
+        return GDALRasterBand::GetLockedBlockRef(nXBlockOff, nYBlockOff,
+                                                 bJustInitialize);
+    }
+    return GDALProxyRasterBand::GetLockedBlockRef(nXBlockOff, nYBlockOff,
+                                                  bJustInitialize);
+}
+
+/************************************************************************/
+/*                        TryGetLockedBlockRef()                        */
+/************************************************************************/
+
+/** Implements GDALRasterBand::TryGetLockedBlockRef
+ */
+GDALRasterBlock *
+GDALThreadSafeRasterBand::TryGetLockedBlockRef(int nXBlockOff, int nYBlockOff)
+{
+    if (m_poTSDS->m_bSharedRead)
+        return GDALRasterBand::TryGetLockedBlockRef(nXBlockOff, nYBlockOff);
+    return GDALProxyRasterBand::TryGetLockedBlockRef(nXBlockOff, nYBlockOff);
+}
+
+/************************************************************************/
+/*                             FlushBlock()                             */
+/************************************************************************/
+
+/** Implements GDALRasterBand::FlushBlock
+ */
+CPLErr GDALThreadSafeRasterBand::FlushBlock(int nXBlockOff, int nYBlockOff,
+                                            int bWriteDirtyBlock)
+{
+    if (m_poTSDS->m_bSharedRead)
+    {
+        return GDALRasterBand::FlushBlock(nXBlockOff, nYBlockOff,
+                                          bWriteDirtyBlock);
+    }
+    return GDALProxyRasterBand::FlushBlock(nXBlockOff, nYBlockOff,
+                                           bWriteDirtyBlock);
+}
+
+/************************************************************************/
+/*                             FlushCache()                             */
+/************************************************************************/
+
+/** Implements GDALRasterBand::FlushCache
+ *
+ * In shared-read mode, our mask and overview bands also have their own
+ * block cache.
+ */
+CPLErr GDALThreadSafeRasterBand::FlushCache(bool bAtClosing)
+{
+    CPLErr eErr = GDALProxyRasterBand::FlushCache(bAtClosing);
+    if (m_poTSDS->m_bSharedRead)
+    {
+        if (m_poMaskBand && m_poMaskBand->FlushCache(bAtClosing) != CE_None)
+            eErr = CE_Failure;
+        for (auto &poOvrBand : m_apoOverviews)
+        {
+            if (poOvrBand->FlushCache(bAtClosing) != CE_None)
+                eErr = CE_Failure;
+        }
+    }
+    return eErr;
+}
+
 /************************************************************************/
 /*                           GetMaskBand()                              */
 /************************************************************************/
@@ -1175,6 +1557,12 @@ bool GDALDatasetIsThreadSafe(GDALDatasetH hDS, int nScopeFlags,
  * Datasets of the MEM driver cannot be opened by name, but this function will
  * take care of "cloning" them, using the same backing memory, when needed.
  *
+ * If the GDAL_THREAD_SAFE_SHARED_READ configuration option is set to YES, and
+ * the driver supports it (GTiff, MEM and VRT drivers currently), no
+ * per-thread dataset is opened. poDS is instead used by all threads, with its
+ * block reads serialized, and with a block cache shared by all threads
+ * (added in GDAL 3.13).
+ *
  * Ownership of the passed dataset is transferred to the thread-safe dataset.
  *
  * The function may also return the passed dataset if it is already thread-safe.
@@ -1190,7 +1578,8 @@ bool GDALDatasetIsThreadSafe(GDALDatasetH hDS, int nScopeFlags,
 std::unique_ptr<GDALDataset>
 GDALGetThreadSafeDataset(std::unique_ptr<GDALDataset> poDS, int nScopeFlags)
 {
-    return GDALThreadSafeDataset::Create(std::move(poDS), nScopeFlags);
+    return GDALThreadSafeDataset::Create(std::move(poDS), nScopeFlags,
+                                         nullptr);
 }
 
 /************************************************************************/
@@ -1207,6 +1596,12 @@ GDALGetThreadSafeDataset(std::unique_ptr<GDALDataset> poDS, int nScopeFlags)
  * Datasets of the MEM driver cannot be opened by name, but this function will
  * take care of "cloning" them, using the same backing memory, when needed.
  *
+ * If the GDAL_THREAD_SAFE_SHARED_READ configuration option is set to YES, and
+ * the driver supports it (GTiff, MEM and VRT drivers currently), no
+ * per-thread dataset is opened. poDS is instead used by all threads, with its
+ * block reads serialized, and with a block cache shared by all threads
+ * (added in GDAL 3.13).
+ *
  * The life-time of the passed dataset must be longer than the one of
  * the returned thread-safe dataset.
  *
@@ -1238,7 +1633,7 @@ GDALGetThreadSafeDataset(std::unique_ptr<GDALDataset> poDS, int nScopeFlags)
  */
 GDALDataset *GDALGetThreadSafeDataset(GDALDataset *poDS, int nScopeFlags)
 {
-    return GDALThreadSafeDataset::Create(poDS, nScopeFlags);
+    return GDALThreadSafeDataset::Create(poDS, nScopeFlags, nullptr);
 }
 
 /************************************************************************/
@@ -1255,6 +1650,12 @@ GDALDataset *GDALGetThreadSafeDataset(GDALDataset *poDS, int nScopeFlags)
  * Datasets of the MEM driver cannot be opened by name, but this function will
  * take care of "cloning" them, using the same backing memory, when needed.
  *
+ * If the GDAL_THREAD_SAFE_SHARED_READ configuration option is set to YES, and
+ * the driver supports it (GTiff, MEM and VRT drivers currently), no
+ * per-thread dataset is opened. poDS is instead used by all threads, with its
+ * block reads serialized, and with a block cache shared by all threads
+ * (added in GDAL 3.13).
+ *
  * The life-time of the passed dataset must be longer than the one of
  * the returned thread-safe dataset.
  *
@@ -1278,7 +1679,9 @@ GDALDataset *GDALGetThreadSafeDataset(GDALDataset *poDS, int nScopeFlags)
  * @param hDS Source dataset
  * @param nScopeFlags Intended scope of use.
  * Only GDAL_OF_RASTER is supported currently.
- * @param papszOptions Options. None currently.
+ * @param papszOptions Options, or NULL. SHARED_READ=YES/NO may be set to
+ * override the GDAL_THREAD_SAFE_SHARED_READ configuration option (added in
+ * GDAL 3.13).
  *
  * @since 3.10
  */
@@ -1287,7 +1690,6 @@ GDALDatasetH GDALGetThreadSafeDataset(GDALDatasetH hDS, int nScopeFlags,
 {
     VALIDATE_POINTER1(hDS, __func__, nullptr);
 
-    CPL_IGNORE_RET_VAL(papszOptions);
-    return GDALDataset::ToHandle(
-        GDALGetThreadSafeDataset(GDALDataset::FromHandle(hDS), nScopeFlags));
+    return GDALDataset::ToHandle(GDALThreadSafeDataset::Create(
+        GDALDataset::FromHandle(hDS), nScopeFlags, papszOptions));
 }
@@ -25,7 +25,9 @@
 #include <cstring>
 
 #include <algorithm>
+#include <atomic>
 #include <limits>
+#include <memory>
 #include <stdexcept>
 #include <type_traits>
 
@@ -36,7 +38,9 @@
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal_priv_templates.hpp"
+#include "gdal_thread_pool.h"
 #include "gdal_vrt.h"
 #include "gdalwarper.h"
 #include "memdataset.h"
@@ -1011,6 +1015,63 @@ static int GDALRasterIOTransformer(void *pTransformerArg, int bDstToSrc,
     return TRUE;
 }
 
+/************************************************************************/
+/*               GDALGetNumThreadsForRasterIOResampled()                */
+/************************************************************************/
+
+// Number of threads used by RasterIOResampled() to resample the nChunks
+// chunks it reads.
+static int GDALGetNumThreadsForRasterIOResampled(int nChunks)
+{
+    const char *pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    const int nThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                             ? CPLGetNumCPUs()
+                             : atoi(pszNumThreads);
+    return std::min(std::max(1, std::min(128, nThreads)), nChunks);
+}
+
+/************************************************************************/
+/*                      GDALResampleChunkToBuffer()                     */
+/************************************************************************/
+
+// Resample the source chunk pChunk described by args, and write the result
+// in the [args.nDstXOff, args.nDstXOff2[ x [args.nDstYOff, args.nDstYOff2[
+// area of the buffer of type eDstDataType whose pixel (0, 0) is at
+// pabyDstOrigin.
+// Nothing else is written, so that disjoint chunks may be resampled
+// concurrently.
+static CPLErr GDALResampleChunkToBuffer(GDALResampleFunction pfnResampleFunc,
+                                        const GDALOverviewResampleArgs &args,
+                                        const void *pChunk,
+                                        GByte *pabyDstOrigin,
+                                        GDALDataType eDstDataType,
+                                        GSpacing nPixelSpace,
+                                        GSpacing nLineSpace)
+{
+    void *pDstBuffer = nullptr;
+    GDALDataType eDstBufferDataType = GDT_Unknown;
+    const CPLErr eErr =
+        pfnResampleFunc(args, pChunk, &pDstBuffer, &eDstBufferDataType);
+    if (eErr == CE_None)
+    {
+        const int nDstXCount = args.nDstXOff2 - args.nDstXOff;
+        const int nDTSize = GDALGetDataTypeSizeBytes(eDstBufferDataType);
+        for (int iY = args.nDstYOff; iY < args.nDstYOff2; ++iY)
+        {
+            GDALCopyWords64(static_cast<GByte *>(pDstBuffer) +
+                                static_cast<size_t>(iY - args.nDstYOff) *
+                                    nDstXCount * nDTSize,
+                            eDstBufferDataType, nDTSize,
+                            pabyDstOrigin + iY * nLineSpace +
+                                args.nDstXOff * nPixelSpace,
+                            eDstDataType, static_cast<int>(nPixelSpace),
+                            nDstXCount);
+        }
+    }
+    CPLFree(pDstBuffer);
+    return eErr;
+}
+
 /************************************************************************/
 /*                          RasterIOResampled()                         */
 /************************************************************************/
@@ -1317,6 +1378,17 @@ CPLErr GDALRasterBand::RasterIOResampled(
                                  DIV_ROUND_UP(nBufYSize, nDstBlockYSize);
         int nBlocksDone = 0;
 
+        // Source chunks are read from the calling thread, as IReadBlock()
+        // implementations are not required to be re-entrant, and resampled
+        // by worker threads into disjoint areas of the output buffer.
+        const int nThreads =
+            GDALGetNumThreadsForRasterIOResampled(nTotalBlocks);
+        auto poJobQueue =
+            nThreads > 1 ? GDALGetGlobalThreadPool(nThreads)->CreateJobQueue()
+                         : std::unique_ptr<CPLJobQueue>(nullptr);
+        const int nMaxPendingJobs = 2 * nThreads;
+        std::atomic<bool> bJobFailed{false};
+
         int nDstYOff;
         for (nDstYOff = 0; nDstYOff < nBufYSize && eErr == CE_None;
              nDstYOff += nDstBlockYSize)
@@ -1433,8 +1505,6 @@ CPLErr GDALRasterBand::RasterIOResampled(
                 if (!bSkipResample && eErr == CE_None)
                 {
                     const bool bPropagateNoData = false;
-                    void *pDstBuffer = nullptr;
-                    GDALDataType eDstBufferDataType = GDT_Unknown;
                     GDALRasterBand *poMEMBand =
                         GDALRasterBand::FromHandle(hMEMBand);
                     GDALOverviewResampleArgs args;
@@ -1467,17 +1537,56 @@ CPLErr GDALRasterBand::RasterIOResampled(
                     args.dfNoDataValue = dfNoDataValue;
                     args.poColorTable = GetColorTable();
                     args.bPropagateNoData = bPropagateNoData;
-                    eErr = pfnResampleFunc(args, pChunk, &pDstBuffer,
-                                           &eDstBufferDataType);
-                    if (eErr == CE_None)
+                    if (poJobQueue)
+                    {
+                        // Hand the buffers over to the job, and allocate new
+                        // ones for the next chunk.
+                        void *pJobChunk = pChunk;
+                        GByte *pabyJobNoDataMask = pabyChunkNoDataMask;
+                        if (!poJobQueue->SubmitJob(
+                                [pfnResampleFunc, args, pJobChunk,
+                                 pabyJobNoDataMask, pabyData, eDTMem, nPSMem,
+                                 nLSMem, &bJobFailed]()
+                                {
+                                    if (GDALResampleChunkToBuffer(
+                                            pfnResampleFunc, args, pJobChunk,
+                                            pabyData, eDTMem, nPSMem,
+                                            nLSMem) != CE_None)
+                                    {
+                                        bJobFailed = true;
+                                    }
+                                    CPLFree(pJobChunk);
+                                    CPLFree(pabyJobNoDataMask);
+                                }))
+                        {
+                            CPLFree(pJobChunk);
+                            CPLFree(pabyJobNoDataMask);
+                            eErr = CE_Failure;
+                        }
+                        pChunk = VSI_MALLOC3_VERBOSE(
+                            GDALGetDataTypeSizeBytes(eWrkDataType),
+                            nFullResXSizeQueried, nFullResYSizeQueried);
+                        pabyChunkNoDataMask =
+                            bUseNoDataMask
+                                ? static_cast<GByte *>(VSI_MALLOC2_VERBOSE(
+                                      nFullResXSizeQueried,
+                                      nFullResYSizeQueried))
+                                : nullptr;
+                        if (pChunk == nullptr ||
+                            (bUseNoDataMask && pabyChunkNoDataMask == nullptr))
+                        {
+                            eErr = CE_Failure;
+                        }
+                        poJobQueue->WaitCompletion(nMaxPendingJobs);
+                        if (bJobFailed)
+                            eErr = CE_Failure;
+                    }
+                    else
                     {
-                        eErr = poMEMBand->RasterIO(
-                            GF_Write, nDstXOff + nDestXOffVirtual,
-                            nDstYOff + nDestYOffVirtual, nDstXCount, nDstYCount,
-                            pDstBuffer, nDstXCount, nDstYCount,
-                            eDstBufferDataType, 0, 0, nullptr);
+                        eErr = GDALResampleChunkToBuffer(
+                            pfnResampleFunc, args, pChunk, pabyData, eDTMem,
+                            nPSMem, nLSMem);
                     }
-                    CPLFree(pDstBuffer);
                 }
 
                 nBlocksDone++;
@@ -1490,6 +1599,13 @@ CPLErr GDALRasterBand::RasterIOResampled(
             }
         }
 
+        if (poJobQueue)
+        {
+            poJobQueue->WaitCompletion();
+            if (bJobFailed)
+                eErr = CE_Failure;
+        }
+
         CPLFree(pChunk);
         CPLFree(pabyChunkNoDataMask);
     }
@@ -1756,10 +1872,10 @@ CPLErr GDALDataset::RasterIOResampled(
         if (nFullResYSizeQueried > nRasterYSize)
             nFullResYSizeQueried = nRasterYSize;
 
+        const int nChunkPixelSize = cpl::fits_on<int>(
+            GDALGetDataTypeSizeBytes(eWrkDataType) * nBandCount);
         void *pChunk = VSI_MALLOC3_VERBOSE(
-            cpl::fits_on<int>(GDALGetDataTypeSizeBytes(eWrkDataType) *
-                              nBandCount),
-            nFullResXSizeQueried, nFullResYSizeQueried);
+            nChunkPixelSize, nFullResXSizeQueried, nFullResYSizeQueried);
         GByte *pabyChunkNoDataMask = nullptr;
 
         GDALRasterBand *poMaskBand = poFirstSrcBand->GetMaskBand();
@@ -1785,6 +1901,44 @@ CPLErr GDALDataset::RasterIOResampled(
                                  DIV_ROUND_UP(nBufYSize, nDstBlockYSize);
         int nBlocksDone = 0;
 
+        // Resample the nBandCount bands of a source chunk, that have the
+        // same arguments except their data.
+        GByte *const pabyDstOrigin = static_cast<GByte *>(pData) -
+                                     nPixelSpace * nDestXOffVirtual -
+                                     nLineSpace * nDestYOffVirtual;
+        const auto ResampleBands =
+            [pfnResampleFunc, pabyDstOrigin, eBufType, nPixelSpace, nLineSpace,
+             nBandSpace, nBandCount](const GDALOverviewResampleArgs &args,
+                                     const void *pChunkIn)
+        {
+            const size_t nChunkBandOffset =
+                static_cast<size_t>(args.nChunkXSize) * args.nChunkYSize *
+                GDALGetDataTypeSizeBytes(args.eWrkDataType);
+            for (int i = 0; i < nBandCount; i++)
+            {
+                if (GDALResampleChunkToBuffer(
+                        pfnResampleFunc, args,
+                        static_cast<const GByte *>(pChunkIn) +
+                            i * nChunkBandOffset,
+                        pabyDstOrigin + i * nBandSpace, eBufType, nPixelSpace,
+                        nLineSpace) != CE_None)
+                {
+                    return CE_Failure;
+                }
+            }
+            return CE_None;
+        };
+
+        // Source chunks are read from the calling thread, and resampled by
+        // worker threads into disjoint areas of the output buffer.
+        const int nThreads =
+            GDALGetNumThreadsForRasterIOResampled(nTotalBlocks);
+        auto poJobQueue =
+            nThreads > 1 ? GDALGetGlobalThreadPool(nThreads)->CreateJobQueue()
+                         : std::unique_ptr<CPLJobQueue>(nullptr);
+        const int nMaxPendingJobs = 2 * nThreads;
+        std::atomic<bool> bJobFailed{false};
+
         int nDstYOff;
         for (nDstYOff = 0; nDstYOff < nBufYSize && eErr == CE_None;
              nDstYOff += nDstBlockYSize)
@@ -1929,68 +2083,87 @@ CPLErr GDALDataset::RasterIOResampled(
                 }
                 else
 #endif
+                if (!bSkipResample && eErr == CE_None)
                 {
-                    size_t nChunkBandOffset =
-                        static_cast<size_t>(nChunkXSizeQueried) *
-                        nChunkYSizeQueried *
-                        GDALGetDataTypeSizeBytes(eWrkDataType);
-                    for (int i = 0;
-                         i < nBandCount && !bSkipResample && eErr == CE_None;
-                         i++)
+                    const bool bPropagateNoData = false;
+                    // All bands of the MEM dataset have the same
+                    // characteristics, and share the same arguments.
+                    GDALRasterBand *poMEMBand = poMEMDS->GetRasterBand(1);
+                    GDALOverviewResampleArgs args;
+                    args.eSrcDataType = eDataType;
+                    args.eOvrDataType = poMEMBand->GetRasterDataType();
+                    args.nOvrXSize = poMEMBand->GetXSize();
+                    args.nOvrYSize = poMEMBand->GetYSize();
+                    args.nOvrNBITS = nNBITS;
+                    args.dfXRatioDstToSrc = dfXRatioDstToSrc;
+                    args.dfYRatioDstToSrc = dfYRatioDstToSrc;
+                    args.dfSrcXDelta =
+                        dfXOff - nXOff; /* == 0 if bHasXOffVirtual */
+                    args.dfSrcYDelta =
+                        dfYOff - nYOff; /* == 0 if bHasYOffVirtual */
+                    args.eWrkDataType = eWrkDataType;
+                    args.pabyChunkNodataMask =
+                        bNoDataMaskFullyOpaque ? nullptr : pabyChunkNoDataMask;
+                    args.nChunkXOff =
+                        nChunkXOffQueried - (bHasXOffVirtual ? 0 : nXOff);
+                    args.nChunkXSize = nChunkXSizeQueried;
+                    args.nChunkYOff =
+                        nChunkYOffQueried - (bHasYOffVirtual ? 0 : nYOff);
+                    args.nChunkYSize = nChunkYSizeQueried;
+                    args.nDstXOff = nDstXOff + nDestXOffVirtual;
+                    args.nDstXOff2 = nDstXOff + nDestXOffVirtual + nDstXCount;
+                    args.nDstYOff = nDstYOff + nDestYOffVirtual;
+                    args.nDstYOff2 = nDstYOff + nDestYOffVirtual + nDstYCount;
+                    args.pszResampling = pszResampling;
+                    args.bHasNoData = false;
+                    args.dfNoDataValue = 0.0;
+                    args.poColorTable = nullptr;
+                    args.bPropagateNoData = bPropagateNoData;
+
+                    if (poJobQueue)
                     {
-                        const bool bPropagateNoData = false;
-                        void *pDstBuffer = nullptr;
-                        GDALDataType eDstBufferDataType = GDT_Unknown;
-                        GDALRasterBand *poMEMBand =
-                            poMEMDS->GetRasterBand(i + 1);
-                        GDALOverviewResampleArgs args;
-                        args.eSrcDataType = eDataType;
-                        args.eOvrDataType = poMEMBand->GetRasterDataType();
-                        args.nOvrXSize = poMEMBand->GetXSize();
-                        args.nOvrYSize = poMEMBand->GetYSize();
-                        args.nOvrNBITS = nNBITS;
-                        args.dfXRatioDstToSrc = dfXRatioDstToSrc;
-                        args.dfYRatioDstToSrc = dfYRatioDstToSrc;
-                        args.dfSrcXDelta =
-                            dfXOff - nXOff; /* == 0 if bHasXOffVirtual */
-                        args.dfSrcYDelta =
-                            dfYOff - nYOff; /* == 0 if bHasYOffVirtual */
-                        args.eWrkDataType = eWrkDataType;
-                        args.pabyChunkNodataMask = bNoDataMaskFullyOpaque
-                                                       ? nullptr
-                                                       : pabyChunkNoDataMask;
-                        args.nChunkXOff =
-                            nChunkXOffQueried - (bHasXOffVirtual ? 0 : nXOff);
-                        args.nChunkXSize = nChunkXSizeQueried;
-                        args.nChunkYOff =
-                            nChunkYOffQueried - (bHasYOffVirtual ? 0 : nYOff);
-                        args.nChunkYSize = nChunkYSizeQueried;
-                        args.nDstXOff = nDstXOff + nDestXOffVirtual;
-                        args.nDstXOff2 =
-                            nDstXOff + nDestXOffVirtual + nDstXCount;
-                        args.nDstYOff = nDstYOff + nDestYOffVirtual;
-                        args.nDstYOff2 =
-                            nDstYOff + nDestYOffVirtual + nDstYCount;
-                        args.pszResampling = pszResampling;
-                        args.bHasNoData = false;
-                        args.dfNoDataValue = 0.0;
-                        args.poColorTable = nullptr;
-                        args.bPropagateNoData = bPropagateNoData;
-
-                        eErr =
-                            pfnResampleFunc(args,
-                                            reinterpret_cast<GByte *>(pChunk) +
-                                                i * nChunkBandOffset,
-                                            &pDstBuffer, &eDstBufferDataType);
-                        if (eErr == CE_None)
+                        // Hand the buffers over to the job, and allocate new
+                        // ones for the next chunk.
+                        void *pJobChunk = pChunk;
+                        GByte *pabyJobNoDataMask = pabyChunkNoDataMask;
+                        if (!poJobQueue->SubmitJob(
+                                [&ResampleBands, args, pJobChunk,
+                                 pabyJobNoDataMask, &bJobFailed]()
+                                {
+                                    if (ResampleBands(args, pJobChunk) !=
+                                        CE_None)
+                                    {
+                                        bJobFailed = true;
+                                    }
+                                    CPLFree(pJobChunk);
+                                    CPLFree(pabyJobNoDataMask);
+                                }))
+                        {
+                            CPLFree(pJobChunk);
+                            CPLFree(pabyJobNoDataMask);
+                            eErr = CE_Failure;
+                        }
+                        pChunk = VSI_MALLOC3_VERBOSE(
+                            nChunkPixelSize, nFullResXSizeQueried,
+                            nFullResYSizeQueried);
+                        pabyChunkNoDataMask =
+                            bUseNoDataMask
+                                ? static_cast<GByte *>(VSI_MALLOC2_VERBOSE(
+                                      nFullResXSizeQueried,
+                                      nFullResYSizeQueried))
+                                : nullptr;
+                        if (pChunk == nullptr ||
+                            (bUseNoDataMask && pabyChunkNoDataMask == nullptr))
                         {
-                            eErr = poMEMBand->RasterIO(
-                                GF_Write, nDstXOff + nDestXOffVirtual,
-                                nDstYOff + nDestYOffVirtual, nDstXCount,
-                                nDstYCount, pDstBuffer, nDstXCount, nDstYCount,
-                                eDstBufferDataType, 0, 0, nullptr);
+                            eErr = CE_Failure;
                         }
-                        CPLFree(pDstBuffer);
+                        poJobQueue->WaitCompletion(nMaxPendingJobs);
+                        if (bJobFailed)
+                            eErr = CE_Failure;
+                    }
+                    else
+                    {
+                        eErr = ResampleBands(args, pChunk);
                     }
                 }
 
@@ -2004,6 +2177,13 @@ CPLErr GDALDataset::RasterIOResampled(
             }
         }
 
+        if (poJobQueue)
+        {
+            poJobQueue->WaitCompletion();
+            if (bJobFailed)
+                eErr = CE_Failure;
+        }
+
         CPLFree(pChunk);
         CPLFree(pabyChunkNoDataMask);
     }
@@ -31,12 +31,14 @@
 #include <map>
 #include <vector>
 #include <set>
+#include <string>
+#include <unordered_set>
 
 #if defined(_WIN32) && !defined(strcasecmp)
 #define strcasecmp stricmp
 #endif
 
-// Used for swq_summary.oSetDistinctValues and oVectorDistinctValues
+// Used for swq_summary.oHashDistinctValues and oVectorDistinctValues
 #define SZ_OGR_NULL "__OGR_NULL__"
 
 typedef enum
@@ -366,7 +368,7 @@ class CPL_UNSTABLE_API swq_summary
         {
         }
 
-        bool operator()(const CPLString &, const CPLString &) const;
+        bool operator()(const std::string &, const std::string &) const;
     };
 
     //! Return the sum, using Kahan-Babuska-Neumaier algorithm.
@@ -378,8 +380,13 @@ class CPL_UNSTABLE_API swq_summary
 
     GIntBig count = 0;
 
+    // Distinct values in their original order. With ORDER BY, they are
+    // sorted with oDistinctComparator once all features have been read.
     std::vector<CPLString> oVectorDistinctValues{};
-    std::set<CPLString, Comparator> oSetDistinctValues{};
+    // Keys of the distinct values, such that values that compare equal
+    // with oDistinctComparator have the same key.
+    std::unordered_set<std::string> oHashDistinctValues{};
+    Comparator oDistinctComparator{};
     bool sum_only_finite_terms = true;
     // Sum accumulator. To get the accurate sum, use the sum() method
     double sum_acc = 0.0;
@@ -808,6 +808,300 @@ bool OGRWKBIntersectsPessimistic(const GByte *pabyWkb, size_t nWKBSize,
     return bRet;
 }
 
+/************************************************************************/
+/*                   OGRWKBSegmentIntersectsEnvelope()                  */
+/************************************************************************/
+
+static inline bool OGRWKBPointInEnvelope(double dfX, double dfY,
+                                         const OGREnvelope &sEnvelope)
+{
+    return dfX >= sEnvelope.MinX && dfY >= sEnvelope.MinY &&
+           dfX <= sEnvelope.MaxX && dfY <= sEnvelope.MaxY;
+}
+
+// Liang-Barsky clipping of segment [(dfX0,dfY0),(dfX1,dfY1)] against the
+// (closed) envelope.
+static bool OGRWKBSegmentIntersectsEnvelope(double dfX0, double dfY0,
+                                            double dfX1, double dfY1,
+                                            const OGREnvelope &sEnvelope)
+{
+    if (OGRWKBPointInEnvelope(dfX0, dfY0, sEnvelope) ||
+        OGRWKBPointInEnvelope(dfX1, dfY1, sEnvelope))
+    {
+        return true;
+    }
+    if (std::max(dfX0, dfX1) < sEnvelope.MinX ||
+        std::min(dfX0, dfX1) > sEnvelope.MaxX ||
+        std::max(dfY0, dfY1) < sEnvelope.MinY ||
+        std::min(dfY0, dfY1) > sEnvelope.MaxY)
+    {
+        return false;
+    }
+
+    const double dfDX = dfX1 - dfX0;
+    const double dfDY = dfY1 - dfY0;
+    const double adfP[] = {-dfDX, dfDX, -dfDY, dfDY};
+    const double adfQ[] = {dfX0 - sEnvelope.MinX, sEnvelope.MaxX - dfX0,
+                           dfY0 - sEnvelope.MinY, sEnvelope.MaxY - dfY0};
+    double dfT0 = 0;
+    double dfT1 = 1;
+    for (int k = 0; k < 4; ++k)
+    {
+        if (adfP[k] == 0)
+        {
+            if (adfQ[k] < 0)
+                return false;
+        }
+        else
+        {
+            const double dfR = adfQ[k] / adfP[k];
+            if (adfP[k] < 0)
+            {
+                if (dfR > dfT1)
+                    return false;
+                dfT0 = std::max(dfT0, dfR);
+            }
+            else
+            {
+                if (dfR < dfT0)
+                    return false;
+                dfT1 = std::min(dfT1, dfR);
+            }
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                OGRWKBIntersectsPointSequenceEnvelope()               */
+/************************************************************************/
+
+/* Returns whether one of the segments of the point sequence intersects
+ * the envelope. If pbCornerInside is not null, it is toggled each time a
+ * ray cast from the (MinX,MinY) corner of the envelope towards +X crosses
+ * a segment (point-in-polygon test with the even-odd rule).
+ */
+static bool OGRWKBIntersectsPointSequenceEnvelope(
+    const uint8_t *data, const size_t size, const OGRwkbByteOrder eByteOrder,
+    const int nDim, size_t &iOffsetInOut, const OGREnvelope &sEnvelope,
+    bool *pbCornerInside, bool &bErrorOut)
+{
+    const uint32_t nPoints =
+        OGRWKBReadUInt32AtOffset(data, eByteOrder, iOffsetInOut);
+    if (nPoints > (size - iOffsetInOut) / (nDim * sizeof(double)))
+    {
+        bErrorOut = true;
+        return false;
+    }
+
+    const auto ReadXY = [data, eByteOrder, nDim, &iOffsetInOut](double &dfX,
+                                                                double &dfY)
+    {
+        memcpy(&dfX, data + iOffsetInOut, sizeof(double));
+        memcpy(&dfY, data + iOffsetInOut + sizeof(double), sizeof(double));
+        iOffsetInOut += nDim * sizeof(double);
+        if (OGR_SWAP(eByteOrder))
+        {
+            CPL_SWAP64PTR(&dfX);
+            CPL_SWAP64PTR(&dfY);
+        }
+    };
+
+    if (nPoints == 0)
+        return false;
+
+    double dfXPrev = 0;
+    double dfYPrev = 0;
+    ReadXY(dfXPrev, dfYPrev);
+    if (nPoints == 1)
+        return OGRWKBPointInEnvelope(dfXPrev, dfYPrev, sEnvelope);
+
+    const double dfCornerX = sEnvelope.MinX;
+    const double dfCornerY = sEnvelope.MinY;
+    for (uint32_t j = 1; j < nPoints; j++)
+    {
+        double dfX = 0;
+        double dfY = 0;
+        ReadXY(dfX, dfY);
+        if (OGRWKBSegmentIntersectsEnvelope(dfXPrev, dfYPrev, dfX, dfY,
+                                            sEnvelope))
+        {
+            return true;
+        }
+        if (pbCornerInside && ((dfYPrev > dfCornerY) != (dfY > dfCornerY)))
+        {
+            const double dfXCross = dfXPrev + (dfX - dfXPrev) *
+                                                  (dfCornerY - dfYPrev) /
+                                                  (dfY - dfYPrev);
+            if (dfCornerX < dfXCross)
+                *pbCornerInside = !*pbCornerInside;
+        }
+        dfXPrev = dfX;
+        dfYPrev = dfY;
+    }
+
+    return false;
+}
+
+/************************************************************************/
+/*                     OGRWKBIntersectsEnvelope()                       */
+/************************************************************************/
+
+static bool OGRWKBIntersectsEnvelope(const GByte *data, const size_t size,
+                                     size_t &iOffsetInOut,
+                                     const OGREnvelope &sEnvelope,
+                                     const int nRec, bool &bErrorOut)
+{
+    if (size - iOffsetInOut < MIN_WKB_SIZE)
+    {
+        bErrorOut = true;
+        return false;
+    }
+    const int nByteOrder = DB2_V72_FIX_BYTE_ORDER(data[iOffsetInOut]);
+    if (!(nByteOrder == wkbXDR || nByteOrder == wkbNDR))
+    {
+        bErrorOut = true;
+        return false;
+    }
+    const OGRwkbByteOrder eByteOrder = static_cast<OGRwkbByteOrder>(nByteOrder);
+
+    OGRwkbGeometryType eGeometryType = wkbUnknown;
+    OGRReadWKBGeometryType(data + iOffsetInOut, wkbVariantIso, &eGeometryType);
+    iOffsetInOut += 5;
+    const auto eFlatType = wkbFlatten(eGeometryType);
+    const int nDim = 2 + (OGR_GT_HasZ(eGeometryType) ? 1 : 0) +
+                     (OGR_GT_HasM(eGeometryType) ? 1 : 0);
+
+    if (eFlatType == wkbPoint)
+    {
+        if (size - iOffsetInOut < nDim * sizeof(double))
+        {
+            bErrorOut = true;
+            return false;
+        }
+        double dfX = 0;
+        double dfY = 0;
+        memcpy(&dfX, data + iOffsetInOut, sizeof(double));
+        memcpy(&dfY, data + iOffsetInOut + sizeof(double), sizeof(double));
+        iOffsetInOut += nDim * sizeof(double);
+        if (OGR_SWAP(eByteOrder))
+        {
+            CPL_SWAP64PTR(&dfX);
+            CPL_SWAP64PTR(&dfY);
+        }
+        // POINT EMPTY has NaN coordinates, which fail the comparisons
+        return OGRWKBPointInEnvelope(dfX, dfY, sEnvelope);
+    }
+
+    if (eFlatType == wkbLineString)
+    {
+        return OGRWKBIntersectsPointSequenceEnvelope(
+            data, size, eByteOrder, nDim, iOffsetInOut, sEnvelope, nullptr,
+            bErrorOut);
+    }
+
+    if (eFlatType == wkbPolygon || eFlatType == wkbTriangle)
+    {
+        const uint32_t nRings =
+            OGRWKBReadUInt32AtOffset(data, eByteOrder, iOffsetInOut);
+        if (nRings > (size - iOffsetInOut) / sizeof(uint32_t))
+        {
+            bErrorOut = true;
+            return false;
+        }
+        // If no ring edge intersects the envelope, then either the envelope
+        // is fully inside the polygon, or fully outside of it. Which is
+        // determined by testing if one of its corner is inside the polygon.
+        bool bCornerInside = false;
+        for (uint32_t i = 0; i < nRings; ++i)
+        {
+            if (iOffsetInOut + sizeof(uint32_t) > size)
+            {
+                bErrorOut = true;
+                return false;
+            }
+            if (OGRWKBIntersectsPointSequenceEnvelope(
+                    data, size, eByteOrder, nDim, iOffsetInOut, sEnvelope,
+                    &bCornerInside, bErrorOut))
+            {
+                return true;
+            }
+            if (bErrorOut)
+                return false;
+        }
+        return bCornerInside;
+    }
+
+    if (eFlatType == wkbMultiPoint || eFlatType == wkbMultiLineString ||
+        eFlatType == wkbMultiPolygon || eFlatType == wkbGeometryCollection ||
+        eFlatType == wkbPolyhedralSurface || eFlatType == wkbTIN)
+    {
+        if (nRec == 128)
+        {
+            bErrorOut = true;
+            return false;
+        }
+        const uint32_t nParts =
+            OGRWKBReadUInt32AtOffset(data, eByteOrder, iOffsetInOut);
+        if (nParts > (size - iOffsetInOut) / MIN_WKB_SIZE)
+        {
+            bErrorOut = true;
+            return false;
+        }
+        for (uint32_t k = 0; k < nParts; k++)
+        {
+            // Note: once an intersecting part has been found, iOffsetInOut
+            // is no longer meaningful, but nothing more needs to be read.
+            if (OGRWKBIntersectsEnvelope(data, size, iOffsetInOut, sEnvelope,
+                                         nRec + 1, bErrorOut))
+            {
+                return true;
+            }
+            else if (bErrorOut)
+            {
+                return false;
+            }
+        }
+        return false;
+    }
+
+    // Curve geometries are not handled
+    bErrorOut = true;
+    return false;
+}
+
+/************************************************************************/
+/*                     OGRWKBIntersectsEnvelope()                       */
+/************************************************************************/
+
+/** Computes whether the geometry (pabyWkb, nWKBSize) intersects the passed
+ * envelope, with an exact test (contrary to OGRWKBIntersectsPessimistic()),
+ * without instantiating an OGRGeometry.
+ *
+ * The envelope is considered as a closed rectangle, so a geometry touching
+ * its boundary intersects it.
+ *
+ * Non-linear geometries (circular strings, compound curves, curve polygons,
+ * multi curves and multi surfaces) are not handled.
+ *
+ * @param pabyWkb WKB geometry.
+ * @param nWKBSize Size of pabyWkb in bytes.
+ * @param sEnvelope Rectangle to test against.
+ * @param[out] bIntersects Set to the result of the test, when the function
+ *                         returns true.
+ * @return true if the test could be done, false if the geometry is of an
+ * unhandled type or is corrupted (the caller must then use another method).
+ */
+bool OGRWKBIntersectsEnvelope(const GByte *pabyWkb, size_t nWKBSize,
+                              const OGREnvelope &sEnvelope, bool &bIntersects)
+{
+    size_t iOffsetInOut = 0;
+    bool bErrorOut = false;
+    bIntersects = OGRWKBIntersectsEnvelope(pabyWkb, nWKBSize, iOffsetInOut,
+                                           sEnvelope, 0, bErrorOut);
+    return !bErrorOut;
+}
+
 /************************************************************************/
 /*                            epsilonEqual()                            */
 /************************************************************************/
@@ -36,6 +36,10 @@ bool CPL_DLL OGRWKBGetBoundingBox(const GByte *pabyWkb, size_t nWKBSize,
 bool CPL_DLL OGRWKBIntersectsPessimistic(const GByte *pabyWkb, size_t nWKBSize,
                                          const OGREnvelope &sEnvelope);
 
+bool CPL_DLL OGRWKBIntersectsEnvelope(const GByte *pabyWkb, size_t nWKBSize,
+                                      const OGREnvelope &sEnvelope,
+                                      bool &bIntersects);
+
 void CPL_DLL OGRWKBFixupCounterClockWiseExternalRing(GByte *pabyWkb,
                                                      size_t nWKBSize);
 
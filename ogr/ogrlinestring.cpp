@@ -23,6 +23,16 @@
 #include <limits>
 #include <new>
 
+#ifdef USE_NEON_OPTIMIZATIONS
+#define USE_SSE2
+#elif defined(__x86_64) || defined(_M_X64)
+#define USE_SSE2
+#endif
+
+#ifdef USE_SSE2
+#include "gdalsse_priv.h"
+#endif
+
 namespace
 {
 
@@ -37,6 +47,197 @@ int DoubleToIntClamp(double dfValue)
     return static_cast<int>(dfValue);
 }
 
+/************************************************************************/
+/*                         GetEnvelopeXY()                              */
+/************************************************************************/
+
+// paoPoints is interleaved X,Y, so a 4-double register holds 2 points:
+// lanes 0 and 2 are X values, lanes 1 and 3 are Y values.
+
+void GetEnvelopeXY(const OGRRawPoint *paoPoints, int nPointCount,
+                   OGREnvelope *psEnvelope)
+{
+    double dfMinX = paoPoints[0].x;
+    double dfMaxX = paoPoints[0].x;
+    double dfMinY = paoPoints[0].y;
+    double dfMaxY = paoPoints[0].y;
+    int iPoint = 1;
+
+#ifdef USE_SSE2
+    if (nPointCount >= 3)
+    {
+        const double *padf = reinterpret_cast<const double *>(paoPoints);
+        const double adfFirst[] = {dfMinX, dfMinY, dfMinX, dfMinY};
+        XMMReg4Double oMin = XMMReg4Double::Load4Val(adfFirst);
+        XMMReg4Double oMax = oMin;
+        for (; iPoint + 1 < nPointCount; iPoint += 2)
+        {
+            const auto oVal = XMMReg4Double::Load4Val(padf + 2 * iPoint);
+            // Put the new value first so that a NaN one is ignored, as in
+            // the scalar code path.
+            oMin = XMMReg4Double::Min(oVal, oMin);
+            oMax = XMMReg4Double::Max(oVal, oMax);
+        }
+        double adfMin[4];
+        double adfMax[4];
+        oMin.Store4Val(adfMin);
+        oMax.Store4Val(adfMax);
+        dfMinX = std::min(adfMin[0], adfMin[2]);
+        dfMinY = std::min(adfMin[1], adfMin[3]);
+        dfMaxX = std::max(adfMax[0], adfMax[2]);
+        dfMaxY = std::max(adfMax[1], adfMax[3]);
+    }
+#endif
+
+    for (; iPoint < nPointCount; iPoint++)
+    {
+        if (dfMaxX < paoPoints[iPoint].x)
+            dfMaxX = paoPoints[iPoint].x;
+        if (dfMaxY < paoPoints[iPoint].y)
+            dfMaxY = paoPoints[iPoint].y;
+        if (dfMinX > paoPoints[iPoint].x)
+            dfMinX = paoPoints[iPoint].x;
+        if (dfMinY > paoPoints[iPoint].y)
+            dfMinY = paoPoints[iPoint].y;
+    }
+
+    psEnvelope->MinX = dfMinX;
+    psEnvelope->MaxX = dfMaxX;
+    psEnvelope->MinY = dfMinY;
+    psEnvelope->MaxY = dfMaxY;
+}
+
+/************************************************************************/
+/*                          GetLengthXY()                               */
+/************************************************************************/
+
+double GetLengthXY(const OGRRawPoint *paoPoints, int nPointCount)
+{
+    double dfLength = 0.0;
+    int i = 0;
+
+#ifdef USE_SSE2
+    if (nPointCount >= 3)
+    {
+        // Process 2 segments at a time: [P(i), P(i+1)] and [P(i+1), P(i+2)]
+        const double *padf = reinterpret_cast<const double *>(paoPoints);
+        XMMReg4Double oSum = XMMReg4Double::Zero();
+        for (; i + 2 < nPointCount; i += 2)
+        {
+            const auto oStart = XMMReg4Double::Load4Val(padf + 2 * i);
+            const auto oEnd = XMMReg4Double::Load4Val(padf + 2 * i + 2);
+            const auto oDelta = oEnd - oStart;
+            const auto oDeltaSq = oDelta * oDelta;
+            // Each segment length ends up in both of its lanes
+            oSum += (oDeltaSq + oDeltaSq.swap_adjacent()).sqrt();
+        }
+        double adfSum[4];
+        oSum.Store4Val(adfSum);
+        dfLength = adfSum[0] + adfSum[2];
+    }
+#endif
+
+    for (; i < nPointCount - 1; i++)
+    {
+        const double dfDeltaX = paoPoints[i + 1].x - paoPoints[i].x;
+        const double dfDeltaY = paoPoints[i + 1].y - paoPoints[i].y;
+        dfLength += sqrt(dfDeltaX * dfDeltaX + dfDeltaY * dfDeltaY);
+    }
+
+    return dfLength;
+}
+
+/************************************************************************/
+/*                     GetDoubleSignedAreaXY()                          */
+/************************************************************************/
+
+// Returns twice the signed area (positive for counter-clockwise rings) of
+// the ring, implicitly closed. Coordinates are taken relative to the first
+// point to limit the loss of precision of the cross products.
+
+double GetDoubleSignedAreaXY(const OGRRawPoint *paoPoints, int nPointCount)
+{
+    const double dfX0 = paoPoints[0].x;
+    const double dfY0 = paoPoints[0].y;
+    double dfSum = 0.0;
+    int i = 0;
+
+#ifdef USE_SSE2
+    if (nPointCount >= 3)
+    {
+        const double *padf = reinterpret_cast<const double *>(paoPoints);
+        const double adfOrigin[] = {dfX0, dfY0, dfX0, dfY0};
+        const auto oOrigin = XMMReg4Double::Load4Val(adfOrigin);
+        XMMReg4Double oSum = XMMReg4Double::Zero();
+        for (; i + 2 < nPointCount; i += 2)
+        {
+            const auto oCur = XMMReg4Double::Load4Val(padf + 2 * i) - oOrigin;
+            const auto oNext =
+                XMMReg4Double::Load4Val(padf + 2 * i + 2) - oOrigin;
+            // (x(i) * y(i+1), y(i) * x(i+1)) for 2 consecutive edges
+            oSum += oCur * oNext.swap_adjacent();
+        }
+        double adfSum[4];
+        oSum.Store4Val(adfSum);
+        dfSum = (adfSum[0] - adfSum[1]) + (adfSum[2] - adfSum[3]);
+    }
+#endif
+
+    for (; i < nPointCount - 1; i++)
+    {
+        dfSum += (paoPoints[i].x - dfX0) * (paoPoints[i + 1].y - dfY0) -
+                 (paoPoints[i].y - dfY0) * (paoPoints[i + 1].x - dfX0);
+    }
+
+    return dfSum;
+}
+
+/************************************************************************/
+/*                       GetSegmentLengthsXY()                          */
+/************************************************************************/
+
+// Computes in padfOut[i] the length (or squared length if bSquared) of the
+// segment [P(i), P(i+1)], for i in [0, nSegments).
+
+// Number of segments processed at once by callers of GetSegmentLengthsXY()
+constexpr int SEGMENT_CHUNK_SIZE = 256;
+
+template <bool bSquared>
+void GetSegmentLengthsXY(const OGRRawPoint *paoPoints, int nSegments,
+                         double *padfOut)
+{
+    int i = 0;
+
+#ifdef USE_SSE2
+    // Process 2 segments at a time: [P(i), P(i+1)] and [P(i+1), P(i+2)]
+    const double *padf = reinterpret_cast<const double *>(paoPoints);
+    for (; i + 2 <= nSegments; i += 2)
+    {
+        const auto oStart = XMMReg4Double::Load4Val(padf + 2 * i);
+        const auto oEnd = XMMReg4Double::Load4Val(padf + 2 * i + 2);
+        const auto oDelta = oEnd - oStart;
+        const auto oDeltaSq = oDelta * oDelta;
+        // Lanes 0 and 2 are dx*dx + dy*dy, evaluated in the same order as
+        // the scalar code below
+        auto oLength = oDeltaSq + oDeltaSq.swap_adjacent();
+        if constexpr (!bSquared)
+            oLength = oLength.sqrt();
+        double adfLength[4];
+        oLength.Store4Val(adfLength);
+        padfOut[i] = adfLength[0];
+        padfOut[i + 1] = adfLength[2];
+    }
+#endif
+
+    for (; i < nSegments; i++)
+    {
+        const double dfDeltaX = paoPoints[i + 1].x - paoPoints[i].x;
+        const double dfDeltaY = paoPoints[i + 1].y - paoPoints[i].y;
+        const double dfSquareLength = dfDeltaX * dfDeltaX + dfDeltaY * dfDeltaY;
+        padfOut[i] = bSquared ? dfSquareLength : sqrt(dfSquareLength);
+    }
+}
+
 }  // namespace
 
 /************************************************************************/
@@ -2077,17 +2278,7 @@ std::string OGRSimpleCurve::exportToWkt(const OGRWktOptions &opts,
 double OGRSimpleCurve::get_Length() const
 
 {
-    double dfLength = 0.0;
-
-    for (int i = 0; i < nPointCount - 1; i++)
-    {
-
-        const double dfDeltaX = paoPoints[i + 1].x - paoPoints[i].x;
-        const double dfDeltaY = paoPoints[i + 1].y - paoPoints[i].y;
-        dfLength += sqrt(dfDeltaX * dfDeltaX + dfDeltaY * dfDeltaY);
-    }
-
-    return dfLength;
+    return GetLengthXY(paoPoints, nPointCount);
 }
 
 /************************************************************************/
@@ -2126,13 +2317,19 @@ void OGRSimpleCurve::Value(double dfDistance, OGRPoint *poPoint) const
     }
 
     double dfLength = 0.0;
+    double adfSegLength[SEGMENT_CHUNK_SIZE];
 
     for (int i = 0; i < nPointCount - 1; i++)
     {
-        const double dfDeltaX = paoPoints[i + 1].x - paoPoints[i].x;
-        const double dfDeltaY = paoPoints[i + 1].y - paoPoints[i].y;
-        const double dfSegLength =
-            sqrt(dfDeltaX * dfDeltaX + dfDeltaY * dfDeltaY);
+        const int iInChunk = i % SEGMENT_CHUNK_SIZE;
+        if (iInChunk == 0)
+        {
+            GetSegmentLengthsXY<false>(
+                paoPoints + i,
+                std::min(SEGMENT_CHUNK_SIZE, nPointCount - 1 - i),
+                adfSegLength);
+        }
+        const double dfSegLength = adfSegLength[iInChunk];
 
         if (dfSegLength > 0)
         {
@@ -2433,27 +2630,7 @@ void OGRSimpleCurve::getEnvelope(OGREnvelope *psEnvelope) const
         return;
     }
 
-    double dfMinX = paoPoints[0].x;
-    double dfMaxX = paoPoints[0].x;
-    double dfMinY = paoPoints[0].y;
-    double dfMaxY = paoPoints[0].y;
-
-    for (int iPoint = 1; iPoint < nPointCount; iPoint++)
-    {
-        if (dfMaxX < paoPoints[iPoint].x)
-            dfMaxX = paoPoints[iPoint].x;
-        if (dfMaxY < paoPoints[iPoint].y)
-            dfMaxY = paoPoints[iPoint].y;
-        if (dfMinX > paoPoints[iPoint].x)
-            dfMinX = paoPoints[iPoint].x;
-        if (dfMinY > paoPoints[iPoint].y)
-            dfMinY = paoPoints[iPoint].y;
-    }
-
-    psEnvelope->MinX = dfMinX;
-    psEnvelope->MaxX = dfMaxX;
-    psEnvelope->MinY = dfMinY;
-    psEnvelope->MaxY = dfMaxY;
+    GetEnvelopeXY(paoPoints, nPointCount, psEnvelope);
 }
 
 /************************************************************************/
@@ -2674,6 +2851,7 @@ bool OGRSimpleCurve::segmentize(double dfMaxLength)
     // First pass to compute new number of points
     constexpr double REL_EPSILON_LENGTH_SQUARE = 1e-5;
     constexpr double REL_EPSILON_ROUND = 1e-2;
+    double adfSquareDist[SEGMENT_CHUNK_SIZE];
     for (int i = 0; i < nPointCount; i++)
     {
         nNewPointCount++;
@@ -2682,9 +2860,15 @@ bool OGRSimpleCurve::segmentize(double dfMaxLength)
             break;
 
         // Must be kept in sync with the second pass loop
-        const double dfX = paoPoints[i + 1].x - paoPoints[i].x;
-        const double dfY = paoPoints[i + 1].y - paoPoints[i].y;
-        const double dfSquareDist = dfX * dfX + dfY * dfY;
+        const int iInChunk = i % SEGMENT_CHUNK_SIZE;
+        if (iInChunk == 0)
+        {
+            GetSegmentLengthsXY<true>(
+                paoPoints + i,
+                std::min(SEGMENT_CHUNK_SIZE, nPointCount - 1 - i),
+                adfSquareDist);
+        }
+        const double dfSquareDist = adfSquareDist[iInChunk];
         if (dfSquareDist - dfSquareMaxLength >
             REL_EPSILON_LENGTH_SQUARE * dfSquareMaxLength)
         {
@@ -2764,11 +2948,18 @@ bool OGRSimpleCurve::segmentize(double dfMaxLength)
         if (i == nPointCount - 1)
             break;
 
-        const double dfX = paoPoints[i + 1].x - paoPoints[i].x;
-        const double dfY = paoPoints[i + 1].y - paoPoints[i].y;
-        const double dfSquareDist = dfX * dfX + dfY * dfY;
-
-        // Must be kept in sync with the initial pass loop
+        // Must be kept in sync with the initial pass loop: the squared
+        // distance is computed by the same kernel so that both passes
+        // agree on the number of intermediate points.
+        const int iInChunk = i % SEGMENT_CHUNK_SIZE;
+        if (iInChunk == 0)
+        {
+            GetSegmentLengthsXY<true>(
+                paoPoints + i,
+                std::min(SEGMENT_CHUNK_SIZE, nPointCount - 1 - i),
+                adfSquareDist);
+        }
+        const double dfSquareDist = adfSquareDist[iInChunk];
         if (dfSquareDist - dfSquareMaxLength >
             REL_EPSILON_LENGTH_SQUARE * dfSquareMaxLength)
         {
@@ -2776,6 +2967,8 @@ bool OGRSimpleCurve::segmentize(double dfMaxLength)
                 sqrt(dfSquareDist / dfSquareMaxLength) - REL_EPSILON_ROUND);
             const int nIntermediatePoints =
                 DoubleToIntClamp(dfIntermediatePoints);
+            const double dfX = paoPoints[i + 1].x - paoPoints[i].x;
+            const double dfY = paoPoints[i + 1].y - paoPoints[i].y;
             const double dfRatioX =
                 dfX / (static_cast<double>(nIntermediatePoints) + 1);
             const double dfRatioY =
@@ -2827,7 +3020,16 @@ bool OGRSimpleCurve::segmentize(double dfMaxLength)
 
 void OGRSimpleCurve::swapXY()
 {
-    for (int i = 0; i < nPointCount; i++)
+    int i = 0;
+#ifdef USE_SSE2
+    double *padf = reinterpret_cast<double *>(paoPoints);
+    for (; i + 1 < nPointCount; i += 2)
+    {
+        const auto oXYXY = XMMReg4Double::Load4Val(padf + 2 * i);
+        oXYXY.swap_adjacent().Store4Val(padf + 2 * i);
+    }
+#endif
+    for (; i < nPointCount; i++)
     {
         std::swap(paoPoints[i].x, paoPoints[i].y);
     }
@@ -2978,10 +3180,11 @@ OGRLineString *OGRLineString::CurveToLine(
 /**
  * \brief Compute area of ring / closed linestring.
  *
- * The area is computed according to Green's Theorem:
+ * The area is computed according to Green's Theorem (shoelace formula):
  *
- * Area is "Sum(x(i)*(y(i+1) - y(i-1)))/2" for i = 0 to pointCount-1,
- * assuming the last point is a duplicate of the first.
+ * Area is "Sum(x(i)*y(i+1) - x(i+1)*y(i))/2" for i = 0 to pointCount-2,
+ * assuming the last point is a duplicate of the first, and with coordinates
+ * taken relative to the first point.
  *
  * @return computed area.
  */
@@ -2997,18 +3200,7 @@ double OGRSimpleCurve::get_LinearArea() const
         return 0;
     }
 
-    double dfAreaSum =
-        paoPoints[0].x * (paoPoints[1].y - paoPoints[nPointCount - 1].y);
-
-    for (int i = 1; i < nPointCount - 1; i++)
-    {
-        dfAreaSum += paoPoints[i].x * (paoPoints[i + 1].y - paoPoints[i - 1].y);
-    }
-
-    dfAreaSum += paoPoints[nPointCount - 1].x *
-                 (paoPoints[0].y - paoPoints[nPointCount - 2].y);
-
-    return 0.5 * fabs(dfAreaSum);
+    return 0.5 * fabs(GetDoubleSignedAreaXY(paoPoints, nPointCount));
 }
 
 /************************************************************************/
@@ -3369,18 +3561,7 @@ int OGRLineString::isClockwise() const
     // Try with Green Formula as a fallback, but this is not a guarantee
     // as we'll probably be affected by numerical instabilities.
 
-    double dfSum =
-        paoPoints[0].x * (paoPoints[1].y - paoPoints[nPointCount - 1].y);
-
-    for (int i = 1; i < nPointCount - 1; i++)
-    {
-        dfSum += paoPoints[i].x * (paoPoints[i + 1].y - paoPoints[i - 1].y);
-    }
-
-    dfSum += paoPoints[nPointCount - 1].x *
-             (paoPoints[0].y - paoPoints[nPointCount - 2].y);
-
-    return dfSum < 0;
+    return GetDoubleSignedAreaXY(paoPoints, nPointCount) < 0;
 }
 
 //! @endcond
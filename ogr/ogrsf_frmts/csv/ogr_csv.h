@@ -16,6 +16,9 @@
 
 #include "ogrsf_frmts.h"
 
+#include <atomic>
+#include <deque>
+#include <memory>
 #include <set>
 
 typedef enum
@@ -82,6 +85,12 @@ class OGRCSVLayer final : public IOGRCSVLayer, public OGRLayer
     bool bHasFieldNames = false;
 
     OGRFeature *GetNextUnfilteredFeature();
+    OGRFeature *TranslateFeature(char **papszTokens, int64_t nFID);
+
+    // Multi-threaded reading
+    int m_nNumThreads = 1;
+    std::deque<std::unique_ptr<OGRFeature>> m_apoPendingFeatures{};
+    bool ReadAheadFeaturesParallel();
 
     bool bNew = false;
     bool bInWriteMode = false;
@@ -122,7 +131,7 @@ class OGRCSVLayer final : public IOGRCSVLayer, public OGRLayer
 
     char **AutodetectFieldTypes(CSLConstList papszOpenOptions, int nFieldCount);
 
-    bool bWarningBadTypeOrWidth = false;
+    std::atomic<bool> bWarningBadTypeOrWidth{false};
     bool bKeepSourceColumns = false;
     bool bKeepGeomColumns = true;
 
@@ -426,6 +426,9 @@ void RegisterOGRCSV()
         "  <Option name='EMPTY_STRING_AS_NULL' type='boolean' "
         "description='Whether to consider empty strings as null fields on "
         "reading' default='NO'/>"
+        "  <Option name='NUM_THREADS' type='string' description='Number of "
+        "worker threads used to build features when reading. Integer or "
+        "ALL_CPUS' default='1'/>"
         "  <Option name='MAX_LINE_SIZE' type='int' description='Maximum number "
         "of bytes for a line (-1=unlimited)' default='" STRINGIFY(
             OGR_CSV_DEFAULT_MAX_LINE_SIZE) "'/>"
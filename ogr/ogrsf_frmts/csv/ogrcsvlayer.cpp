@@ -29,6 +29,7 @@
 #include "cpl_conv.h"
 #include "cpl_csv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "cpl_vsi_virtual.h"
@@ -39,6 +40,7 @@
 #include "ogr_p.h"
 #include "ogr_spatialref.h"
 #include "ogrsf_frmts.h"
+#include "gdal_thread_pool.h"
 
 #define DIGIT_ZERO '0'
 
@@ -133,6 +135,14 @@ void OGRCSVLayer::BuildFeatureDefn(const char *pszNfdcGeomField,
     bEmptyStringNull =
         CPLFetchBool(papszOpenOptions, "EMPTY_STRING_AS_NULL", false);
 
+    const char *pszNumThreads =
+        CSLFetchNameValueDef(papszOpenOptions, "NUM_THREADS",
+                             CPLGetConfigOption("GDAL_NUM_THREADS", "1"));
+    m_nNumThreads =
+        std::max(1, std::min(128, EQUAL(pszNumThreads, "ALL_CPUS")
+                                      ? CPLGetNumCPUs()
+                                      : atoi(pszNumThreads)));
+
     // If this is not a new file, read ahead to establish if it is
     // already in CRLF (DOS) mode, or just a normal unix CR mode.
     if (!bNew && bInWriteMode)
@@ -1275,6 +1285,7 @@ void OGRCSVLayer::ResetReading()
     bNeedRewindBeforeRead = false;
 
     m_nNextFID = FID_INITIAL_VALUE;
+    m_apoPendingFeatures.clear();
 }
 
 /************************************************************************/
@@ -1310,7 +1321,23 @@ OGRFeature *OGRCSVLayer::GetFeature(GIntBig nFID)
 {
     if (nFID < FID_INITIAL_VALUE || fpCSV == nullptr)
         return nullptr;
-    if (nFID < m_nNextFID || bNeedRewindBeforeRead)
+    if (!m_apoPendingFeatures.empty() && !bNeedRewindBeforeRead)
+    {
+        // Features read ahead by ReadAheadFeaturesParallel() precede the
+        // current position in the file.
+        const int64_t nFirstPendingFID =
+            m_nNextFID - static_cast<int64_t>(m_apoPendingFeatures.size());
+        if (nFID >= nFirstPendingFID && nFID < m_nNextFID)
+        {
+            for (int64_t i = nFirstPendingFID; i < nFID; ++i)
+                m_apoPendingFeatures.pop_front();
+            return GetNextUnfilteredFeature();
+        }
+        if (nFID >= m_nNextFID)
+            m_apoPendingFeatures.clear();
+    }
+    if (nFID < m_nNextFID || bNeedRewindBeforeRead ||
+        !m_apoPendingFeatures.empty())
         ResetReading();
     while (m_nNextFID < nFID)
     {
@@ -1333,11 +1360,127 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
     if (fpCSV == nullptr)
         return nullptr;
 
+    if (m_nNumThreads > 1)
+    {
+        if (m_apoPendingFeatures.empty() && !ReadAheadFeaturesParallel())
+            return nullptr;
+        OGRFeature *poFeature = m_apoPendingFeatures.front().release();
+        m_apoPendingFeatures.pop_front();
+        m_nFeaturesRead++;
+        return poFeature;
+    }
+
     // Read the CSV record.
     char **papszTokens = GetNextLineTokens();
     if (papszTokens == nullptr)
         return nullptr;
 
+    OGRFeature *poFeature = TranslateFeature(papszTokens, m_nNextFID);
+
+    if ((m_nNextFID % 100000) == 0)
+    {
+        CPLDebug("CSV", "FID = %" PRId64 ", file offset = %" PRIu64, m_nNextFID,
+                 static_cast<uint64_t>(fpCSV->Tell()));
+    }
+
+    m_nNextFID++;
+    m_nFeaturesRead++;
+
+    return poFeature;
+}
+
+/************************************************************************/
+/*                     ReadAheadFeaturesParallel()                      */
+/************************************************************************/
+
+/** Reads the next batch of records and translates them into features on
+ * worker threads. Features are queued in m_apoPendingFeatures in file order.
+ *
+ * Records are still split into tokens on the calling thread, as determining
+ * record boundaries requires following the quoting state from the start of
+ * the file.
+ */
+bool OGRCSVLayer::ReadAheadFeaturesParallel()
+{
+    const int nBatchSize = 1000 * m_nNumThreads;
+    std::vector<char **> apapszTokens;
+    apapszTokens.reserve(nBatchSize);
+    const int64_t nFirstFID = m_nNextFID;
+    while (static_cast<int>(apapszTokens.size()) < nBatchSize)
+    {
+        char **papszTokens = GetNextLineTokens();
+        if (papszTokens == nullptr)
+            break;
+        apapszTokens.push_back(papszTokens);
+
+        if ((m_nNextFID % 100000) == 0)
+        {
+            CPLDebug("CSV", "FID = %" PRId64 ", file offset = %" PRIu64,
+                     m_nNextFID, static_cast<uint64_t>(fpCSV->Tell()));
+        }
+        m_nNextFID++;
+    }
+    if (apapszTokens.empty())
+        return false;
+
+    const size_t nRecords = apapszTokens.size();
+    std::vector<std::unique_ptr<OGRFeature>> apoFeatures(nRecords);
+
+    const auto TranslateRange = [this, &apapszTokens, &apoFeatures,
+                                 nFirstFID](size_t iStart, size_t iEnd)
+    {
+        for (size_t i = iStart; i < iEnd; ++i)
+        {
+            apoFeatures[i].reset(TranslateFeature(
+                apapszTokens[i], nFirstFID + static_cast<int64_t>(i)));
+        }
+    };
+
+    auto poThreadPool = GDALGetGlobalThreadPool(m_nNumThreads);
+    auto poQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (poQueue && nRecords > 1)
+    {
+        CPLErrorAccumulator oErrorAccumulator;
+        const size_t nJobs =
+            std::min(nRecords, static_cast<size_t>(m_nNumThreads));
+        const size_t nPerJob = (nRecords + nJobs - 1) / nJobs;
+        for (size_t iStart = 0; iStart < nRecords; iStart += nPerJob)
+        {
+            const size_t iEnd = std::min(nRecords, iStart + nPerJob);
+            poQueue->SubmitJob(
+                [&TranslateRange, &oErrorAccumulator, iStart, iEnd]()
+                {
+                    auto oAccumulator =
+                        oErrorAccumulator.InstallForCurrentScope();
+                    CPL_IGNORE_RET_VAL(oAccumulator);
+                    TranslateRange(iStart, iEnd);
+                });
+        }
+        poQueue->WaitCompletion();
+        oErrorAccumulator.ReplayErrors();
+    }
+    else
+    {
+        TranslateRange(0, nRecords);
+    }
+
+    for (auto &poFeature : apoFeatures)
+        m_apoPendingFeatures.push_back(std::move(poFeature));
+
+    return true;
+}
+
+/************************************************************************/
+/*                          TranslateFeature()                          */
+/************************************************************************/
+
+/** Builds a feature from the tokens of a record, and takes ownership of
+ * papszTokens.
+ *
+ * This may be called concurrently from several threads.
+ */
+OGRFeature *OGRCSVLayer::TranslateFeature(char **papszTokens, int64_t nFID)
+{
     // Create the OGR feature.
     OGRFeature *poFeature = new OGRFeature(poFeatureDefn);
 
@@ -1444,29 +1587,27 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
         const OGRFieldType eFieldType = poFieldDefn->GetType();
         const OGRFieldSubType eFieldSubType = poFieldDefn->GetSubType();
 
-        const auto WarnOnceBadValue = [this, poFieldDefn]()
+        const auto WarnOnceBadValue = [this, poFieldDefn, nFID]()
         {
-            if (!bWarningBadTypeOrWidth)
+            if (!bWarningBadTypeOrWidth.exchange(true))
             {
-                bWarningBadTypeOrWidth = true;
                 CPLError(CE_Warning, CPLE_AppDefined,
                          "Invalid value type found in record %" PRId64
                          " for field %s. "
                          "This warning will no longer be emitted",
-                         m_nNextFID, poFieldDefn->GetNameRef());
+                         nFID, poFieldDefn->GetNameRef());
             };
         };
 
-        const auto WarnTooLargeWidth = [this, poFieldDefn]()
+        const auto WarnTooLargeWidth = [this, poFieldDefn, nFID]()
         {
-            if (!bWarningBadTypeOrWidth)
+            if (!bWarningBadTypeOrWidth.exchange(true))
             {
-                bWarningBadTypeOrWidth = true;
                 CPLError(CE_Warning, CPLE_AppDefined,
                          "Value with a width greater than field width "
                          "found in record %" PRId64 " for field %s. "
                          "This warning will no longer be emitted",
-                         m_nNextFID, poFieldDefn->GetNameRef());
+                         nFID, poFieldDefn->GetNameRef());
             };
         };
 
@@ -1544,15 +1685,15 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
                             pszDot != nullptr
                                 ? static_cast<int>(strlen(pszDot + 1))
                                 : 0;
-                        if (nPrecision > poFieldDefn->GetPrecision())
+                        if (nPrecision > poFieldDefn->GetPrecision() &&
+                            !bWarningBadTypeOrWidth.exchange(true))
                         {
-                            bWarningBadTypeOrWidth = true;
                             CPLError(CE_Warning, CPLE_AppDefined,
                                      "Value with a precision greater than "
                                      "field precision found in record %" PRId64
                                      " for field %s. "
                                      "This warning will no longer be emitted",
-                                     m_nNextFID, poFieldDefn->GetNameRef());
+                                     nFID, poFieldDefn->GetNameRef());
                         }
                     }
                 }
@@ -1714,16 +1855,8 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
 
     CSLDestroy(papszTokens);
 
-    if ((m_nNextFID % 100000) == 0)
-    {
-        CPLDebug("CSV", "FID = %" PRId64 ", file offset = %" PRIu64, m_nNextFID,
-                 static_cast<uint64_t>(fpCSV->Tell()));
-    }
-
     // Translate the record id.
-    poFeature->SetFID(m_nNextFID++);
-
-    m_nFeaturesRead++;
+    poFeature->SetFID(nFID);
 
     return poFeature;
 }
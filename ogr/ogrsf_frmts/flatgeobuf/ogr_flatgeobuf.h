@@ -48,6 +48,7 @@ static constexpr uint32_t feature_max_buffer_size =
 struct FeatureItem : FlatGeobuf::Item
 {
     uint32_t size;
+    uint32_t hilbertValue;  // computed at sorting time. Fits in padding.
     uint64_t offset;
 };
 
@@ -20,6 +20,7 @@
 #include "ograrrowarrayhelper.h"
 #include "ogrlayerarrow.h"
 #include "ogr_recordbatch.h"
+#include "gdal_thread_pool.h"
 
 #include "ogr_flatgeobuf.h"
 #include "cplerrors.h"
@@ -534,6 +535,92 @@ static bool SupportsSeekWhileWriting(const std::string &osFilename)
            STARTS_WITH(osFilename.c_str(), "/vsimem/");
 }
 
+/************************************************************************/
+/*                         HilbertSortItems()                           */
+/************************************************************************/
+
+// Equivalent of FlatGeobuf::hilbertSort(), except that the Hilbert value of
+// each item is computed only once, instead of at each comparison, and that
+// several threads (GDAL_NUM_THREADS, 1 by default) can be used to
+// compute those values and sort chunks of items, which are then merged.
+// Items with the same Hilbert value are ordered by increasing offset in the
+// temporary file, so that the result does not depend on the number of
+// threads.
+static void HilbertSortItems(std::deque<FeatureItem> &items,
+                             const NodeItem &extent)
+{
+    const double minX = extent.minX;
+    const double minY = extent.minY;
+    const double width = extent.width();
+    const double height = extent.height();
+    const size_t nItems = items.size();
+
+    const char *pszThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    int nThreads = EQUAL(pszThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                 : atoi(pszThreads);
+    // Not worth using threads for small layers
+    constexpr size_t MIN_ITEMS_PER_THREAD = 100 * 1000;
+    nThreads = static_cast<int>(std::min<size_t>(
+        std::clamp(nThreads, 1, 128),
+        std::max<size_t>(1, nItems / MIN_ITEMS_PER_THREAD)));
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (!poJobQueue)
+        nThreads = 1;
+
+    const auto compare = [](const FeatureItem &a, const FeatureItem &b)
+    {
+        return a.hilbertValue > b.hilbertValue ||
+               (a.hilbertValue == b.hilbertValue && a.offset < b.offset);
+    };
+
+    std::vector<size_t> anChunkStart(nThreads + 1);
+    for (int i = 0; i <= nThreads; ++i)
+        anChunkStart[i] = static_cast<size_t>(
+            static_cast<uint64_t>(nItems) * i / nThreads);
+
+    const auto sortChunk = [&items, &anChunkStart, &compare, minX, minY, width,
+                            height](int iChunk)
+    {
+        const auto start = items.begin() + anChunkStart[iChunk];
+        const auto end = items.begin() + anChunkStart[iChunk + 1];
+        for (auto it = start; it != end; ++it)
+        {
+            it->hilbertValue = hilbert(it->nodeItem, HILBERT_MAX, minX, minY,
+                                       width, height);
+        }
+        std::sort(start, end, compare);
+    };
+
+    if (nThreads == 1)
+    {
+        sortChunk(0);
+        return;
+    }
+
+    for (int i = 0; i < nThreads; ++i)
+        poJobQueue->SubmitJob([&sortChunk, i]() { sortChunk(i); });
+    poJobQueue->WaitCompletion();
+
+    // Merge sorted chunks pairwise, with independent merges of a same level
+    // running in parallel.
+    for (int nStep = 1; nStep < nThreads; nStep *= 2)
+    {
+        for (int i = 0; i + nStep < nThreads; i += 2 * nStep)
+        {
+            const auto start = items.begin() + anChunkStart[i];
+            const auto middle = items.begin() + anChunkStart[i + nStep];
+            const auto end =
+                items.begin() + anChunkStart[std::min(i + 2 * nStep, nThreads)];
+            poJobQueue->SubmitJob(
+                [start, middle, end, &compare]()
+                { std::inplace_merge(start, middle, end, compare); });
+        }
+        poJobQueue->WaitCompletion();
+    }
+}
+
 bool OGRFlatGeobufLayer::CreateFinalFile()
 {
     // no spatial index requested, we are (almost) done
@@ -608,7 +695,7 @@ bool OGRFlatGeobufLayer::CreateFinalFile()
     writeHeader(m_poFp, m_featuresCount, &extentVector);
 
     CPLDebugOnly("FlatGeobuf", "Sorting items for Packed R-tree");
-    hilbertSort(m_featureItems);
+    HilbertSortItems(m_featureItems, extent);
     CPLDebugOnly("FlatGeobuf", "Calc new feature offsets");
     uint64_t featureOffset = 0;
     for (auto &item : m_featureItems)
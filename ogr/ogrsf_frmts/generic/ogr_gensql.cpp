@@ -19,6 +19,7 @@
 #include "ogr_recordbatch.h"
 #include "ogrlayerarrow.h"
 #include "cpl_time.h"
+#include "cpl_vsi_virtual.h"
 #include <algorithm>
 #include <limits>
 #include <map>
@@ -1988,26 +1989,33 @@ OGRFeature *OGRGenSQLResultsLayer::GetFeature(GIntBig nFID)
         }
         else
         {
-            if (m_aosDistinctList.empty())
+            if (m_aosDistinctList.empty() &&
+                !oSummary.oVectorDistinctValues.empty())
             {
-                std::set<CPLString, swq_summary::Comparator>::const_iterator
-                    oIter = oSummary.oSetDistinctValues.begin();
-                std::set<CPLString, swq_summary::Comparator>::const_iterator
-                    oEnd = oSummary.oSetDistinctValues.end();
                 try
                 {
                     m_aosDistinctList.reserve(
-                        oSummary.oSetDistinctValues.size());
-                    for (; oIter != oEnd; ++oIter)
+                        oSummary.oVectorDistinctValues.size());
+                    for (auto &osValue : oSummary.oVectorDistinctValues)
                     {
-                        m_aosDistinctList.push_back(*oIter);
+                        m_aosDistinctList.push_back(std::move(osValue));
                     }
                 }
                 catch (std::bad_alloc &)
                 {
+                    m_aosDistinctList.clear();
                     return nullptr;
                 }
-                oSummary.oSetDistinctValues.clear();
+                oSummary.oVectorDistinctValues.clear();
+                oSummary.oHashDistinctValues.clear();
+
+                // Values are unique with respect to the comparator, and in
+                // the order they were first seen, so that the result of a
+                // stable sort is deterministic.
+                std::stable_sort(m_aosDistinctList.begin(),
+                                 m_aosDistinctList.end(),
+                                 oSummary.oDistinctComparator);
+                oSummary.count = static_cast<GIntBig>(m_aosDistinctList.size());
             }
 
             if (nFID < 0 ||
@@ -2189,6 +2197,119 @@ void OGRGenSQLResultsLayer::ReadIndexFields(OGRFeature *poSrcFeat,
     }
 }
 
+/************************************************************************/
+/*                     Order by run file helpers                        */
+/*                                                                      */
+/*      When the key values of an ORDER BY do not fit in the memory     */
+/*      budget, CreateOrderByIndex() sorts them by runs, writes each    */
+/*      sorted run to a temporary file as a sequence of                 */
+/*      (sequence number, FID, key values) records, and merges the      */
+/*      runs at the end.                                                */
+/************************************************************************/
+
+namespace
+{
+// Kind of a key value, regarding its serialization
+enum class OrderByKeyKind
+{
+    RAW,             // OGRField without pointer, written as is
+    SPECIAL_STRING,  // Always set string of a special field
+    STRING,          // String of a OFTString field, possibly unset or null
+};
+
+struct OrderByRunFile
+{
+    std::string osFilename{};
+    VSIVirtualHandleUniquePtr fp{};
+    std::vector<OGRField> asFields{};
+    GUIntBig nSeq = 0;
+    GIntBig nFID = 0;
+
+    OrderByRunFile() = default;
+    OrderByRunFile(const OrderByRunFile &) = delete;
+    OrderByRunFile &operator=(const OrderByRunFile &) = delete;
+
+    ~OrderByRunFile()
+    {
+        fp.reset();
+        if (!osFilename.empty())
+            VSIUnlink(osFilename.c_str());
+    }
+};
+}  // namespace
+
+static bool
+WriteOrderByRecord(VSIVirtualHandle *fp,
+                   const std::vector<OrderByKeyKind> &aeKeyKinds,
+                   GUIntBig nSeq, GIntBig nFID, const OGRField *pasFields)
+{
+    bool bOK = fp->Write(&nSeq, sizeof(nSeq), 1) == 1 &&
+               fp->Write(&nFID, sizeof(nFID), 1) == 1;
+    for (size_t iKey = 0; bOK && iKey < aeKeyKinds.size(); ++iKey)
+    {
+        const OGRField *psField = pasFields + iKey;
+        const bool bIsString =
+            aeKeyKinds[iKey] == OrderByKeyKind::SPECIAL_STRING ||
+            (aeKeyKinds[iKey] == OrderByKeyKind::STRING &&
+             !OGR_RawField_IsUnset(psField) && !OGR_RawField_IsNull(psField));
+        const GByte byIsString = bIsString ? 1 : 0;
+        bOK = fp->Write(&byIsString, 1, 1) == 1;
+        if (bOK && bIsString)
+        {
+            const uint32_t nLen =
+                static_cast<uint32_t>(strlen(psField->String));
+            bOK = fp->Write(&nLen, sizeof(nLen), 1) == 1 &&
+                  fp->Write(psField->String, 1, nLen) == nLen;
+        }
+        else if (bOK)
+        {
+            bOK = fp->Write(psField, sizeof(OGRField), 1) == 1;
+        }
+    }
+    return bOK;
+}
+
+// Returns false at end of file, or on error. On error, pasFields is left in
+// a state where it can be passed to FreeIndexFields()
+static bool ReadOrderByRecord(VSIVirtualHandle *fp, size_t nOrderItems,
+                              GUIntBig &nSeq, GIntBig &nFID,
+                              OGRField *pasFields)
+{
+    memset(pasFields, 0, sizeof(OGRField) * nOrderItems);
+    if (fp->Read(&nSeq, sizeof(nSeq), 1) != 1 ||
+        fp->Read(&nFID, sizeof(nFID), 1) != 1)
+    {
+        return false;
+    }
+    for (size_t iKey = 0; iKey < nOrderItems; ++iKey)
+    {
+        OGRField *psField = pasFields + iKey;
+        GByte byIsString = 0;
+        if (fp->Read(&byIsString, 1, 1) != 1)
+            return false;
+        if (byIsString)
+        {
+            uint32_t nLen = 0;
+            if (fp->Read(&nLen, sizeof(nLen), 1) != 1)
+                return false;
+            char *pszStr = static_cast<char *>(VSI_MALLOC_VERBOSE(
+                static_cast<size_t>(nLen) + 1));
+            if (!pszStr)
+                return false;
+            pszStr[nLen] = 0;
+            psField->String = pszStr;
+            if (fp->Read(pszStr, 1, nLen) != nLen)
+                return false;
+        }
+        else if (fp->Read(psField, sizeof(OGRField), 1) != 1)
+        {
+            memset(psField, 0, sizeof(OGRField));
+            return false;
+        }
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                         CreateOrderByIndex()                         */
 /*                                                                      */
@@ -2198,12 +2319,14 @@ void OGRGenSQLResultsLayer::ReadIndexFields(OGRFeature *poSrcFeat,
 /*                                                                      */
 /*      This is accomplished by making one pass through all the         */
 /*      eligible source features, and capturing the order by fields     */
-/*      of all records in memory.  A quick sort is then applied to      */
+/*      of all records in memory.  A merge sort is then applied to      */
 /*      this in memory copy of the order-by fields to create the        */
 /*      required index.                                                 */
 /*                                                                      */
-/*      Keeping all the key values in memory will *not* scale up to     */
-/*      very large input datasets.                                      */
+/*      When the key values exceed the OGR_SQL_ORDER_BY_MAX_MEMORY      */
+/*      budget, sorted runs are spilled to temporary files and merged   */
+/*      at the end. Only the resulting FID index is then kept in        */
+/*      memory.                                                         */
 /************************************************************************/
 
 void OGRGenSQLResultsLayer::CreateOrderByIndex()
@@ -2299,6 +2422,103 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
 
     IndexFieldsFreer oIndexFieldsFreer(*this, asIndexFields, nIndexSize);
 
+    /* -------------------------------------------------------------------- */
+    /*      Determine the memory budget for key values, and how to          */
+    /*      serialize them if it is exceeded.                               */
+    /* -------------------------------------------------------------------- */
+    GIntBig nMaxMemory = 0;
+    {
+        const char *pszMaxMemory =
+            CPLGetConfigOption("OGR_SQL_ORDER_BY_MAX_MEMORY", "25%");
+        bool bUnitSpecified = false;
+        if (CPLParseMemorySize(pszMaxMemory, &nMaxMemory, &bUnitSpecified) !=
+            CE_None)
+        {
+            CPLError(CE_Warning, CPLE_IllegalArg,
+                     "Invalid value for OGR_SQL_ORDER_BY_MAX_MEMORY: %s",
+                     pszMaxMemory);
+            nMaxMemory = 0;
+        }
+        else if (!bUnitSpecified)
+        {
+            // Value without unit is in megabytes
+            nMaxMemory *= 1024 * 1024;
+        }
+    }
+
+    std::vector<OrderByKeyKind> aeKeyKinds(nOrderItems, OrderByKeyKind::RAW);
+    for (int iKey = 0; iKey < nOrderItems; iKey++)
+    {
+        const swq_order_def *psKeyDef = psSelectInfo->order_defs + iKey;
+        if (psKeyDef->field_index >= m_iFIDFieldIndex)
+        {
+            if (SpecialFieldTypes[psKeyDef->field_index - m_iFIDFieldIndex] ==
+                SWQ_STRING)
+            {
+                aeKeyKinds[iKey] = OrderByKeyKind::SPECIAL_STRING;
+            }
+        }
+        else if (m_poSrcLayer->GetLayerDefn()
+                     ->GetFieldDefn(psKeyDef->field_index)
+                     ->GetType() == OFTString)
+        {
+            aeKeyKinds[iKey] = OrderByKeyKind::STRING;
+        }
+    }
+
+    const GIntBig nRowMemory =
+        static_cast<GIntBig>(sizeof(OGRField) * nOrderItems + sizeof(GIntBig));
+    GIntBig nKeyMemory = 0;
+    std::vector<std::unique_ptr<OrderByRunFile>> apoRuns;
+    GUIntBig nRunStart = 0;
+
+    // Sort the nIndexSize rows in memory, write them in a new run file,
+    // and reset the in-memory state.
+    const auto WriteRun = [this, nOrderItems, &aeKeyKinds, &asIndexFields,
+                           &nIndexSize, &anFIDList, &apoRuns, &nRunStart,
+                           &nKeyMemory]()
+    {
+        m_anFIDIndex.resize(nIndexSize);
+        for (size_t i = 0; i < nIndexSize; i++)
+            m_anFIDIndex[i] = static_cast<GIntBig>(i);
+        std::vector<GIntBig> anMerged(nIndexSize);
+        SortIndexSection(asIndexFields.data(), anMerged.data(), 0, nIndexSize);
+
+        auto poRun = std::make_unique<OrderByRunFile>();
+        poRun->osFilename = CPLGenerateTempFilenameSafe("ogr_sql_order_by");
+        poRun->fp.reset(VSIFOpenL(poRun->osFilename.c_str(), "wb+"));
+        if (!poRun->fp)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot create %s",
+                     poRun->osFilename.c_str());
+            return false;
+        }
+        for (size_t i = 0; i < nIndexSize; i++)
+        {
+            const size_t iRow = static_cast<size_t>(m_anFIDIndex[i]);
+            if (!WriteOrderByRecord(poRun->fp.get(), aeKeyKinds,
+                                    nRunStart + iRow, anFIDList[iRow],
+                                    asIndexFields.data() + iRow * nOrderItems))
+            {
+                CPLError(CE_Failure, CPLE_FileIO, "Cannot write in %s",
+                         poRun->osFilename.c_str());
+                return false;
+            }
+        }
+        poRun->asFields.resize(nOrderItems);
+        apoRuns.push_back(std::move(poRun));
+
+        FreeIndexFields(asIndexFields.data(), nIndexSize);
+        memset(asIndexFields.data(), 0,
+               sizeof(OGRField) * nOrderItems * nIndexSize);
+        nRunStart += nIndexSize;
+        nIndexSize = 0;
+        anFIDList.clear();
+        m_anFIDIndex.clear();
+        nKeyMemory = 0;
+        return true;
+    };
+
     /* -------------------------------------------------------------------- */
     /*      Read in all the key values.                                     */
     /* -------------------------------------------------------------------- */
@@ -2350,6 +2570,123 @@ void OGRGenSQLResultsLayer::CreateOrderByIndex()
         anFIDList.push_back(poSrcFeat->GetFID());
 
         nIndexSize++;
+
+        if (nMaxMemory > 0)
+        {
+            nKeyMemory += nRowMemory;
+            const OGRField *pasRow =
+                asIndexFields.data() + (nIndexSize - 1) * nOrderItems;
+            for (int iKey = 0; iKey < nOrderItems; iKey++)
+            {
+                if (aeKeyKinds[iKey] == OrderByKeyKind::SPECIAL_STRING ||
+                    (aeKeyKinds[iKey] == OrderByKeyKind::STRING &&
+                     !OGR_RawField_IsUnset(&pasRow[iKey]) &&
+                     !OGR_RawField_IsNull(&pasRow[iKey])))
+                {
+                    nKeyMemory +=
+                        static_cast<GIntBig>(strlen(pasRow[iKey].String)) + 1;
+                }
+            }
+            if (nKeyMemory > nMaxMemory && !WriteRun())
+            {
+                m_anFIDIndex.clear();
+                return;
+            }
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      If runs have been spilled to disk, merge them.                  */
+    /* -------------------------------------------------------------------- */
+    if (!apoRuns.empty())
+    {
+        if (nIndexSize > 0 && !WriteRun())
+        {
+            m_anFIDIndex.clear();
+            return;
+        }
+        CPLDebug("GenSQL",
+                 "CreateOrderByIndex(): merging %d sorted runs of "
+                 CPL_FRMT_GUIB " features",
+                 static_cast<int>(apoRuns.size()), nRunStart);
+
+        try
+        {
+            m_anFIDIndex.reserve(static_cast<size_t>(nRunStart));
+        }
+        catch (const std::bad_alloc &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "CreateOrderByIndex(): out of memory");
+            return;
+        }
+
+        // Heap of run indices, whose top is the run with the smallest
+        // current record. Ties are broken by run index, so that the sort
+        // stays stable.
+        const auto IsAfter = [this, &apoRuns](size_t iRunA, size_t iRunB)
+        {
+            const int nResult = Compare(apoRuns[iRunA]->asFields.data(),
+                                        apoRuns[iRunB]->asFields.data());
+            return nResult > 0 || (nResult == 0 && iRunA > iRunB);
+        };
+        std::vector<size_t> anHeap;
+        bool bOK = true;
+        for (size_t iRun = 0; iRun < apoRuns.size(); ++iRun)
+        {
+            auto &poRun = apoRuns[iRun];
+            poRun->fp->Seek(0, SEEK_SET);
+            if (ReadOrderByRecord(poRun->fp.get(), nOrderItems, poRun->nSeq,
+                                  poRun->nFID, poRun->asFields.data()))
+            {
+                anHeap.push_back(iRun);
+            }
+            else
+            {
+                FreeIndexFields(poRun->asFields.data(), 1);
+                bOK = false;
+            }
+        }
+        std::make_heap(anHeap.begin(), anHeap.end(), IsAfter);
+
+        bool bAlreadySorted = true;
+        while (bOK && !anHeap.empty())
+        {
+            std::pop_heap(anHeap.begin(), anHeap.end(), IsAfter);
+            const size_t iRun = anHeap.back();
+            auto &poRun = apoRuns[iRun];
+            if (poRun->nSeq != static_cast<GUIntBig>(m_anFIDIndex.size()))
+                bAlreadySorted = false;
+            m_anFIDIndex.push_back(poRun->nFID);
+            FreeIndexFields(poRun->asFields.data(), 1);
+            if (ReadOrderByRecord(poRun->fp.get(), nOrderItems, poRun->nSeq,
+                                  poRun->nFID, poRun->asFields.data()))
+            {
+                std::push_heap(anHeap.begin(), anHeap.end(), IsAfter);
+            }
+            else
+            {
+                // End of run (or read error, detected below)
+                FreeIndexFields(poRun->asFields.data(), 1);
+                anHeap.pop_back();
+            }
+        }
+        for (size_t iRun : anHeap)
+            FreeIndexFields(apoRuns[iRun]->asFields.data(), 1);
+
+        if (!bOK || m_anFIDIndex.size() != nRunStart)
+        {
+            CPLError(CE_Failure, CPLE_FileIO,
+                     "CreateOrderByIndex(): cannot read temporary files");
+            m_anFIDIndex.clear();
+            return;
+        }
+
+        if (bAlreadySorted)
+            m_anFIDIndex.clear();
+
+        ResetReading();
+        return;
     }
 
     // CPLDebug("GenSQL", "CreateOrderByIndex() = %zu features", nIndexSize);
@@ -20,7 +20,12 @@
 #include "ogr_wkb.h"
 #include "ogrlayer_private.h"
 
+#include "cpl_error_internal.h"
+#include "cpl_quad_tree.h"
 #include "cpl_time.h"
+#include "gdal_thread_pool.h"
+
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <limits>
@@ -3933,8 +3938,18 @@ bool OGRLayer::FilterWKBGeometry(const GByte *pabyWKB, size_t nWKBSize,
         }
         else
         {
+            // For a rectangular filter, try an exact test directly on the
+            // WKB, to avoid instantiating a geometry.
+            bool bIntersects = false;
             if (bFilterIsEnvelope &&
-                OGRWKBIntersectsPessimistic(pabyWKB, nWKBSize, sFilterEnvelope))
+                OGRWKBIntersectsEnvelope(pabyWKB, nWKBSize, sFilterEnvelope,
+                                         bIntersects))
+            {
+                return bIntersects;
+            }
+            else if (bFilterIsEnvelope &&
+                     OGRWKBIntersectsPessimistic(pabyWKB, nWKBSize,
+                                                 sFilterEnvelope))
             {
                 return true;
             }
@@ -5122,6 +5137,572 @@ static OGRGeometry *promote_to_multi(OGRGeometry *poGeom)
         return poGeom;
 }
 
+/************************************************************************/
+/*                   OGRLayerAlgebraMethodIndex                         */
+/************************************************************************/
+
+namespace
+{
+
+/** In-memory copy of the method layer of an overlay operation, with a
+ * quadtree on the feature envelopes.
+ *
+ * Once loaded, it is only read, and can thus be queried concurrently.
+ */
+class OGRLayerAlgebraMethodIndex
+{
+    std::vector<OGRFeatureUniquePtr> m_apoFeatures{};
+    CPLQuadTree *m_hQuadTree = nullptr;
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRLayerAlgebraMethodIndex)
+
+  public:
+    OGRLayerAlgebraMethodIndex() = default;
+
+    ~OGRLayerAlgebraMethodIndex()
+    {
+        if (m_hQuadTree)
+            CPLQuadTreeDestroy(m_hQuadTree);
+    }
+
+    /** Read all features of poLayer (honoring its current spatial and
+     * attribute filters) that have a non-empty geometry.
+     */
+    void Load(OGRLayer *poLayer)
+    {
+        std::vector<OGREnvelope> asEnvelopes;
+        OGREnvelope sGlobalEnvelope;
+        for (auto &&poFeature : poLayer)
+        {
+            const OGRGeometry *poGeom = poFeature->GetGeometryRef();
+            if (!poGeom || poGeom->IsEmpty())
+                continue;
+            OGREnvelope sEnvelope;
+            poGeom->getEnvelope(&sEnvelope);
+            sGlobalEnvelope.Merge(sEnvelope);
+            asEnvelopes.push_back(sEnvelope);
+            m_apoFeatures.push_back(std::move(poFeature));
+        }
+        if (m_apoFeatures.empty())
+            return;
+
+        CPLRectObj sGlobalBounds;
+        sGlobalBounds.minx = sGlobalEnvelope.MinX;
+        sGlobalBounds.miny = sGlobalEnvelope.MinY;
+        sGlobalBounds.maxx = sGlobalEnvelope.MaxX;
+        sGlobalBounds.maxy = sGlobalEnvelope.MaxY;
+        m_hQuadTree = CPLQuadTreeCreate(&sGlobalBounds, nullptr);
+        CPLQuadTreeSetMaxDepth(
+            m_hQuadTree,
+            CPLQuadTreeGetAdvisedMaxDepth(static_cast<int>(
+                std::min<size_t>(INT_MAX, m_apoFeatures.size()))));
+        for (size_t i = 0; i < m_apoFeatures.size(); ++i)
+        {
+            CPLRectObj sBounds;
+            sBounds.minx = asEnvelopes[i].MinX;
+            sBounds.miny = asEnvelopes[i].MinY;
+            sBounds.maxx = asEnvelopes[i].MaxX;
+            sBounds.maxy = asEnvelopes[i].MaxY;
+            // m_hQuadTree stores indices into m_apoFeatures as void*
+            CPLQuadTreeInsertWithBounds(
+                m_hQuadTree,
+                reinterpret_cast<void *>(static_cast<uintptr_t>(i)), &sBounds);
+        }
+    }
+
+    /** Return the features whose envelope intersects the one of poFilter,
+     * in the order they were read from the layer. If bExact is set, only
+     * the ones whose geometry intersects poFilter are returned, which
+     * mimics what a spatial filter set to poFilter would return.
+     */
+    std::vector<const OGRFeature *> Search(const OGRGeometry *poFilter,
+                                           bool bExact) const
+    {
+        std::vector<const OGRFeature *> apoRet;
+        if (!m_hQuadTree || poFilter->IsEmpty())
+            return apoRet;
+
+        OGREnvelope sEnvelope;
+        poFilter->getEnvelope(&sEnvelope);
+        CPLRectObj sAOI;
+        sAOI.minx = sEnvelope.MinX;
+        sAOI.miny = sEnvelope.MinY;
+        sAOI.maxx = sEnvelope.MaxX;
+        sAOI.maxy = sEnvelope.MaxY;
+        int nCount = 0;
+        void **pahHits = CPLQuadTreeSearch(m_hQuadTree, &sAOI, &nCount);
+        if (!pahHits)
+            return apoRet;
+        std::vector<size_t> anIndices;
+        anIndices.reserve(nCount);
+        for (int i = 0; i < nCount; ++i)
+            anIndices.push_back(static_cast<size_t>(
+                reinterpret_cast<uintptr_t>(pahHits[i])));
+        CPLFree(pahHits);
+        std::sort(anIndices.begin(), anIndices.end());
+
+        OGRPreparedGeometryUniquePtr poPreparedFilter;
+        if (bExact && OGRHasPreparedGeometrySupport())
+        {
+            poPreparedFilter.reset(OGRCreatePreparedGeometry(
+                OGRGeometry::ToHandle(const_cast<OGRGeometry *>(poFilter))));
+        }
+
+        apoRet.reserve(nCount);
+        for (const size_t nIdx : anIndices)
+        {
+            const OGRFeature *poFeature = m_apoFeatures[nIdx].get();
+            if (bExact)
+            {
+                const OGRGeometry *poGeom = poFeature->GetGeometryRef();
+                const bool bIntersects =
+                    poPreparedFilter
+                        ? CPL_TO_BOOL(OGRPreparedGeometryIntersects(
+                              poPreparedFilter.get(),
+                              OGRGeometry::ToHandle(
+                                  const_cast<OGRGeometry *>(poGeom))))
+                        : CPL_TO_BOOL(poFilter->Intersects(poGeom));
+                if (!bIntersects)
+                    continue;
+            }
+            apoRet.push_back(poFeature);
+        }
+        return apoRet;
+    }
+};
+
+/** Overlay operations that can be run with OGRLayerAlgebraMethodIndex */
+enum class OGRLayerAlgebraIndexedOp
+{
+    INTERSECTION,
+    // Intersections, followed by the part of the input feature not covered
+    // by them, as done by Identity() and the first pass of Union()
+    IDENTITY,
+    CLIP,
+    ERASE,
+};
+
+/** Options of the overlay operations relevant to the indexed code path */
+struct OGRLayerAlgebraIndexedOptions
+{
+    bool bSkipFailures = false;
+    bool bPromoteToMulti = false;
+    bool bUsePreparedGeometries = true;
+    bool bPretestContainment = false;
+    bool bKeepLowerDimGeom = false;
+};
+
+/** Output of the processing of one feature of the input layer */
+struct OGRLayerAlgebraIndexedResult
+{
+    OGRFeatureUniquePtr poInputFeature{};
+    // Result geometries, with the method feature they come from (only for
+    // INTERSECTION and IDENTITY, nullptr otherwise)
+    std::vector<std::pair<OGRGeometryUniquePtr, const OGRFeature *>>
+        aoResults{};
+    bool bFailed = false;
+};
+
+}  // namespace
+
+/************************************************************************/
+/*                       overlay_indexed_feature()                      */
+/************************************************************************/
+
+// Compute the result geometries for one input feature.
+// Only reads from oIndex and pGeometryMethodFilter, so that it can be
+// called concurrently from several threads.
+static void overlay_indexed_feature(
+    OGRLayerAlgebraIndexedOp eOp, const OGRLayerAlgebraMethodIndex &oIndex,
+    const OGRGeometry *pGeometryMethodFilter,
+    const OGRLayerAlgebraIndexedOptions &sOptions,
+    OGRLayerAlgebraIndexedResult &sResult)
+{
+    const auto HasFailed = [&sOptions]()
+    {
+        if (CPLGetLastErrorType() == CE_None)
+            return false;
+        if (!sOptions.bSkipFailures)
+            return true;
+        CPLErrorReset();
+        return false;
+    };
+
+    const OGRGeometry *x_geom = sResult.poInputFeature->GetGeometryRef();
+    if (!x_geom)
+        return;
+
+    // Equivalent of set_filter_from()
+    const OGRGeometry *poFilter = x_geom;
+    OGRGeometryUniquePtr poFilterIntersection;
+    if (pGeometryMethodFilter)
+    {
+        if (!x_geom->Intersects(pGeometryMethodFilter))
+            return;
+        CPLErrorReset();
+        poFilterIntersection.reset(
+            x_geom->Intersection(pGeometryMethodFilter));
+        if (HasFailed())
+        {
+            sResult.bFailed = true;
+            return;
+        }
+        if (!poFilterIntersection)
+            return;
+        poFilter = poFilterIntersection.get();
+    }
+
+    if (eOp == OGRLayerAlgebraIndexedOp::INTERSECTION ||
+        eOp == OGRLayerAlgebraIndexedOp::IDENTITY)
+    {
+        // The prepared geometry pretest below already discards method
+        // features that do not intersect x_geom.
+        const auto apoCandidates = oIndex.Search(
+            poFilter, poFilterIntersection != nullptr ||
+                          !sOptions.bUsePreparedGeometries);
+
+        OGRPreparedGeometryUniquePtr x_prepared_geom;
+        if (sOptions.bUsePreparedGeometries && !apoCandidates.empty())
+        {
+            x_prepared_geom.reset(OGRCreatePreparedGeometry(
+                OGRGeometry::ToHandle(const_cast<OGRGeometry *>(x_geom))));
+            if (!x_prepared_geom)
+                return;
+        }
+
+        // this will be the geometry of the last result feature of IDENTITY
+        OGRGeometryUniquePtr x_geom_diff;
+        if (eOp == OGRLayerAlgebraIndexedOp::IDENTITY)
+            x_geom_diff.reset(x_geom->clone());
+
+        for (const OGRFeature *y : apoCandidates)
+        {
+            const OGRGeometry *y_geom = y->GetGeometryRef();
+            OGRGeometryH y_geom_h =
+                OGRGeometry::ToHandle(const_cast<OGRGeometry *>(y_geom));
+            OGRGeometryUniquePtr z_geom;
+
+            if (x_prepared_geom)
+            {
+                CPLErrorReset();
+                if (sOptions.bPretestContainment &&
+                    OGRPreparedGeometryContains(x_prepared_geom.get(),
+                                                y_geom_h))
+                {
+                    if (CPLGetLastErrorType() == CE_None)
+                        z_geom.reset(y_geom->clone());
+                }
+                else if (!OGRPreparedGeometryIntersects(x_prepared_geom.get(),
+                                                        y_geom_h))
+                {
+                    if (CPLGetLastErrorType() == CE_None)
+                        continue;
+                }
+                if (CPLGetLastErrorType() != CE_None)
+                {
+                    if (HasFailed())
+                    {
+                        sResult.bFailed = true;
+                        return;
+                    }
+                    continue;
+                }
+            }
+            if (!z_geom)
+            {
+                CPLErrorReset();
+                z_geom.reset(x_geom->Intersection(y_geom));
+                if (CPLGetLastErrorType() != CE_None || z_geom == nullptr)
+                {
+                    if (!sOptions.bSkipFailures)
+                    {
+                        sResult.bFailed = true;
+                        return;
+                    }
+                    CPLErrorReset();
+                    continue;
+                }
+                if (z_geom->IsEmpty() ||
+                    (!sOptions.bKeepLowerDimGeom &&
+                     (x_geom->getDimension() == y_geom->getDimension() &&
+                      z_geom->getDimension() < x_geom->getDimension())))
+                {
+                    continue;
+                }
+            }
+            if (sOptions.bPromoteToMulti)
+                z_geom.reset(promote_to_multi(z_geom.release()));
+            if (x_geom_diff)
+            {
+                CPLErrorReset();
+                OGRGeometryUniquePtr x_geom_diff_new(
+                    x_geom_diff->Difference(y_geom));
+                if (CPLGetLastErrorType() != CE_None ||
+                    x_geom_diff_new == nullptr)
+                {
+                    if (!sOptions.bSkipFailures)
+                    {
+                        sResult.bFailed = true;
+                        return;
+                    }
+                    CPLErrorReset();
+                }
+                else
+                {
+                    x_geom_diff.swap(x_geom_diff_new);
+                }
+            }
+            sResult.aoResults.emplace_back(std::move(z_geom), y);
+        }
+
+        if (x_geom_diff && !x_geom_diff->IsEmpty())
+        {
+            if (sOptions.bPromoteToMulti)
+                x_geom_diff.reset(promote_to_multi(x_geom_diff.release()));
+            sResult.aoResults.emplace_back(std::move(x_geom_diff), nullptr);
+        }
+    }
+    else if (eOp == OGRLayerAlgebraIndexedOp::CLIP)
+    {
+        // incrementally add area from y to geom
+        OGRGeometryUniquePtr geom;
+        for (const OGRFeature *y : oIndex.Search(poFilter, true))
+        {
+            const OGRGeometry *y_geom = y->GetGeometryRef();
+            if (!geom)
+            {
+                geom.reset(y_geom->clone());
+                continue;
+            }
+            CPLErrorReset();
+            OGRGeometryUniquePtr geom_new(geom->Union(y_geom));
+            if (CPLGetLastErrorType() != CE_None || geom_new == nullptr)
+            {
+                if (!sOptions.bSkipFailures)
+                {
+                    sResult.bFailed = true;
+                    return;
+                }
+                CPLErrorReset();
+            }
+            else
+            {
+                geom.swap(geom_new);
+            }
+        }
+
+        if (geom)
+        {
+            CPLErrorReset();
+            OGRGeometryUniquePtr poIntersection(
+                x_geom->Intersection(geom.get()));
+            if (CPLGetLastErrorType() != CE_None || poIntersection == nullptr)
+            {
+                if (!sOptions.bSkipFailures)
+                    sResult.bFailed = true;
+                else
+                    CPLErrorReset();
+            }
+            else if (!poIntersection->IsEmpty())
+            {
+                if (sOptions.bPromoteToMulti)
+                    poIntersection.reset(
+                        promote_to_multi(poIntersection.release()));
+                sResult.aoResults.emplace_back(std::move(poIntersection),
+                                               nullptr);
+            }
+        }
+    }
+    else
+    {
+        // incrementally erase y from geom
+        OGRGeometryUniquePtr geom(x_geom->clone());
+        for (const OGRFeature *y : oIndex.Search(poFilter, true))
+        {
+            CPLErrorReset();
+            OGRGeometryUniquePtr geom_new(
+                geom->Difference(y->GetGeometryRef()));
+            if (CPLGetLastErrorType() != CE_None || geom_new == nullptr)
+            {
+                if (!sOptions.bSkipFailures)
+                {
+                    sResult.bFailed = true;
+                    return;
+                }
+                CPLErrorReset();
+            }
+            else
+            {
+                geom.swap(geom_new);
+                if (geom->IsEmpty())
+                    break;
+            }
+        }
+
+        if (!geom->IsEmpty())
+        {
+            if (sOptions.bPromoteToMulti)
+                geom.reset(promote_to_multi(geom.release()));
+            sResult.aoResults.emplace_back(std::move(geom), nullptr);
+        }
+    }
+}
+
+/************************************************************************/
+/*                           overlay_indexed()                          */
+/************************************************************************/
+
+// Implementation of Intersection(), Clip() and Erase(), and of the passes of
+// Union(), SymDifference(), Identity() and Update() that overlay the features
+// of a layer with the other one, when the INDEX_METHOD_LAYER option is set:
+// pLayerMethod is loaded once in memory with a spatial index, instead of
+// being re-scanned with a spatial filter for each feature of pLayerInput, and
+// features of pLayerInput are processed in parallel batches when NUM_THREADS
+// is set.
+static OGRErr overlay_indexed(OGRLayerAlgebraIndexedOp eOp,
+                              OGRLayer *pLayerInput, OGRLayer *pLayerMethod,
+                              OGRLayer *pLayerResult,
+                              const OGRGeometry *pGeometryMethodFilter,
+                              const int *mapInput, const int *mapMethod,
+                              const OGRLayerAlgebraIndexedOptions &sOptions,
+                              CSLConstList papszOptions,
+                              GDALProgressFunc pfnProgress, void *pProgressArg)
+{
+    OGRLayerAlgebraMethodIndex oIndex;
+    oIndex.Load(pLayerMethod);
+
+    const char *pszThreads =
+        CSLFetchNameValueDef(papszOptions, "NUM_THREADS", "1");
+    const int nThreads = std::max(1, std::min(128, EQUAL(pszThreads, "ALL_CPUS")
+                                                       ? CPLGetNumCPUs()
+                                                       : atoi(pszThreads)));
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    // Number of input features read ahead and processed concurrently
+    const size_t nBatchSize = poJobQueue ? 64 * static_cast<size_t>(nThreads)
+                                         : 1;
+
+    OGRFeatureDefn *poDefnResult = pLayerResult->GetLayerDefn();
+    const double progress_max =
+        static_cast<double>(pLayerInput->GetFeatureCount(FALSE));
+    double progress_counter = 0;
+    const double progress_ticker = 0;
+
+    pLayerInput->ResetReading();
+    std::vector<OGRLayerAlgebraIndexedResult> asResults(nBatchSize);
+    bool bEOF = false;
+    while (!bEOF)
+    {
+        size_t nCount = 0;
+        for (; nCount < nBatchSize; ++nCount)
+        {
+            if (pfnProgress)
+            {
+                const double p = progress_counter / progress_max;
+                if (p > progress_ticker && !pfnProgress(p, "", pProgressArg))
+                {
+                    CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+                    return OGRERR_FAILURE;
+                }
+                progress_counter += 1.0;
+            }
+
+            auto &sResult = asResults[nCount];
+            sResult.poInputFeature.reset(pLayerInput->GetNextFeature());
+            sResult.aoResults.clear();
+            sResult.bFailed = false;
+            if (!sResult.poInputFeature)
+            {
+                bEOF = true;
+                break;
+            }
+        }
+
+        if (poJobQueue && nCount > 1)
+        {
+            CPLErrorAccumulator oErrorAccumulator;
+            for (size_t i = 0; i < nCount; ++i)
+            {
+                auto &sResult = asResults[i];
+                poJobQueue->SubmitJob(
+                    [eOp, &oIndex, pGeometryMethodFilter, &sOptions, &sResult,
+                     &oErrorAccumulator]()
+                    {
+                        auto oAccumulator =
+                            oErrorAccumulator.InstallForCurrentScope();
+                        CPL_IGNORE_RET_VAL(oAccumulator);
+                        overlay_indexed_feature(eOp, oIndex,
+                                                pGeometryMethodFilter,
+                                                sOptions, sResult);
+                    });
+            }
+            poJobQueue->WaitCompletion();
+            oErrorAccumulator.ReplayErrors();
+        }
+        else
+        {
+            for (size_t i = 0; i < nCount; ++i)
+            {
+                overlay_indexed_feature(eOp, oIndex, pGeometryMethodFilter,
+                                        sOptions, asResults[i]);
+            }
+        }
+
+        for (size_t i = 0; i < nCount; ++i)
+        {
+            auto &sResult = asResults[i];
+            for (auto &oResult : sResult.aoResults)
+            {
+                OGRFeatureUniquePtr z(new OGRFeature(poDefnResult));
+                z->SetFieldsFrom(sResult.poInputFeature.get(), mapInput);
+                if (oResult.second)
+                    z->SetFieldsFrom(oResult.second, mapMethod);
+                z->SetGeometryDirectly(oResult.first.release());
+                const OGRErr ret = pLayerResult->CreateFeature(z.get());
+                if (ret != OGRERR_NONE)
+                {
+                    if (!sOptions.bSkipFailures)
+                        return ret;
+                    CPLErrorReset();
+                }
+            }
+            if (sResult.bFailed)
+                return OGRERR_FAILURE;
+        }
+    }
+
+    if (pfnProgress && !pfnProgress(1.0, "", pProgressArg))
+    {
+        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        return OGRERR_FAILURE;
+    }
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                       overlay_indexed_scaled()                       */
+/************************************************************************/
+
+// Run overlay_indexed() as the part of an operation that goes from dfMin to
+// dfMax of its progress.
+static OGRErr overlay_indexed_scaled(
+    OGRLayerAlgebraIndexedOp eOp, OGRLayer *pLayerInput, OGRLayer *pLayerMethod,
+    OGRLayer *pLayerResult, const OGRGeometry *pGeometryMethodFilter,
+    const int *mapInput, const int *mapMethod,
+    const OGRLayerAlgebraIndexedOptions &sOptions, CSLConstList papszOptions,
+    double dfMin, double dfMax, GDALProgressFunc pfnProgress,
+    void *pProgressArg)
+{
+    std::unique_ptr<void, decltype(&GDALDestroyScaledProgress)> pScaledData(
+        GDALCreateScaledProgress(dfMin, dfMax, pfnProgress, pProgressArg),
+        GDALDestroyScaledProgress);
+    return overlay_indexed(
+        eOp, pLayerInput, pLayerMethod, pLayerResult, pGeometryMethodFilter,
+        mapInput, mapMethod, sOptions, papszOptions,
+        pScaledData ? GDALScaledProgress : nullptr, pScaledData.get());
+}
+
 /************************************************************************/
 /*                          Intersection()                              */
 /************************************************************************/
@@ -5176,6 +5757,16 @@ static OGRGeometry *promote_to_multi(OGRGeometry *poGeom)
  *     features with lower dimension geometry, but only if the result layer
  *     has an unknown geometry type.
  * </li>
+ * <li>INDEX_METHOD_LAYER=YES/NO. Set to YES to load the method layer
+ *     once in memory, with a spatial index, instead of querying it with
+ *     a spatial filter for each feature of this layer. This is much faster
+ *     when the method layer has many features, provided it fits in RAM.
+ *     (GDAL >= 3.13)
+ * </li>
+ * <li>NUM_THREADS=integer or ALL_CPUS. Number of threads used to process
+ *     features of this layer in parallel. Only taken into account when
+ *     INDEX_METHOD_LAYER=YES. Defaults to 1. (GDAL >= 3.13)
+ * </li>
  * </ul>
  *
  * This method is the same as the C function OGR_L_Intersection().
@@ -5263,6 +5854,22 @@ OGRErr OGRLayer::Intersection(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         }
     }
 
+    if (CPLTestBool(
+            CSLFetchNameValueDef(papszOptions, "INDEX_METHOD_LAYER", "NO")))
+    {
+        OGRLayerAlgebraIndexedOptions sOptions;
+        sOptions.bSkipFailures = bSkipFailures;
+        sOptions.bPromoteToMulti = bPromoteToMulti;
+        sOptions.bUsePreparedGeometries = bUsePreparedGeometries;
+        sOptions.bPretestContainment = bPretestContainment;
+        sOptions.bKeepLowerDimGeom = bKeepLowerDimGeom;
+        ret = overlay_indexed(OGRLayerAlgebraIndexedOp::INTERSECTION, this,
+                              pLayerMethod, pLayerResult, pGeometryMethodFilter,
+                              mapInput, mapMethod, sOptions, papszOptions,
+                              pfnProgress, pProgressArg);
+        goto done;
+    }
+
     for (auto &&x : this)
     {
 
@@ -5498,6 +6105,16 @@ done:
  *     features with lower dimension geometry, but only if the result layer
  *     has an unknown geometry type.
  * </li>
+ * <li>INDEX_METHOD_LAYER=YES/NO. Set to YES to load the method layer
+ *     once in memory, with a spatial index, instead of querying it with
+ *     a spatial filter for each feature of the input layer. This is much
+ *     faster when the method layer has many features, provided it fits in
+ *     RAM. (GDAL >= 3.13)
+ * </li>
+ * <li>NUM_THREADS=integer or ALL_CPUS. Number of threads used to process
+ *     features of the input layer in parallel. Only taken into account
+ *     when INDEX_METHOD_LAYER=YES. Defaults to 1. (GDAL >= 3.13)
+ * </li>
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Intersection().
@@ -5594,6 +6211,18 @@ OGRErr OGR_L_Intersection(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  *     features with lower dimension geometry, but only if the result layer
  *     has an unknown geometry type.
  * </li>
+ * <li>INDEX_METHOD_LAYER=YES/NO. Set to YES to load the method layer
+ *     once in memory, with a spatial index, instead of querying it with
+ *     a spatial filter for each feature of this layer, and likewise to
+ *     load this layer when processing the features of the method layer.
+ *     This is much faster when the layers have many features, provided
+ *     they fit in RAM. (GDAL >= 3.13)
+ * </li>
+ * <li>NUM_THREADS=integer or ALL_CPUS. Number of threads used to process
+ *     features of this layer and of the method layer in parallel. Only
+ *     taken into account when INDEX_METHOD_LAYER=YES. Defaults to 1.
+ *     (GDAL >= 3.13)
+ * </li>
  * </ul>
  *
  * This method is the same as the C function OGR_L_Union().
@@ -5682,6 +6311,34 @@ OGRErr OGRLayer::Union(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         }
     }
 
+    if (CPLTestBool(
+            CSLFetchNameValueDef(papszOptions, "INDEX_METHOD_LAYER", "NO")))
+    {
+        OGRLayerAlgebraIndexedOptions sOptions;
+        sOptions.bSkipFailures = bSkipFailures;
+        sOptions.bPromoteToMulti = bPromoteToMulti;
+        sOptions.bUsePreparedGeometries = bUsePreparedGeometries;
+        sOptions.bKeepLowerDimGeom = bKeepLowerDimGeom;
+        const double dfRatio =
+            progress_max > 0
+                ? static_cast<double>(GetFeatureCount(FALSE)) / progress_max
+                : 0.5;
+        // add features based on input layer, and then on method layer
+        ret = overlay_indexed_scaled(
+            OGRLayerAlgebraIndexedOp::IDENTITY, this, pLayerMethod,
+            pLayerResult, pGeometryMethodFilter, mapInput, mapMethod, sOptions,
+            papszOptions, 0.0, dfRatio, pfnProgress, pProgressArg);
+        if (ret == OGRERR_NONE)
+        {
+            ret = overlay_indexed_scaled(
+                OGRLayerAlgebraIndexedOp::ERASE, pLayerMethod, this,
+                pLayerResult, pGeometryInputFilter, mapMethod, mapInput,
+                sOptions, papszOptions, dfRatio, 1.0, pfnProgress,
+                pProgressArg);
+        }
+        goto done;
+    }
+
     // add features based on input layer
     for (auto &&x : this)
     {
@@ -6048,6 +6705,18 @@ done:
  *     features with lower dimension geometry, but only if the result layer
  *     has an unknown geometry type.
  * </li>
+ * <li>INDEX_METHOD_LAYER=YES/NO. Set to YES to load the method layer
+ *     once in memory, with a spatial index, instead of querying it with
+ *     a spatial filter for each feature of the input layer, and likewise to
+ *     load the input layer when processing the features of the method layer.
+ *     This is much faster when the layers have many features, provided
+ *     they fit in RAM. (GDAL >= 3.13)
+ * </li>
+ * <li>NUM_THREADS=integer or ALL_CPUS. Number of threads used to process
+ *     features of the input layer and of the method layer in parallel. Only
+ *     taken into account when INDEX_METHOD_LAYER=YES. Defaults to 1.
+ *     (GDAL >= 3.13)
+ * </li>
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Union().
@@ -6131,6 +6800,18 @@ OGRErr OGR_L_Union(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>INDEX_METHOD_LAYER=YES/NO. Set to YES to load the method layer
+ *     once in memory, with a spatial index, instead of querying it with
+ *     a spatial filter for each feature of this layer, and likewise to
+ *     load this layer when processing the features of the method layer.
+ *     This is much faster when the layers have many features, provided
+ *     they fit in RAM. (GDAL >= 3.13)
+ * </li>
+ * <li>NUM_THREADS=integer or ALL_CPUS. Number of threads used to process
+ *     features of this layer and of the method layer in parallel. Only
+ *     taken into account when INDEX_METHOD_LAYER=YES. Defaults to 1.
+ *     (GDAL >= 3.13)
+ * </li>
  * </ul>
  *
  * This method is the same as the C function OGR_L_SymDifference().
@@ -6205,6 +6886,32 @@ OGRErr OGRLayer::SymDifference(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         goto done;
     poDefnResult = pLayerResult->GetLayerDefn();
 
+    if (CPLTestBool(
+            CSLFetchNameValueDef(papszOptions, "INDEX_METHOD_LAYER", "NO")))
+    {
+        OGRLayerAlgebraIndexedOptions sOptions;
+        sOptions.bSkipFailures = bSkipFailures;
+        sOptions.bPromoteToMulti = bPromoteToMulti;
+        const double dfRatio =
+            progress_max > 0
+                ? static_cast<double>(GetFeatureCount(FALSE)) / progress_max
+                : 0.5;
+        // add features based on input layer, and then on method layer
+        ret = overlay_indexed_scaled(
+            OGRLayerAlgebraIndexedOp::ERASE, this, pLayerMethod, pLayerResult,
+            pGeometryMethodFilter, mapInput, mapMethod, sOptions, papszOptions,
+            0.0, dfRatio, pfnProgress, pProgressArg);
+        if (ret == OGRERR_NONE)
+        {
+            ret = overlay_indexed_scaled(
+                OGRLayerAlgebraIndexedOp::ERASE, pLayerMethod, this,
+                pLayerResult, pGeometryInputFilter, mapMethod, mapInput,
+                sOptions, papszOptions, dfRatio, 1.0, pfnProgress,
+                pProgressArg);
+        }
+        goto done;
+    }
+
     // add features based on input layer
     for (auto &&x : this)
     {
@@ -6466,6 +7173,18 @@ done:
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>INDEX_METHOD_LAYER=YES/NO. Set to YES to load the method layer
+ *     once in memory, with a spatial index, instead of querying it with
+ *     a spatial filter for each feature of the input layer, and likewise to
+ *     load the input layer when processing the features of the method layer.
+ *     This is much faster when the layers have many features, provided
+ *     they fit in RAM. (GDAL >= 3.13)
+ * </li>
+ * <li>NUM_THREADS=integer or ALL_CPUS. Number of threads used to process
+ *     features of the input layer and of the method layer in parallel. Only
+ *     taken into account when INDEX_METHOD_LAYER=YES. Defaults to 1.
+ *     (GDAL >= 3.13)
+ * </li>
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::SymDifference().
@@ -6561,6 +7280,16 @@ OGRErr OGR_L_SymDifference(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  *     features with lower dimension geometry, but only if the result layer
  *     has an unknown geometry type.
  * </li>
+ * <li>INDEX_METHOD_LAYER=YES/NO. Set to YES to load the method layer
+ *     once in memory, with a spatial index, instead of querying it with
+ *     a spatial filter for each feature of this layer. This is much faster
+ *     when the method layer has many features, provided it fits in RAM.
+ *     (GDAL >= 3.13)
+ * </li>
+ * <li>NUM_THREADS=integer or ALL_CPUS. Number of threads used to process
+ *     features of this layer in parallel. Only taken into account when
+ *     INDEX_METHOD_LAYER=YES. Defaults to 1. (GDAL >= 3.13)
+ * </li>
  * </ul>
  *
  * This method is the same as the C function OGR_L_Identity().
@@ -6643,6 +7372,21 @@ OGRErr OGRLayer::Identity(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         goto done;
     poDefnResult = pLayerResult->GetLayerDefn();
 
+    if (CPLTestBool(
+            CSLFetchNameValueDef(papszOptions, "INDEX_METHOD_LAYER", "NO")))
+    {
+        OGRLayerAlgebraIndexedOptions sOptions;
+        sOptions.bSkipFailures = bSkipFailures;
+        sOptions.bPromoteToMulti = bPromoteToMulti;
+        sOptions.bUsePreparedGeometries = bUsePreparedGeometries;
+        sOptions.bKeepLowerDimGeom = bKeepLowerDimGeom;
+        ret = overlay_indexed(OGRLayerAlgebraIndexedOp::IDENTITY, this,
+                              pLayerMethod, pLayerResult, pGeometryMethodFilter,
+                              mapInput, mapMethod, sOptions, papszOptions,
+                              pfnProgress, pProgressArg);
+        goto done;
+    }
+
     // split the features in input layer to the result layer
     for (auto &&x : this)
     {
@@ -6895,6 +7639,16 @@ done:
  *     features with lower dimension geometry, but only if the result layer
  *     has an unknown geometry type.
  * </li>
+ * <li>INDEX_METHOD_LAYER=YES/NO. Set to YES to load the method layer
+ *     once in memory, with a spatial index, instead of querying it with
+ *     a spatial filter for each feature of the input layer. This is much faster
+ *     when the method layer has many features, provided it fits in RAM.
+ *     (GDAL >= 3.13)
+ * </li>
+ * <li>NUM_THREADS=integer or ALL_CPUS. Number of threads used to process
+ *     features of the input layer in parallel. Only taken into account when
+ *     INDEX_METHOD_LAYER=YES. Defaults to 1. (GDAL >= 3.13)
+ * </li>
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Identity().
@@ -6979,6 +7733,16 @@ OGRErr OGR_L_Identity(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>INDEX_METHOD_LAYER=YES/NO. Set to YES to load the method layer
+ *     once in memory, with a spatial index, instead of querying it with
+ *     a spatial filter for each feature of this layer. This is much faster
+ *     when the method layer has many features, provided it fits in RAM.
+ *     (GDAL >= 3.13)
+ * </li>
+ * <li>NUM_THREADS=integer or ALL_CPUS. Number of threads used to process
+ *     features of this layer in parallel. Only taken into account when
+ *     INDEX_METHOD_LAYER=YES. Defaults to 1. (GDAL >= 3.13)
+ * </li>
  * </ul>
  *
  * This method is the same as the C function OGR_L_Update().
@@ -7049,6 +7813,25 @@ OGRErr OGRLayer::Update(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         goto done;
     poDefnResult = pLayerResult->GetLayerDefn();
 
+    if (CPLTestBool(
+            CSLFetchNameValueDef(papszOptions, "INDEX_METHOD_LAYER", "NO")))
+    {
+        OGRLayerAlgebraIndexedOptions sOptions;
+        sOptions.bSkipFailures = bSkipFailures;
+        sOptions.bPromoteToMulti = bPromoteToMulti;
+        const double dfInputCount = static_cast<double>(GetFeatureCount(FALSE));
+        // add clipped features from the input layer
+        ret = overlay_indexed_scaled(
+            OGRLayerAlgebraIndexedOp::ERASE, this, pLayerMethod, pLayerResult,
+            pGeometryMethodFilter, mapInput, mapMethod, sOptions, papszOptions,
+            0.0, progress_max > 0 ? dfInputCount / progress_max : 0.5,
+            pfnProgress, pProgressArg);
+        if (ret != OGRERR_NONE)
+            goto done;
+        progress_counter = dfInputCount;
+        goto add_update_features;
+    }
+
     // add clipped features from the input layer
     for (auto &&x : this)
     {
@@ -7151,6 +7934,7 @@ OGRErr OGRLayer::Update(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
     }
 
     // restore the original filter and add features from the update layer
+add_update_features:
     pLayerMethod->SetSpatialFilter(pGeometryMethodFilter);
     for (auto &&y : pLayerMethod)
     {
@@ -7251,6 +8035,16 @@ done:
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>INDEX_METHOD_LAYER=YES/NO. Set to YES to load the method layer
+ *     once in memory, with a spatial index, instead of querying it with
+ *     a spatial filter for each feature of the input layer. This is much faster
+ *     when the method layer has many features, provided it fits in RAM.
+ *     (GDAL >= 3.13)
+ * </li>
+ * <li>NUM_THREADS=integer or ALL_CPUS. Number of threads used to process
+ *     features of the input layer in parallel. Only taken into account when
+ *     INDEX_METHOD_LAYER=YES. Defaults to 1. (GDAL >= 3.13)
+ * </li>
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Update().
@@ -7328,6 +8122,16 @@ OGRErr OGR_L_Update(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>INDEX_METHOD_LAYER=YES/NO. Set to YES to load the method layer
+ *     once in memory, with a spatial index, instead of querying it with
+ *     a spatial filter for each feature of this layer. This is much faster
+ *     when the method layer has many features, provided it fits in RAM.
+ *     (GDAL >= 3.13)
+ * </li>
+ * <li>NUM_THREADS=integer or ALL_CPUS. Number of threads used to process
+ *     features of this layer in parallel. Only taken into account when
+ *     INDEX_METHOD_LAYER=YES. Defaults to 1. (GDAL >= 3.13)
+ * </li>
  * </ul>
  *
  * This method is the same as the C function OGR_L_Clip().
@@ -7390,6 +8194,20 @@ OGRErr OGRLayer::Clip(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         goto done;
 
     poDefnResult = pLayerResult->GetLayerDefn();
+
+    if (CPLTestBool(
+            CSLFetchNameValueDef(papszOptions, "INDEX_METHOD_LAYER", "NO")))
+    {
+        OGRLayerAlgebraIndexedOptions sOptions;
+        sOptions.bSkipFailures = bSkipFailures;
+        sOptions.bPromoteToMulti = bPromoteToMulti;
+        ret = overlay_indexed(OGRLayerAlgebraIndexedOp::CLIP, this,
+                              pLayerMethod, pLayerResult, pGeometryMethodFilter,
+                              mapInput, nullptr, sOptions, papszOptions,
+                              pfnProgress, pProgressArg);
+        goto done;
+    }
+
     for (auto &&x : this)
     {
 
@@ -7560,6 +8378,16 @@ done:
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>INDEX_METHOD_LAYER=YES/NO. Set to YES to load the method layer
+ *     once in memory, with a spatial index, instead of querying it with
+ *     a spatial filter for each feature of the input layer. This is much
+ *     faster when the method layer has many features, provided it fits in
+ *     RAM. (GDAL >= 3.13)
+ * </li>
+ * <li>NUM_THREADS=integer or ALL_CPUS. Number of threads used to process
+ *     features of the input layer in parallel. Only taken into account
+ *     when INDEX_METHOD_LAYER=YES. Defaults to 1. (GDAL >= 3.13)
+ * </li>
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Clip().
@@ -7637,6 +8465,16 @@ OGRErr OGR_L_Clip(OGRLayerH pLayerInput, OGRLayerH pLayerMethod,
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>INDEX_METHOD_LAYER=YES/NO. Set to YES to load the method layer
+ *     once in memory, with a spatial index, instead of querying it with
+ *     a spatial filter for each feature of this layer. This is much faster
+ *     when the method layer has many features, provided it fits in RAM.
+ *     (GDAL >= 3.13)
+ * </li>
+ * <li>NUM_THREADS=integer or ALL_CPUS. Number of threads used to process
+ *     features of this layer in parallel. Only taken into account when
+ *     INDEX_METHOD_LAYER=YES. Defaults to 1. (GDAL >= 3.13)
+ * </li>
  * </ul>
  *
  * This method is the same as the C function OGR_L_Erase().
@@ -7700,6 +8538,19 @@ OGRErr OGRLayer::Erase(OGRLayer *pLayerMethod, OGRLayer *pLayerResult,
         goto done;
     poDefnResult = pLayerResult->GetLayerDefn();
 
+    if (CPLTestBool(
+            CSLFetchNameValueDef(papszOptions, "INDEX_METHOD_LAYER", "NO")))
+    {
+        OGRLayerAlgebraIndexedOptions sOptions;
+        sOptions.bSkipFailures = bSkipFailures;
+        sOptions.bPromoteToMulti = bPromoteToMulti;
+        ret = overlay_indexed(OGRLayerAlgebraIndexedOp::ERASE, this,
+                              pLayerMethod, pLayerResult, pGeometryMethodFilter,
+                              mapInput, nullptr, sOptions, papszOptions,
+                              pfnProgress, pProgressArg);
+        goto done;
+    }
+
     for (auto &&x : this)
     {
 
@@ -7848,6 +8699,16 @@ done:
  * <li>METHOD_PREFIX=string. Set a prefix for the field names that
  *     will be created from the fields of the method layer.
  * </li>
+ * <li>INDEX_METHOD_LAYER=YES/NO. Set to YES to load the method layer
+ *     once in memory, with a spatial index, instead of querying it with
+ *     a spatial filter for each feature of the input layer. This is much
+ *     faster when the method layer has many features, provided it fits in
+ *     RAM. (GDAL >= 3.13)
+ * </li>
+ * <li>NUM_THREADS=integer or ALL_CPUS. Number of threads used to process
+ *     features of the input layer in parallel. Only taken into account
+ *     when INDEX_METHOD_LAYER=YES. Defaults to 1. (GDAL >= 3.13)
+ * </li>
  * </ul>
  *
  * This function is the same as the C++ method OGRLayer::Erase().
@@ -20,6 +20,7 @@
 #include "ogr_wkb.h"
 #include "ogr_p.h"
 #include "ogrlayer_private.h"
+#include "gdal_thread_pool.h"
 
 #include "cpl_float.h"
 #include "cpl_json.h"
@@ -1922,6 +1923,183 @@ FillDateTimeArrayAsString(struct ArrowArray *psChild,
     return nFeatCount;
 }
 
+/************************************************************************/
+/*                    InitParallelArrowArrayStream()                    */
+/************************************************************************/
+
+/** Open, if the NUM_THREADS option of GetArrowStream() requires it, one
+ * clone of the layer per worker thread, so that features can be decoded
+ * concurrently.
+ *
+ * This is only possible on read-only datasets, when no filter is set, and
+ * for layers that support fast feature count and fast SetNextByIndex(), so
+ * that each clone can be positioned at the start of its range.
+ */
+void OGRLayer::InitParallelArrowArrayStream()
+{
+    auto &sPrivateData = *m_poSharedArrowArrayStreamPrivateData;
+    sPrivateData.m_bParallelReadingInitialized = true;
+
+    const char *pszThreads =
+        m_aosArrowArrayStreamOptions.FetchNameValueDef("NUM_THREADS", "1");
+    const int nThreads = std::max(1, std::min(128, EQUAL(pszThreads, "ALL_CPUS")
+                                                       ? CPLGetNumCPUs()
+                                                       : atoi(pszThreads)));
+    if (nThreads <= 1)
+        return;
+
+    GDALDataset *poDS = GetDataset();
+    if (m_poFilterGeom != nullptr || m_poAttrQuery != nullptr ||
+        !sPrivateData.m_anQueriedFIDs.empty() ||
+        !TestCapability(OLCFastFeatureCount) ||
+        !TestCapability(OLCFastSetNextByIndex) || poDS == nullptr ||
+        poDS->GetAccess() != GA_ReadOnly || poDS->GetDriver() == nullptr ||
+        poDS->GetDescription()[0] == '\0')
+    {
+        CPLDebug("OGR",
+                 "NUM_THREADS=%s ignored for layer %s: only supported without "
+                 "filters, on read-only layers with fast feature count and "
+                 "fast SetNextByIndex()",
+                 pszThreads, GetName());
+        return;
+    }
+
+    const GIntBig nFeatureCount = GetFeatureCount(/* bForce = */ true);
+    if (nFeatureCount <= 1)
+        return;
+
+    const auto poLayerDefn = GetLayerDefn();
+    CPLStringList aosIgnoredFields;
+    for (const auto *poFieldDefn : poLayerDefn->GetFields())
+    {
+        if (poFieldDefn->IsIgnored())
+            aosIgnoredFields.AddString(poFieldDefn->GetNameRef());
+    }
+    for (const auto *poGeomFieldDefn : poLayerDefn->GetGeomFields())
+    {
+        if (poGeomFieldDefn->IsIgnored())
+            aosIgnoredFields.AddString(poGeomFieldDefn->GetNameRef());
+    }
+    if (poLayerDefn->IsStyleIgnored())
+        aosIgnoredFields.AddString("OGR_STYLE");
+
+    const char *const apszAllowedDrivers[] = {
+        poDS->GetDriver()->GetDescription(), nullptr};
+    const int nWorkers =
+        static_cast<int>(std::min<GIntBig>(nThreads, nFeatureCount));
+    for (int i = 0; i < nWorkers; ++i)
+    {
+        auto poCloneDS = GDALDatasetUniquePtr(GDALDataset::Open(
+            poDS->GetDescription(), GDAL_OF_VECTOR | GDAL_OF_READONLY,
+            apszAllowedDrivers, poDS->GetOpenOptions()));
+        OGRLayer *poCloneLayer =
+            poCloneDS ? poCloneDS->GetLayerByName(GetName()) : nullptr;
+        // The clones must expose exactly the same schema (field names and
+        // types), as their features are assembled into the same batches.
+        if (!poCloneLayer ||
+            !poCloneLayer->GetLayerDefn()->IsSame(poLayerDefn) ||
+            poCloneLayer->SetIgnoredFields(aosIgnoredFields.List()) !=
+                OGRERR_NONE)
+        {
+            CPLDebug("OGR", "Cannot clone layer %s. Using sequential reading",
+                     GetName());
+            sPrivateData.m_apoParallelLayers.clear();
+            sPrivateData.m_apoParallelDatasets.clear();
+            return;
+        }
+        sPrivateData.m_apoParallelLayers.push_back(poCloneLayer);
+        sPrivateData.m_apoParallelDatasets.push_back(std::move(poCloneDS));
+    }
+
+    CPLDebug("OGR", "Using %d threads to read layer %s", nWorkers, GetName());
+    sPrivateData.m_nParallelFeatureCount = nFeatureCount;
+    sPrivateData.m_nParallelNextIndex = 0;
+}
+
+/************************************************************************/
+/*                 FillArrowArrayFeatureQueueParallel()                 */
+/************************************************************************/
+
+/** Fill the feature queue with up to nMaxBatchSize features, by splitting
+ * the next range of feature indices among the layer clones.
+ *
+ * @return false when the end of the layer has been reached.
+ */
+bool OGRLayer::FillArrowArrayFeatureQueueParallel(size_t nMaxBatchSize)
+{
+    auto &sPrivateData = *m_poSharedArrowArrayStreamPrivateData;
+    auto &oFeatureQueue = sPrivateData.m_oFeatureQueue;
+    if (oFeatureQueue.size() >= nMaxBatchSize)
+        return true;
+    const GIntBig nRemaining = sPrivateData.m_nParallelFeatureCount -
+                               sPrivateData.m_nParallelNextIndex;
+    const GIntBig nToRead = std::min<GIntBig>(
+        nRemaining, static_cast<GIntBig>(nMaxBatchSize - oFeatureQueue.size()));
+    if (nToRead <= 0)
+        return false;
+
+    const int nWorkers = static_cast<int>(std::min<GIntBig>(
+        sPrivateData.m_apoParallelLayers.size(), nToRead));
+    auto poThreadPool = GDALGetGlobalThreadPool(nWorkers);
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (!poJobQueue)
+        return false;
+
+    struct Job
+    {
+        OGRLayer *poLayer = nullptr;
+        GIntBig nStartIndex = 0;
+        GIntBig nCount = 0;
+        std::vector<std::unique_ptr<OGRFeature>> apoFeatures{};
+    };
+
+    std::vector<Job> asJobs(nWorkers);
+    GIntBig nStartIndex = sPrivateData.m_nParallelNextIndex;
+    for (int i = 0; i < nWorkers; ++i)
+    {
+        Job &sJob = asJobs[i];
+        sJob.poLayer = sPrivateData.m_apoParallelLayers[i];
+        sJob.nStartIndex = nStartIndex;
+        sJob.nCount = nToRead / nWorkers + (i < nToRead % nWorkers ? 1 : 0);
+        nStartIndex += sJob.nCount;
+        poJobQueue->SubmitJob(
+            [&sJob]()
+            {
+                if (sJob.poLayer->SetNextByIndex(sJob.nStartIndex) !=
+                    OGRERR_NONE)
+                    return;
+                sJob.apoFeatures.reserve(static_cast<size_t>(sJob.nCount));
+                for (GIntBig j = 0; j < sJob.nCount; ++j)
+                {
+                    auto poFeature = std::unique_ptr<OGRFeature>(
+                        sJob.poLayer->GetNextFeature());
+                    if (!poFeature)
+                        break;
+                    sJob.apoFeatures.push_back(std::move(poFeature));
+                }
+            });
+    }
+    poJobQueue->WaitCompletion();
+
+    bool bRet = true;
+    for (Job &sJob : asJobs)
+    {
+        for (auto &poFeature : sJob.apoFeatures)
+            oFeatureQueue.emplace_back(std::move(poFeature));
+        if (static_cast<GIntBig>(sJob.apoFeatures.size()) != sJob.nCount)
+        {
+            // Feature count was over-estimated, or read error.
+            // Do not try to read further.
+            bRet = false;
+            break;
+        }
+    }
+    sPrivateData.m_nParallelNextIndex = nStartIndex;
+
+    return bRet && sPrivateData.m_nParallelNextIndex <
+                       sPrivateData.m_nParallelFeatureCount;
+}
+
 /************************************************************************/
 /*                          GetNextArrowArray()                         */
 /************************************************************************/
@@ -1998,7 +2176,23 @@ int OGRLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
     }
     else if (!poPrivate->poShared->m_bEOF)
     {
-        while (oFeatureQueue.size() < static_cast<size_t>(nMaxBatchSize))
+        if (!m_poSharedArrowArrayStreamPrivateData
+                 ->m_bParallelReadingInitialized)
+        {
+            InitParallelArrowArrayStream();
+        }
+        if (!m_poSharedArrowArrayStreamPrivateData->m_apoParallelLayers.empty())
+        {
+            if (!FillArrowArrayFeatureQueueParallel(
+                    static_cast<size_t>(nMaxBatchSize)))
+            {
+                poPrivate->poShared->m_bEOF = true;
+            }
+        }
+        const bool bSequential =
+            m_poSharedArrowArrayStreamPrivateData->m_apoParallelLayers.empty();
+        while (bSequential &&
+               oFeatureQueue.size() < static_cast<size_t>(nMaxBatchSize))
         {
             auto poFeature = std::unique_ptr<OGRFeature>(GetNextFeature());
             if (!poFeature)
@@ -2415,6 +2609,14 @@ void OGRLayer::ReleaseStream(struct ArrowArrayStream *stream)
             stream->private_data);
     poPrivate->poShared->m_bArrowArrayStreamInProgress = false;
     poPrivate->poShared->m_bEOF = false;
+    poPrivate->poShared->m_bParallelReadingInitialized = false;
+    if (!poPrivate->poShared->m_apoParallelLayers.empty())
+    {
+        // Features in the queue come from the layer clones
+        poPrivate->poShared->m_oFeatureQueue.clear();
+        poPrivate->poShared->m_apoParallelLayers.clear();
+        poPrivate->poShared->m_apoParallelDatasets.clear();
+    }
     if (poPrivate->poShared->m_poLayer)
         poPrivate->poShared->m_poLayer->ResetReading();
     delete poPrivate;
@@ -2565,6 +2767,14 @@ From OGR using the Arrow C Stream data interface</a> tutorial.
  *     ARROW:extension:name=geoarrow.wkb and
  *     ARROW:extension:metadata={"crs": &lt;projjson CRS representation>&gt; are set.
  * </li>
+ * <li>NUM_THREADS=integer or ALL_CPUS (GDAL >= 3.13). Defaults to 1.
+ *     Number of threads used to decode features. When greater than 1, the
+ *     default implementation opens one clone of the layer per thread and
+ *     each clone decodes a sub-range of each batch. This is only used for
+ *     read-only layers that advertise OLCFastFeatureCount and
+ *     OLCFastSetNextByIndex, and without spatial or attribute filter.
+ *     Reading then always starts from the beginning of the layer.
+ * </li>
  * </ul>
  *
  * The Arrow/Parquet drivers recognize the following option:
@@ -2771,6 +2981,14 @@ YES.</li>
  *     ARROW:extension:name=geoarrow.wkb and
  *     ARROW:extension:metadata={"crs": &lt;projjson CRS representation>&gt; are set.
  * </li>
+ * <li>NUM_THREADS=integer or ALL_CPUS (GDAL >= 3.13). Defaults to 1.
+ *     Number of threads used to decode features. When greater than 1, the
+ *     default implementation opens one clone of the layer per thread and
+ *     each clone decodes a sub-range of each batch. This is only used for
+ *     read-only layers that advertise OLCFastFeatureCount and
+ *     OLCFastSetNextByIndex, and without spatial or attribute filter.
+ *     Reading then always starts from the beginning of the layer.
+ * </li>
  * </ul>
  *
  * The Arrow/Parquet drivers recognize the following option:
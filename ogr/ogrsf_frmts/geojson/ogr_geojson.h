@@ -73,6 +73,7 @@ class OGRGeoJSONLayer final : public OGRMemLayer
 
     void ResetReading() override;
     OGRFeature *GetNextFeature() override;
+    OGRErr SetNextByIndex(GIntBig nIndex) override;
     OGRFeature *GetFeature(GIntBig nFID) override;
     GIntBig GetFeatureCount(int bForce) override;
 
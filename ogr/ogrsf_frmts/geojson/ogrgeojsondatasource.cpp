@@ -14,6 +14,7 @@
 #include "cpl_port.h"
 #include "ogr_geojson.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <cstdlib>
@@ -1149,6 +1150,13 @@ void OGRGeoJSONDataSource::SetOptionsOnReader(GDALOpenInfo *poOpenInfo,
         poOpenInfo->papszOpenOptions, "DATE_AS_STRING",
         CPLGetConfigOption("OGR_GEOJSON_DATE_AS_STRING", "NO"))));
 
+    const char *pszNumThreads =
+        CSLFetchNameValueDef(poOpenInfo->papszOpenOptions, "NUM_THREADS",
+                             CPLGetConfigOption("GDAL_NUM_THREADS", "1"));
+    poReader->SetNumThreads(std::min(128, EQUAL(pszNumThreads, "ALL_CPUS")
+                                              ? CPLGetNumCPUs()
+                                              : atoi(pszNumThreads)));
+
     const char *pszForeignMembers = CSLFetchNameValueDef(
         poOpenInfo->papszOpenOptions, "FOREIGN_MEMBERS", "AUTO");
     if (EQUAL(pszForeignMembers, "AUTO"))
@@ -721,6 +721,9 @@ void RegisterOGRGeoJSON()
         "creating the layer. "
         "The overrides are defined as a JSON list of field definitions. "
         "This can be a filename or a JSON string or a URL.'/>"
+        "  <Option name='NUM_THREADS' type='string' description='Number of "
+        "worker threads used to decode features when reading. Integer or "
+        "ALL_CPUS' default='1'/>"
         "</OpenOptionList>");
 
     poDriver->SetMetadataItem(GDAL_DMD_CREATIONOPTIONLIST,
@@ -163,6 +163,22 @@ OGRFeature *OGRGeoJSONLayer::GetNextFeature()
     }
 }
 
+/************************************************************************/
+/*                           SetNextByIndex()                           */
+/************************************************************************/
+
+OGRErr OGRGeoJSONLayer::SetNextByIndex(GIntBig nIndex)
+{
+    if (poReader_ && !bHasAppendedFeatures_ && poReader_->HasFeatureIndex() &&
+        m_poFilterGeom == nullptr && m_poAttrQuery == nullptr)
+    {
+        nFeatureReadSinceReset_ = nIndex;
+        return poReader_->SetNextByIndex(nIndex) ? OGRERR_NONE
+                                                 : OGRERR_NON_EXISTING_FEATURE;
+    }
+    return OGRMemLayer::SetNextByIndex(nIndex);
+}
+
 /************************************************************************/
 /*                          GetFeatureCount()                           */
 /************************************************************************/
@@ -513,6 +529,9 @@ int OGRGeoJSONLayer::TestCapability(const char *pszCap) const
     else if (EQUAL(pszCap, OLCFastGetExtent) ||
              EQUAL(pszCap, OLCFastGetExtent3D))
         return m_poFilterGeom == nullptr && m_poAttrQuery == nullptr;
+    else if (EQUAL(pszCap, OLCFastSetNextByIndex) && poReader_)
+        return m_poFilterGeom == nullptr && m_poAttrQuery == nullptr &&
+               poReader_->HasFeatureIndex();
     return OGRMemLayer::TestCapability(pszCap);
 }
 
@@ -18,7 +18,11 @@
 #include "ogrlibjsonutils.h"
 #include "ogrjsoncollectionstreamingparser.h"
 #include "ogr_api.h"
+#include "cpl_error_internal.h"
+#include "gdal_thread_pool.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <limits>
 #include <set>
@@ -37,6 +41,7 @@ class OGRGeoJSONReaderStreamingParser final
     std::vector<OGRFeature *> m_apoFeatures{};
     size_t m_nCurFeatureIdx = 0;
     bool m_bOriginalIdModifiedEmitted = false;
+    vsi_l_offset m_nStreamStartOffset = 0;
     std::set<GIntBig> m_oSetUsedFIDs{};
 
     std::map<std::string, int> m_oMapFieldNameToIdx{};
@@ -71,6 +76,12 @@ class OGRGeoJSONReaderStreamingParser final
     {
         m_bOriginalIdModifiedEmitted = b;
     }
+
+    /** Set the file offset of the first byte passed to Parse() */
+    inline void SetStreamStartOffset(vsi_l_offset nOffset)
+    {
+        m_nStreamStartOffset = nOffset;
+    }
 };
 
 /************************************************************************/
@@ -135,6 +146,55 @@ void OGRGeoJSONBaseReader::SetDateAsString(bool bDateAsString)
     bDateAsString_ = bDateAsString;
 }
 
+/************************************************************************/
+/*                            SetNumThreads                             */
+/************************************************************************/
+
+void OGRGeoJSONBaseReader::SetNumThreads(int nNumThreads)
+{
+    m_nNumThreads = std::max(1, nNumThreads);
+}
+
+/************************************************************************/
+/*                   OGRGeoJSONFeatureIndex::Reset()                    */
+/************************************************************************/
+
+void OGRGeoJSONFeatureIndex::Reset()
+{
+    m_anOffset.clear();
+    m_anSize.clear();
+    m_bValid = true;
+}
+
+/************************************************************************/
+/*                    OGRGeoJSONFeatureIndex::Add()                     */
+/************************************************************************/
+
+void OGRGeoJSONFeatureIndex::Add(vsi_l_offset nOffset, GUIntBig nSize)
+{
+    if (!m_bValid)
+        return;
+    if (nSize > std::numeric_limits<uint32_t>::max())
+    {
+        CPLDebug("GeoJSON", "Feature too large to be indexed");
+        Invalidate();
+        return;
+    }
+    m_anOffset.push_back(nOffset);
+    m_anSize.push_back(static_cast<uint32_t>(nSize));
+}
+
+/************************************************************************/
+/*                 OGRGeoJSONFeatureIndex::Invalidate()                 */
+/************************************************************************/
+
+void OGRGeoJSONFeatureIndex::Invalidate()
+{
+    m_bValid = false;
+    std::vector<vsi_l_offset>().swap(m_anOffset);
+    std::vector<uint32_t>().swap(m_anSize);
+}
+
 /************************************************************************/
 /*                           OGRGeoJSONReader                           */
 /************************************************************************/
@@ -282,6 +342,8 @@ void OGRGeoJSONReaderStreamingParser::GotFeature(json_object *poObj,
         {
         }
         m_poLayer->IncFeatureCount();
+        m_oReader.m_oFeatureIndex.Add(
+            m_nStreamStartOffset + GetCurFeatureOffset(), GetCurFeatureSize());
     }
     else
     {
@@ -441,6 +503,7 @@ bool OGRGeoJSONReader::FirstPassReadLayer(OGRGeoJSONDataSource *poDS,
 
     nBufferSize_ = 4096 * 10;
     pabyBuffer_ = static_cast<GByte *>(CPLMalloc(nBufferSize_));
+    m_oFeatureIndex.Reset();
     int nIter = 0;
     bool bThresholdReached = false;
     const GIntBig nMaxBytesFirstPass = CPLAtoGIntBig(
@@ -468,6 +531,7 @@ bool OGRGeoJSONReader::FirstPassReadLayer(OGRGeoJSONDataSource *poDS,
         {
             bFirstSeg_ = false;
             nSkip = SkipPrologEpilogAndUpdateJSonPLikeWrapper(nRead);
+            oParser.SetStreamStartOffset(nSkip);
         }
         if (bFinished && bJSonPLikeWrapper_ && nRead > nSkip)
             nRead--;
@@ -548,6 +612,15 @@ bool OGRGeoJSONReader::FirstPassReadLayer(OGRGeoJSONDataSource *poDS,
 
     bCanEasilyAppend_ = oParser.CanEasilyAppend();
     nTotalFeatureCount_ = poLayer->GetFeatureCount(FALSE);
+
+    // The feature index can only be used when FIDs are the index of features
+    // in the collection, and the file is not going to be modified.
+    if (bThresholdReached || !osFIDColumn.empty() || IsFeatureLevelIdAsFID() ||
+        poDS->IsUpdatable() ||
+        static_cast<GIntBig>(m_oFeatureIndex.size()) != nTotalFeatureCount_)
+    {
+        m_oFeatureIndex.Invalidate();
+    }
     nTotalOGRFeatureMemEstimate_ = oParser.GetTotalOGRFeatureMemEstimate();
 
     json_object *poRootObj = oParser.StealRootObject();
@@ -662,6 +735,61 @@ void OGRGeoJSONReader::ResetReading()
             poStreamingParser_->GetOriginalIdModifiedEmitted();
     delete poStreamingParser_;
     poStreamingParser_ = nullptr;
+
+    // When several threads are available, features are decoded by batches
+    // located through the feature index, rather than by the streaming parser.
+    m_apoPendingFeatures.clear();
+    m_nNextIndexedFeature = (m_nNumThreads > 1 && HasFeatureIndex()) ? 0 : -1;
+}
+
+/************************************************************************/
+/*                           SetNextByIndex()                           */
+/************************************************************************/
+
+bool OGRGeoJSONReader::SetNextByIndex(GIntBig nIndex)
+{
+    CPLAssert(HasFeatureIndex());
+    ResetReading();
+    if (nIndex < 0 || static_cast<GUIntBig>(nIndex) >= m_oFeatureIndex.size())
+    {
+        m_nNextIndexedFeature = static_cast<GIntBig>(m_oFeatureIndex.size());
+        return false;
+    }
+    m_nNextIndexedFeature = nIndex;
+    return true;
+}
+
+/************************************************************************/
+/*                       GetNextIndexedFeature()                        */
+/************************************************************************/
+
+OGRFeature *OGRGeoJSONReader::GetNextIndexedFeature(OGRGeoJSONLayer *poLayer)
+{
+    while (m_apoPendingFeatures.empty())
+    {
+        const size_t nStart = static_cast<size_t>(m_nNextIndexedFeature);
+        if (nStart >= m_oFeatureIndex.size())
+            return nullptr;
+        auto apoFeatures = ReadIndexedFeatures(
+            poLayer, fp_, m_oFeatureIndex, nStart,
+            1000 * static_cast<size_t>(m_nNumThreads));
+        if (apoFeatures.empty())
+        {
+            m_nNextIndexedFeature =
+                static_cast<GIntBig>(m_oFeatureIndex.size());
+            return nullptr;
+        }
+        m_nNextIndexedFeature += static_cast<GIntBig>(apoFeatures.size());
+        for (auto &poFeature : apoFeatures)
+        {
+            if (poFeature)
+                m_apoPendingFeatures.push_back(std::move(poFeature));
+        }
+    }
+
+    OGRFeature *poFeature = m_apoPendingFeatures.front().release();
+    m_apoPendingFeatures.pop_front();
+    return poFeature;
 }
 
 /************************************************************************/
@@ -671,6 +799,9 @@ void OGRGeoJSONReader::ResetReading()
 OGRFeature *OGRGeoJSONReader::GetNextFeature(OGRGeoJSONLayer *poLayer)
 {
     CPLAssert(fp_);
+    if (m_nNextIndexedFeature >= 0)
+        return GetNextIndexedFeature(poLayer);
+
     if (poStreamingParser_ == nullptr)
     {
         poStreamingParser_ = new OGRGeoJSONReaderStreamingParser(
@@ -727,6 +858,19 @@ OGRFeature *OGRGeoJSONReader::GetFeature(OGRGeoJSONLayer *poLayer, GIntBig nFID)
 {
     CPLAssert(fp_);
 
+    if (HasFeatureIndex())
+    {
+        if (nFID < 0 || static_cast<GUIntBig>(nFID) >= m_oFeatureIndex.size())
+            return nullptr;
+
+        // Preserve the position of the streaming parser
+        const vsi_l_offset nCurPos = VSIFTellL(fp_);
+        auto apoFeatures = ReadIndexedFeatures(
+            poLayer, fp_, m_oFeatureIndex, static_cast<size_t>(nFID), 1);
+        VSIFSeekL(fp_, nCurPos, SEEK_SET);
+        return apoFeatures.empty() ? nullptr : apoFeatures[0].release();
+    }
+
     if (oMapFIDToOffsetSize_.empty())
     {
         CPLDebug("GeoJSON",
@@ -2389,10 +2533,9 @@ OGRFeature *OGRGeoJSONBaseReader::ReadFeature(OGRLayer *poLayer,
     }
     else
     {
-        static bool bWarned = false;
-        if (!bWarned)
+        static std::atomic<bool> bWarned{false};
+        if (!bWarned.exchange(true))
         {
-            bWarned = true;
             CPLDebug(
                 "GeoJSON",
                 "Non conformant Feature object. Missing \'geometry\' member.");
@@ -2402,6 +2545,125 @@ OGRFeature *OGRGeoJSONBaseReader::ReadFeature(OGRLayer *poLayer,
     return poFeature;
 }
 
+/************************************************************************/
+/*                        ReadIndexedFeatures()                         */
+/************************************************************************/
+
+/** Read and decode up to nMaxCount features, starting at index nStart of
+ * oIndex. Decoding is spread over GetNumThreads() threads. The FID of each
+ * feature is set to its index. The returned vector has one element per
+ * consumed index entry (nullptr if it could not be decoded), and is empty
+ * in case of I/O error.
+ */
+std::vector<std::unique_ptr<OGRFeature>> OGRGeoJSONBaseReader::
+    ReadIndexedFeatures(OGRLayer *poLayer, VSILFILE *fp,
+                        const OGRGeoJSONFeatureIndex &oIndex, size_t nStart,
+                        size_t nMaxCount)
+{
+    std::vector<std::unique_ptr<OGRFeature>> apoFeatures;
+
+    // Features are contiguous in the file, so read them at once, within a
+    // reasonable memory budget.
+    constexpr vsi_l_offset MAX_BATCH_BYTES = 100 * 1024 * 1024;
+    const vsi_l_offset nStartOffset = oIndex.GetOffset(nStart);
+    size_t nEnd = nStart;
+    vsi_l_offset nEndOffset = nStartOffset;
+    while (nEnd < oIndex.size() && nEnd - nStart < nMaxCount &&
+           (nEnd == nStart ||
+            oIndex.GetEndOffset(nEnd) - nStartOffset <= MAX_BATCH_BYTES))
+    {
+        nEndOffset = oIndex.GetEndOffset(nEnd);
+        ++nEnd;
+    }
+    const size_t nCount = nEnd - nStart;
+
+    std::string osBuffer;
+    if (nEndOffset - nStartOffset > std::numeric_limits<size_t>::max() / 2)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "Too large feature");
+        return apoFeatures;
+    }
+    try
+    {
+        osBuffer.resize(static_cast<size_t>(nEndOffset - nStartOffset));
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate buffer for features");
+        return apoFeatures;
+    }
+    if (VSIFSeekL(fp, nStartOffset, SEEK_SET) != 0 ||
+        VSIFReadL(&osBuffer[0], 1, osBuffer.size(), fp) != osBuffer.size())
+    {
+        CPLError(CE_Failure, CPLE_FileIO,
+                 "Cannot read features at offset " CPL_FRMT_GUIB,
+                 static_cast<GUIntBig>(nStartOffset));
+        return apoFeatures;
+    }
+
+    // Nul-terminate each feature in place, by overwriting the separator
+    // that follows it. The last one is terminated by osBuffer itself.
+    for (size_t i = nStart; i + 1 < nEnd; ++i)
+    {
+        osBuffer[static_cast<size_t>(oIndex.GetEndOffset(i) - nStartOffset)] =
+            '\0';
+    }
+
+    apoFeatures.resize(nCount);
+    const auto DecodeRange = [this, poLayer, &oIndex, &osBuffer, &apoFeatures,
+                              nStart, nStartOffset](size_t iStart, size_t iEnd)
+    {
+        for (size_t i = iStart; i < iEnd; ++i)
+        {
+            const char *pszJSON =
+                osBuffer.c_str() +
+                static_cast<size_t>(oIndex.GetOffset(nStart + i) -
+                                    nStartOffset);
+            json_object *poObj = nullptr;
+            if (!OGRJSonParse(pszJSON, &poObj))
+                continue;
+            if (OGRGeoJSONGetType(poObj) == GeoJSONObject::eFeature)
+            {
+                apoFeatures[i].reset(ReadFeature(poLayer, poObj, pszJSON));
+                apoFeatures[i]->SetFID(static_cast<GIntBig>(nStart + i));
+            }
+            json_object_put(poObj);
+        }
+    };
+
+    auto poThreadPool =
+        m_nNumThreads > 1 ? GDALGetGlobalThreadPool(m_nNumThreads) : nullptr;
+    auto poQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (poQueue && nCount > 1)
+    {
+        CPLErrorAccumulator oErrorAccumulator;
+        const size_t nJobs =
+            std::min(nCount, static_cast<size_t>(m_nNumThreads));
+        const size_t nPerJob = (nCount + nJobs - 1) / nJobs;
+        for (size_t iStart = 0; iStart < nCount; iStart += nPerJob)
+        {
+            const size_t iEnd = std::min(nCount, iStart + nPerJob);
+            poQueue->SubmitJob(
+                [&DecodeRange, &oErrorAccumulator, iStart, iEnd]()
+                {
+                    auto oAccumulator =
+                        oErrorAccumulator.InstallForCurrentScope();
+                    CPL_IGNORE_RET_VAL(oAccumulator);
+                    DecodeRange(iStart, iEnd);
+                });
+        }
+        poQueue->WaitCompletion();
+        oErrorAccumulator.ReplayErrors();
+    }
+    else
+    {
+        DecodeRange(0, nCount);
+    }
+
+    return apoFeatures;
+}
+
 /************************************************************************/
 /*                           Extent getters                             */
 /************************************************************************/
@@ -21,6 +21,9 @@
 #include "ogrgeojsonutils.h"
 #include "directedacyclicgraph.hpp"
 
+#include <cstdint>
+#include <deque>
+#include <memory>
 #include <utility>
 #include <map>
 #include <set>
@@ -44,6 +47,46 @@ class OGRFeature;
 class OGRGeoJSONLayer;
 class OGRSpatialReference;
 
+/************************************************************************/
+/*                        OGRGeoJSONFeatureIndex                        */
+/************************************************************************/
+
+/** Byte range in the file of each Feature object, in the order they are
+ * returned by sequential reading. Features are contiguous in the file and
+ * separated by at least one byte (comma, new line or record separator).
+ */
+class OGRGeoJSONFeatureIndex
+{
+    std::vector<vsi_l_offset> m_anOffset{};
+    std::vector<uint32_t> m_anSize{};
+    bool m_bValid = false;
+
+  public:
+    void Reset();
+    void Add(vsi_l_offset nOffset, GUIntBig nSize);
+    void Invalidate();
+
+    bool IsValid() const
+    {
+        return m_bValid;
+    }
+
+    size_t size() const
+    {
+        return m_anOffset.size();
+    }
+
+    vsi_l_offset GetOffset(size_t i) const
+    {
+        return m_anOffset[i];
+    }
+
+    vsi_l_offset GetEndOffset(size_t i) const
+    {
+        return m_anOffset[i] + m_anSize[i];
+    }
+};
+
 /************************************************************************/
 /*                        OGRGeoJSONBaseReader                          */
 /************************************************************************/
@@ -59,6 +102,7 @@ class OGRGeoJSONBaseReader
     void SetStoreNativeData(bool bStoreNativeData);
     void SetArrayAsString(bool bArrayAsString);
     void SetDateAsString(bool bDateAsString);
+    void SetNumThreads(int nNumThreads);
 
     enum class ForeignMemberProcessing
     {
@@ -85,6 +129,20 @@ class OGRGeoJSONBaseReader
                               const OGRSpatialReference *poLayerSRS);
     OGRFeature *ReadFeature(OGRLayer *poLayer, json_object *poObj,
                             const char *pszSerializedObj);
+    std::vector<std::unique_ptr<OGRFeature>>
+    ReadIndexedFeatures(OGRLayer *poLayer, VSILFILE *fp,
+                        const OGRGeoJSONFeatureIndex &oIndex, size_t nStart,
+                        size_t nMaxCount);
+
+    bool IsFeatureLevelIdAsFID() const
+    {
+        return bFeatureLevelIdAsFID_;
+    }
+
+    int GetNumThreads() const
+    {
+        return m_nNumThreads;
+    }
 
     bool ExtentRead() const;
 
@@ -98,6 +156,7 @@ class OGRGeoJSONBaseReader
     bool bStoreNativeData_ = false;
     bool bArrayAsString_ = false;
     bool bDateAsString_ = false;
+    int m_nNumThreads = 1;
     ForeignMemberProcessing eForeignMemberProcessing_ =
         ForeignMemberProcessing::AUTO;
 
@@ -152,8 +211,16 @@ class OGRGeoJSONReader : public OGRGeoJSONBaseReader
     void ResetReading();
     OGRFeature *GetNextFeature(OGRGeoJSONLayer *poLayer);
     OGRFeature *GetFeature(OGRGeoJSONLayer *poLayer, GIntBig nFID);
+    bool SetNextByIndex(GIntBig nIndex);
     bool IngestAll(OGRGeoJSONLayer *poLayer);
 
+    /** Whether features can be accessed by index without reparsing the
+     * file, in which case feature FIDs are their index */
+    bool HasFeatureIndex() const
+    {
+        return m_oFeatureIndex.IsValid();
+    }
+
     VSILFILE *GetFP()
     {
         return fp_;
@@ -189,6 +256,12 @@ class OGRGeoJSONReader : public OGRGeoJSONBaseReader
 
     std::map<GIntBig, std::pair<vsi_l_offset, vsi_l_offset>>
         oMapFIDToOffsetSize_;
+
+    OGRGeoJSONFeatureIndex m_oFeatureIndex{};
+    // Index of the next feature to read through m_oFeatureIndex, or -1 when
+    // reading through poStreamingParser_
+    GIntBig m_nNextIndexedFeature = -1;
+    std::deque<std::unique_ptr<OGRFeature>> m_apoPendingFeatures{};
     //
     // Copy operations not supported.
     //
@@ -204,6 +277,7 @@ class OGRGeoJSONReader : public OGRGeoJSONBaseReader
 
     void ReadFeatureCollection(OGRGeoJSONLayer *poLayer, json_object *poObj);
     size_t SkipPrologEpilogAndUpdateJSonPLikeWrapper(size_t nRead);
+    OGRFeature *GetNextIndexedFeature(OGRGeoJSONLayer *poLayer);
 };
 
 void OGRGeoJSONGenerateFeatureDefnDealWithID(
@@ -13,6 +13,7 @@
 #include "cpl_port.h"
 #include "cpl_vsi_virtual.h"
 #include "cpl_http.h"
+#include "cpl_multiproc.h"
 #include "cpl_vsi_error.h"
 
 #include "ogr_geojson.h"
@@ -22,6 +23,7 @@
 #include "ogrgeojsongeometry.h"
 
 #include <algorithm>
+#include <deque>
 #include <memory>
 
 constexpr char RS = '\x1e';
@@ -83,14 +85,27 @@ class OGRGeoJSONSeqLayer final : public OGRLayer
     vsi_l_offset m_nFileSize = 0;
     GIntBig m_nIter = 0;
 
+    // File offset of m_osBuffer[0]
+    vsi_l_offset m_nBufferFileOffset = 0;
+    // Byte range of the object returned by the last GetNextObject() call
+    vsi_l_offset m_nObjectFileOffset = 0;
+    size_t m_nObjectSize = 0;
+
     GIntBig m_nTotalFeatures = 0;
     GIntBig m_nNextFID = 0;
 
+    OGRGeoJSONFeatureIndex m_oFeatureIndex{};
+    // Index of the next feature to read through m_oFeatureIndex, or -1 when
+    // reading sequentially through GetNextObject()
+    GIntBig m_nNextIndexedFeature = -1;
+    std::deque<std::unique_ptr<OGRFeature>> m_apoPendingFeatures{};
+
     std::unique_ptr<OGRCoordinateTransformation> m_poCT{};
     OGRGeometryFactory::TransformWithOptionsCache m_oTransformCache;
     OGRGeoJSONWriteOptions m_oWriteOptions;
 
     json_object *GetNextObject(bool bLooseIdentification);
+    OGRFeature *GetNextIndexedFeature();
 
   public:
     OGRGeoJSONSeqLayer(OGRGeoJSONSeqDataSource *poDS, const char *pszName);
@@ -111,6 +126,8 @@ class OGRGeoJSONSeqLayer final : public OGRLayer
 
     void ResetReading() override;
     OGRFeature *GetNextFeature() override;
+    OGRErr SetNextByIndex(GIntBig nIndex) override;
+    OGRFeature *GetFeature(GIntBig nFID) override;
     const OGRFeatureDefn *GetLayerDefn() const override;
 
     const char *GetFIDColumn() const override
@@ -127,6 +144,11 @@ class OGRGeoJSONSeqLayer final : public OGRLayer
     {
         return m_poDS;
     }
+
+    void SetNumThreads(int nNumThreads)
+    {
+        m_oReader.SetNumThreads(nNumThreads);
+    }
 };
 
 /************************************************************************/
@@ -413,6 +435,9 @@ bool OGRGeoJSONSeqLayer::Init(bool bLooseIdentification,
     gdal::DirectedAcyclicGraph<int, std::string> dag;
     bool bOK = false;
 
+    if (bEstablishLayerDefn)
+        m_oFeatureIndex.Reset();
+
     while (true)
     {
         auto poObject = GetNextObject(bLooseIdentification);
@@ -423,6 +448,14 @@ bool OGRGeoJSONSeqLayer::Init(bool bLooseIdentification,
         {
             m_oReader.GenerateFeatureDefn(oMapFieldNameToIdx, apoFieldDefn, dag,
                                           this, poObject);
+            m_oFeatureIndex.Add(m_nObjectFileOffset, m_nObjectSize);
+        }
+        else if (eObjectType != GeoJSONObject::eFeatureCollection &&
+                 eObjectType != GeoJSONObject::eUnknown)
+        {
+            // Bare geometries also consume a FID, but only if they can be
+            // decoded. Do not attempt to index such sequences.
+            m_oFeatureIndex.Invalidate();
         }
         json_object_put(poObject);
         if (!bEstablishLayerDefn)
@@ -445,6 +478,14 @@ bool OGRGeoJSONSeqLayer::Init(bool bLooseIdentification,
         }
         m_poFeatureDefn->Seal(true);
         m_oReader.FinalizeLayerDefn(this, m_osFIDColumn);
+
+        // The feature index can only be used when FIDs are the index of
+        // features in the sequence, and the file is not going to be modified.
+        if (!m_osFIDColumn.empty() || m_oReader.IsFeatureLevelIdAsFID() ||
+            m_poDS->GetAccess() == GA_Update)
+        {
+            m_oFeatureIndex.Invalidate();
+        }
     }
 
     ResetReading();
@@ -481,6 +522,12 @@ void OGRGeoJSONSeqLayer::ResetReading()
     m_nPosInBuffer = nBufferSizeValidated;
     m_nBufferValidSize = nBufferSizeValidated;
     m_nNextFID = 0;
+
+    // When several threads are available, features are decoded by batches
+    // located through the feature index.
+    m_apoPendingFeatures.clear();
+    m_nNextIndexedFeature =
+        (m_oReader.GetNumThreads() > 1 && m_oFeatureIndex.IsValid()) ? 0 : -1;
 }
 
 /************************************************************************/
@@ -499,6 +546,7 @@ json_object *OGRGeoJSONSeqLayer::GetNextObject(bool bLooseIdentification)
             {
                 return nullptr;
             }
+            m_nBufferFileOffset = VSIFTellL(m_poDS->m_fp);
             m_nBufferValidSize =
                 VSIFReadL(&m_osBuffer[0], 1, m_osBuffer.size(), m_poDS->m_fp);
             m_nPosInBuffer = 0;
@@ -525,6 +573,9 @@ json_object *OGRGeoJSONSeqLayer::GetNextObject(bool bLooseIdentification)
             }
         }
 
+        if (m_osFeatureBuffer.empty())
+            m_nObjectFileOffset = m_nBufferFileOffset + m_nPosInBuffer;
+
         // Find next feature separator in buffer
         const size_t nNextSepPos = m_osBuffer.find(
             m_poDS->m_bIsRSSeparated ? RS : '\n', m_nPosInBuffer);
@@ -566,6 +617,7 @@ json_object *OGRGeoJSONSeqLayer::GetNextObject(bool bLooseIdentification)
         }
         if (!m_osFeatureBuffer.empty())
         {
+            m_nObjectSize = m_osFeatureBuffer.size();
             json_object *poObject = nullptr;
             CPL_IGNORE_RET_VAL(
                 OGRJSonParse(m_osFeatureBuffer.c_str(), &poObject));
@@ -601,6 +653,25 @@ OGRFeature *OGRGeoJSONSeqLayer::GetNextFeature()
     }
 
     GetLayerDefn();  // force scan if not already done
+    if (m_nNextIndexedFeature >= 0)
+    {
+        while (true)
+        {
+            OGRFeature *poFeature = GetNextIndexedFeature();
+            if (!poFeature)
+                return nullptr;
+            if ((m_poFilterGeom == nullptr ||
+                 FilterGeometry(
+                     poFeature->GetGeomFieldRef(m_iGeomFieldFilter))) &&
+                (m_poAttrQuery == nullptr ||
+                 m_poAttrQuery->Evaluate(poFeature)))
+            {
+                return poFeature;
+            }
+            delete poFeature;
+        }
+    }
+
     while (true)
     {
         auto poObject = GetNextObject(false);
@@ -648,6 +719,83 @@ OGRFeature *OGRGeoJSONSeqLayer::GetNextFeature()
     }
 }
 
+/************************************************************************/
+/*                       GetNextIndexedFeature()                        */
+/************************************************************************/
+
+OGRFeature *OGRGeoJSONSeqLayer::GetNextIndexedFeature()
+{
+    while (m_apoPendingFeatures.empty())
+    {
+        const size_t nStart = static_cast<size_t>(m_nNextIndexedFeature);
+        if (nStart >= m_oFeatureIndex.size())
+            return nullptr;
+        auto apoFeatures = m_oReader.ReadIndexedFeatures(
+            this, m_poDS->m_fp, m_oFeatureIndex, nStart,
+            1000 * static_cast<size_t>(m_oReader.GetNumThreads()));
+        if (apoFeatures.empty())
+        {
+            m_nNextIndexedFeature =
+                static_cast<GIntBig>(m_oFeatureIndex.size());
+            return nullptr;
+        }
+        m_nNextIndexedFeature += static_cast<GIntBig>(apoFeatures.size());
+        for (auto &poFeature : apoFeatures)
+        {
+            if (poFeature)
+                m_apoPendingFeatures.push_back(std::move(poFeature));
+        }
+    }
+
+    OGRFeature *poFeature = m_apoPendingFeatures.front().release();
+    m_apoPendingFeatures.pop_front();
+    return poFeature;
+}
+
+/************************************************************************/
+/*                           SetNextByIndex()                           */
+/************************************************************************/
+
+OGRErr OGRGeoJSONSeqLayer::SetNextByIndex(GIntBig nIndex)
+{
+    GetLayerDefn();  // force scan if not already done
+    if (!m_oFeatureIndex.IsValid() || m_poFilterGeom != nullptr ||
+        m_poAttrQuery != nullptr)
+    {
+        return OGRLayer::SetNextByIndex(nIndex);
+    }
+
+    ResetReading();
+    if (nIndex < 0 || static_cast<GUIntBig>(nIndex) >= m_oFeatureIndex.size())
+    {
+        m_nNextIndexedFeature = static_cast<GIntBig>(m_oFeatureIndex.size());
+        return OGRERR_NON_EXISTING_FEATURE;
+    }
+    m_nNextIndexedFeature = nIndex;
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                             GetFeature()                             */
+/************************************************************************/
+
+OGRFeature *OGRGeoJSONSeqLayer::GetFeature(GIntBig nFID)
+{
+    GetLayerDefn();  // force scan if not already done
+    if (!m_oFeatureIndex.IsValid())
+        return OGRLayer::GetFeature(nFID);
+
+    if (nFID < 0 || static_cast<GUIntBig>(nFID) >= m_oFeatureIndex.size())
+        return nullptr;
+
+    // Preserve the position of sequential reading
+    const vsi_l_offset nCurPos = VSIFTellL(m_poDS->m_fp);
+    auto apoFeatures = m_oReader.ReadIndexedFeatures(
+        this, m_poDS->m_fp, m_oFeatureIndex, static_cast<size_t>(nFID), 1);
+    VSIFSeekL(m_poDS->m_fp, nCurPos, SEEK_SET);
+    return apoFeatures.empty() ? nullptr : apoFeatures[0].release();
+}
+
 /************************************************************************/
 /*                          GetFeatureCount()                           */
 /************************************************************************/
@@ -675,6 +823,15 @@ int OGRGeoJSONSeqLayer::TestCapability(const char *pszCap) const
     {
         return true;
     }
+    if (EQUAL(pszCap, OLCRandomRead))
+    {
+        return m_oFeatureIndex.IsValid();
+    }
+    if (EQUAL(pszCap, OLCFastSetNextByIndex))
+    {
+        return m_poFilterGeom == nullptr && m_poAttrQuery == nullptr &&
+               m_oFeatureIndex.IsValid();
+    }
     if (EQUAL(pszCap, OLCCreateField) || EQUAL(pszCap, OLCSequentialWrite))
     {
         return m_poDS->GetAccess() == GA_Update;
@@ -859,6 +1016,14 @@ bool OGRGeoJSONSeqDataSource::Open(GDALOpenInfo *poOpenInfo,
     }
     SetDescription(poOpenInfo->pszFilename);
     auto poLayer = new OGRGeoJSONSeqLayer(this, osLayerName.c_str());
+
+    const char *pszNumThreads =
+        CSLFetchNameValueDef(poOpenInfo->papszOpenOptions, "NUM_THREADS",
+                             CPLGetConfigOption("GDAL_NUM_THREADS", "1"));
+    poLayer->SetNumThreads(std::min(128, EQUAL(pszNumThreads, "ALL_CPUS")
+                                             ? CPLGetNumCPUs()
+                                             : atoi(pszNumThreads)));
+
     const bool bLooseIdentification =
         nSrcType == eGeoJSONSourceService &&
         !STARTS_WITH_CI(poOpenInfo->pszFilename, "GeoJSONSeq:");
@@ -1014,6 +1179,14 @@ void RegisterOGRGeoJSONSeq()
     poDriver->SetMetadataItem(GDAL_DMD_HELPTOPIC,
                               "drivers/vector/geojsonseq.html");
 
+    poDriver->SetMetadataItem(
+        GDAL_DMD_OPENOPTIONLIST,
+        "<OpenOptionList>"
+        "  <Option name='NUM_THREADS' type='string' description='Number of "
+        "worker threads used to decode features when reading. Integer or "
+        "ALL_CPUS' default='1'/>"
+        "</OpenOptionList>");
+
     poDriver->SetMetadataItem(
         GDAL_DS_LAYER_CREATIONOPTIONLIST,
         "<LayerCreationOptionList>"
@@ -129,6 +129,7 @@ void OGRJSONCollectionStreamingParser::StartObject()
             m_abFirstMember.push_back(true);
         }
         m_bStartFeature = true;
+        m_nCurFeatureOffset = GetCurrentOffset();
     }
     else if (m_poCurObj)
     {
@@ -170,6 +171,8 @@ void OGRJSONCollectionStreamingParser::EndObject()
 
     if (m_bInFeaturesArray && m_nDepth == 2 && m_poCurObj)
     {
+        m_nCurFeatureSize = GetCurrentOffset() + 1 - m_nCurFeatureOffset;
+
         if (m_bStoreNativeData)
         {
             m_abFirstMember.pop_back();
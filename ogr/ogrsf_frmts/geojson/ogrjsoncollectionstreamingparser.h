@@ -53,6 +53,9 @@ class OGRJSONCollectionStreamingParser CPL_NON_FINAL
     bool m_bStartFeature = false;
     bool m_bEndFeature = false;
 
+    GUIntBig m_nCurFeatureOffset = 0;
+    GUIntBig m_nCurFeatureSize = 0;
+
     void AppendObject(json_object *poNewObj);
 
     CPL_DISALLOW_COPY_ASSIGN(OGRJSONCollectionStreamingParser)
@@ -67,6 +70,19 @@ class OGRJSONCollectionStreamingParser CPL_NON_FINAL
                             const std::string &osJson) = 0;
     virtual void TooComplex() = 0;
 
+    /** Offset in the stream of the opening brace of the feature being
+     * reported by GotFeature() */
+    inline GUIntBig GetCurFeatureOffset() const
+    {
+        return m_nCurFeatureOffset;
+    }
+
+    /** Size in bytes of the feature being reported by GotFeature() */
+    inline GUIntBig GetCurFeatureSize() const
+    {
+        return m_nCurFeatureSize;
+    }
+
     bool m_bHasTopLevelMeasures = false;
 
   public:
@@ -15,7 +15,10 @@
 #include "gdal_alg_priv.h"
 #include "ogrsqlitevfs.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_float.h"
+#include "cpl_multiproc.h"
+#include "gdal_thread_pool.h"
 
 #include <algorithm>
 #include <cmath>
@@ -869,6 +872,23 @@ GByte *GDALGPKGMBTilesLikePseudoDataset::ReadTile(int nRow, int nCol,
     CPLDebug("GPKG", "ReadTile(row=%d, col=%d)", nRow, nCol);
 #endif
 
+    if (!m_oMapPrefetchedTiles.empty())
+    {
+        auto oIter = m_oMapPrefetchedTiles.find(std::make_pair(nRow, nCol));
+        if (oIter != m_oMapPrefetchedTiles.end())
+        {
+            if (oIter->second.abyTileData.empty())
+                FillEmptyTile(pabyData);
+            else
+                memcpy(pabyData, oIter->second.abyTileData.data(),
+                       oIter->second.abyTileData.size());
+            if (pbIsLossyFormat)
+                *pbIsLossyFormat = oIter->second.bIsLossyFormat;
+            m_oMapPrefetchedTiles.erase(oIter);
+            return pabyData;
+        }
+    }
+
     char *pszSQL = sqlite3_mprintf(
         "SELECT tile_data%s FROM \"%w\" "
         "WHERE zoom_level = %d AND tile_row = %d AND tile_column = %d%s",
@@ -980,6 +1000,242 @@ GByte *GDALGPKGMBTilesLikePseudoDataset::ReadTile(int nRow, int nCol,
     return pabyData;
 }
 
+/************************************************************************/
+/*                       ParseNumThreadsOption()                        */
+/************************************************************************/
+
+void GDALGPKGMBTilesLikePseudoDataset::ParseNumThreadsOption(
+    CSLConstList papszOptions)
+{
+    const char *pszNumThreads =
+        CSLFetchNameValueDef(papszOptions, "NUM_THREADS",
+                             CPLGetConfigOption("GDAL_NUM_THREADS", "1"));
+    m_nNumThreads =
+        std::max(1, std::min(128, EQUAL(pszNumThreads, "ALL_CPUS")
+                                      ? CPLGetNumCPUs()
+                                      : atoi(pszNumThreads)));
+}
+
+/************************************************************************/
+/*                           PrefetchTiles()                            */
+/************************************************************************/
+
+/** Fetches the tiles intersecting a RasterIO() request and decodes them in
+ * parallel, so that the IReadBlock() calls that follow only have to copy
+ * them. Returns true if ReleasePrefetchedTiles() must be called once the
+ * request has been served.
+ */
+bool GDALGPKGMBTilesLikePseudoDataset::PrefetchTiles(
+    GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
+    int nBufXSize, int nBufYSize)
+{
+    // In update mode, the tile being assembled in m_pabyCachedTiles or dirty
+    // blocks might be written to the database while the request is served,
+    // which would make prefetched tiles stale. Requests that need resampling
+    // may also be redirected to an overview.
+    if (m_nNumThreads <= 1 || m_bPrefetchActive || eRWFlag != GF_Read ||
+        IGetUpdate() || m_pabyCachedTiles == nullptr ||
+        m_nShiftXPixelsMod != 0 || m_nShiftYPixelsMod != 0 ||
+        nXSize != nBufXSize || nYSize != nBufYSize)
+    {
+        return false;
+    }
+
+    auto poBand =
+        cpl::down_cast<GDALGPKGMBTilesLikeRasterBand *>(IGetRasterBand(1));
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    const int nBlockXStart = nXOff / nBlockXSize;
+    const int nBlockXEnd = (nXOff + nXSize - 1) / nBlockXSize;
+    const int nBlockYStart = nYOff / nBlockYSize;
+    int nBlockYEnd = (nYOff + nYSize - 1) / nBlockYSize;
+    const int nBlocksPerRow = nBlockXEnd - nBlockXStart + 1;
+
+    // Bound the memory used by decoded tiles to a fraction of the block cache
+    const int nTileBands = m_eDT == GDT_Byte ? 4 : 1;
+    const size_t nTileBufferSize = static_cast<size_t>(nBlockXSize) *
+                                   nBlockYSize * m_nDTSize * nTileBands;
+    const GIntBig nMaxTiles = std::max<GIntBig>(
+        1, GDALGetCacheMax64() / 4 / static_cast<GIntBig>(nTileBufferSize));
+    if (nBlocksPerRow > nMaxTiles)
+        return false;
+    nBlockYEnd = static_cast<int>(std::min<GIntBig>(
+        nBlockYEnd, nBlockYStart + nMaxTiles / nBlocksPerRow - 1));
+
+    // Register the tiles whose blocks are not already cached
+    std::map<int, int> oMapDBRowToRow;
+    for (int nBlockY = nBlockYStart; nBlockY <= nBlockYEnd; nBlockY++)
+    {
+        const int nRow = nBlockY + m_nShiftYTiles;
+        if (nRow < 0 || nRow >= m_nTileMatrixHeight)
+            continue;
+        for (int nBlockX = nBlockXStart; nBlockX <= nBlockXEnd; nBlockX++)
+        {
+            const int nCol = nBlockX + m_nShiftXTiles;
+            if (nCol < 0 || nCol >= m_nTileMatrixWidth)
+                continue;
+            GDALRasterBlock *poBlock =
+                poBand->AccessibleTryGetLockedBlockRef(nBlockX, nBlockY);
+            if (poBlock)
+            {
+                poBlock->DropLock();
+                continue;
+            }
+            m_oMapPrefetchedTiles[std::make_pair(nRow, nCol)];
+            oMapDBRowToRow[GetRowFromIntoTopConvention(nRow)] = nRow;
+        }
+    }
+    if (m_oMapPrefetchedTiles.size() < 2)
+    {
+        m_oMapPrefetchedTiles.clear();
+        return false;
+    }
+
+    struct TileToDecode
+    {
+        PrefetchedTile *psTile = nullptr;
+        std::vector<GByte> abyRawData{};
+        double dfTileOffset = 0.0;
+        double dfTileScale = 1.0;
+    };
+
+    std::vector<TileToDecode> asTilesToDecode;
+
+    // Fetch the blobs of all tiles with a single query, on this thread
+    // since the SQLite connection cannot be shared.
+    char *pszSQL = sqlite3_mprintf(
+        "SELECT tile_row, tile_column, tile_data%s FROM \"%w\" "
+        "WHERE zoom_level = %d AND tile_row BETWEEN %d AND %d AND "
+        "tile_column BETWEEN %d AND %d%s",
+        m_eDT != GDT_Byte ? ", id" : "",  // MBTiles do not have an id
+        m_osRasterTable.c_str(), m_nZoomLevel, oMapDBRowToRow.begin()->first,
+        oMapDBRowToRow.rbegin()->first, nBlockXStart + m_nShiftXTiles,
+        nBlockXEnd + m_nShiftXTiles,
+        !m_osWHERE.empty() ? CPLSPrintf(" AND (%s)", m_osWHERE.c_str()) : "");
+    sqlite3_stmt *hStmt = nullptr;
+    int rc = SQLPrepareWithError(IGetDB(), pszSQL, -1, &hStmt, nullptr);
+    sqlite3_free(pszSQL);
+    if (rc != SQLITE_OK)
+    {
+        m_oMapPrefetchedTiles.clear();
+        return false;
+    }
+    std::set<std::pair<int, int>> oSetFetchedTiles;
+    try
+    {
+        while ((rc = sqlite3_step(hStmt)) == SQLITE_ROW)
+        {
+            const auto oIterRow =
+                oMapDBRowToRow.find(sqlite3_column_int(hStmt, 0));
+            if (oIterRow == oMapDBRowToRow.end() ||
+                sqlite3_column_type(hStmt, 2) != SQLITE_BLOB)
+                continue;
+            const auto oKey =
+                std::make_pair(oIterRow->second, sqlite3_column_int(hStmt, 1));
+            auto oIterTile = m_oMapPrefetchedTiles.find(oKey);
+            // Like ReadTile(), only consider the first matching record
+            if (oIterTile == m_oMapPrefetchedTiles.end() ||
+                !oSetFetchedTiles.insert(oKey).second)
+                continue;
+
+            TileToDecode sTile;
+            sTile.psTile = &(oIterTile->second);
+            const GByte *pabyRawData =
+                static_cast<const GByte *>(sqlite3_column_blob(hStmt, 2));
+            sTile.abyRawData.assign(
+                pabyRawData, pabyRawData + sqlite3_column_bytes(hStmt, 2));
+            if (m_eDT != GDT_Byte)
+            {
+                GetTileOffsetAndScale(sqlite3_column_int64(hStmt, 3),
+                                      sTile.dfTileOffset, sTile.dfTileScale);
+            }
+            sTile.psTile->abyTileData.resize(nTileBufferSize);
+            asTilesToDecode.push_back(std::move(sTile));
+        }
+    }
+    catch (const std::bad_alloc &)
+    {
+        rc = SQLITE_NOMEM;
+    }
+    sqlite3_finalize(hStmt);
+    if (rc != SQLITE_DONE)
+    {
+        // Let the regular code path report the error
+        m_oMapPrefetchedTiles.clear();
+        return false;
+    }
+
+    // Make sure the color table is established before ReadTile() is used
+    // concurrently, as this may involve reading a tile.
+    poBand->GetColorTable();
+
+    auto poThreadPool = GDALGetGlobalThreadPool(m_nNumThreads);
+    auto poQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (!poQueue)
+    {
+        m_oMapPrefetchedTiles.clear();
+        return false;
+    }
+
+    CPLErrorAccumulator oErrorAccumulator;
+    for (auto &sTile : asTilesToDecode)
+    {
+        poQueue->SubmitJob(
+            [this, &sTile, &oErrorAccumulator]()
+            {
+                auto oAccumulator = oErrorAccumulator.InstallForCurrentScope();
+                CPL_IGNORE_RET_VAL(oAccumulator);
+
+                const CPLString osMemFileName(
+                    VSIMemGenerateHiddenFilename("gpkg_read_tile"));
+                VSILFILE *fp = VSIFileFromMemBuffer(
+                    osMemFileName.c_str(), sTile.abyRawData.data(),
+                    sTile.abyRawData.size(), FALSE);
+                VSIFCloseL(fp);
+                ReadTile(osMemFileName, sTile.psTile->abyTileData.data(),
+                         sTile.dfTileOffset, sTile.dfTileScale,
+                         &(sTile.psTile->bIsLossyFormat));
+                VSIUnlink(osMemFileName);
+            });
+    }
+    poQueue->WaitCompletion();
+    oErrorAccumulator.ReplayErrors();
+
+    m_bPrefetchActive = true;
+    return true;
+}
+
+/************************************************************************/
+/*                       ReleasePrefetchedTiles()                       */
+/************************************************************************/
+
+void GDALGPKGMBTilesLikePseudoDataset::ReleasePrefetchedTiles()
+{
+    m_oMapPrefetchedTiles.clear();
+    m_bPrefetchActive = false;
+}
+
+/************************************************************************/
+/*                            IRasterIO()                               */
+/************************************************************************/
+
+CPLErr GDALGPKGMBTilesLikeRasterBand::IRasterIO(
+    GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
+    void *pData, int nBufXSize, int nBufYSize, GDALDataType eBufType,
+    GSpacing nPixelSpace, GSpacing nLineSpace,
+    GDALRasterIOExtraArg *psExtraArg)
+{
+    const bool bPrefetched = m_poTPD->PrefetchTiles(
+        eRWFlag, nXOff, nYOff, nXSize, nYSize, nBufXSize, nBufYSize);
+    const CPLErr eErr = GDALPamRasterBand::IRasterIO(
+        eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
+        eBufType, nPixelSpace, nLineSpace, psExtraArg);
+    if (bPrefetched)
+        m_poTPD->ReleasePrefetchedTiles();
+    return eErr;
+}
+
 /************************************************************************/
 /*                         IReadBlock()                                 */
 /************************************************************************/
@@ -17,6 +17,10 @@
 #include "gdal_pam.h"
 #include <sqlite3.h>
 
+#include <map>
+#include <utility>
+#include <vector>
+
 typedef struct
 {
     int nRow;
@@ -93,10 +97,25 @@ class GDALGPKGMBTilesLikePseudoDataset /* non final */
 
     int m_nTileInsertionCount = 0;
 
+    // Number of threads used to decode tiles in RasterIO() requests
+    int m_nNumThreads = 1;
+
     GDALGPKGMBTilesLikePseudoDataset *m_poParentDS = nullptr;
 
   private:
     bool m_bInWriteTile = false;
+
+    struct PrefetchedTile
+    {
+        std::vector<GByte> abyTileData{};  // empty for a missing tile
+        bool bIsLossyFormat = false;
+    };
+
+    // Tiles decoded ahead of IReadBlock() by PrefetchTiles(), indexed by
+    // (row, column)
+    std::map<std::pair<int, int>, PrefetchedTile> m_oMapPrefetchedTiles{};
+    bool m_bPrefetchActive = false;
+
     CPLErr WriteTileInternal(); /* should only be called by WriteTile() */
     GIntBig GetTileId(int nRow, int nCol);
     bool DeleteTile(int nRow, int nCol);
@@ -123,6 +142,11 @@ class GDALGPKGMBTilesLikePseudoDataset /* non final */
 
     CPLErr WriteTile();
 
+    void ParseNumThreadsOption(CSLConstList papszOptions);
+    bool PrefetchTiles(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
+                       int nYSize, int nBufXSize, int nBufYSize);
+    void ReleasePrefetchedTiles();
+
     CPLErr FlushTiles();
     CPLErr FlushRemainingShiftedTiles(bool bPartialFlush);
     CPLErr WriteShiftedTile(int nRow, int nCol, int iBand, int nDstXOffset,
@@ -164,6 +188,12 @@ class GDALGPKGMBTilesLikeRasterBand /* non final*/ : public GDALPamRasterBand
                                void *pData) override;
     CPLErr FlushCache(bool bAtClosing) override;
 
+    CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
+                     int nYSize, void *pData, int nBufXSize, int nBufYSize,
+                     GDALDataType eBufType, GSpacing nPixelSpace,
+                     GSpacing nLineSpace,
+                     GDALRasterIOExtraArg *psExtraArg) override;
+
     int IGetDataCoverageStatus(int nXOff, int nYOff, int nXSize, int nYSize,
                                int nMaskFlagStop, double *pdfDataPct) override;
 
@@ -695,6 +695,14 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
     bool m_bInsertStatementWithUpsert = false;
     std::string m_osInsertStatementUpsertUniqueColumnName{};
     sqlite3_stmt *m_poInsertStatement = nullptr;
+    // Multi-row insert statement used when OGR_GPKG_BULK_INSERT_BATCH_SIZE
+    // is set. m_nBulkInsertBatchSize is -1 until the option has been read.
+    sqlite3_stmt *m_hBulkInsertStatement = nullptr;
+    int m_nBulkInsertBatchSize = -1;
+    int m_nBulkInsertParamsPerRow = 0;
+    int m_nBulkInsertRowsPerStatement = 0;
+    int m_nBulkInsertPendingRows = 0;
+    GIntBig m_nBulkInsertNextFID = -1;
     sqlite3_stmt *m_poGetFeatureStatement = nullptr;
     bool m_bDeferredSpatialIndexCreation = false;
     // m_bHasSpatialIndex cannot be bool.  -1 is unset.
@@ -796,6 +804,11 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
 
     OGRErr CreateOrUpsertFeature(OGRFeature *poFeature, bool bUpsert);
 
+    bool PrepareBulkInsertStatement(OGRFeature *poFeature);
+    bool ComputeBulkInsertNextFID();
+    OGRErr BulkInsertFeature(OGRFeature *poFeature, GIntBig &nFID);
+    void DiscardPendingBulkInsert();
+
     GIntBig GetTotalFeatureCount();
 
     CPL_DISALLOW_COPY_ASSIGN(OGRGeoPackageTableLayer)
@@ -981,6 +994,7 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
     bool DoJobAtTransactionCommit();
     bool DoJobAtTransactionRollback();
     bool RunDeferredSpatialIndexUpdate();
+    bool FlushPendingBulkInsert();
 
 #ifdef ENABLE_GPKG_OGR_CONTENTS
     bool GetAddOGRFeatureCountTriggers() const
@@ -1037,7 +1051,9 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
                                  bool bBindUnsetFields, int nUpdatedFieldsCount,
                                  const int *panUpdatedFieldsIdx,
                                  int nUpdatedGeomFieldsCount,
-                                 const int *panUpdatedGeomFieldsIdx);
+                                 const int *panUpdatedGeomFieldsIdx,
+                                 int nFirstParam = 1,
+                                 bool bCopyValues = false);
 
     void UpdateContentsToNullExtent();
 
@@ -1085,10 +1085,14 @@ CPLErr GDALGeoPackageDataset::IRasterIO(
     GSpacing nLineSpace, GSpacing nBandSpace, GDALRasterIOExtraArg *psExtraArg)
 
 {
+    const bool bPrefetched = PrefetchTiles(eRWFlag, nXOff, nYOff, nXSize,
+                                           nYSize, nBufXSize, nBufYSize);
     CPLErr eErr = OGRSQLiteBaseDataSource::IRasterIO(
         eRWFlag, nXOff, nYOff, nXSize, nYSize, pData, nBufXSize, nBufYSize,
         eBufType, nBandCount, panBandMap, nPixelSpace, nLineSpace, nBandSpace,
         psExtraArg);
+    if (bPrefetched)
+        ReleasePrefetchedTiles();
 
     // If writing all bands, in non-shifted mode, flush all entirely written
     // tiles This can avoid "stressing" the block cache with too many dirty
@@ -2526,6 +2530,7 @@ bool GDALGeoPackageDataset::InitRaster(
         m_nQuality = poParentDS->m_nQuality;
         m_nZLevel = poParentDS->m_nZLevel;
         m_bDither = poParentDS->m_bDither;
+        m_nNumThreads = poParentDS->m_nNumThreads;
         /*m_nSRID = poParentDS->m_nSRID;*/
         m_osWHERE = poParentDS->m_osWHERE;
         SetDescription(CPLSPrintf("%s - zoom_level=%d",
@@ -2994,6 +2999,7 @@ bool GDALGeoPackageDataset::OpenRaster(
     }
 
     ParseCompressionOptions(papszOpenOptionsIn);
+    ParseNumThreadsOption(papszOpenOptionsIn);
 
     m_osWHERE = CSLFetchNameValueDef(papszOpenOptionsIn, "WHERE", "");
 
@@ -7623,6 +7629,13 @@ OGRLayer *GDALGeoPackageDataset::ExecuteSQL(const char *pszSQLCommand,
         return GDALDataset::ExecuteSQL(osSQLCommand, poSpatialFilter,
                                        pszDialect);
 
+    // Rows queued in bulk insert mode must be visible to the statement
+    for (auto &poLayer : m_apoLayers)
+    {
+        if (!poLayer->FlushPendingBulkInsert())
+            return nullptr;
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Prepare statement.                                              */
     /* -------------------------------------------------------------------- */
@@ -721,6 +721,9 @@ void RegisterOGRGeoPackage()
         "interest' default='NO'/>"
         "  <Option name='WHERE' type='string' scope='raster' description='SQL "
         "WHERE clause to be appended to tile requests'/>" COMPRESSION_OPTIONS
+        "  <Option name='NUM_THREADS' type='string' scope='raster' "
+        "description='Number of worker threads used to decode tiles when "
+        "reading. Integer or ALL_CPUS' default='1'/>"
         "  <Option name='PRELUDE_STATEMENTS' type='string' "
         "scope='raster,vector' description='SQL statement(s) to send on the "
         "SQLite connection before any other ones'/>"
@@ -214,11 +214,11 @@ OGRErr OGRGeoPackageTableLayer::FeatureBindParameters(
     OGRFeature *poFeature, sqlite3_stmt *poStmt, int *pnColCount, bool bAddFID,
     bool bBindUnsetFields, int nUpdatedFieldsCount,
     const int *panUpdatedFieldsIdx, int nUpdatedGeomFieldsCount,
-    const int * /*panUpdatedGeomFieldsIdx*/)
+    const int * /*panUpdatedGeomFieldsIdx*/, int nFirstParam, bool bCopyValues)
 {
     const OGRFeatureDefn *poFeatureDefn = poFeature->GetDefnRef();
 
-    int nColCount = 1;
+    int nColCount = nFirstParam;
     if (bAddFID)
     {
         int err = sqlite3_bind_int64(poStmt, nColCount++, poFeature->GetFID());
@@ -348,8 +348,9 @@ OGRErr OGRGeoPackageTableLayer::FeatureBindParameters(
                     int szBlob = 0;
                     GByte *pabyBlob =
                         poFeature->GetFieldAsBinary(iField, &szBlob);
-                    err = sqlite3_bind_blob(poStmt, nColCount++, pabyBlob,
-                                            szBlob, SQLITE_STATIC);
+                    err = sqlite3_bind_blob(
+                        poStmt, nColCount++, pabyBlob, szBlob,
+                        bCopyValues ? SQLITE_TRANSIENT : SQLITE_STATIC);
                     break;
                 }
                 default:
@@ -526,6 +527,10 @@ OGRErr OGRGeoPackageTableLayer::FeatureBindParameters(
                         pszVal = poFeature->GetFieldAsString(iField);
                     }
 
+                    // Values bound by a bulk insert statement must outlive
+                    // the feature and m_osInsertionBuffer
+                    if (bCopyValues && destructorType == SQLITE_STATIC)
+                        destructorType = SQLITE_TRANSIENT;
                     err = sqlite3_bind_text(poStmt, nColCount++, pszVal,
                                             nValLengthBytes, destructorType);
                     break;
@@ -1537,6 +1542,9 @@ OGRGeoPackageTableLayer::~OGRGeoPackageTableLayer()
     if (m_poInsertStatement)
         sqlite3_finalize(m_poInsertStatement);
 
+    if (m_hBulkInsertStatement)
+        sqlite3_finalize(m_hBulkInsertStatement);
+
     if (m_poGetFeatureStatement)
         sqlite3_finalize(m_poGetFeatureStatement);
 
@@ -1789,6 +1797,9 @@ OGRErr OGRGeoPackageTableLayer::CreateField(const OGRFieldDefn *poField,
 
     if (!m_bDeferredCreation)
     {
+        if (!FlushPendingBulkInsert())
+            return OGRERR_FAILURE;
+
         CPLString osCommand;
 
         // ADD COLUMN has several restrictions
@@ -2472,90 +2483,136 @@ OGRErr OGRGeoPackageTableLayer::CreateOrUpsertFeature(OGRFeature *poFeature,
         }
     }
 
-    /* If there's a unset field with a default value, then we must create */
-    /* a specific INSERT statement to avoid unset fields to be bound to NULL */
-    if (m_poInsertStatement &&
-        (bHasDefaultValue ||
-         m_bInsertStatementWithFID != (poFeature->GetFID() != OGRNullFID) ||
-         m_bInsertStatementWithUpsert != bUpsert ||
-         m_osInsertStatementUpsertUniqueColumnName != osUpsertUniqueColumnName))
+    // In bulk insert mode, rows are accumulated in a multi-row INSERT
+    // statement, and FIDs are assigned here. Features with unset fields that
+    // have a default value need a specific statement, so they go through the
+    // regular path.
+    if (m_nBulkInsertBatchSize < 0)
     {
-        sqlite3_finalize(m_poInsertStatement);
-        m_poInsertStatement = nullptr;
+        m_nBulkInsertBatchSize = std::max(
+            0,
+            atoi(CPLGetConfigOption("OGR_GPKG_BULK_INSERT_BATCH_SIZE", "0")));
     }
+    bool bBulkInsert =
+        !bUpsert && !bHasDefaultValue && m_nBulkInsertBatchSize > 1 &&
+        m_pszFidColumn != nullptr &&
+        poFeature->GetFID() != std::numeric_limits<GIntBig>::max() &&
+        PrepareBulkInsertStatement(poFeature);
 
-    if (!m_poInsertStatement)
+    // An explicit FID that is not greater than all existing and queued FIDs
+    // might conflict with one of them. Such a feature goes through the
+    // regular path, once the queue is flushed, so that a conflict is
+    // reported for that feature only.
+    if (bBulkInsert && poFeature->GetFID() != OGRNullFID)
     {
-        /* Construct a SQL INSERT statement from the OGRFeature */
-        /* Only work with fields that are set */
-        /* Do not stick values into SQL, use placeholder and bind values later
-         */
-        m_bInsertStatementWithFID = poFeature->GetFID() != OGRNullFID;
-        m_bInsertStatementWithUpsert = bUpsert;
-        m_osInsertStatementUpsertUniqueColumnName = osUpsertUniqueColumnName;
-        CPLString osCommand = FeatureGenerateInsertSQL(
-            poFeature, m_bInsertStatementWithFID, !bHasDefaultValue, bUpsert,
-            osUpsertUniqueColumnName);
-
-        /* Prepare the SQL into a statement */
-        sqlite3 *poDb = m_poDS->GetDB();
-        int err = SQLPrepareWithError(poDb, osCommand, -1, &m_poInsertStatement,
-                                      nullptr);
-        if (err != SQLITE_OK)
-        {
+        if (!ComputeBulkInsertNextFID())
             return OGRERR_FAILURE;
-        }
+        if (poFeature->GetFID() < m_nBulkInsertNextFID)
+            bBulkInsert = false;
     }
 
-    /* Bind values onto the statement now */
-    OGRErr errOgr = FeatureBindInsertParameters(poFeature, m_poInsertStatement,
-                                                m_bInsertStatementWithFID,
-                                                !bHasDefaultValue);
-    if (errOgr != OGRERR_NONE)
+    GIntBig nFID = OGRNullFID;
+    if (bBulkInsert)
     {
-        sqlite3_reset(m_poInsertStatement);
-        sqlite3_clear_bindings(m_poInsertStatement);
-        sqlite3_finalize(m_poInsertStatement);
-        m_poInsertStatement = nullptr;
-        return errOgr;
+        const OGRErr errOgr = BulkInsertFeature(poFeature, nFID);
+        if (errOgr != OGRERR_NONE)
+            return errOgr;
     }
+    else
+    {
+        if (!FlushPendingBulkInsert())
+            return OGRERR_FAILURE;
 
-    /* From here execute the statement and check errors */
-    const int err = sqlite3_step(m_poInsertStatement);
-    if (!(err == SQLITE_OK || err == SQLITE_DONE
+        /* If there's a unset field with a default value, then we must */
+        /* create a specific INSERT statement to avoid unset fields to be */
+        /* bound to NULL */
+        if (m_poInsertStatement &&
+            (bHasDefaultValue ||
+             m_bInsertStatementWithFID !=
+                 (poFeature->GetFID() != OGRNullFID) ||
+             m_bInsertStatementWithUpsert != bUpsert ||
+             m_osInsertStatementUpsertUniqueColumnName !=
+                 osUpsertUniqueColumnName))
+        {
+            sqlite3_finalize(m_poInsertStatement);
+            m_poInsertStatement = nullptr;
+        }
+
+        if (!m_poInsertStatement)
+        {
+            /* Construct a SQL INSERT statement from the OGRFeature */
+            /* Only work with fields that are set */
+            /* Do not stick values into SQL, use placeholder and bind values
+             * later */
+            m_bInsertStatementWithFID = poFeature->GetFID() != OGRNullFID;
+            m_bInsertStatementWithUpsert = bUpsert;
+            m_osInsertStatementUpsertUniqueColumnName =
+                osUpsertUniqueColumnName;
+            CPLString osCommand = FeatureGenerateInsertSQL(
+                poFeature, m_bInsertStatementWithFID, !bHasDefaultValue,
+                bUpsert, osUpsertUniqueColumnName);
+
+            /* Prepare the SQL into a statement */
+            sqlite3 *poDb = m_poDS->GetDB();
+            int err = SQLPrepareWithError(poDb, osCommand, -1,
+                                          &m_poInsertStatement, nullptr);
+            if (err != SQLITE_OK)
+            {
+                return OGRERR_FAILURE;
+            }
+        }
+
+        /* Bind values onto the statement now */
+        OGRErr errOgr = FeatureBindInsertParameters(
+            poFeature, m_poInsertStatement, m_bInsertStatementWithFID,
+            !bHasDefaultValue);
+        if (errOgr != OGRERR_NONE)
+        {
+            sqlite3_reset(m_poInsertStatement);
+            sqlite3_clear_bindings(m_poInsertStatement);
+            sqlite3_finalize(m_poInsertStatement);
+            m_poInsertStatement = nullptr;
+            return errOgr;
+        }
+
+        /* From here execute the statement and check errors */
+        const int err = sqlite3_step(m_poInsertStatement);
+        if (!(err == SQLITE_OK || err == SQLITE_DONE
 #if SQLITE_VERSION_NUMBER >= 3035000L
-          || err == SQLITE_ROW
+              || err == SQLITE_ROW
 #endif
-          ))
-    {
-        CPLError(CE_Failure, CPLE_AppDefined, "failed to execute insert : %s",
-                 sqlite3_errmsg(m_poDS->GetDB())
-                     ? sqlite3_errmsg(m_poDS->GetDB())
-                     : "");
-        sqlite3_reset(m_poInsertStatement);
-        sqlite3_clear_bindings(m_poInsertStatement);
-        sqlite3_finalize(m_poInsertStatement);
-        m_poInsertStatement = nullptr;
-        return OGRERR_FAILURE;
-    }
+              ))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "failed to execute insert : %s",
+                     sqlite3_errmsg(m_poDS->GetDB())
+                         ? sqlite3_errmsg(m_poDS->GetDB())
+                         : "");
+            sqlite3_reset(m_poInsertStatement);
+            sqlite3_clear_bindings(m_poInsertStatement);
+            sqlite3_finalize(m_poInsertStatement);
+            m_poInsertStatement = nullptr;
+            return OGRERR_FAILURE;
+        }
 
-    /* Read the latest FID value */
-    const GIntBig nFID = (bUpsert && !osUpsertUniqueColumnName.empty())
-                             ?
+        /* Read the latest FID value */
+        nFID = (bUpsert && !osUpsertUniqueColumnName.empty())
+                   ?
 #if SQLITE_VERSION_NUMBER >= 3035000L
-                             sqlite3_column_int64(m_poInsertStatement, 0)
+                   sqlite3_column_int64(m_poInsertStatement, 0)
 #else
-                             OGRNullFID
+                   OGRNullFID
 #endif
-                             : sqlite3_last_insert_rowid(m_poDS->GetDB());
+                   : sqlite3_last_insert_rowid(m_poDS->GetDB());
 
-    sqlite3_reset(m_poInsertStatement);
-    sqlite3_clear_bindings(m_poInsertStatement);
+        sqlite3_reset(m_poInsertStatement);
+        sqlite3_clear_bindings(m_poInsertStatement);
 
-    if (bHasDefaultValue)
-    {
-        sqlite3_finalize(m_poInsertStatement);
-        m_poInsertStatement = nullptr;
+        if (bHasDefaultValue)
+        {
+            sqlite3_finalize(m_poInsertStatement);
+            m_poInsertStatement = nullptr;
+        }
     }
 
     if (nFID != OGRNullFID)
@@ -2690,6 +2747,197 @@ OGRErr OGRGeoPackageTableLayer::ICreateFeature(OGRFeature *poFeature)
     return CreateOrUpsertFeature(poFeature, /* bUpsert=*/false);
 }
 
+/************************************************************************/
+/*                    PrepareBulkInsertStatement()                      */
+/************************************************************************/
+
+// Prepare a statement of the form
+// INSERT INTO t (fid, geom, ...) SELECT * FROM (VALUES (?,?,...),(?,?,...))
+// WHERE column1 IS NOT NULL
+// Rows whose FID parameter is left unbound are skipped, which enables the
+// same statement to be used to flush an incomplete batch.
+bool OGRGeoPackageTableLayer::PrepareBulkInsertStatement(OGRFeature *poFeature)
+{
+    if (m_hBulkInsertStatement)
+        return true;
+
+    const std::string osSQL = FeatureGenerateInsertSQL(
+        poFeature, /* bAddFID = */ true, /* bBindUnsetFields = */ true,
+        /* bUpsert = */ false, std::string());
+    const auto nPos = osSQL.rfind(") VALUES (");
+    if (nPos == std::string::npos)
+    {
+        m_nBulkInsertBatchSize = 0;
+        return false;
+    }
+    const std::string osRow = osSQL.substr(nPos + strlen(") VALUES "));
+    const int nParamsPerRow =
+        static_cast<int>(std::count(osRow.begin(), osRow.end(), '?'));
+    const int nMaxParams =
+        sqlite3_limit(m_poDS->GetDB(), SQLITE_LIMIT_VARIABLE_NUMBER, -1);
+    const int nRowsPerStatement = std::min(
+        m_nBulkInsertBatchSize, nMaxParams / std::max(1, nParamsPerRow));
+    if (nRowsPerStatement < 2)
+    {
+        CPLDebug("GPKG", "Too many columns in %s for bulk insert mode",
+                 m_pszTableName);
+        m_nBulkInsertBatchSize = 0;
+        return false;
+    }
+
+    std::string osBulkSQL(osSQL.substr(0, nPos + 1));
+    osBulkSQL += " SELECT * FROM (VALUES ";
+    for (int i = 0; i < nRowsPerStatement; ++i)
+    {
+        if (i > 0)
+            osBulkSQL += ',';
+        osBulkSQL += osRow;
+    }
+    osBulkSQL += ") WHERE column1 IS NOT NULL";
+
+    if (SQLPrepareWithError(m_poDS->GetDB(), osBulkSQL.c_str(), -1,
+                            &m_hBulkInsertStatement, nullptr) != SQLITE_OK)
+    {
+        m_hBulkInsertStatement = nullptr;
+        m_nBulkInsertBatchSize = 0;
+        return false;
+    }
+
+    m_nBulkInsertParamsPerRow = nParamsPerRow;
+    m_nBulkInsertRowsPerStatement = nRowsPerStatement;
+    m_nBulkInsertPendingRows = 0;
+    return true;
+}
+
+/************************************************************************/
+/*                      ComputeBulkInsertNextFID()                      */
+/************************************************************************/
+
+// Computes, if not already done, the FID assigned to the next feature
+// without FID queued in bulk insert mode. All existing and queued FIDs are
+// lower than it.
+bool OGRGeoPackageTableLayer::ComputeBulkInsertNextFID()
+{
+    if (m_nBulkInsertNextFID < 0)
+    {
+        // Emulate the AUTOINCREMENT behavior of the FID column, taking into
+        // account rows that would have been deleted.
+        CPLPushErrorHandler(CPLQuietErrorHandler);
+        OGRErr err = OGRERR_NONE;
+        GIntBig nMaxFID = SQLGetInteger64(
+            m_poDS->GetDB(),
+            CPLSPrintf("SELECT seq FROM sqlite_sequence WHERE name = '%s'",
+                       SQLEscapeLiteral(m_pszTableName).c_str()),
+            &err);
+        CPLPopErrorHandler();
+        if (err != OGRERR_NONE)
+        {
+            CPLErrorReset();
+            nMaxFID = 0;
+        }
+        const GIntBig nMaxExistingFID = SQLGetInteger64(
+            m_poDS->GetDB(),
+            CPLSPrintf("SELECT MAX(\"%s\") FROM \"%s\"",
+                       SQLEscapeName(m_pszFidColumn).c_str(),
+                       SQLEscapeName(m_pszTableName).c_str()),
+            nullptr);
+        nMaxFID = std::max(nMaxFID, nMaxExistingFID);
+        if (nMaxFID == std::numeric_limits<GIntBig>::max())
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Cannot assign a new FID: maximum value reached");
+            return false;
+        }
+        m_nBulkInsertNextFID = nMaxFID + 1;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                        BulkInsertFeature()                           */
+/************************************************************************/
+
+OGRErr OGRGeoPackageTableLayer::BulkInsertFeature(OGRFeature *poFeature,
+                                                  GIntBig &nFID)
+{
+    if (!ComputeBulkInsertNextFID())
+        return OGRERR_FAILURE;
+
+    const GIntBig nOldFID = poFeature->GetFID();
+    if (nOldFID == OGRNullFID)
+        poFeature->SetFID(m_nBulkInsertNextFID);
+
+    const int nFirstParam =
+        1 + m_nBulkInsertPendingRows * m_nBulkInsertParamsPerRow;
+    const OGRErr errOgr = FeatureBindParameters(
+        poFeature, m_hBulkInsertStatement, nullptr, /* bAddFID = */ true,
+        /* bBindUnsetFields = */ true, -1, nullptr, -1, nullptr, nFirstParam,
+        /* bCopyValues = */ true);
+    if (errOgr != OGRERR_NONE)
+    {
+        poFeature->SetFID(nOldFID);
+        sqlite3_bind_null(m_hBulkInsertStatement, nFirstParam);
+        return errOgr;
+    }
+
+    nFID = poFeature->GetFID();
+    if (nFID >= m_nBulkInsertNextFID)
+        m_nBulkInsertNextFID = nFID + 1;
+
+    ++m_nBulkInsertPendingRows;
+    if (m_nBulkInsertPendingRows == m_nBulkInsertRowsPerStatement)
+    {
+        // Keep m_nBulkInsertNextFID valid for the next batch
+        const GIntBig nNextFID = m_nBulkInsertNextFID;
+        if (!FlushPendingBulkInsert())
+            return OGRERR_FAILURE;
+        m_nBulkInsertNextFID = nNextFID;
+    }
+
+    return OGRERR_NONE;
+}
+
+/************************************************************************/
+/*                      FlushPendingBulkInsert()                        */
+/************************************************************************/
+
+bool OGRGeoPackageTableLayer::FlushPendingBulkInsert()
+{
+    m_nBulkInsertNextFID = -1;
+    if (m_nBulkInsertPendingRows == 0)
+        return true;
+    m_nBulkInsertPendingRows = 0;
+
+    const int err = sqlite3_step(m_hBulkInsertStatement);
+    const bool bRet = err == SQLITE_DONE;
+    if (!bRet)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "failed to execute bulk insert : %s",
+                 sqlite3_errmsg(m_poDS->GetDB())
+                     ? sqlite3_errmsg(m_poDS->GetDB())
+                     : "");
+    }
+    sqlite3_reset(m_hBulkInsertStatement);
+    sqlite3_clear_bindings(m_hBulkInsertStatement);
+    return bRet;
+}
+
+/************************************************************************/
+/*                     DiscardPendingBulkInsert()                       */
+/************************************************************************/
+
+void OGRGeoPackageTableLayer::DiscardPendingBulkInsert()
+{
+    if (m_hBulkInsertStatement)
+    {
+        sqlite3_reset(m_hBulkInsertStatement);
+        sqlite3_clear_bindings(m_hBulkInsertStatement);
+    }
+    m_nBulkInsertPendingRows = 0;
+    m_nBulkInsertNextFID = -1;
+}
+
 /************************************************************************/
 /*                  SetDeferredSpatialIndexCreation()                   */
 /************************************************************************/
@@ -3491,6 +3739,13 @@ void OGRGeoPackageTableLayer::ResetReading()
 
     OGRGeoPackageLayer::ResetReading();
 
+    FlushPendingBulkInsert();
+    if (m_hBulkInsertStatement)
+    {
+        sqlite3_finalize(m_hBulkInsertStatement);
+        m_hBulkInsertStatement = nullptr;
+    }
+
     if (m_poInsertStatement)
     {
         sqlite3_finalize(m_poInsertStatement);
@@ -3552,6 +3807,9 @@ OGRErr OGRGeoPackageTableLayer::ResetStatementInternal(GIntBig nStartIndex)
 {
     ClearStatement();
 
+    if (!FlushPendingBulkInsert())
+        return OGRERR_FAILURE;
+
     /* There is no active query statement set up, */
     /* so job #1 is to prepare the statement. */
     /* Append the attribute filter, if there is one */
@@ -3636,6 +3894,8 @@ OGRFeature *OGRGeoPackageTableLayer::GetNextFeature()
         return nullptr;
 
     CancelAsyncNextArrowArray();
+    if (!FlushPendingBulkInsert())
+        return nullptr;
 
     if (m_poFilterGeom != nullptr)
     {
@@ -3664,6 +3924,8 @@ OGRFeature *OGRGeoPackageTableLayer::GetFeature(GIntBig nFID)
     if (m_bDeferredCreation && RunDeferredCreationIfNecessary() != OGRERR_NONE)
         return nullptr;
     CancelAsyncNextArrowArray();
+    if (!FlushPendingBulkInsert())
+        return nullptr;
 
     if (m_pszFidColumn == nullptr)
         return OGRLayer::GetFeature(nFID);
@@ -3798,6 +4060,9 @@ OGRErr OGRGeoPackageTableLayer::DeleteFeature(GIntBig nFID)
 
 bool OGRGeoPackageTableLayer::DoJobAtTransactionCommit()
 {
+    if (!FlushPendingBulkInsert())
+        return false;
+
     if (m_bAllowedRTreeThread)
         return true;
 
@@ -3815,6 +4080,7 @@ bool OGRGeoPackageTableLayer::DoJobAtTransactionCommit()
 
 bool OGRGeoPackageTableLayer::DoJobAtTransactionRollback()
 {
+    DiscardPendingBulkInsert();
     if (m_bThreadRTreeStarted)
         CancelAsyncRTree();
     m_nCountInsertInTransaction = 0;
@@ -3843,6 +4109,10 @@ bool OGRGeoPackageTableLayer::DoJobAtTransactionRollback()
 
 bool OGRGeoPackageTableLayer::StartDeferredSpatialIndexUpdate()
 {
+    // Pending rows must be inserted while the RTree triggers still exist
+    if (!FlushPendingBulkInsert())
+        return false;
+
     if (m_poFeatureDefn->GetGeomFieldCount() == 0)
         return true;
 
@@ -3961,11 +4231,13 @@ bool OGRGeoPackageTableLayer::FlushPendingSpatialIndexUpdate()
 
 bool OGRGeoPackageTableLayer::RunDeferredSpatialIndexUpdate()
 {
+    bool ret = FlushPendingBulkInsert();
+
     m_nCountInsertInTransaction = 0;
     if (m_aoRTreeTriggersSQL.empty())
-        return true;
+        return ret;
 
-    bool ret = FlushPendingSpatialIndexUpdate();
+    ret &= FlushPendingSpatialIndexUpdate();
 
     RevertWorkaroundUpdate1TriggerIssue();
 
@@ -4086,6 +4358,8 @@ GIntBig OGRGeoPackageTableLayer::GetFeatureCount(int /*bForce*/)
         return 0;
 
     CancelAsyncNextArrowArray();
+    if (!FlushPendingBulkInsert())
+        return -1;
 
     /* Ignore bForce, because we always do a full count on the database */
     OGRErr err;
@@ -4289,6 +4563,8 @@ OGRErr OGRGeoPackageTableLayer::IGetExtent(int /* iGeomField  */,
         return OGRERR_FAILURE;
 
     CancelAsyncNextArrowArray();
+    if (!FlushPendingBulkInsert())
+        return OGRERR_FAILURE;
 
     if (m_poFeatureDefn->GetGeomFieldCount() && HasSpatialIndex() &&
         CPLTestBool(
@@ -4485,6 +4761,9 @@ bool OGRGeoPackageTableLayer::CreateSpatialIndex(const char *pszTableName)
 
     CancelAsyncNextArrowArray();
 
+    if (!FlushPendingBulkInsert())
+        return false;
+
     m_bDeferredSpatialIndexCreation = false;
 
     if (m_pszFidColumn == nullptr)
@@ -8625,6 +8904,13 @@ int OGRGeoPackageTableLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
         return EIO;
     }
 
+    // Needed by the base, asynchronous and optimized implementations
+    if (!FlushPendingBulkInsert())
+    {
+        memset(out_array, 0, sizeof(*out_array));
+        return EIO;
+    }
+
     if (m_poFilterGeom != nullptr)
     {
         // Both are exclusive
@@ -16,6 +16,9 @@
 #include "cpl_json.h"
 #include "ogrsf_frmts.h"
 
+#include <memory>
+#include <string>
+
 #define MVT_LCO                                                                \
     "<LayerCreationOptionList>"                                                \
     "  <Option name='MINZOOM' type='int' min='0' max='22' "                    \
@@ -75,9 +78,32 @@ OGRFeature *OGRMVTCreateFeatureFrom(OGRFeature *poSrcFeature,
                                     const OGRSpatialReference *poSRS);
 
 // #ifdef HAVE_MVT_WRITE_SUPPORT
-GDALDataset *OGRMVTWriterDatasetCreate(const char *pszFilename, int nXSize,
-                                       int nYSize, int nBandsIn,
-                                       GDALDataType eDT, char **papszOptions);
+
+/** Receiver of the tiles generated by the MVT writer, used instead of the
+ * directory or MBTiles output (e.g. by the PMTiles writer).
+ */
+class OGRMVTTileSink
+{
+  public:
+    virtual ~OGRMVTTileSink() = default;
+
+    /** Returns the key by which tiles are sorted before being passed to
+     * WriteTile(). nY is counted from the top of the tile matrix. */
+    virtual uint64_t GetTileSortKey(int nZ, int nX, int nY) const = 0;
+
+    /** Receives the (possibly compressed) encoded content of a tile. */
+    virtual bool WriteTile(int nZ, int nX, int nY,
+                           const std::string &osTileData) = 0;
+
+    /** Called once all tiles have been written, with the MBTiles-style
+     * metadata items as string values. */
+    virtual bool Finalize(const CPLJSONObject &oMetadata) = 0;
+};
+
+GDALDataset *OGRMVTWriterDatasetCreate(
+    const char *pszFilename, int nXSize, int nYSize, int nBandsIn,
+    GDALDataType eDT, char **papszOptions,
+    std::unique_ptr<OGRMVTTileSink> poTileSink = nullptr);
 // #endif
 
 #endif  // MVTUTILS_H
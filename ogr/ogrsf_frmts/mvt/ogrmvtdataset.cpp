@@ -3392,6 +3392,7 @@ class OGRMVTWriterDataset final : public GDALDataset
     CPLString m_osDescription;
     CPLString m_osType{"overlay"};
     sqlite3 *m_hDBMBTILES = nullptr;
+    std::unique_ptr<OGRMVTTileSink> m_poTileSink{};
     OGREnvelope m_oEnvelope;
     bool m_bMaxTileSizeOptSpecified = false;
     bool m_bMaxFeaturesOptSpecified = false;
@@ -3499,6 +3500,11 @@ class OGRMVTWriterDataset final : public GDALDataset
                                int nBandsIn, GDALDataType eDT,
                                char **papszOptions);
 
+    static GDALDataset *Create(const char *pszFilename, int nXSize, int nYSize,
+                               int nBandsIn, GDALDataType eDT,
+                               char **papszOptions,
+                               std::unique_ptr<OGRMVTTileSink> poTileSink);
+
     OGRSpatialReference *GetSRS()
     {
         return m_poSRS;
@@ -5393,16 +5399,74 @@ bool OGRMVTWriterDataset::CreateOutput()
         }
     }
 
+    // A tile sink may require an ordering of tiles that cannot be expressed
+    // in SQL (e.g. Hilbert-curve based tile ids for PMTiles). In that case
+    // collect the tile coordinates and sort them first.
+    struct TileCoordinates
+    {
+        uint64_t nSortKey;
+        int nZ;
+        int nX;
+        int nY;
+    };
+
+    std::vector<TileCoordinates> asTileCoordinates;
+    if (m_poTileSink)
+    {
+        try
+        {
+            while (sqlite3_step(hStmtZXY) == SQLITE_ROW)
+            {
+                TileCoordinates sCoords;
+                sCoords.nZ = sqlite3_column_int(hStmtZXY, 0);
+                sCoords.nX = sqlite3_column_int(hStmtZXY, 1);
+                sCoords.nY = sqlite3_column_int(hStmtZXY, 2);
+                sCoords.nSortKey = m_poTileSink->GetTileSortKey(
+                    sCoords.nZ, sCoords.nX, sCoords.nY);
+                asTileCoordinates.push_back(sCoords);
+            }
+        }
+        catch (const std::exception &e)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Out of memory collecting tile coordinates: %s",
+                     e.what());
+            sqlite3_finalize(hStmtZXY);
+            sqlite3_finalize(hStmtLayer);
+            sqlite3_finalize(hStmtRows);
+            return false;
+        }
+        std::sort(asTileCoordinates.begin(), asTileCoordinates.end(),
+                  [](const TileCoordinates &a, const TileCoordinates &b)
+                  { return a.nSortKey < b.nSortKey; });
+    }
+
     int nLastZ = -1;
     int nLastX = -1;
     bool bRet = true;
     GIntBig nTempTilesRead = 0;
+    size_t iTile = 0;
 
-    while (sqlite3_step(hStmtZXY) == SQLITE_ROW)
+    while (true)
     {
-        int nZ = sqlite3_column_int(hStmtZXY, 0);
-        int nX = sqlite3_column_int(hStmtZXY, 1);
-        int nY = sqlite3_column_int(hStmtZXY, 2);
+        int nZ, nX, nY;
+        if (m_poTileSink)
+        {
+            if (iTile == asTileCoordinates.size())
+                break;
+            nZ = asTileCoordinates[iTile].nZ;
+            nX = asTileCoordinates[iTile].nX;
+            nY = asTileCoordinates[iTile].nY;
+            ++iTile;
+        }
+        else
+        {
+            if (sqlite3_step(hStmtZXY) != SQLITE_ROW)
+                break;
+            nZ = sqlite3_column_int(hStmtZXY, 0);
+            nX = sqlite3_column_int(hStmtZXY, 1);
+            nY = sqlite3_column_int(hStmtZXY, 2);
+        }
 
         std::string oTileBuffer(EncodeTile(nZ, nX, nY, hStmtLayer, hStmtRows,
                                            oMapLayerProps, oSetLayers,
@@ -5412,6 +5476,10 @@ bool OGRMVTWriterDataset::CreateOutput()
         {
             bRet = false;
         }
+        else if (m_poTileSink)
+        {
+            bRet = m_poTileSink->WriteTile(nZ, nX, nY, oTileBuffer);
+        }
         else if (hInsertStmt)
         {
             sqlite3_bind_int(hInsertStmt, 1, nZ);
@@ -5839,6 +5907,15 @@ bool OGRMVTWriterDataset::GenerateMetadata(
         return true;
     }
 
+    if (m_poTileSink)
+    {
+        // Pass items as strings, as they would be stored in MBTiles
+        CPLJSONObject oMetadata;
+        for (const auto &oChild : oRoot.GetChildren())
+            oMetadata.Add(oChild.GetName(), oChild.ToString());
+        return m_poTileSink->Finalize(oMetadata);
+    }
+
     return oDoc.Save(
         CPLFormFilenameSafe(GetDescription(), "metadata.json", nullptr));
 }
@@ -6105,6 +6182,15 @@ OGRMVTWriterDataset::ICreateLayer(const char *pszLayerName,
 GDALDataset *OGRMVTWriterDataset::Create(const char *pszFilename, int nXSize,
                                          int nYSize, int nBandsIn,
                                          GDALDataType eDT, char **papszOptions)
+{
+    return Create(pszFilename, nXSize, nYSize, nBandsIn, eDT, papszOptions,
+                  nullptr);
+}
+
+GDALDataset *
+OGRMVTWriterDataset::Create(const char *pszFilename, int nXSize, int nYSize,
+                            int nBandsIn, GDALDataType eDT, char **papszOptions,
+                            std::unique_ptr<OGRMVTTileSink> poTileSink)
 {
     if (nXSize != 0 || nYSize != 0 || nBandsIn != 0 || eDT != GDT_Unknown)
     {
@@ -6120,13 +6206,25 @@ GDALDataset *OGRMVTWriterDataset::Create(const char *pszFilename, int nXSize,
     {
         pszFormat = "MBTILES";
     }
-    const bool bMBTILES = pszFormat != nullptr && EQUAL(pszFormat, "MBTILES");
+    const bool bMBTILES =
+        !poTileSink && pszFormat != nullptr && EQUAL(pszFormat, "MBTILES");
 
     // For debug only
     bool bReuseTempFile =
         CPLTestBool(CPLGetConfigOption("OGR_MVT_REUSE_TEMP_FILE", "NO"));
 
-    if (bMBTILES)
+    if (poTileSink)
+    {
+        // Tiles and metadata are entirely handled by the sink, which
+        // addresses tiles in the Web Mercator tile matrix.
+        if (CSLFetchNameValue(papszOptions, "TILING_SCHEME"))
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "Custom TILING_SCHEME not supported with this output");
+            return nullptr;
+        }
+    }
+    else if (bMBTILES)
     {
         if (!bMBTILESExt)
         {
@@ -6155,6 +6253,7 @@ GDALDataset *OGRMVTWriterDataset::Create(const char *pszFilename, int nXSize,
     }
 
     OGRMVTWriterDataset *poDS = new OGRMVTWriterDataset();
+    poDS->m_poTileSink = std::move(poTileSink);
     poDS->m_pMyVFS = OGRSQLiteCreateVFS(nullptr, poDS);
     sqlite3_vfs_register(poDS->m_pMyVFS, 0);
 
@@ -6394,12 +6493,14 @@ GDALDataset *OGRMVTWriterDataset::Create(const char *pszFilename, int nXSize,
     return poDS;
 }
 
-GDALDataset *OGRMVTWriterDatasetCreate(const char *pszFilename, int nXSize,
-                                       int nYSize, int nBandsIn,
-                                       GDALDataType eDT, char **papszOptions)
+GDALDataset *OGRMVTWriterDatasetCreate(
+    const char *pszFilename, int nXSize, int nYSize, int nBandsIn,
+    GDALDataType eDT, char **papszOptions,
+    std::unique_ptr<OGRMVTTileSink> poTileSink)
 {
     return OGRMVTWriterDataset::Create(pszFilename, nXSize, nYSize, nBandsIn,
-                                       eDT, papszOptions);
+                                       eDT, papszOptions,
+                                       std::move(poTileSink));
 }
 
 #endif  // HAVE_MVT_WRITE_SUPPORT
@@ -136,6 +136,13 @@ class CPL_DLL OGRLayer : public GDALMajorObject
         std::vector<GIntBig> m_anQueriedFIDs{};
         size_t m_iQueriedFIDS = 0;
         std::deque<std::unique_ptr<OGRFeature>> m_oFeatureQueue{};
+
+        // Parallel reading through clones of the layer (NUM_THREADS option)
+        bool m_bParallelReadingInitialized = false;
+        std::vector<GDALDatasetUniquePtr> m_apoParallelDatasets{};
+        std::vector<OGRLayer *> m_apoParallelLayers{};
+        GIntBig m_nParallelFeatureCount = 0;
+        GIntBig m_nParallelNextIndex = 0;
     };
 
     std::shared_ptr<ArrowArrayStreamPrivateData>
@@ -145,6 +152,9 @@ class CPL_DLL OGRLayer : public GDALMajorObject
     {
         std::shared_ptr<ArrowArrayStreamPrivateData> poShared{};
     };
+
+    void InitParallelArrowArrayStream();
+    bool FillArrowArrayFeatureQueueParallel(size_t nMaxBatchSize);
     //! @endcond
 
     friend class OGRArrowArrayHelper;
@@ -15,12 +15,17 @@
 #include "filegdbtable.h"
 #include "filegdbtable_priv.h"
 
+#include <atomic>
 #include <cctype>
 #include <cstdint>
 #include <algorithm>
 #include <limits>
+#include <new>
 
+#include "cpl_error_internal.h"
+#include "cpl_multiproc.h"
 #include "cpl_string.h"
+#include "gdal_thread_pool.h"
 
 namespace OpenFileGDB
 {
@@ -420,6 +425,83 @@ void FileGDBTable::ComputeOptimalSpatialIndexGridResolution()
     }
 }
 
+/************************************************************************/
+/*                      GetNumThreadsForIndexing()                      */
+/************************************************************************/
+
+static int GetNumThreadsForIndexing()
+{
+    const char *pszNumThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    return std::max(1, std::min(128, EQUAL(pszNumThreads, "ALL_CPUS")
+                                         ? CPLGetNumCPUs()
+                                         : atoi(pszNumThreads)));
+}
+
+/************************************************************************/
+/*                           ParallelSort()                             */
+/************************************************************************/
+
+/** Sorts asValues by sorting slices of it on worker threads, and merging
+ * them pairwise, also on worker threads. The result is the same as with
+ * std::sort(), provided that comp defines a total order.
+ */
+template <class T, class Compare>
+static void ParallelSort(std::vector<T> &asValues, Compare comp)
+{
+    constexpr size_t MIN_VALUES_PER_SLICE = 65536;
+    const int nNumThreads = GetNumThreadsForIndexing();
+    const size_t nSlices = std::min(static_cast<size_t>(nNumThreads),
+                                    asValues.size() / MIN_VALUES_PER_SLICE);
+    auto poThreadPool =
+        nSlices > 1 ? GDALGetGlobalThreadPool(nNumThreads) : nullptr;
+    auto poQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (!poQueue)
+    {
+        std::sort(asValues.begin(), asValues.end(), comp);
+        return;
+    }
+
+    std::vector<size_t> anBounds;
+    for (size_t i = 0; i <= nSlices; ++i)
+        anBounds.push_back(asValues.size() / nSlices * i);
+    anBounds.back() = asValues.size();
+
+    const auto begin = asValues.begin();
+    for (size_t i = 0; i < nSlices; ++i)
+    {
+        const size_t nStart = anBounds[i];
+        const size_t nEnd = anBounds[i + 1];
+        poQueue->SubmitJob([begin, nStart, nEnd, comp]()
+                           { std::sort(begin + nStart, begin + nEnd, comp); });
+    }
+    poQueue->WaitCompletion();
+
+    while (anBounds.size() > 2)
+    {
+        std::vector<size_t> anNewBounds;
+        size_t i = 0;
+        for (; i + 2 < anBounds.size(); i += 2)
+        {
+            const size_t nStart = anBounds[i];
+            const size_t nMiddle = anBounds[i + 1];
+            const size_t nEnd = anBounds[i + 2];
+            poQueue->SubmitJob(
+                [begin, nStart, nMiddle, nEnd, comp]()
+                {
+                    std::inplace_merge(begin + nStart, begin + nMiddle,
+                                       begin + nEnd, comp);
+                });
+            anNewBounds.push_back(nStart);
+        }
+        // Odd number of slices: the last one is merged at the next round
+        if (i + 1 < anBounds.size())
+            anNewBounds.push_back(anBounds[i]);
+        anNewBounds.push_back(anBounds.back());
+        poQueue->WaitCompletion();
+        anBounds = std::move(anNewBounds);
+    }
+}
+
 /************************************************************************/
 /*                           WriteIndex()                               */
 /************************************************************************/
@@ -476,11 +558,11 @@ static bool WriteIndex(
     }
 
     // Sort by ascending values, and for same value by ascending OID
-    std::sort(asValues.begin(), asValues.end(),
-              [](const ValueOIDPair &a, const ValueOIDPair &b) {
-                  return a.first < b.first ||
-                         (a.first == b.first && a.second < b.second);
-              });
+    ParallelSort(asValues,
+                 [](const ValueOIDPair &a, const ValueOIDPair &b) {
+                     return a.first < b.first ||
+                            (a.first == b.first && a.second < b.second);
+                 });
 
     bool bRet = true;
     std::vector<GByte> abyPage;
@@ -1146,6 +1228,181 @@ bool FileGDBTable::CreateSpatialIndex()
         }
     };
 
+    // Appends to asValuesOut the grid cells covered by a geometry blob
+    const auto AddGeometryToIndex =
+        [AddPointToIndex, AddLineStringToIndex, AddPolygonToIndex](
+            FileGDBOGRGeometryConverter *poConverter, const OGRField *psField,
+            int64_t nOID, std::vector<int64_t> &aSetValues,
+            std::vector<ValueOIDPair> &asValuesOut)
+    {
+        auto poGeom =
+            std::unique_ptr<OGRGeometry>(poConverter->GetAsGeometry(psField));
+        if (poGeom == nullptr || poGeom->IsEmpty())
+            return;
+
+        aSetValues.clear();
+        const auto eGeomType = wkbFlatten(poGeom->getGeometryType());
+        if (eGeomType == wkbPoint)
+        {
+            const auto poPoint = poGeom->toPoint();
+            AddPointToIndex(poPoint->getX(), poPoint->getY(), aSetValues);
+        }
+        else if (eGeomType == wkbMultiPoint)
+        {
+            for (const auto poPoint : *(poGeom->toMultiPoint()))
+            {
+                AddPointToIndex(poPoint->getX(), poPoint->getY(), aSetValues);
+            }
+        }
+        else if (eGeomType == wkbLineString)
+        {
+            AddLineStringToIndex(poGeom->toLineString(), aSetValues);
+        }
+        else if (eGeomType == wkbMultiLineString)
+        {
+            for (const auto poLS : *(poGeom->toMultiLineString()))
+            {
+                AddLineStringToIndex(poLS, aSetValues);
+            }
+        }
+        else if (eGeomType == wkbCircularString ||
+                 eGeomType == wkbCompoundCurve)
+        {
+            poGeom.reset(poGeom->getLinearGeometry());
+            if (poGeom)
+                AddLineStringToIndex(poGeom->toLineString(), aSetValues);
+        }
+        else if (eGeomType == wkbMultiCurve)
+        {
+            poGeom.reset(poGeom->getLinearGeometry());
+            if (poGeom)
+            {
+                for (const auto poLS : *(poGeom->toMultiLineString()))
+                {
+                    AddLineStringToIndex(poLS, aSetValues);
+                }
+            }
+        }
+        else if (eGeomType == wkbPolygon)
+        {
+            AddPolygonToIndex(poGeom->toPolygon(), aSetValues);
+        }
+        else if (eGeomType == wkbCurvePolygon)
+        {
+            poGeom.reset(poGeom->getLinearGeometry());
+            if (poGeom)
+                AddPolygonToIndex(poGeom->toPolygon(), aSetValues);
+        }
+        else if (eGeomType == wkbMultiPolygon)
+        {
+            for (const auto poPoly : *(poGeom->toMultiPolygon()))
+            {
+                AddPolygonToIndex(poPoly, aSetValues);
+            }
+        }
+        else if (eGeomType == wkbMultiSurface)
+        {
+            poGeom.reset(poGeom->getLinearGeometry());
+            if (poGeom)
+            {
+                for (const auto poPoly : *(poGeom->toMultiPolygon()))
+                {
+                    AddPolygonToIndex(poPoly, aSetValues);
+                }
+            }
+        }
+
+        std::sort(aSetValues.begin(), aSetValues.end());
+
+        int64_t nLastVal = std::numeric_limits<int64_t>::min();
+        for (auto nVal : aSetValues)
+        {
+            if (nVal != nLastVal)
+            {
+                asValuesOut.push_back(ValueOIDPair(nVal, nOID));
+                nLastVal = nVal;
+            }
+        }
+    };
+
+    // When several threads are used, geometry blobs are copied by batches,
+    // and decoded and rasterized on worker threads.
+    const int nNumThreads = GetNumThreadsForIndexing();
+    auto poThreadPool =
+        nNumThreads > 1 ? GDALGetGlobalThreadPool(nNumThreads) : nullptr;
+    auto poQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    std::vector<GByte> abyBatchBlobs;
+    // Offset in abyBatchBlobs of the blob of each feature, and its OID
+    std::vector<std::pair<size_t, int64_t>> anBatchOffsetOID;
+    const auto ProcessBatch =
+        [&asValues, &abyBatchBlobs, &anBatchOffsetOID, &poQueue, poGeomField,
+         nNumThreads, AddGeometryToIndex]()
+    {
+        const size_t nFeatures = anBatchOffsetOID.size();
+        if (nFeatures == 0)
+            return;
+        const size_t nJobs =
+            std::min(nFeatures, static_cast<size_t>(nNumThreads));
+        const size_t nPerJob = (nFeatures + nJobs - 1) / nJobs;
+        std::vector<std::vector<ValueOIDPair>> aasJobValues(nJobs);
+        std::atomic<bool> bJobFailed{false};
+        CPLErrorAccumulator oErrorAccumulator;
+        for (size_t iJob = 0; iJob < nJobs; ++iJob)
+        {
+            const size_t iStart = iJob * nPerJob;
+            const size_t iEnd = std::min(nFeatures, iStart + nPerJob);
+            poQueue->SubmitJob(
+                [&oErrorAccumulator, &abyBatchBlobs, &anBatchOffsetOID,
+                 &aasJobValues, &bJobFailed, poGeomField, AddGeometryToIndex,
+                 iJob, iStart, iEnd]()
+                {
+                    auto oAccumulator =
+                        oErrorAccumulator.InstallForCurrentScope();
+                    CPL_IGNORE_RET_VAL(oAccumulator);
+                    try
+                    {
+                        auto poConverter =
+                            std::unique_ptr<FileGDBOGRGeometryConverter>(
+                                FileGDBOGRGeometryConverter::BuildConverter(
+                                    poGeomField));
+                        std::vector<int64_t> aSetValuesJob;
+                        for (size_t i = iStart; i < iEnd; ++i)
+                        {
+                            const size_t nOffset = anBatchOffsetOID[i].first;
+                            const size_t nNextOffset =
+                                i + 1 < anBatchOffsetOID.size()
+                                    ? anBatchOffsetOID[i + 1].first
+                                    : abyBatchBlobs.size();
+                            OGRField sField;
+                            sField.Binary.nCount =
+                                static_cast<int>(nNextOffset - nOffset);
+                            sField.Binary.paData =
+                                abyBatchBlobs.data() + nOffset;
+                            AddGeometryToIndex(
+                                poConverter.get(), &sField,
+                                anBatchOffsetOID[i].second, aSetValuesJob,
+                                aasJobValues[iJob]);
+                        }
+                    }
+                    catch (const std::exception &)
+                    {
+                        bJobFailed = true;
+                    }
+                });
+        }
+        poQueue->WaitCompletion();
+        oErrorAccumulator.ReplayErrors();
+        if (bJobFailed)
+            throw std::bad_alloc();
+        for (const auto &asJobValues : aasJobValues)
+        {
+            asValues.insert(asValues.end(), asJobValues.begin(),
+                            asJobValues.end());
+        }
+        abyBatchBlobs.clear();
+        anBatchOffsetOID.clear();
+    };
+
     std::vector<int64_t> aSetValues;
     int64_t iLastReported = 0;
     const auto nReportIncrement = m_nTotalRecordCount / 20;
@@ -1166,106 +1423,31 @@ bool FileGDBTable::CreateSpatialIndex()
             if (iCurFeat < 0)
                 break;
             const OGRField *psField = GetFieldValue(m_iGeomField);
-            if (psField != nullptr)
+            if (psField == nullptr)
+                continue;
+            if (poQueue)
             {
-                auto poGeom = std::unique_ptr<OGRGeometry>(
-                    poGeomConverter->GetAsGeometry(psField));
-                if (poGeom != nullptr && !poGeom->IsEmpty())
+                anBatchOffsetOID.emplace_back(abyBatchBlobs.size(),
+                                              iCurFeat + 1);
+                abyBatchBlobs.insert(abyBatchBlobs.end(),
+                                     psField->Binary.paData,
+                                     psField->Binary.paData +
+                                         psField->Binary.nCount);
+                if (anBatchOffsetOID.size() >=
+                        static_cast<size_t>(1000 * nNumThreads) ||
+                    abyBatchBlobs.size() >= 64 * 1024 * 1024)
                 {
-                    aSetValues.clear();
-                    const auto eGeomType =
-                        wkbFlatten(poGeom->getGeometryType());
-                    if (eGeomType == wkbPoint)
-                    {
-                        const auto poPoint = poGeom->toPoint();
-                        AddPointToIndex(poPoint->getX(), poPoint->getY(),
-                                        aSetValues);
-                    }
-                    else if (eGeomType == wkbMultiPoint)
-                    {
-                        for (const auto poPoint : *(poGeom->toMultiPoint()))
-                        {
-                            AddPointToIndex(poPoint->getX(), poPoint->getY(),
-                                            aSetValues);
-                        }
-                    }
-                    else if (eGeomType == wkbLineString)
-                    {
-                        AddLineStringToIndex(poGeom->toLineString(),
-                                             aSetValues);
-                    }
-                    else if (eGeomType == wkbMultiLineString)
-                    {
-                        for (const auto poLS : *(poGeom->toMultiLineString()))
-                        {
-                            AddLineStringToIndex(poLS, aSetValues);
-                        }
-                    }
-                    else if (eGeomType == wkbCircularString ||
-                             eGeomType == wkbCompoundCurve)
-                    {
-                        poGeom.reset(poGeom->getLinearGeometry());
-                        if (poGeom)
-                            AddLineStringToIndex(poGeom->toLineString(),
-                                                 aSetValues);
-                    }
-                    else if (eGeomType == wkbMultiCurve)
-                    {
-                        poGeom.reset(poGeom->getLinearGeometry());
-                        if (poGeom)
-                        {
-                            for (const auto poLS :
-                                 *(poGeom->toMultiLineString()))
-                            {
-                                AddLineStringToIndex(poLS, aSetValues);
-                            }
-                        }
-                    }
-                    else if (eGeomType == wkbPolygon)
-                    {
-                        AddPolygonToIndex(poGeom->toPolygon(), aSetValues);
-                    }
-                    else if (eGeomType == wkbCurvePolygon)
-                    {
-                        poGeom.reset(poGeom->getLinearGeometry());
-                        if (poGeom)
-                            AddPolygonToIndex(poGeom->toPolygon(), aSetValues);
-                    }
-                    else if (eGeomType == wkbMultiPolygon)
-                    {
-                        for (const auto poPoly : *(poGeom->toMultiPolygon()))
-                        {
-                            AddPolygonToIndex(poPoly, aSetValues);
-                        }
-                    }
-                    else if (eGeomType == wkbMultiSurface)
-                    {
-                        poGeom.reset(poGeom->getLinearGeometry());
-                        if (poGeom)
-                        {
-                            for (const auto poPoly :
-                                 *(poGeom->toMultiPolygon()))
-                            {
-                                AddPolygonToIndex(poPoly, aSetValues);
-                            }
-                        }
-                    }
-
-                    std::sort(aSetValues.begin(), aSetValues.end());
-
-                    int64_t nLastVal = std::numeric_limits<int64_t>::min();
-                    for (auto nVal : aSetValues)
-                    {
-                        if (nVal != nLastVal)
-                        {
-                            asValues.push_back(
-                                ValueOIDPair(nVal, iCurFeat + 1));
-                            nLastVal = nVal;
-                        }
-                    }
+                    ProcessBatch();
                 }
             }
+            else
+            {
+                AddGeometryToIndex(poGeomConverter.get(), psField,
+                                   iCurFeat + 1, aSetValues, asValues);
+            }
         }
+        if (poQueue)
+            ProcessBatch();
     }
     catch (const std::exception &e)
     {
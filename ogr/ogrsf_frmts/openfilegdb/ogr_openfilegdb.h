@@ -147,6 +147,8 @@ class OGROpenFileGDBLayer final : public OGRLayer
 
     int m_iFieldToReadAsBinary = -1;
 
+    bool m_bLastGetNextArrowArrayUsedOptimizedCodePath = false;
+
     FileGDBIterator *m_poAttributeIterator = nullptr;
     int m_bIteratorSufficientToEvaluateFilter = FALSE;
     FileGDBIterator *BuildIteratorFromExprNode(swq_expr_node *poNode);
@@ -264,6 +266,10 @@ class OGROpenFileGDBLayer final : public OGRLayer
     OGRFeature *GetNextFeature() override;
     OGRFeature *GetFeature(GIntBig nFeatureId) override;
     OGRErr SetNextByIndex(GIntBig nIndex) override;
+    int GetNextArrowArray(struct ArrowArrayStream *,
+                          struct ArrowArray *out_array) override;
+    const char *GetMetadataItem(const char *pszName,
+                                const char *pszDomain) override;
 
     GIntBig GetFeatureCount(int bForce = TRUE) override;
     OGRErr IGetExtent(int iGeomField, OGREnvelope *psExtent,
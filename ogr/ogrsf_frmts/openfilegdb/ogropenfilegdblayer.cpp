@@ -35,6 +35,9 @@
 #include "ogr_spatialref.h"
 #include "ogr_srs_api.h"
 #include "ogrsf_frmts.h"
+#include "ogr_p.h"
+#include "ograrrowarrayhelper.h"
+#include "ogrlayerarrow.h"
 #include "filegdbtable.h"
 #include "ogr_swq.h"
 #include "filegdb_coordprec_read.h"
@@ -1720,6 +1723,35 @@ void OGROpenFileGDBLayer::BuildCombinedIterator()
     }
 }
 
+/***********************************************************************/
+/*                      PromoteToMultiGeometry()                       */
+/***********************************************************************/
+
+// Layers of FileGDB are reported with a multi geometry type, so promote
+// single polygons and lines to their multi counterpart.
+static OGRGeometry *PromoteToMultiGeometry(OGRGeometry *poGeom)
+{
+    const OGRwkbGeometryType eFlattenType =
+        wkbFlatten(poGeom->getGeometryType());
+    if (eFlattenType == wkbPolygon)
+        poGeom = OGRGeometryFactory::forceToMultiPolygon(poGeom);
+    else if (eFlattenType == wkbCurvePolygon)
+    {
+        OGRMultiSurface *poMS = new OGRMultiSurface();
+        poMS->addGeometryDirectly(poGeom);
+        poGeom = poMS;
+    }
+    else if (eFlattenType == wkbLineString)
+        poGeom = OGRGeometryFactory::forceToMultiLineString(poGeom);
+    else if (eFlattenType == wkbCompoundCurve)
+    {
+        OGRMultiCurve *poMC = new OGRMultiCurve();
+        poMC->addGeometryDirectly(poGeom);
+        poGeom = poMC;
+    }
+    return poGeom;
+}
+
 /***********************************************************************/
 /*                         GetCurrentFeature()                         */
 /***********************************************************************/
@@ -1788,26 +1820,7 @@ OGRFeature *OGROpenFileGDBLayer::GetCurrentFeature()
                 OGRGeometry *poGeom = m_poGeomConverter->GetAsGeometry(psField);
                 if (poGeom != nullptr)
                 {
-                    OGRwkbGeometryType eFlattenType =
-                        wkbFlatten(poGeom->getGeometryType());
-                    if (eFlattenType == wkbPolygon)
-                        poGeom =
-                            OGRGeometryFactory::forceToMultiPolygon(poGeom);
-                    else if (eFlattenType == wkbCurvePolygon)
-                    {
-                        OGRMultiSurface *poMS = new OGRMultiSurface();
-                        poMS->addGeometryDirectly(poGeom);
-                        poGeom = poMS;
-                    }
-                    else if (eFlattenType == wkbLineString)
-                        poGeom =
-                            OGRGeometryFactory::forceToMultiLineString(poGeom);
-                    else if (eFlattenType == wkbCompoundCurve)
-                    {
-                        OGRMultiCurve *poMC = new OGRMultiCurve();
-                        poMC->addGeometryDirectly(poGeom);
-                        poGeom = poMC;
-                    }
+                    poGeom = PromoteToMultiGeometry(poGeom);
 
                     poGeom->assignSpatialReference(
                         m_poFeatureDefn->GetGeomFieldDefn(0)->GetSpatialRef());
@@ -1980,6 +1993,382 @@ OGRFeature *OGROpenFileGDBLayer::GetNextFeature()
     }
 }
 
+/***********************************************************************/
+/*                        GetNextArrowArray()                          */
+/***********************************************************************/
+
+int OGROpenFileGDBLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
+                                           struct ArrowArray *out_array)
+{
+    m_bLastGetNextArrowArrayUsedOptimizedCodePath = false;
+    if (!BuildLayerDefinition())
+    {
+        memset(out_array, 0, sizeof(*out_array));
+        return EIO;
+    }
+
+    // The optimized code path only deals with a sequential scan of the
+    // table. Filtered reads and the special cases of GetCurrentFeature() are
+    // left to the generic implementation.
+    if (m_poFilterGeom != nullptr || m_poAttrQuery != nullptr ||
+        m_nFilteredFeatureCount >= 0 || m_poAttributeIterator != nullptr ||
+        m_poSpatialIndexIterator != nullptr ||
+        m_poCombinedIterator != nullptr || m_iFieldToReadAsBinary >= 0 ||
+        m_poLyrTable->HasDeletedFeaturesListed() ||
+        CPLTestBool(
+            CPLGetConfigOption("OGR_OPENFILEGDB_STREAM_BASE_IMPL", "NO")))
+    {
+        return OGRLayer::GetNextArrowArray(stream, out_array);
+    }
+
+    m_bLastGetNextArrowArrayUsedOptimizedCodePath = true;
+    int errorErrno = EIO;
+    memset(out_array, 0, sizeof(*out_array));
+
+    const int64_t nTotalRecordCount = m_poLyrTable->GetTotalRecordCount();
+    if (m_bEOF || m_iCurFeat >= nTotalRecordCount)
+        return 0;
+
+    OGRArrowArrayHelper sHelper(m_poDS, m_poFeatureDefn,
+                                m_aosArrowArrayStreamOptions, out_array);
+    if (out_array->release == nullptr)
+    {
+        return ENOMEM;
+    }
+
+    // Features do not go through GetCurrentFeature(), so the in-memory
+    // spatial index cannot be built.
+    if (m_eSpatialIndexState == SPI_IN_BUILDING)
+        m_eSpatialIndexState = SPI_INVALID;
+
+    // Map .gdbtable columns to Arrow columns. Columns whose field is
+    // ignored map to -1 and are never decoded.
+    const int nGDBFieldCount = m_poLyrTable->GetFieldCount();
+    std::vector<int> anGDBIdxToOGRIdx(nGDBFieldCount, -1);
+    int nLastGDBIdxToRead = -1;
+    {
+        int iOGRIdx = 0;
+        for (int iGDBIdx = 0; iGDBIdx < nGDBFieldCount; iGDBIdx++)
+        {
+            if (iOGRIdx == m_iFIDAsRegularColumnIndex)
+                iOGRIdx++;
+            if (iGDBIdx == m_iGeomFieldIdx)
+            {
+                if (sHelper.m_nGeomFieldCount > 0 &&
+                    sHelper.m_mapOGRGeomFieldToArrowField[0] >= 0)
+                {
+                    nLastGDBIdxToRead = iGDBIdx;
+                }
+            }
+            else if (iGDBIdx != m_poLyrTable->GetObjectIdFieldIdx())
+            {
+                if (iOGRIdx < sHelper.m_nFieldCount &&
+                    sHelper.m_mapOGRFieldToArrowField[iOGRIdx] >= 0)
+                {
+                    anGDBIdxToOGRIdx[iGDBIdx] = iOGRIdx;
+                    nLastGDBIdxToRead = iGDBIdx;
+                }
+                iOGRIdx++;
+            }
+        }
+    }
+
+    const int iFIDAsRegularArrowField =
+        m_iFIDAsRegularColumnIndex >= 0
+            ? sHelper.m_mapOGRFieldToArrowField[m_iFIDAsRegularColumnIndex]
+            : -1;
+
+    struct tm brokenDown;
+    memset(&brokenDown, 0, sizeof(brokenDown));
+
+    const bool bDateTimeAsString = m_aosArrowArrayStreamOptions.FetchBool(
+        GAS_OPT_DATETIME_AS_STRING, false);
+    OGRISO8601Format sISO8601Format;
+    sISO8601Format.ePrecision = OGRISO8601Precision::AUTO;
+
+    const uint32_t nMemLimit = OGRArrowArrayHelper::GetMemLimit();
+
+    // Returns true if appending nBytes to the variable-size column psArray
+    // would exceed the memory limit, in which case the current row is
+    // deferred to the next batch.
+    const auto ExceedsMemLimit =
+        [nMemLimit](const struct ArrowArray *psArray, int iFeat, size_t nBytes)
+    {
+        if (iFeat == 0)
+            return false;
+        const auto panOffsets =
+            static_cast<const int32_t *>(psArray->buffers[1]);
+        const uint32_t nCurLength = static_cast<uint32_t>(panOffsets[iFeat]);
+        return nBytes <= nMemLimit && nBytes > nMemLimit - nCurLength;
+    };
+
+    // Null values of the current row are only recorded once the row is
+    // known to fit in the batch, so that null counts stay consistent when it
+    // is deferred.
+    std::vector<int> anNullArrowFields;
+
+    int iFeat = 0;
+    while (iFeat < sHelper.m_nMaxBatchSize)
+    {
+        if (m_iCurFeat >= nTotalRecordCount)
+            break;
+        const int64_t iRow =
+            m_poLyrTable->GetAndSelectNextNonEmptyRow(m_iCurFeat);
+        if (iRow < 0)
+        {
+            m_bEOF = TRUE;
+            break;
+        }
+
+        anNullArrowFields.clear();
+        bool bDeferRow = false;
+        for (int iGDBIdx = 0; iGDBIdx <= nLastGDBIdxToRead && !bDeferRow;
+             iGDBIdx++)
+        {
+            if (iGDBIdx == m_iGeomFieldIdx)
+            {
+                const int iArrowField =
+                    sHelper.m_mapOGRGeomFieldToArrowField[0];
+                if (iArrowField < 0)
+                    continue;
+                auto psArray = out_array->children[iArrowField];
+
+                const OGRField *psField = m_poLyrTable->GetFieldValue(iGDBIdx);
+                std::unique_ptr<OGRGeometry> poGeom;
+                if (psField)
+                {
+                    OGRGeometry *poGeomRaw =
+                        m_poGeomConverter->GetAsGeometry(psField);
+                    if (poGeomRaw)
+                        poGeom.reset(PromoteToMultiGeometry(poGeomRaw));
+                }
+                if (!poGeom)
+                {
+                    anNullArrowFields.push_back(iArrowField);
+                    continue;
+                }
+
+                const size_t nWKBSize = poGeom->WkbSize();
+                if (ExceedsMemLimit(psArray, iFeat, nWKBSize))
+                {
+                    bDeferRow = true;
+                    break;
+                }
+                GByte *outPtr = sHelper.GetPtrForStringOrBinary(
+                    iArrowField, iFeat, nWKBSize);
+                if (outPtr == nullptr)
+                {
+                    errorErrno = ENOMEM;
+                    goto error;
+                }
+                poGeom->exportToWkb(wkbNDR, outPtr, wkbVariantIso);
+                continue;
+            }
+
+            const int iOGRIdx = anGDBIdxToOGRIdx[iGDBIdx];
+            if (iOGRIdx < 0)
+                continue;
+            const int iArrowField = sHelper.m_mapOGRFieldToArrowField[iOGRIdx];
+            auto psArray = out_array->children[iArrowField];
+
+            const OGRField *psField = m_poLyrTable->GetFieldValue(iGDBIdx);
+            if (psField == nullptr)
+            {
+                anNullArrowFields.push_back(iArrowField);
+                continue;
+            }
+
+            const OGRFieldDefn *poFieldDefn =
+                m_poFeatureDefn->GetFieldDefnUnsafe(iOGRIdx);
+            const GByte *pabyData = nullptr;
+            size_t nBytes = 0;
+            char szDateTime[OGR_SIZEOF_ISO8601_DATETIME_BUFFER];
+            switch (poFieldDefn->GetType())
+            {
+                case OFTInteger:
+                {
+                    if (poFieldDefn->GetSubType() == OFSTBoolean)
+                    {
+                        if (psField->Integer != 0)
+                            sHelper.SetBoolOn(psArray, iFeat);
+                    }
+                    else if (poFieldDefn->GetSubType() == OFSTInt16)
+                    {
+                        sHelper.SetInt16(
+                            psArray, iFeat,
+                            static_cast<int16_t>(psField->Integer));
+                    }
+                    else
+                    {
+                        sHelper.SetInt32(psArray, iFeat, psField->Integer);
+                    }
+                    break;
+                }
+
+                case OFTInteger64:
+                {
+                    sHelper.SetInt64(psArray, iFeat, psField->Integer64);
+                    break;
+                }
+
+                case OFTReal:
+                {
+                    if (poFieldDefn->GetSubType() == OFSTFloat32)
+                    {
+                        sHelper.SetFloat(psArray, iFeat,
+                                         static_cast<float>(psField->Real));
+                    }
+                    else
+                    {
+                        sHelper.SetDouble(psArray, iFeat, psField->Real);
+                    }
+                    break;
+                }
+
+                case OFTDate:
+                {
+                    sHelper.SetDate(psArray, iFeat, brokenDown, *psField);
+                    break;
+                }
+
+                case OFTTime:
+                {
+                    sHelper.SetInt32(
+                        psArray, iFeat,
+                        psField->Date.Hour * 3600000 +
+                            psField->Date.Minute * 60000 +
+                            static_cast<int>(psField->Date.Second * 1000 +
+                                             0.5f));
+                    break;
+                }
+
+                case OFTDateTime:
+                {
+                    OGRField sField = *psField;
+                    if (m_poLyrTable->GetField(iGDBIdx)->GetType() ==
+                        FGFT_DATETIME)
+                    {
+                        sField.Date.TZFlag = m_bTimeInUTC ? 100 : 0;
+                    }
+                    if (!bDateTimeAsString)
+                    {
+                        sHelper.SetDateTime(psArray, iFeat, brokenDown,
+                                            sHelper.m_anTZFlags[iOGRIdx],
+                                            sField);
+                    }
+                    else
+                    {
+                        nBytes = OGRGetISO8601DateTime(&sField, sISO8601Format,
+                                                       szDateTime);
+                        pabyData = reinterpret_cast<const GByte *>(szDateTime);
+                    }
+                    break;
+                }
+
+                case OFTString:
+                {
+                    nBytes = strlen(psField->String);
+                    pabyData = reinterpret_cast<const GByte *>(psField->String);
+                    break;
+                }
+
+                case OFTBinary:
+                {
+                    nBytes = psField->Binary.nCount;
+                    pabyData = psField->Binary.paData;
+                    break;
+                }
+
+                default:
+                    break;
+            }
+
+            if (pabyData)
+            {
+                if (ExceedsMemLimit(psArray, iFeat, nBytes))
+                {
+                    bDeferRow = true;
+                    break;
+                }
+                GByte *outPtr =
+                    sHelper.GetPtrForStringOrBinary(iArrowField, iFeat, nBytes);
+                if (outPtr == nullptr)
+                {
+                    errorErrno = ENOMEM;
+                    goto error;
+                }
+                if (nBytes)
+                    memcpy(outPtr, pabyData, nBytes);
+            }
+        }
+
+        if (bDeferRow)
+        {
+            m_iCurFeat = iRow;
+            break;
+        }
+
+        for (const int iArrowField : anNullArrowFields)
+        {
+            if (!sHelper.SetNull(iArrowField, iFeat))
+            {
+                errorErrno = ENOMEM;
+                goto error;
+            }
+        }
+
+        if (sHelper.m_panFIDValues)
+            sHelper.m_panFIDValues[iFeat] = iRow + 1;
+        if (iFIDAsRegularArrowField >= 0)
+        {
+            auto psArray = out_array->children[iFIDAsRegularArrowField];
+            if (m_poFeatureDefn->GetFieldDefnUnsafe(m_iFIDAsRegularColumnIndex)
+                    ->GetType() == OFTInteger64)
+            {
+                sHelper.SetInt64(psArray, iFeat, iRow + 1);
+            }
+            else
+            {
+                sHelper.SetInt32(psArray, iFeat, static_cast<int>(iRow + 1));
+            }
+        }
+
+        m_iCurFeat = iRow + 1;
+        ++iFeat;
+    }
+
+    if (m_poLyrTable->HasGotError())
+    {
+        m_bEOF = TRUE;
+        goto error;
+    }
+
+    sHelper.Shrink(iFeat);
+    if (iFeat == 0)
+        sHelper.ClearArray();
+
+    return 0;
+
+error:
+    sHelper.ClearArray();
+    return errorErrno;
+}
+
+/***********************************************************************/
+/*                         GetMetadataItem()                           */
+/***********************************************************************/
+
+const char *OGROpenFileGDBLayer::GetMetadataItem(const char *pszName,
+                                                 const char *pszDomain)
+{
+    if (pszName && pszDomain && EQUAL(pszDomain, "__DEBUG__") &&
+        EQUAL(pszName, "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH"))
+    {
+        return m_bLastGetNextArrowArrayUsedOptimizedCodePath ? "YES" : "NO";
+    }
+    return OGRLayer::GetMetadataItem(pszName, pszDomain);
+}
+
 /***********************************************************************/
 /*                          GetFeature()                               */
 /***********************************************************************/
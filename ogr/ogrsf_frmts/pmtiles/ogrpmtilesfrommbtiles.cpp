@@ -25,6 +25,7 @@
 #include <algorithm>
 #include <array>
 #include <cassert>
+#include <limits>
 #include <unordered_map>
 #include <utility>
 
@@ -32,32 +33,17 @@
 /*                         ProcessMetadata()                            */
 /************************************************************************/
 
-static bool ProcessMetadata(GDALDataset *poSQLiteDS, pmtiles::headerv3 &sHeader,
-                            std::string &osMetadata)
+static bool ProcessMetadata(const CPLJSONObject &oMetadataItems,
+                            pmtiles::headerv3 &sHeader, std::string &osMetadata)
 {
-
-    auto poMetadata = poSQLiteDS->GetLayerByName("metadata");
-    if (!poMetadata)
-    {
-        CPLError(CE_Failure, CPLE_AppDefined, "metadata table not found");
-        return false;
-    }
-
-    const int iName = poMetadata->GetLayerDefn()->GetFieldIndex("name");
-    const int iValue = poMetadata->GetLayerDefn()->GetFieldIndex("value");
-    if (iName < 0 || iValue < 0)
-    {
-        CPLError(CE_Failure, CPLE_AppDefined,
-                 "Bad structure for metadata table");
-        return false;
-    }
-
     CPLJSONObject oObj;
     CPLJSONDocument oJsonDoc;
-    for (auto &&poFeature : poMetadata)
+    for (const auto &oItem : oMetadataItems.GetChildren())
     {
-        const char *pszName = poFeature->GetFieldAsString(iName);
-        const char *pszValue = poFeature->GetFieldAsString(iValue);
+        const std::string osName = oItem.GetName();
+        const std::string osValue = oItem.ToString();
+        const char *pszName = osName.c_str();
+        const char *pszValue = osValue.c_str();
         if (EQUAL(pszName, "json"))
         {
             if (!oJsonDoc.LoadMemory(pszValue))
@@ -175,279 +161,222 @@ static bool ProcessMetadata(GDALDataset *poSQLiteDS, pmtiles::headerv3 &sHeader,
 }
 
 /************************************************************************/
-/*                               HashArray()                            */
+/*                       ReadMBTilesMetadata()                          */
 /************************************************************************/
 
-// From https://codereview.stackexchange.com/questions/171999/specializing-stdhash-for-stdarray
-// We do not use std::hash<std::array<T, N>> as the name of the struct
-// because with gcc 5.4 we get the following error:
-// https://stackoverflow.com/questions/25594644/warning-specialization-of-template-in-different-namespace
-template <class T, size_t N> struct HashArray
+static bool ReadMBTilesMetadata(GDALDataset *poSQLiteDS,
+                                CPLJSONObject &oMetadataItems)
 {
-    CPL_NOSANITIZE_UNSIGNED_INT_OVERFLOW
-    size_t operator()(const std::array<T, N> &key) const
+    auto poMetadata = poSQLiteDS->GetLayerByName("metadata");
+    if (!poMetadata)
     {
-        std::hash<T> hasher;
-        size_t result = 0;
-        for (size_t i = 0; i < N; ++i)
-        {
-            result = result * 31 + hasher(key[i]);
-        }
-        return result;
+        CPLError(CE_Failure, CPLE_AppDefined, "metadata table not found");
+        return false;
     }
-};
-
-/************************************************************************/
-/*                    OGRPMTilesConvertFromMBTiles()                    */
-/************************************************************************/
 
-bool OGRPMTilesConvertFromMBTiles(const char *pszDestName,
-                                  const char *pszSrcName)
-{
-    const char *const apszAllowedDrivers[] = {"SQLite", nullptr};
-    auto poSQLiteDS = std::unique_ptr<GDALDataset>(
-        GDALDataset::Open(pszSrcName, GDAL_OF_VECTOR, apszAllowedDrivers));
-    if (!poSQLiteDS)
+    const int iName = poMetadata->GetLayerDefn()->GetFieldIndex("name");
+    const int iValue = poMetadata->GetLayerDefn()->GetFieldIndex("value");
+    if (iName < 0 || iValue < 0)
     {
         CPLError(CE_Failure, CPLE_AppDefined,
-                 "Cannot open %s with SQLite driver", pszSrcName);
+                 "Bad structure for metadata table");
         return false;
     }
 
-    pmtiles::headerv3 sHeader;
-    std::string osMetadata;
-    if (!ProcessMetadata(poSQLiteDS.get(), sHeader, osMetadata))
-        return false;
-
-    auto poTilesLayer = poSQLiteDS->GetLayerByName("tiles");
-    if (!poTilesLayer)
+    for (auto &&poFeature : poMetadata)
     {
-        CPLError(CE_Failure, CPLE_AppDefined, "tiles table not found");
-        return false;
+        oMetadataItems.Add(poFeature->GetFieldAsString(iName),
+                           poFeature->GetFieldAsString(iValue));
     }
+    return true;
+}
 
-    const int iZoomLevel =
-        poTilesLayer->GetLayerDefn()->GetFieldIndex("zoom_level");
-    const int iTileColumn =
-        poTilesLayer->GetLayerDefn()->GetFieldIndex("tile_column");
-    const int iTileRow =
-        poTilesLayer->GetLayerDefn()->GetFieldIndex("tile_row");
-    const int iTileData =
-        poTilesLayer->GetLayerDefn()->GetFieldIndex("tile_data");
-    if (iZoomLevel < 0 || iTileColumn < 0 || iTileRow < 0 || iTileData < 0)
-    {
-        CPLError(CE_Failure, CPLE_AppDefined, "Bad structure for tiles table");
-        return false;
-    }
+/************************************************************************/
+/*                      OGRPMTilesArchiveWriter()                       */
+/************************************************************************/
 
-    struct TileEntry
-    {
-        uint64_t nTileId;
-        std::array<unsigned char, 16> abyMD5;
-    };
+OGRPMTilesArchiveWriter::OGRPMTilesArchiveWriter(const std::string &osDestName)
+    : m_osDestName(osDestName)
+{
+}
 
-    // In a first step browse through the tiles table to compute the PMTiles
-    // tile_id of each tile, and compute a hash of the tile data for
-    // deduplication
-    std::vector<TileEntry> asTileEntries;
-    for (auto &&poFeature : poTilesLayer)
+/************************************************************************/
+/*                     ~OGRPMTilesArchiveWriter()                       */
+/************************************************************************/
+
+OGRPMTilesArchiveWriter::~OGRPMTilesArchiveWriter()
+{
+    if (m_poTmpFile)
     {
-        const int nZoomLevel = poFeature->GetFieldAsInteger(iZoomLevel);
-        if (nZoomLevel < 0 || nZoomLevel > 30)
-        {
-            CPLError(CE_Warning, CPLE_AppDefined,
-                     "Skipping tile with missing or invalid zoom_level");
-            continue;
-        }
-        const int nColumn = poFeature->GetFieldAsInteger(iTileColumn);
-        if (nColumn < 0 || nColumn >= (1 << nZoomLevel))
-        {
-            CPLError(CE_Warning, CPLE_AppDefined,
-                     "Skipping tile with missing or invalid tile_column");
-            continue;
-        }
-        const int nRow = poFeature->GetFieldAsInteger(iTileRow);
-        if (nRow < 0 || nRow >= (1 << nZoomLevel))
-        {
-            CPLError(CE_Warning, CPLE_AppDefined,
-                     "Skipping tile with missing or invalid tile_row");
-            continue;
-        }
-        // MBTiles uses a 0=bottom-most row, whereas PMTiles uses
-        // 0=top-most row
-        const int nY = (1 << nZoomLevel) - 1 - nRow;
-        uint64_t nTileId;
-        try
-        {
-            nTileId = pmtiles::zxy_to_tileid(static_cast<uint8_t>(nZoomLevel),
-                                             nColumn, nY);
-        }
-        catch (const std::exception &e)
-        {
-            // shouldn't happen given previous checks
-            CPLError(CE_Failure, CPLE_AppDefined, "Cannot compute tile id: %s",
-                     e.what());
-            return false;
-        }
-        int nTileDataLength = 0;
-        const GByte *pabyData =
-            poFeature->GetFieldAsBinary(iTileData, &nTileDataLength);
-        if (!pabyData)
-        {
-            CPLError(CE_Failure, CPLE_AppDefined, "Missing tile_data");
-            return false;
-        }
+        m_poTmpFile.reset();
+        VSIUnlink(m_osTmpFilename.c_str());
+    }
+}
 
-        TileEntry sEntry;
-        sEntry.nTileId = nTileId;
+/************************************************************************/
+/*                         HashMD5::operator()                          */
+/************************************************************************/
 
-        CPLMD5Context md5context;
-        CPLMD5Init(&md5context);
-        CPLMD5Update(&md5context, pabyData, nTileDataLength);
-        CPLMD5Final(&sEntry.abyMD5[0], &md5context);
-        try
-        {
-            asTileEntries.push_back(sEntry);
-        }
-        catch (const std::exception &e)
-        {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Out of memory browsing through tiles: %s", e.what());
-            return false;
-        }
+// From https://codereview.stackexchange.com/questions/171999/specializing-stdhash-for-stdarray
+CPL_NOSANITIZE_UNSIGNED_INT_OVERFLOW
+size_t OGRPMTilesArchiveWriter::HashMD5::operator()(const MD5Digest &key) const
+{
+    std::hash<unsigned char> hasher;
+    size_t result = 0;
+    for (size_t i = 0; i < key.size(); ++i)
+    {
+        result = result * 31 + hasher(key[i]);
     }
+    return result;
+}
 
-    // Sort the tiles by ascending tile_id. This is a requirement to build
-    // the PMTiles directories.
-    std::sort(asTileEntries.begin(), asTileEntries.end(),
-              [](const TileEntry &a, const TileEntry &b)
-              { return a.nTileId < b.nTileId; });
+/************************************************************************/
+/*                               Open()                                 */
+/************************************************************************/
 
+bool OGRPMTilesArchiveWriter::Open()
+{
     // Let's build a temporary file that contains the tile data in
     // a way that corresponds to the "clustered" mode, that is
     // "offsets are either contiguous with the previous offset+length, or
     // refer to a lesser offset, when writing with deduplication."
-    std::string osTmpFile(std::string(pszDestName) + ".tmp");
-    if (!VSIIsLocal(pszDestName))
+    m_osTmpFilename = m_osDestName + ".tmp";
+    if (!VSIIsLocal(m_osDestName.c_str()))
     {
-        osTmpFile = CPLGenerateTempFilenameSafe(CPLGetFilename(pszDestName));
+        m_osTmpFilename =
+            CPLGenerateTempFilenameSafe(CPLGetFilename(m_osDestName.c_str()));
     }
 
-    auto poTmpFile =
-        VSIVirtualHandleUniquePtr(VSIFOpenL(osTmpFile.c_str(), "wb+"));
-    VSIUnlink(osTmpFile.c_str());
-    if (!poTmpFile)
+    m_poTmpFile =
+        VSIVirtualHandleUniquePtr(VSIFOpenL(m_osTmpFilename.c_str(), "wb+"));
+    VSIUnlink(m_osTmpFilename.c_str());
+    if (!m_poTmpFile)
     {
         CPLError(CE_Failure, CPLE_FileIO, "Cannot open %s for write",
-                 osTmpFile.c_str());
+                 m_osTmpFilename.c_str());
         return false;
     }
+    return true;
+}
 
-    struct ResetAndUnlinkTmpFile
+/************************************************************************/
+/*                            ComputeMD5()                              */
+/************************************************************************/
+
+/* static */
+OGRPMTilesArchiveWriter::MD5Digest
+OGRPMTilesArchiveWriter::ComputeMD5(const void *pData, size_t nSize)
+{
+    MD5Digest abyMD5;
+    CPLMD5Context md5context;
+    CPLMD5Init(&md5context);
+    CPLMD5Update(&md5context, pData, nSize);
+    CPLMD5Final(&abyMD5[0], &md5context);
+    return abyMD5;
+}
+
+/************************************************************************/
+/*                         AddDuplicateTile()                           */
+/************************************************************************/
+
+bool OGRPMTilesArchiveWriter::AddDuplicateTile(uint64_t nTileId,
+                                               const MD5Digest &abyMD5)
+{
+    if (!m_asEntries.empty() && nTileId == m_nLastTileId + 1 &&
+        abyMD5 == m_abyLastMD5)
     {
-        VSIVirtualHandleUniquePtr &m_poFile;
-        std::string m_osFilename;
+        // If the tile id immediately follows the previous one and
+        // has the same tile data, increase the run_length
+        m_asEntries.back().run_length++;
+        m_nLastTileId = nTileId;
+        ++m_nAddressedTiles;
+        return true;
+    }
 
-        ResetAndUnlinkTmpFile(VSIVirtualHandleUniquePtr &poFile,
-                              const std::string &osFilename)
-            : m_poFile(poFile), m_osFilename(osFilename)
-        {
-        }
+    auto oIter = m_oMapMD5ToOffsetLen.find(abyMD5);
+    if (oIter == m_oMapMD5ToOffsetLen.end())
+        return false;
 
-        ~ResetAndUnlinkTmpFile()
-        {
-            m_poFile.reset();
-            VSIUnlink(m_osFilename.c_str());
-        }
-    };
+    // Point to previously written tile data if this content
+    // has already been written
+    pmtiles::entryv3 sPMTilesEntry;
+    sPMTilesEntry.tile_id = nTileId;
+    sPMTilesEntry.run_length = 1;
+    sPMTilesEntry.offset = oIter->second.first;
+    sPMTilesEntry.length = oIter->second.second;
+    m_asEntries.push_back(sPMTilesEntry);
+
+    m_nLastTileId = nTileId;
+    m_abyLastMD5 = abyMD5;
+    ++m_nAddressedTiles;
+    return true;
+}
 
-    ResetAndUnlinkTmpFile oReseer(poTmpFile, osTmpFile);
+/************************************************************************/
+/*                              AddTile()                               */
+/************************************************************************/
 
-    std::vector<pmtiles::entryv3> asPMTilesEntries;
-    uint64_t nLastTileId = 0;
-    uint64_t nFileOffset = 0;
-    std::array<unsigned char, 16> abyLastMD5;
-    std::unordered_map<std::array<unsigned char, 16>,
-                       std::pair<uint64_t, uint32_t>,
-                       HashArray<unsigned char, 16>>
-        oMapMD5ToOffsetLen;
-    for (const auto &sEntry : asTileEntries)
+bool OGRPMTilesArchiveWriter::AddTile(uint64_t nTileId,
+                                      const MD5Digest &abyMD5,
+                                      const void *pData, size_t nSize)
+{
+    if (!m_asEntries.empty() && nTileId <= m_nLastTileId)
     {
-        if (sEntry.nTileId == nLastTileId + 1 && sEntry.abyMD5 == abyLastMD5)
-        {
-            // If the tile id immediately follows the previous one and
-            // has the same tile data, increase the run_length
-            asPMTilesEntries.back().run_length++;
-        }
-        else
-        {
-            pmtiles::entryv3 sPMTilesEntry;
-            sPMTilesEntry.tile_id = sEntry.nTileId;
-            sPMTilesEntry.run_length = 1;
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Tiles must be added by ascending tile id");
+        return false;
+    }
+    if (nSize > std::numeric_limits<uint32_t>::max())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Too large tile");
+        return false;
+    }
 
-            auto oIter = oMapMD5ToOffsetLen.find(sEntry.abyMD5);
-            if (oIter != oMapMD5ToOffsetLen.end())
-            {
-                // Point to previously written tile data if this content
-                // has already been written
-                sPMTilesEntry.offset = oIter->second.first;
-                sPMTilesEntry.length = oIter->second.second;
-            }
-            else
-            {
-                try
-                {
-                    const auto sXYZ = pmtiles::tileid_to_zxy(sEntry.nTileId);
-                    poTilesLayer->SetAttributeFilter(CPLSPrintf(
-                        "zoom_level = %d AND tile_column = %u AND tile_row = "
-                        "%u",
-                        sXYZ.z, sXYZ.x, (1U << sXYZ.z) - 1U - sXYZ.y));
-                }
-                catch (const std::exception &e)
-                {
-                    // shouldn't happen given previous checks
-                    CPLError(CE_Failure, CPLE_AppDefined,
-                             "Cannot compute xyz: %s", e.what());
-                    return false;
-                }
-                poTilesLayer->ResetReading();
-                auto poFeature =
-                    std::unique_ptr<OGRFeature>(poTilesLayer->GetNextFeature());
-                if (!poFeature)
-                {
-                    CPLError(CE_Failure, CPLE_AppDefined, "Cannot find tile");
-                    return false;
-                }
-                int nTileDataLength = 0;
-                const GByte *pabyData =
-                    poFeature->GetFieldAsBinary(iTileData, &nTileDataLength);
-                if (!pabyData)
-                {
-                    CPLError(CE_Failure, CPLE_AppDefined, "Missing tile_data");
-                    return false;
-                }
-
-                sPMTilesEntry.offset = nFileOffset;
-                sPMTilesEntry.length = nTileDataLength;
-
-                oMapMD5ToOffsetLen[sEntry.abyMD5] =
-                    std::pair<uint64_t, uint32_t>(nFileOffset, nTileDataLength);
-
-                nFileOffset += nTileDataLength;
-
-                if (poTmpFile->Write(pabyData, nTileDataLength, 1) != 1)
-                {
-                    CPLError(CE_Failure, CPLE_FileIO, "Failed writing");
-                    return false;
-                }
-            }
+    try
+    {
+        if (AddDuplicateTile(nTileId, abyMD5))
+            return true;
+
+        pmtiles::entryv3 sPMTilesEntry;
+        sPMTilesEntry.tile_id = nTileId;
+        sPMTilesEntry.run_length = 1;
+        sPMTilesEntry.offset = m_nFileOffset;
+        sPMTilesEntry.length = static_cast<uint32_t>(nSize);
+        m_asEntries.push_back(sPMTilesEntry);
+
+        m_oMapMD5ToOffsetLen[abyMD5] = std::pair<uint64_t, uint32_t>(
+            m_nFileOffset, static_cast<uint32_t>(nSize));
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory adding tile: %s", e.what());
+        return false;
+    }
 
-            asPMTilesEntries.push_back(sPMTilesEntry);
+    m_nLastTileId = nTileId;
+    m_abyLastMD5 = abyMD5;
+    ++m_nAddressedTiles;
+    m_nFileOffset += nSize;
 
-            nLastTileId = sEntry.nTileId;
-            abyLastMD5 = sEntry.abyMD5;
-        }
+    if (nSize > 0 && m_poTmpFile->Write(pData, nSize, 1) != 1)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Failed writing");
+        return false;
     }
+    return true;
+}
+
+/************************************************************************/
+/*                              Finalize()                              */
+/************************************************************************/
+
+bool OGRPMTilesArchiveWriter::Finalize(const CPLJSONObject &oMetadataItems)
+{
+    pmtiles::headerv3 sHeader;
+    std::string osMetadata;
+    if (!ProcessMetadata(oMetadataItems, sHeader, osMetadata))
+        return false;
 
     const CPLCompressor *psCompressor = CPLGetCompressor("gzip");
     assert(psCompressor);
@@ -491,7 +420,7 @@ bool OGRPMTilesConvertFromMBTiles(const char *pszDestName,
         // Build the root and leave directories (one depth max)
         std::tie(osRootBytes, osLeaveBytes, nNumLeaves) =
             pmtiles::make_root_leaves(oCompressFunc, pmtiles::COMPRESSION_GZIP,
-                                      asPMTilesEntries);
+                                      m_asEntries);
     }
     catch (const std::exception &e)
     {
@@ -511,30 +440,31 @@ bool OGRPMTilesConvertFromMBTiles(const char *pszDestName,
     sHeader.leaf_dirs_bytes = osLeaveBytes.size();
     sHeader.tile_data_offset =
         sHeader.leaf_dirs_offset + sHeader.leaf_dirs_bytes;
-    sHeader.tile_data_bytes = nFileOffset;
+    sHeader.tile_data_bytes = m_nFileOffset;
 
     // Nomber of tiles that are addressable in the PMTiles archive, that is
     // the number of tiles we would have if not deduplicating them
-    sHeader.addressed_tiles_count = asTileEntries.size();
+    sHeader.addressed_tiles_count = m_nAddressedTiles;
 
     // Number of tile entries in root and leave directories
     // ie entries whose run_length >= 1
-    sHeader.tile_entries_count = asPMTilesEntries.size();
+    sHeader.tile_entries_count = m_asEntries.size();
 
     // Number of distinct tile blobs
-    sHeader.tile_contents_count = oMapMD5ToOffsetLen.size();
+    sHeader.tile_contents_count = m_oMapMD5ToOffsetLen.size();
 
     // Now build the final file!
-    auto poFile = VSIVirtualHandleUniquePtr(VSIFOpenL(pszDestName, "wb"));
+    auto poFile =
+        VSIVirtualHandleUniquePtr(VSIFOpenL(m_osDestName.c_str(), "wb"));
     if (!poFile)
     {
         CPLError(CE_Failure, CPLE_FileIO, "Cannot open %s for write",
-                 pszDestName);
+                 m_osDestName.c_str());
         return false;
     }
     const auto osHeader = sHeader.serialize();
 
-    if (poTmpFile->Seek(0, SEEK_SET) != 0 ||
+    if (m_poTmpFile->Seek(0, SEEK_SET) != 0 ||
         poFile->Write(osHeader.data(), osHeader.size(), 1) != 1 ||
         poFile->Write(osRootBytes.data(), osRootBytes.size(), 1) != 1 ||
         poFile->Write(osCompressedMetadata.data(), osCompressedMetadata.size(),
@@ -549,13 +479,13 @@ bool OGRPMTilesConvertFromMBTiles(const char *pszDestName,
     // Copy content of the temporary file at end of the output file.
     std::string oCopyBuffer;
     oCopyBuffer.resize(1024 * 1024);
-    const uint64_t nTotalSize = nFileOffset;
-    nFileOffset = 0;
+    const uint64_t nTotalSize = m_nFileOffset;
+    uint64_t nFileOffset = 0;
     while (nFileOffset < nTotalSize)
     {
         const size_t nToRead = static_cast<size_t>(
             std::min<uint64_t>(nTotalSize - nFileOffset, oCopyBuffer.size()));
-        if (poTmpFile->Read(&oCopyBuffer[0], nToRead, 1) != 1 ||
+        if (m_poTmpFile->Read(&oCopyBuffer[0], nToRead, 1) != 1 ||
             poFile->Write(&oCopyBuffer[0], nToRead, 1) != 1)
         {
             CPLError(CE_Failure, CPLE_FileIO, "Failed writing");
@@ -569,3 +499,175 @@ bool OGRPMTilesConvertFromMBTiles(const char *pszDestName,
 
     return true;
 }
+
+/************************************************************************/
+/*                    OGRPMTilesConvertFromMBTiles()                    */
+/************************************************************************/
+
+bool OGRPMTilesConvertFromMBTiles(const char *pszDestName,
+                                  const char *pszSrcName)
+{
+    const char *const apszAllowedDrivers[] = {"SQLite", nullptr};
+    auto poSQLiteDS = std::unique_ptr<GDALDataset>(
+        GDALDataset::Open(pszSrcName, GDAL_OF_VECTOR, apszAllowedDrivers));
+    if (!poSQLiteDS)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Cannot open %s with SQLite driver", pszSrcName);
+        return false;
+    }
+
+    CPLJSONObject oMetadataItems;
+    if (!ReadMBTilesMetadata(poSQLiteDS.get(), oMetadataItems))
+        return false;
+
+    auto poTilesLayer = poSQLiteDS->GetLayerByName("tiles");
+    if (!poTilesLayer)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "tiles table not found");
+        return false;
+    }
+
+    const int iZoomLevel =
+        poTilesLayer->GetLayerDefn()->GetFieldIndex("zoom_level");
+    const int iTileColumn =
+        poTilesLayer->GetLayerDefn()->GetFieldIndex("tile_column");
+    const int iTileRow =
+        poTilesLayer->GetLayerDefn()->GetFieldIndex("tile_row");
+    const int iTileData =
+        poTilesLayer->GetLayerDefn()->GetFieldIndex("tile_data");
+    if (iZoomLevel < 0 || iTileColumn < 0 || iTileRow < 0 || iTileData < 0)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Bad structure for tiles table");
+        return false;
+    }
+
+    struct TileEntry
+    {
+        uint64_t nTileId;
+        OGRPMTilesArchiveWriter::MD5Digest abyMD5;
+    };
+
+    // In a first step browse through the tiles table to compute the PMTiles
+    // tile_id of each tile, and compute a hash of the tile data for
+    // deduplication
+    std::vector<TileEntry> asTileEntries;
+    for (auto &&poFeature : poTilesLayer)
+    {
+        const int nZoomLevel = poFeature->GetFieldAsInteger(iZoomLevel);
+        if (nZoomLevel < 0 || nZoomLevel > 30)
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Skipping tile with missing or invalid zoom_level");
+            continue;
+        }
+        const int nColumn = poFeature->GetFieldAsInteger(iTileColumn);
+        if (nColumn < 0 || nColumn >= (1 << nZoomLevel))
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Skipping tile with missing or invalid tile_column");
+            continue;
+        }
+        const int nRow = poFeature->GetFieldAsInteger(iTileRow);
+        if (nRow < 0 || nRow >= (1 << nZoomLevel))
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Skipping tile with missing or invalid tile_row");
+            continue;
+        }
+        // MBTiles uses a 0=bottom-most row, whereas PMTiles uses
+        // 0=top-most row
+        const int nY = (1 << nZoomLevel) - 1 - nRow;
+        uint64_t nTileId;
+        try
+        {
+            nTileId = pmtiles::zxy_to_tileid(static_cast<uint8_t>(nZoomLevel),
+                                             nColumn, nY);
+        }
+        catch (const std::exception &e)
+        {
+            // shouldn't happen given previous checks
+            CPLError(CE_Failure, CPLE_AppDefined, "Cannot compute tile id: %s",
+                     e.what());
+            return false;
+        }
+        int nTileDataLength = 0;
+        const GByte *pabyData =
+            poFeature->GetFieldAsBinary(iTileData, &nTileDataLength);
+        if (!pabyData)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "Missing tile_data");
+            return false;
+        }
+
+        TileEntry sEntry;
+        sEntry.nTileId = nTileId;
+        sEntry.abyMD5 =
+            OGRPMTilesArchiveWriter::ComputeMD5(pabyData, nTileDataLength);
+        try
+        {
+            asTileEntries.push_back(sEntry);
+        }
+        catch (const std::exception &e)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Out of memory browsing through tiles: %s", e.what());
+            return false;
+        }
+    }
+
+    // Sort the tiles by ascending tile_id. This is a requirement to build
+    // the PMTiles directories.
+    std::sort(asTileEntries.begin(), asTileEntries.end(),
+              [](const TileEntry &a, const TileEntry &b)
+              { return a.nTileId < b.nTileId; });
+
+    OGRPMTilesArchiveWriter oWriter(pszDestName);
+    if (!oWriter.Open())
+        return false;
+
+    for (const auto &sEntry : asTileEntries)
+    {
+        if (oWriter.AddDuplicateTile(sEntry.nTileId, sEntry.abyMD5))
+            continue;
+
+        // Only fetch the tile data if its content has not already been
+        // written
+        try
+        {
+            const auto sXYZ = pmtiles::tileid_to_zxy(sEntry.nTileId);
+            poTilesLayer->SetAttributeFilter(CPLSPrintf(
+                "zoom_level = %d AND tile_column = %u AND tile_row = %u",
+                sXYZ.z, sXYZ.x, (1U << sXYZ.z) - 1U - sXYZ.y));
+        }
+        catch (const std::exception &e)
+        {
+            // shouldn't happen given previous checks
+            CPLError(CE_Failure, CPLE_AppDefined, "Cannot compute xyz: %s",
+                     e.what());
+            return false;
+        }
+        poTilesLayer->ResetReading();
+        auto poFeature =
+            std::unique_ptr<OGRFeature>(poTilesLayer->GetNextFeature());
+        if (!poFeature)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "Cannot find tile");
+            return false;
+        }
+        int nTileDataLength = 0;
+        const GByte *pabyData =
+            poFeature->GetFieldAsBinary(iTileData, &nTileDataLength);
+        if (!pabyData)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "Missing tile_data");
+            return false;
+        }
+
+        if (!oWriter.AddTile(sEntry.nTileId, sEntry.abyMD5, pabyData,
+                             nTileDataLength))
+            return false;
+    }
+
+    return oWriter.Finalize(oMetadataItems);
+}
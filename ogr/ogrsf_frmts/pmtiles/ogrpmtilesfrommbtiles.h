@@ -14,8 +14,74 @@
 #define OGRPMTILESFROMMBTILES_H_INCLUDED
 
 #include "gdal_priv.h"
+#include "cpl_json.h"
+#include "cpl_vsi_virtual.h"
+
+#include "include_pmtiles.h"
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 bool OGRPMTilesConvertFromMBTiles(const char *pszDestName,
                                   const char *pszSrcName);
 
+/************************************************************************/
+/*                       OGRPMTilesArchiveWriter                        */
+/************************************************************************/
+
+/** Writes a "clustered" PMTiles archive of MVT tiles.
+ *
+ * Tiles must be added by strictly ascending tile id. Their content is
+ * streamed to a temporary file, deduplicated on the fly, and the final
+ * file (header, directories, metadata and tile data) is assembled by
+ * Finalize().
+ */
+class OGRPMTilesArchiveWriter
+{
+  public:
+    typedef std::array<unsigned char, 16> MD5Digest;
+
+    explicit OGRPMTilesArchiveWriter(const std::string &osDestName);
+    ~OGRPMTilesArchiveWriter();
+
+    bool Open();
+
+    static MD5Digest ComputeMD5(const void *pData, size_t nSize);
+
+    /** Registers a tile whose content has already been added, either as
+     * the previous tile or earlier. Returns false if the content is not
+     * known, in which case AddTile() must be called. */
+    bool AddDuplicateTile(uint64_t nTileId, const MD5Digest &abyMD5);
+
+    bool AddTile(uint64_t nTileId, const MD5Digest &abyMD5, const void *pData,
+                 size_t nSize);
+
+    /** Assembles the final file. oMetadataItems contains MBTiles-style
+     * metadata items (name, value as strings) */
+    bool Finalize(const CPLJSONObject &oMetadataItems);
+
+  private:
+    struct HashMD5
+    {
+        size_t operator()(const MD5Digest &key) const;
+    };
+
+    std::string m_osDestName{};
+    std::string m_osTmpFilename{};
+    VSIVirtualHandleUniquePtr m_poTmpFile{};
+    std::vector<pmtiles::entryv3> m_asEntries{};
+    std::unordered_map<MD5Digest, std::pair<uint64_t, uint32_t>, HashMD5>
+        m_oMapMD5ToOffsetLen{};
+    uint64_t m_nLastTileId = 0;
+    MD5Digest m_abyLastMD5{};
+    uint64_t m_nFileOffset = 0;
+    uint64_t m_nAddressedTiles = 0;
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRPMTilesArchiveWriter)
+};
+
 #endif /* OGRPMTILESFROMMBTILES_H_INCLUDED */
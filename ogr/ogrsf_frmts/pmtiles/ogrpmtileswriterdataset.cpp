@@ -17,6 +17,68 @@
 #include "mvtutils.h"
 #include "ogrpmtilesfrommbtiles.h"
 
+#include <limits>
+
+namespace
+{
+
+/************************************************************************/
+/*                        OGRPMTilesTileSink                            */
+/************************************************************************/
+
+// Receives the tiles generated by the MVT writer, by ascending PMTiles tile
+// id, and streams them to the PMTiles archive writer.
+class OGRPMTilesTileSink final : public OGRMVTTileSink
+{
+    OGRPMTilesArchiveWriter m_oWriter;
+
+  public:
+    explicit OGRPMTilesTileSink(const std::string &osDestName)
+        : m_oWriter(osDestName)
+    {
+    }
+
+    bool Open()
+    {
+        return m_oWriter.Open();
+    }
+
+    uint64_t GetTileSortKey(int nZ, int nX, int nY) const override
+    {
+        if (nZ < 0 || nZ > 30 || nX < 0 || nX >= (1 << nZ) || nY < 0 ||
+            nY >= (1 << nZ))
+        {
+            return std::numeric_limits<uint64_t>::max();
+        }
+        return pmtiles::zxy_to_tileid(static_cast<uint8_t>(nZ), nX, nY);
+    }
+
+    bool WriteTile(int nZ, int nX, int nY,
+                   const std::string &osTileData) override
+    {
+        const uint64_t nTileId = GetTileSortKey(nZ, nX, nY);
+        if (nTileId == std::numeric_limits<uint64_t>::max())
+        {
+            CPLError(CE_Warning, CPLE_AppDefined,
+                     "Skipping tile %d/%d/%d not addressable in PMTiles", nZ,
+                     nX, nY);
+            return true;
+        }
+        return m_oWriter.AddTile(
+            nTileId,
+            OGRPMTilesArchiveWriter::ComputeMD5(osTileData.data(),
+                                                osTileData.size()),
+            osTileData.data(), osTileData.size());
+    }
+
+    bool Finalize(const CPLJSONObject &oMetadata) override
+    {
+        return m_oWriter.Finalize(oMetadata);
+    }
+};
+
+}  // namespace
+
 /************************************************************************/
 /*                     ~OGRPMTilesWriterDataset()                       */
 /************************************************************************/
@@ -35,24 +97,14 @@ CPLErr OGRPMTilesWriterDataset::Close()
     CPLErr eErr = CE_None;
     if (nOpenFlags != OPEN_FLAGS_CLOSED)
     {
-        if (m_poMBTilesWriterDataset)
+        if (m_poMVTWriterDataset)
         {
-            if (m_poMBTilesWriterDataset->Close() != CE_None)
+            // This generates the tiles and writes the PMTiles file
+            if (m_poMVTWriterDataset->Close() != CE_None)
             {
                 eErr = CE_Failure;
             }
-            else
-            {
-                if (!OGRPMTilesConvertFromMBTiles(
-                        GetDescription(),
-                        m_poMBTilesWriterDataset->GetDescription()))
-                {
-                    eErr = CE_Failure;
-                }
-            }
-
-            VSIUnlink(m_poMBTilesWriterDataset->GetDescription());
-            m_poMBTilesWriterDataset.reset();
+            m_poMVTWriterDataset.reset();
         }
 
         if (GDALDataset::Close() != CE_None)
@@ -70,27 +122,32 @@ bool OGRPMTilesWriterDataset::Create(const char *pszFilename,
 {
     SetDescription(pszFilename);
     CPLStringList aosOptions(papszOptions);
-    aosOptions.SetNameValue("FORMAT", "MBTILES");
-
-    // Let's build a temporary file that contains the tile data in
-    // a way that corresponds to the "clustered" mode, that is
-    // "offsets are either contiguous with the previous offset+length, or
-    // refer to a lesser offset, when writing with deduplication."
-    std::string osTmpFile(pszFilename);
-    if (!VSIIsLocal(pszFilename))
+
+    // Encoded tiles are directly streamed by the MVT writer to the PMTiles
+    // archive writer, by ascending tile id, without going through an
+    // intermediate MBTiles file.
+    if (!aosOptions.FetchNameValue("TEMPORARY_DB") && !VSIIsLocal(pszFilename))
     {
-        osTmpFile = CPLGenerateTempFilenameSafe(CPLGetFilename(pszFilename));
+        aosOptions.SetNameValue(
+            "TEMPORARY_DB",
+            (CPLGenerateTempFilenameSafe(CPLGetFilename(pszFilename)) +
+             ".temp.db")
+                .c_str());
     }
-    osTmpFile += ".tmp.mbtiles";
 
     if (!aosOptions.FetchNameValue("NAME"))
         aosOptions.SetNameValue("NAME",
                                 CPLGetBasenameSafe(pszFilename).c_str());
 
-    m_poMBTilesWriterDataset.reset(OGRMVTWriterDatasetCreate(
-        osTmpFile.c_str(), 0, 0, 0, GDT_Unknown, aosOptions.List()));
+    auto poTileSink = std::make_unique<OGRPMTilesTileSink>(pszFilename);
+    if (!poTileSink->Open())
+        return false;
+
+    m_poMVTWriterDataset.reset(OGRMVTWriterDatasetCreate(
+        pszFilename, 0, 0, 0, GDT_Unknown, aosOptions.List(),
+        std::move(poTileSink)));
 
-    return m_poMBTilesWriterDataset != nullptr;
+    return m_poMVTWriterDataset != nullptr;
 }
 
 /************************************************************************/
@@ -102,8 +159,8 @@ OGRPMTilesWriterDataset::ICreateLayer(const char *pszLayerName,
                                       const OGRGeomFieldDefn *poGeomFieldDefn,
                                       CSLConstList papszOptions)
 {
-    return m_poMBTilesWriterDataset->CreateLayer(pszLayerName, poGeomFieldDefn,
-                                                 papszOptions);
+    return m_poMVTWriterDataset->CreateLayer(pszLayerName, poGeomFieldDefn,
+                                             papszOptions);
 }
 
 /************************************************************************/
@@ -112,7 +169,7 @@ OGRPMTilesWriterDataset::ICreateLayer(const char *pszLayerName,
 
 int OGRPMTilesWriterDataset::TestCapability(const char *pszCap) const
 {
-    return m_poMBTilesWriterDataset->TestCapability(pszCap);
+    return m_poMVTWriterDataset->TestCapability(pszCap);
 }
 
 #endif  // HAVE_MVT_WRITE_SUPPORT
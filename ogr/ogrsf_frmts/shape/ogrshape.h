@@ -24,6 +24,9 @@
 #include "shapefil.h"
 #include "shp_vsi.h"
 #include "ogrlayerpool.h"
+#include <deque>
+#include <functional>
+#include <memory>
 #include <set>
 #include <vector>
 
@@ -172,6 +175,17 @@ class OGRShapeLayer final : public OGRAbstractProxiedLayer
 
     bool m_bAutoRepack = false;
 
+    // Multi-threaded reading
+    int m_nNumThreads = 1;
+    std::deque<std::unique_ptr<OGRFeature>> m_apoPendingFeatures{};
+    bool ReadAheadFeaturesParallel();
+    bool ReadSHPRecords(int iFirst, int nShapes,
+                        const std::function<bool(int)> &IsSkipped,
+                        std::vector<GByte> &abySHP, SAOffset &nSHPOffset);
+    bool WriteQIXBulk(int nMaxDepth, const char *pszQIXFilename);
+    OGRFeature *FetchShape(int iShapeId, SHPHandle hSHP, DBFHandle hDBF,
+                           bool &bHasWarnedWrongWindingOrder);
+
     typedef enum
     {
         YES,
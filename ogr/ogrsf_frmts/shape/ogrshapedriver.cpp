@@ -354,6 +354,9 @@ void RegisterOGRShape()
         "default='YES'/>"
         "  <Option name='DBF_EOF_CHAR' type='boolean' description='Whether to "
         "write the 0x1A end-of-file character in DBF files' default='YES'/>"
+        "  <Option name='NUM_THREADS' type='string' description='Number of "
+        "worker threads used to decode shapes and attributes when reading. "
+        "Integer or ALL_CPUS' default='1'/>"
         "</OpenOptionList>");
 
     poDriver->SetMetadataItem(GDAL_DMD_CREATIONOPTIONLIST,
@@ -26,6 +26,7 @@
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_multiproc.h"
 #include "cpl_port.h"
 #include "cpl_string.h"
@@ -39,6 +40,7 @@
 #include "ogr_srs_api.h"
 #include "ogrlayerpool.h"
 #include "ograrrowarrayhelper.h"
+#include "gdal_thread_pool.h"
 #include "ogrsf_frmts.h"
 #include "shapefil.h"
 #include "shp_vsi.h"
@@ -133,6 +135,14 @@ OGRShapeLayer::OGRShapeLayer(OGRShapeDataSource *poDSIn,
     }
     SetMetadataItem("SOURCE_ENCODING", m_osEncoding, "SHAPEFILE");
 
+    const char *pszNumThreads =
+        CSLFetchNameValueDef(m_poDS->GetOpenOptions(), "NUM_THREADS",
+                             CPLGetConfigOption("GDAL_NUM_THREADS", "1"));
+    m_nNumThreads =
+        std::max(1, std::min(128, EQUAL(pszNumThreads, "ALL_CPUS")
+                                      ? CPLGetNumCPUs()
+                                      : atoi(pszNumThreads)));
+
     m_poFeatureDefn = SHPReadOGRFeatureDefn(
         CPLGetBasenameSafe(m_osFullName.c_str()).c_str(), m_hSHP, m_hDBF,
         m_osEncoding,
@@ -767,6 +777,7 @@ void OGRShapeLayer::ResetReading()
     m_iMatchingFID = 0;
 
     m_iNextShapeId = 0;
+    m_apoPendingFeatures.clear();
 
     if (m_bHeaderDirty && m_bUpdateAccess)
         SyncToDisk();
@@ -874,6 +885,7 @@ OGRErr OGRShapeLayer::SetNextByIndex(GIntBig nIndex)
         return OGRLayer::SetNextByIndex(nIndex);
 
     m_iNextShapeId = static_cast<int>(nIndex);
+    m_apoPendingFeatures.clear();
 
     return OGRERR_NONE;
 }
@@ -887,12 +899,22 @@ OGRErr OGRShapeLayer::SetNextByIndex(GIntBig nIndex)
 
 OGRFeature *OGRShapeLayer::FetchShape(int iShapeId)
 
+{
+    return FetchShape(iShapeId, m_hSHP, m_hDBF, m_bHasWarnedWrongWindingOrder);
+}
+
+// This may be called concurrently from several threads, provided that each
+// of them uses its own hSHP and hDBF handles.
+OGRFeature *OGRShapeLayer::FetchShape(int iShapeId, SHPHandle hSHP,
+                                      DBFHandle hDBF,
+                                      bool &bHasWarnedWrongWindingOrder)
+
 {
     OGRFeature *poFeature = nullptr;
 
-    if (m_poFilterGeom != nullptr && m_hSHP != nullptr)
+    if (m_poFilterGeom != nullptr && hSHP != nullptr)
     {
-        SHPObject *psShape = SHPReadObject(m_hSHP, iShapeId);
+        SHPObject *psShape = SHPReadObject(hSHP, iShapeId);
 
         // do not trust degenerate bounds on non-point geometries
         // or bounds on null shapes.
@@ -904,9 +926,9 @@ OGRFeature *OGRShapeLayer::FetchShape(int iShapeId)
               psShape->dfYMin == psShape->dfYMax)) ||
             psShape->nSHPType == SHPT_NULL)
         {
-            poFeature = SHPReadOGRFeature(m_hSHP, m_hDBF, m_poFeatureDefn,
+            poFeature = SHPReadOGRFeature(hSHP, hDBF, m_poFeatureDefn,
                                           iShapeId, psShape, m_osEncoding,
-                                          m_bHasWarnedWrongWindingOrder);
+                                          bHasWarnedWrongWindingOrder);
         }
         else if (m_sFilterEnvelope.MaxX < psShape->dfXMin ||
                  m_sFilterEnvelope.MaxY < psShape->dfYMin ||
@@ -918,16 +940,16 @@ OGRFeature *OGRShapeLayer::FetchShape(int iShapeId)
         }
         else
         {
-            poFeature = SHPReadOGRFeature(m_hSHP, m_hDBF, m_poFeatureDefn,
+            poFeature = SHPReadOGRFeature(hSHP, hDBF, m_poFeatureDefn,
                                           iShapeId, psShape, m_osEncoding,
-                                          m_bHasWarnedWrongWindingOrder);
+                                          bHasWarnedWrongWindingOrder);
         }
     }
     else
     {
-        poFeature = SHPReadOGRFeature(m_hSHP, m_hDBF, m_poFeatureDefn, iShapeId,
+        poFeature = SHPReadOGRFeature(hSHP, hDBF, m_poFeatureDefn, iShapeId,
                                       nullptr, m_osEncoding,
-                                      m_bHasWarnedWrongWindingOrder);
+                                      bHasWarnedWrongWindingOrder);
     }
 
     return poFeature;
@@ -975,6 +997,14 @@ OGRFeature *OGRShapeLayer::GetNextFeature()
 
             m_iMatchingFID++;
         }
+        else if (m_nNumThreads > 1 && !m_bUpdateAccess)
+        {
+            if (m_apoPendingFeatures.empty() && !ReadAheadFeaturesParallel())
+                return nullptr;
+
+            poFeature = m_apoPendingFeatures.front().release();
+            m_apoPendingFeatures.pop_front();
+        }
         else
         {
             if (m_iNextShapeId >= m_nTotalShapeCount)
@@ -1020,6 +1050,313 @@ OGRFeature *OGRShapeLayer::GetNextFeature()
     }
 }
 
+/************************************************************************/
+/*                      OGRShapeReadAheadHandles                        */
+/************************************************************************/
+
+namespace
+{
+/** Copies of the shapelib handles of a layer whose .shp and .dbf content is
+ * served from blocks read in advance, so that records can be decoded by a
+ * worker thread. They share the record index and the field descriptions of
+ * the original handles, and must only be used for reading.
+ */
+class OGRShapeReadAheadHandles
+{
+    SHPInfo m_sSHP{};
+    DBFInfo m_sDBF{};
+    SHPHandle m_hSHP = nullptr;
+    DBFHandle m_hDBF = nullptr;
+    std::vector<char> m_abyCurrentRecord{};
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRShapeReadAheadHandles)
+
+  public:
+    OGRShapeReadAheadHandles(SHPHandle hSHP, const std::vector<GByte> &abySHP,
+                             SAOffset nSHPOffset, DBFHandle hDBF,
+                             const std::vector<GByte> &abyDBF,
+                             SAOffset nDBFOffset)
+    {
+        if (hSHP)
+        {
+            m_sSHP = *hSHP;
+            m_sSHP.fpSHP = VSI_SHP_OpenWindow(hSHP->fpSHP, abySHP.data(),
+                                              nSHPOffset, abySHP.size());
+            m_sSHP.fpSHX = nullptr;
+            m_sSHP.bUpdated = FALSE;
+            m_sSHP.pabyRec = nullptr;
+            m_sSHP.nBufSize = 0;
+            m_sSHP.bFastModeReadObject = FALSE;
+            m_sSHP.pabyObjectBuf = nullptr;
+            m_sSHP.nObjectBufSize = 0;
+            m_sSHP.psCachedObject = nullptr;
+            m_hSHP = &m_sSHP;
+        }
+        if (hDBF)
+        {
+            m_abyCurrentRecord.resize(std::max(1, hDBF->nRecordLength));
+            m_sDBF = *hDBF;
+            m_sDBF.fp = VSI_SHP_OpenWindow(hDBF->fp, abyDBF.data(), nDBFOffset,
+                                           abyDBF.size());
+            m_sDBF.nCurrentRecord = -1;
+            m_sDBF.bCurrentRecordModified = FALSE;
+            m_sDBF.pszCurrentRecord = m_abyCurrentRecord.data();
+            m_sDBF.nWorkFieldLength = 0;
+            m_sDBF.pszWorkField = nullptr;
+            m_sDBF.bUpdated = FALSE;
+            m_hDBF = &m_sDBF;
+        }
+    }
+
+    ~OGRShapeReadAheadHandles()
+    {
+        if (m_hSHP)
+        {
+            free(m_sSHP.pabyRec);
+            m_sSHP.sHooks.FClose(m_sSHP.fpSHP);
+        }
+        if (m_hDBF)
+        {
+            free(m_sDBF.pszWorkField);
+            m_sDBF.sHooks.FClose(m_sDBF.fp);
+        }
+    }
+
+    SHPHandle GetSHP() const
+    {
+        return m_hSHP;
+    }
+
+    DBFHandle GetDBF() const
+    {
+        return m_hDBF;
+    }
+};
+}  // namespace
+
+/************************************************************************/
+/*                          ReadSHPRecords()                            */
+/************************************************************************/
+
+/** Reads the .shp records of shapes [iFirst, iFirst + nShapes[, except the
+ * ones for which IsSkipped() returns true, with a single contiguous read
+ * into abySHP, starting at file offset nSHPOffset.
+ *
+ * Returns false if the records are not stored (reasonably) contiguously, in
+ * which case they must be read with SHPReadObject() on the layer handle.
+ */
+bool OGRShapeLayer::ReadSHPRecords(int iFirst, int nShapes,
+                                   const std::function<bool(int)> &IsSkipped,
+                                   std::vector<GByte> &abySHP,
+                                   SAOffset &nSHPOffset)
+{
+    bool bParallel = true;
+
+    // Load the .shx entries in the case of lazy loading.
+    if (m_hSHP->fpSHX != nullptr &&
+        std::find(m_hSHP->panRecOffset + iFirst,
+                  m_hSHP->panRecOffset + iFirst + nShapes,
+                  0U) != m_hSHP->panRecOffset + iFirst + nShapes)
+    {
+        std::vector<GByte> abySHX(static_cast<size_t>(nShapes) * 8);
+        if (m_hSHP->sHooks.FSeek(m_hSHP->fpSHX,
+                                 100 + static_cast<SAOffset>(iFirst) * 8,
+                                 SEEK_SET) == 0 &&
+            m_hSHP->sHooks.FRead(abySHX.data(), 8, nShapes, m_hSHP->fpSHX) ==
+                static_cast<SAOffset>(nShapes))
+        {
+            for (int i = 0; i < nShapes; ++i)
+            {
+                unsigned nOffset = 0;
+                unsigned nLength = 0;
+                memcpy(&nOffset, abySHX.data() + 8 * i, 4);
+                memcpy(&nLength, abySHX.data() + 8 * i + 4, 4);
+                CPL_MSBPTR32(&nOffset);
+                CPL_MSBPTR32(&nLength);
+                if (nOffset > static_cast<unsigned>(INT_MAX) ||
+                    nLength > static_cast<unsigned>(INT_MAX / 2 - 4))
+                {
+                    // Let SHPReadObject() report the error
+                    bParallel = false;
+                    break;
+                }
+                m_hSHP->panRecOffset[iFirst + i] = nOffset * 2;
+                m_hSHP->panRecSize[iFirst + i] = nLength * 2;
+            }
+        }
+        else
+        {
+            bParallel = false;
+        }
+    }
+
+    SAOffset nStart = std::numeric_limits<SAOffset>::max();
+    SAOffset nEnd = 0;
+    SAOffset nTotalSize = 0;
+    for (int i = 0; bParallel && i < nShapes; ++i)
+    {
+        if (IsSkipped(i))
+            continue;
+        const SAOffset nOffset = m_hSHP->panRecOffset[iFirst + i];
+        const SAOffset nSize = m_hSHP->panRecSize[iFirst + i] + 8;
+        nStart = std::min(nStart, nOffset);
+        nEnd = std::max(nEnd, nOffset + nSize);
+        nTotalSize += nSize;
+    }
+    // Do not read large unused areas, for example for a file where
+    // shapes have been rewritten at its end.
+    constexpr SAOffset MAX_READ_AHEAD_SIZE = 100 * 1024 * 1024;
+    if (bParallel && nEnd > nStart &&
+        (nEnd - nStart > MAX_READ_AHEAD_SIZE ||
+         nEnd - nStart > 2 * nTotalSize + 1024 * 1024))
+    {
+        bParallel = false;
+    }
+    if (bParallel && nEnd > nStart)
+    {
+        nSHPOffset = nStart;
+        abySHP.resize(static_cast<size_t>(nEnd - nStart));
+        size_t nRead = 0;
+        if (m_hSHP->sHooks.FSeek(m_hSHP->fpSHP, nStart, SEEK_SET) == 0)
+        {
+            nRead = static_cast<size_t>(m_hSHP->sHooks.FRead(
+                abySHP.data(), 1, nEnd - nStart, m_hSHP->fpSHP));
+        }
+        // In case of a truncated file, SHPReadObject() will report the
+        // error for the missing shapes.
+        abySHP.resize(nRead);
+    }
+    return bParallel;
+}
+
+/************************************************************************/
+/*                     ReadAheadFeaturesParallel()                      */
+/************************************************************************/
+
+/** Reads the .shp and .dbf records of the next batch of shapes with a single
+ * contiguous read in each file, and decodes them into features on worker
+ * threads. Features are queued in m_apoPendingFeatures in file order, with a
+ * null entry for deleted records and for shapes rejected by the spatial
+ * filter envelope.
+ */
+bool OGRShapeLayer::ReadAheadFeaturesParallel()
+{
+    if (m_iNextShapeId >= m_nTotalShapeCount)
+        return false;
+
+    const int iFirst = m_iNextShapeId;
+    int nShapes = std::min(m_nTotalShapeCount - iFirst, 1000 * m_nNumThreads);
+
+    // Read the .dbf records.
+    std::vector<GByte> abyDBF;
+    SAOffset nDBFOffset = 0;
+    int nDBFRecords = 0;
+    const int nRecordLength = m_hDBF ? std::max(1, m_hDBF->nRecordLength) : 0;
+    if (m_hDBF)
+    {
+        nDBFRecords =
+            std::max(0, std::min(nShapes, m_hDBF->nRecords - iFirst));
+        nDBFOffset = static_cast<SAOffset>(m_hDBF->nHeaderLength) +
+                     static_cast<SAOffset>(iFirst) * nRecordLength;
+        abyDBF.resize(static_cast<size_t>(nDBFRecords) * nRecordLength);
+        int nRead = 0;
+        if (nDBFRecords > 0 &&
+            m_hDBF->sHooks.FSeek(m_hDBF->fp, nDBFOffset, SEEK_SET) == 0)
+        {
+            nRead = static_cast<int>(m_hDBF->sHooks.FRead(
+                abyDBF.data(), nRecordLength, nDBFRecords, m_hDBF->fp));
+        }
+        if (nRead < nDBFRecords)
+        {
+            // I/O error: stop at the last complete record, as sequential
+            // reading does.
+            nShapes = nRead;
+            nDBFRecords = nRead;
+            abyDBF.resize(static_cast<size_t>(nRead) * nRecordLength);
+            if (nShapes == 0)
+            {
+                m_iNextShapeId = m_nTotalShapeCount;
+                return false;
+            }
+        }
+    }
+    m_iNextShapeId = iFirst + nShapes;
+
+    const auto IsDeleted = [&abyDBF, nDBFRecords, nRecordLength](int i)
+    {
+        return i < nDBFRecords &&
+               abyDBF[static_cast<size_t>(i) * nRecordLength] == '*';
+    };
+
+    // Read the .shp records, provided that they are stored contiguously.
+    std::vector<GByte> abySHP;
+    SAOffset nSHPOffset = 0;
+    const bool bParallel =
+        !m_hSHP ||
+        ReadSHPRecords(iFirst, nShapes, IsDeleted, abySHP, nSHPOffset);
+
+    std::vector<std::unique_ptr<OGRFeature>> apoFeatures(nShapes);
+    auto poThreadPool =
+        bParallel ? GDALGetGlobalThreadPool(m_nNumThreads) : nullptr;
+    auto poQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    if (poQueue && nShapes > 1)
+    {
+        const int nJobs = std::min(nShapes, m_nNumThreads);
+        const int nPerJob = (nShapes + nJobs - 1) / nJobs;
+        std::vector<int> abHasWarnedWrongWindingOrder(
+            nJobs, m_bHasWarnedWrongWindingOrder);
+        CPLErrorAccumulator oErrorAccumulator;
+        for (int iJob = 0; iJob < nJobs; ++iJob)
+        {
+            const int iStart = iJob * nPerJob;
+            const int iEnd = std::min(nShapes, iStart + nPerJob);
+            poQueue->SubmitJob(
+                [this, &oErrorAccumulator, &apoFeatures, &abySHP, &abyDBF,
+                 &abHasWarnedWrongWindingOrder, &IsDeleted, nSHPOffset,
+                 nDBFOffset, iFirst, iJob, iStart, iEnd]()
+                {
+                    auto oAccumulator =
+                        oErrorAccumulator.InstallForCurrentScope();
+                    CPL_IGNORE_RET_VAL(oAccumulator);
+                    OGRShapeReadAheadHandles oHandles(m_hSHP, abySHP,
+                                                      nSHPOffset, m_hDBF,
+                                                      abyDBF, nDBFOffset);
+                    bool bHasWarned = abHasWarnedWrongWindingOrder[iJob] != 0;
+                    for (int i = iStart; i < iEnd; ++i)
+                    {
+                        if (!IsDeleted(i))
+                        {
+                            apoFeatures[i].reset(FetchShape(
+                                iFirst + i, oHandles.GetSHP(),
+                                oHandles.GetDBF(), bHasWarned));
+                        }
+                    }
+                    abHasWarnedWrongWindingOrder[iJob] = bHasWarned;
+                });
+        }
+        poQueue->WaitCompletion();
+        oErrorAccumulator.ReplayErrors();
+        for (int bHasWarned : abHasWarnedWrongWindingOrder)
+        {
+            if (bHasWarned)
+                m_bHasWarnedWrongWindingOrder = true;
+        }
+    }
+    else
+    {
+        for (int i = 0; i < nShapes; ++i)
+        {
+            if (!IsDeleted(i))
+                apoFeatures[i].reset(FetchShape(iFirst + i));
+        }
+    }
+
+    for (auto &poFeature : apoFeatures)
+        m_apoPendingFeatures.push_back(std::move(poFeature));
+
+    return true;
+}
+
 /************************************************************************/
 /*                             GetFeature()                             */
 /************************************************************************/
@@ -2703,6 +3040,438 @@ OGRErr OGRShapeLayer::DropSpatialIndex()
     return OGRERR_NONE;
 }
 
+/************************************************************************/
+/*                        Bulk .qix generation                          */
+/************************************************************************/
+
+namespace
+{
+// Deepest tree handled by OGRShapeLayer::WriteQIXBulk(): the path of a node
+// must fit on 28 bits.
+constexpr int QIX_MAX_BULK_DEPTH = 15;
+constexpr uint32_t QIX_NO_NODE = std::numeric_limits<uint32_t>::max();
+
+/** Node of the quadtree built by SHPCreateTree() and SHPTreeTrimExtraNodes(),
+ * without the ids of its shapes.
+ */
+struct OGRShapeQIXNode
+{
+    double adfBoundsMin[4] = {0, 0, 0, 0};
+    double adfBoundsMax[4] = {0, 0, 0, 0};
+    int nShapeCount = 0;
+    int nSubNodes = 0;
+    int anSubNode[4] = {0, 0, 0, 0};
+};
+
+// Same as SHPTreeSplitBounds() of shptree.c
+void OGRShapeQIXSplitBounds(const double *padfBoundsMinIn,
+                            const double *padfBoundsMaxIn,
+                            double *padfBoundsMin1, double *padfBoundsMax1,
+                            double *padfBoundsMin2, double *padfBoundsMax2)
+{
+    constexpr double SHP_SPLIT_RATIO = 0.55;
+
+    memcpy(padfBoundsMin1, padfBoundsMinIn, sizeof(double) * 4);
+    memcpy(padfBoundsMax1, padfBoundsMaxIn, sizeof(double) * 4);
+    memcpy(padfBoundsMin2, padfBoundsMinIn, sizeof(double) * 4);
+    memcpy(padfBoundsMax2, padfBoundsMaxIn, sizeof(double) * 4);
+
+    if ((padfBoundsMaxIn[0] - padfBoundsMinIn[0]) >
+        (padfBoundsMaxIn[1] - padfBoundsMinIn[1]))
+    {
+        const double dfRange = padfBoundsMaxIn[0] - padfBoundsMinIn[0];
+        padfBoundsMax1[0] = padfBoundsMinIn[0] + dfRange * SHP_SPLIT_RATIO;
+        padfBoundsMin2[0] = padfBoundsMaxIn[0] - dfRange * SHP_SPLIT_RATIO;
+    }
+    else
+    {
+        const double dfRange = padfBoundsMaxIn[1] - padfBoundsMinIn[1];
+        padfBoundsMax1[1] = padfBoundsMinIn[1] + dfRange * SHP_SPLIT_RATIO;
+        padfBoundsMin2[1] = padfBoundsMaxIn[1] - dfRange * SHP_SPLIT_RATIO;
+    }
+}
+
+// Bounds of the 4 subnodes of a node, in the order of SHPTreeNodeAddShapeId()
+void OGRShapeQIXSubNodeBounds(const double *padfBoundsMin,
+                              const double *padfBoundsMax,
+                              double adfSubBoundsMin[4][4],
+                              double adfSubBoundsMax[4][4])
+{
+    double adfBoundsMinH1[4], adfBoundsMaxH1[4];
+    double adfBoundsMinH2[4], adfBoundsMaxH2[4];
+    OGRShapeQIXSplitBounds(padfBoundsMin, padfBoundsMax, adfBoundsMinH1,
+                           adfBoundsMaxH1, adfBoundsMinH2, adfBoundsMaxH2);
+    OGRShapeQIXSplitBounds(adfBoundsMinH1, adfBoundsMaxH1, adfSubBoundsMin[0],
+                           adfSubBoundsMax[0], adfSubBoundsMin[1],
+                           adfSubBoundsMax[1]);
+    OGRShapeQIXSplitBounds(adfBoundsMinH2, adfBoundsMaxH2, adfSubBoundsMin[2],
+                           adfSubBoundsMax[2], adfSubBoundsMin[3],
+                           adfSubBoundsMax[3]);
+}
+
+/** Returns the path from the root to the node where SHPTreeNodeAddShapeId()
+ * stores a shape: the number of levels below the root in the 4 most
+ * significant bits, and the index of the subnode taken at each level in
+ * 2-bit groups, starting from the least significant bits.
+ */
+uint32_t OGRShapeQIXGetPath(const SHPObject *psShape,
+                            const double *padfRootBoundsMin,
+                            const double *padfRootBoundsMax, int nMaxDepth)
+{
+    double adfBoundsMin[4];
+    double adfBoundsMax[4];
+    memcpy(adfBoundsMin, padfRootBoundsMin, sizeof(adfBoundsMin));
+    memcpy(adfBoundsMax, padfRootBoundsMax, sizeof(adfBoundsMax));
+
+    uint32_t nPath = 0;
+    int nLevel = 0;
+    for (; nLevel + 1 < nMaxDepth; ++nLevel)
+    {
+        double adfSubBoundsMin[4][4];
+        double adfSubBoundsMax[4][4];
+        OGRShapeQIXSubNodeBounds(adfBoundsMin, adfBoundsMax, adfSubBoundsMin,
+                                 adfSubBoundsMax);
+        int iSubNode = 0;
+        // Same test as SHPCheckObjectContained() for 2 dimensions
+        while (iSubNode < 4 &&
+               (psShape->dfXMin < adfSubBoundsMin[iSubNode][0] ||
+                psShape->dfXMax > adfSubBoundsMax[iSubNode][0] ||
+                psShape->dfYMin < adfSubBoundsMin[iSubNode][1] ||
+                psShape->dfYMax > adfSubBoundsMax[iSubNode][1]))
+        {
+            ++iSubNode;
+        }
+        if (iSubNode == 4)
+            break;
+        nPath |= static_cast<uint32_t>(iSubNode) << (2 * nLevel);
+        memcpy(adfBoundsMin, adfSubBoundsMin[iSubNode], sizeof(adfBoundsMin));
+        memcpy(adfBoundsMax, adfSubBoundsMax[iSubNode], sizeof(adfBoundsMax));
+    }
+    return (static_cast<uint32_t>(nLevel) << 28) | nPath;
+}
+
+/** Same as SHPTreeNodeTrim() of shptree.c. anPromotedTo[i] is set to the
+ * node into which node i is promoted, if it is.
+ */
+bool OGRShapeQIXTrimNode(std::vector<OGRShapeQIXNode> &aoNodes,
+                         std::vector<int> &anPromotedTo, int iNode)
+{
+    OGRShapeQIXNode &oNode = aoNodes[iNode];
+    for (int i = 0; i < oNode.nSubNodes; i++)
+    {
+        if (OGRShapeQIXTrimNode(aoNodes, anPromotedTo, oNode.anSubNode[i]))
+        {
+            oNode.anSubNode[i] = oNode.anSubNode[oNode.nSubNodes - 1];
+            oNode.nSubNodes--;
+            i--;
+        }
+    }
+
+    if (oNode.nSubNodes == 1 && oNode.nShapeCount == 0)
+    {
+        const int iSubNode = oNode.anSubNode[0];
+        oNode = aoNodes[iSubNode];
+        anPromotedTo[iSubNode] = iNode;
+    }
+
+    return oNode.nSubNodes == 0 && oNode.nShapeCount == 0;
+}
+
+/** Appends the nodes of the subtree of iNode to anOrder in the order in
+ * which they are written, and returns the size of the records of its
+ * subnodes, as SHPGetSubNodeOffset() of shptree.c.
+ */
+GIntBig OGRShapeQIXCollectNodes(const std::vector<OGRShapeQIXNode> &aoNodes,
+                                int iNode, std::vector<int> &anOrder,
+                                std::vector<GIntBig> &anSubNodeOffset)
+{
+    anOrder.push_back(iNode);
+    GIntBig nOffset = 0;
+    const OGRShapeQIXNode &oNode = aoNodes[iNode];
+    for (int i = 0; i < oNode.nSubNodes; ++i)
+    {
+        const int iSubNode = oNode.anSubNode[i];
+        nOffset += 4 * sizeof(double) +
+                   (aoNodes[iSubNode].nShapeCount + 3) * sizeof(int);
+        nOffset += OGRShapeQIXCollectNodes(aoNodes, iSubNode, anOrder,
+                                           anSubNodeOffset);
+    }
+    anSubNodeOffset[iNode] = nOffset;
+    return nOffset;
+}
+}  // namespace
+
+/************************************************************************/
+/*                           WriteQIXBulk()                             */
+/************************************************************************/
+
+/** Writes the same .qix file as SHPCreateTree(), SHPTreeTrimExtraNodes() and
+ * SHPWriteTree(), without inserting shapes one at a time in an in-memory
+ * tree.
+ *
+ * The node of each shape only depends on its bounding box, so it is computed
+ * on worker threads from blocks of .shp records read in advance. The tree
+ * skeleton is then built and trimmed from the shape counts of the nodes, and
+ * the file is written in a single pass, the shape ids of the nodes being
+ * distributed by chunks from the array of node indices. Memory use is 4
+ * bytes per shape, plus the skeleton and a 64 MB chunk of shape ids.
+ */
+bool OGRShapeLayer::WriteQIXBulk(int nMaxDepth, const char *pszQIXFilename)
+{
+    int nShapes = 0;
+    double adfRootBoundsMin[4];
+    double adfRootBoundsMax[4];
+    SHPGetInfo(m_hSHP, &nShapes, nullptr, adfRootBoundsMin, adfRootBoundsMax);
+
+    std::vector<uint32_t> anNodeOfShape;
+    std::vector<OGRShapeQIXNode> aoNodes(1);
+    try
+    {
+        anNodeOfShape.resize(nShapes);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate memory for spatial index creation");
+        return false;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Compute the path of each shape in the tree.                     */
+    /* -------------------------------------------------------------------- */
+    auto poThreadPool =
+        m_nNumThreads > 1 ? GDALGetGlobalThreadPool(m_nNumThreads) : nullptr;
+    auto poQueue = poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+    const int nBatchSize = 10000 * m_nNumThreads;
+    for (int iFirst = 0; iFirst < nShapes; iFirst += nBatchSize)
+    {
+        const int nBatch = std::min(nShapes - iFirst, nBatchSize);
+        std::vector<GByte> abySHP;
+        SAOffset nSHPOffset = 0;
+        if (poQueue && nBatch > 1 &&
+            ReadSHPRecords(
+                iFirst, nBatch, [](int) { return false; }, abySHP, nSHPOffset))
+        {
+            const int nJobs = std::min(nBatch, m_nNumThreads);
+            const int nPerJob = (nBatch + nJobs - 1) / nJobs;
+            CPLErrorAccumulator oErrorAccumulator;
+            for (int iJob = 0; iJob < nJobs; ++iJob)
+            {
+                const int iStart = iFirst + iJob * nPerJob;
+                const int iEnd = std::min(iFirst + nBatch, iStart + nPerJob);
+                poQueue->SubmitJob(
+                    [this, &oErrorAccumulator, &abySHP, &anNodeOfShape,
+                     &adfRootBoundsMin, &adfRootBoundsMax, nSHPOffset,
+                     nMaxDepth, iStart, iEnd]()
+                    {
+                        auto oAccumulator =
+                            oErrorAccumulator.InstallForCurrentScope();
+                        CPL_IGNORE_RET_VAL(oAccumulator);
+                        OGRShapeReadAheadHandles oHandles(
+                            m_hSHP, abySHP, nSHPOffset, nullptr,
+                            std::vector<GByte>(), 0);
+                        for (int i = iStart; i < iEnd; ++i)
+                        {
+                            SHPObject *psShape =
+                                SHPReadObject(oHandles.GetSHP(), i);
+                            anNodeOfShape[i] =
+                                psShape ? OGRShapeQIXGetPath(
+                                              psShape, adfRootBoundsMin,
+                                              adfRootBoundsMax, nMaxDepth)
+                                        : QIX_NO_NODE;
+                            SHPDestroyObject(psShape);
+                        }
+                    });
+            }
+            poQueue->WaitCompletion();
+            oErrorAccumulator.ReplayErrors();
+        }
+        else
+        {
+            for (int i = iFirst; i < iFirst + nBatch; ++i)
+            {
+                SHPObject *psShape = SHPReadObject(m_hSHP, i);
+                anNodeOfShape[i] =
+                    psShape ? OGRShapeQIXGetPath(psShape, adfRootBoundsMin,
+                                                 adfRootBoundsMax, nMaxDepth)
+                            : QIX_NO_NODE;
+                SHPDestroyObject(psShape);
+            }
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Build the tree skeleton, and replace the path of each shape     */
+    /*      by the index of its node.                                       */
+    /* -------------------------------------------------------------------- */
+    memcpy(aoNodes[0].adfBoundsMin, adfRootBoundsMin,
+           sizeof(adfRootBoundsMin));
+    memcpy(aoNodes[0].adfBoundsMax, adfRootBoundsMax,
+           sizeof(adfRootBoundsMax));
+    int nTotalCount = 0;
+    try
+    {
+        for (uint32_t &nPath : anNodeOfShape)
+        {
+            if (nPath == QIX_NO_NODE)
+                continue;
+            ++nTotalCount;
+            const int nLevels = static_cast<int>(nPath >> 28);
+            int iNode = 0;
+            for (int iLevel = 0; iLevel < nLevels; ++iLevel)
+            {
+                if (aoNodes[iNode].nSubNodes == 0)
+                {
+                    double adfSubBoundsMin[4][4];
+                    double adfSubBoundsMax[4][4];
+                    OGRShapeQIXSubNodeBounds(aoNodes[iNode].adfBoundsMin,
+                                             aoNodes[iNode].adfBoundsMax,
+                                             adfSubBoundsMin, adfSubBoundsMax);
+                    const int iFirstSubNode = static_cast<int>(aoNodes.size());
+                    aoNodes.resize(aoNodes.size() + 4);
+                    for (int i = 0; i < 4; ++i)
+                    {
+                        auto &oSubNode = aoNodes[iFirstSubNode + i];
+                        memcpy(oSubNode.adfBoundsMin, adfSubBoundsMin[i],
+                               sizeof(oSubNode.adfBoundsMin));
+                        memcpy(oSubNode.adfBoundsMax, adfSubBoundsMax[i],
+                               sizeof(oSubNode.adfBoundsMax));
+                        aoNodes[iNode].anSubNode[i] = iFirstSubNode + i;
+                    }
+                    aoNodes[iNode].nSubNodes = 4;
+                }
+                iNode = aoNodes[iNode].anSubNode[(nPath >> (2 * iLevel)) & 3];
+            }
+            aoNodes[iNode].nShapeCount++;
+            nPath = static_cast<uint32_t>(iNode);
+        }
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate memory for spatial index creation");
+        return false;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Trim unused nodes. Shapes of promoted nodes move to the node    */
+    /*      that replaces them, which has always a lower index.             */
+    /* -------------------------------------------------------------------- */
+    std::vector<int> anPromotedTo(aoNodes.size());
+    for (size_t i = 0; i < anPromotedTo.size(); ++i)
+        anPromotedTo[i] = static_cast<int>(i);
+    OGRShapeQIXTrimNode(aoNodes, anPromotedTo, 0);
+    for (size_t i = 0; i < anPromotedTo.size(); ++i)
+        anPromotedTo[i] = anPromotedTo[anPromotedTo[i]];
+    for (uint32_t &nNode : anNodeOfShape)
+    {
+        if (nNode != QIX_NO_NODE)
+            nNode = static_cast<uint32_t>(anPromotedTo[nNode]);
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Compute the layout of the file.                                 */
+    /* -------------------------------------------------------------------- */
+    std::vector<int> anOrder;
+    std::vector<GIntBig> anSubNodeOffset(aoNodes.size());
+    if (OGRShapeQIXCollectNodes(aoNodes, 0, anOrder, anSubNodeOffset) >
+        INT_MAX)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Too many shapes for a .qix spatial index");
+        return false;
+    }
+    // Position of the first shape id of each node in the sequence of the
+    // shape ids of all nodes.
+    std::vector<GIntBig> anFirstIdPos(aoNodes.size());
+    GIntBig nIdPos = 0;
+    for (int iNode : anOrder)
+    {
+        anFirstIdPos[iNode] = nIdPos;
+        nIdPos += aoNodes[iNode].nShapeCount;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Write the file.                                                 */
+    /* -------------------------------------------------------------------- */
+    constexpr GIntBig IDS_PER_CHUNK = 16 * 1024 * 1024;
+    std::vector<int> anIds(
+        static_cast<size_t>(std::min<GIntBig>(nTotalCount, IDS_PER_CHUNK)));
+    std::vector<GIntBig> anNextIdPos;
+    GIntBig nChunkStart = 0;
+    GIntBig nChunkEnd = 0;
+    // Fill anIds with the next chunk of the sequence of shape ids.
+    const auto LoadNextChunk = [&]()
+    {
+        nChunkStart = nChunkEnd;
+        nChunkEnd = std::min<GIntBig>(nTotalCount, nChunkStart + IDS_PER_CHUNK);
+        anNextIdPos = anFirstIdPos;
+        for (int i = 0; i < nShapes; ++i)
+        {
+            const uint32_t nNode = anNodeOfShape[i];
+            if (nNode == QIX_NO_NODE)
+                continue;
+            const GIntBig nPos = anNextIdPos[nNode]++;
+            if (nPos >= nChunkStart && nPos < nChunkEnd)
+                anIds[static_cast<size_t>(nPos - nChunkStart)] = i;
+        }
+    };
+
+    VSILFILE *fp = VSIFOpenL(pszQIXFilename, "wb");
+    if (fp == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_OpenFailed, "Cannot create %s",
+                 pszQIXFilename);
+        return false;
+    }
+
+    GByte abyHeader[16] = {'S', 'Q', 'T', CPL_IS_LSB ? 1 : 2, 1, 0, 0, 0};
+    memcpy(abyHeader + 8, &nTotalCount, 4);
+    memcpy(abyHeader + 12, &nMaxDepth, 4);
+    bool bOK = VSIFWriteL(abyHeader, sizeof(abyHeader), 1, fp) == 1;
+
+    nIdPos = 0;
+    for (int iNode : anOrder)
+    {
+        if (!bOK)
+            break;
+        const OGRShapeQIXNode &oNode = aoNodes[iNode];
+        GByte abyRec[40];
+        const int nOffset = static_cast<int>(anSubNodeOffset[iNode]);
+        memcpy(abyRec, &nOffset, 4);
+        memcpy(abyRec + 4, oNode.adfBoundsMin + 0, sizeof(double));
+        memcpy(abyRec + 12, oNode.adfBoundsMin + 1, sizeof(double));
+        memcpy(abyRec + 20, oNode.adfBoundsMax + 0, sizeof(double));
+        memcpy(abyRec + 28, oNode.adfBoundsMax + 1, sizeof(double));
+        memcpy(abyRec + 36, &oNode.nShapeCount, 4);
+        bOK = VSIFWriteL(abyRec, sizeof(abyRec), 1, fp) == 1;
+
+        GIntBig nRemaining = oNode.nShapeCount;
+        while (bOK && nRemaining > 0)
+        {
+            if (nIdPos == nChunkEnd)
+                LoadNextChunk();
+            const size_t nToWrite = static_cast<size_t>(
+                std::min(nRemaining, nChunkEnd - nIdPos));
+            bOK = VSIFWriteL(anIds.data() + (nIdPos - nChunkStart),
+                             sizeof(int), nToWrite, fp) == nToWrite;
+            nIdPos += nToWrite;
+            nRemaining -= nToWrite;
+        }
+
+        bOK = bOK && VSIFWriteL(&oNode.nSubNodes, 4, 1, fp) == 1;
+    }
+
+    if (VSIFCloseL(fp) != 0)
+        bOK = false;
+    if (!bOK)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Write error in %s",
+                 pszQIXFilename);
+    }
+    return bOK;
+}
+
 /************************************************************************/
 /*                         CreateSpatialIndex()                         */
 /************************************************************************/
@@ -2721,10 +3490,47 @@ OGRErr OGRShapeLayer::CreateSpatialIndex(int nMaxDepth)
 
     m_bCheckedForQIX = false;
 
+    OGRShapeLayer::SyncToDisk();
+
+    const std::string osQIXFilename =
+        CPLResetExtensionSafe(m_osFullName.c_str(), "qix");
+
+    /* -------------------------------------------------------------------- */
+    /*      Bulk load the tree, if its depth allows it. The result is the   */
+    /*      same as with SHPCreateTree(), which can be forced for testing   */
+    /*      purposes.                                                       */
+    /* -------------------------------------------------------------------- */
+    if (m_hSHP != nullptr && nMaxDepth <= QIX_MAX_BULK_DEPTH &&
+        CPLTestBool(CPLGetConfigOption("SHAPE_QIX_BULK_LOAD", "YES")))
+    {
+        if (nMaxDepth == 0)
+        {
+            // Same default depth as SHPCreateTree()
+            GIntBig nMaxNodeCount = 1;
+            while (nMaxNodeCount * 4 < m_hSHP->nRecords)
+            {
+                nMaxDepth += 1;
+                nMaxNodeCount = nMaxNodeCount * 2;
+            }
+            nMaxDepth = std::min(nMaxDepth, MAX_DEFAULT_TREE_DEPTH);
+        }
+
+        CPLDebug("SHAPE", "Creating index file %s", osQIXFilename.c_str());
+
+        if (!WriteQIXBulk(nMaxDepth, osQIXFilename.c_str()))
+        {
+            VSIUnlink(osQIXFilename.c_str());
+            return OGRERR_FAILURE;
+        }
+
+        CPL_IGNORE_RET_VAL(CheckForQIX());
+
+        return OGRERR_NONE;
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Build a quadtree structure for this file.                       */
     /* -------------------------------------------------------------------- */
-    OGRShapeLayer::SyncToDisk();
     SHPTree *psTree = SHPCreateTree(m_hSHP, 2, nMaxDepth, nullptr, nullptr);
 
     if (nullptr == psTree)
@@ -2744,13 +3550,9 @@ OGRErr OGRShapeLayer::CreateSpatialIndex(int nMaxDepth)
     /* -------------------------------------------------------------------- */
     /*      Dump tree to .qix file.                                         */
     /* -------------------------------------------------------------------- */
-    char *pszQIXFilename =
-        CPLStrdup(CPLResetExtensionSafe(m_osFullName.c_str(), "qix").c_str());
-
-    CPLDebug("SHAPE", "Creating index file %s", pszQIXFilename);
+    CPLDebug("SHAPE", "Creating index file %s", osQIXFilename.c_str());
 
-    SHPWriteTree(psTree, pszQIXFilename);
-    CPLFree(pszQIXFilename);
+    SHPWriteTree(psTree, osQIXFilename.c_str());
 
     /* -------------------------------------------------------------------- */
     /*      cleanup                                                         */
@@ -3887,7 +4689,8 @@ int OGRShapeLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
         return EIO;
     }
 
-    if (!m_hDBF || m_poAttrQuery != nullptr || m_poFilterGeom != nullptr)
+    if (!m_hDBF || m_poAttrQuery != nullptr || m_poFilterGeom != nullptr ||
+        !m_apoPendingFeatures.empty())
     {
         return OGRLayer::GetNextArrowArray(stream, out_array);
     }
@@ -26,6 +26,10 @@ typedef struct
     int bEnforce2GBLimit;
     int bHasWarned2GB;
     SAOffset nCurOffset;
+    /* Set for files created by VSI_SHP_OpenWindow() */
+    const unsigned char *pabyWindow;
+    SAOffset nWindowOffset;
+    SAOffset nWindowSize;
 } OGRSHPDBFFile;
 
 /************************************************************************/
@@ -69,6 +73,21 @@ static SAOffset VSI_SHP_Read(void *p, SAOffset size, SAOffset nmemb,
 
 {
     OGRSHPDBFFile *pFile = reinterpret_cast<OGRSHPDBFFile *>(file);
+    if (pFile->pabyWindow)
+    {
+        if (size == 0 || pFile->nCurOffset < pFile->nWindowOffset ||
+            pFile->nCurOffset >= pFile->nWindowOffset + pFile->nWindowSize)
+            return 0;
+        const SAOffset nAvailable =
+            pFile->nWindowOffset + pFile->nWindowSize - pFile->nCurOffset;
+        const SAOffset ret =
+            nmemb < nAvailable / size ? nmemb : nAvailable / size;
+        memcpy(p,
+               pFile->pabyWindow + (pFile->nCurOffset - pFile->nWindowOffset),
+               static_cast<size_t>(ret * size));
+        pFile->nCurOffset += ret * size;
+        return ret;
+    }
     SAOffset ret = static_cast<SAOffset>(VSIFReadL(
         p, static_cast<size_t>(size), static_cast<size_t>(nmemb), pFile->fp));
     pFile->nCurOffset += ret * size;
@@ -114,6 +133,8 @@ static SAOffset VSI_SHP_Write(const void *p, SAOffset size, SAOffset nmemb,
 {
     OGRSHPDBFFile *pFile = reinterpret_cast<OGRSHPDBFFile *>(file);
     SAOffset ret;
+    if (pFile->pabyWindow)
+        return 0;
     if (!VSI_SHP_WriteMoreDataOK(file, size * nmemb))
         return 0;
     ret = static_cast<SAOffset>(VSIFWriteL(
@@ -130,6 +151,16 @@ static SAOffset VSI_SHP_Seek(SAFile file, SAOffset offset, int whence)
 
 {
     OGRSHPDBFFile *pFile = reinterpret_cast<OGRSHPDBFFile *>(file);
+    if (pFile->pabyWindow)
+    {
+        /* The end of the window is considered as the end of file */
+        if (whence == SEEK_CUR)
+            offset += pFile->nCurOffset;
+        else if (whence == SEEK_END)
+            offset += pFile->nWindowOffset + pFile->nWindowSize;
+        pFile->nCurOffset = offset;
+        return 0;
+    }
     int ret = VSIFSeekL(pFile->fp, static_cast<vsi_l_offset>(offset), whence);
     if (whence == 0 && ret == 0)
         pFile->nCurOffset = offset;
@@ -157,6 +188,8 @@ static int VSI_SHP_Flush(SAFile file)
 
 {
     OGRSHPDBFFile *pFile = reinterpret_cast<OGRSHPDBFFile *>(file);
+    if (pFile->pabyWindow)
+        return 0;
     return VSIFFlushL(pFile->fp);
 }
 
@@ -168,7 +201,7 @@ static int VSI_SHP_Close(SAFile file)
 
 {
     OGRSHPDBFFile *pFile = reinterpret_cast<OGRSHPDBFFile *>(file);
-    int ret = VSIFCloseL(pFile->fp);
+    int ret = pFile->fp ? VSIFCloseL(pFile->fp) : 0;
     CPLFree(pFile->pszFilename);
     CPLFree(pFile);
     return ret;
@@ -238,6 +271,32 @@ const char *VSI_SHP_GetFilename(SAFile file)
     return pFile->pszFilename;
 }
 
+/************************************************************************/
+/*                         VSI_SHP_OpenWindow()                         */
+/************************************************************************/
+
+/* Returns a read-only file, to be closed with the FClose() hook, whose */
+/* content is the nSize bytes of pabyData located at nOffset in hBaseFile. */
+/* Reads outside of that window return no data. pabyData must remain valid */
+/* until the returned file is closed. The returned file may be used by */
+/* another thread than the one using hBaseFile. */
+SAFile VSI_SHP_OpenWindow(SAFile hBaseFile, const void *pabyData,
+                          SAOffset nOffset, SAOffset nSize)
+{
+    OGRSHPDBFFile *pBaseFile = reinterpret_cast<OGRSHPDBFFile *>(hBaseFile);
+    OGRSHPDBFFile *pFile =
+        static_cast<OGRSHPDBFFile *>(CPLCalloc(1, sizeof(OGRSHPDBFFile)));
+    pFile->fp = nullptr;
+    pFile->pszFilename = CPLStrdup(pBaseFile->pszFilename);
+    pFile->nCurOffset = nOffset;
+    static const unsigned char byEmptyWindow = 0;
+    pFile->pabyWindow = pabyData ? static_cast<const unsigned char *>(pabyData)
+                                 : &byEmptyWindow;
+    pFile->nWindowOffset = nOffset;
+    pFile->nWindowSize = nSize;
+    return reinterpret_cast<SAFile>(pFile);
+}
+
 /************************************************************************/
 /*                        VSI_SHP_Open2GBLimit()                        */
 /************************************************************************/
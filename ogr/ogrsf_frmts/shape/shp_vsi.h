@@ -27,6 +27,8 @@ const SAHooks *VSI_SHP_GetHook(int b2GBLimit);
 
 VSILFILE *VSI_SHP_GetVSIL(SAFile file);
 const char *VSI_SHP_GetFilename(SAFile file);
+SAFile VSI_SHP_OpenWindow(SAFile hBaseFile, const void *pabyData,
+                          SAOffset nOffset, SAOffset nSize);
 int VSI_SHP_WriteMoreDataOK(SAFile file, SAOffset nExtraBytes);
 
 CPL_C_END
@@ -320,6 +320,31 @@ int swqlex(YYSTYPE *ppNode, swq_parse_context *context)
     }
 }
 
+/************************************************************************/
+/*                           GetDistinctKey()                           */
+/*                                                                      */
+/*      Return the key of a value for DISTINCT, such that keys are      */
+/*      equal when the values compare equal with Compare() (e.g. "1"    */
+/*      and "1.0", or "-0" and "0" for a real field).                   */
+/************************************************************************/
+
+static std::string GetDistinctKey(swq_field_type eType, const char *pszValue)
+{
+    if (strcmp(pszValue, SZ_OGR_NULL) == 0)
+        return pszValue;
+    if (eType == SWQ_INTEGER64)
+        return std::to_string(CPLAtoGIntBig(pszValue));
+    if (eType == SWQ_FLOAT)
+    {
+        const double dfValue = CPLAtof(pszValue);
+        if (std::isnan(dfValue))
+            return "nan";
+        // + 0.0 turns -0.0 into 0.0
+        return CPLSPrintf("%.17g", dfValue + 0.0);
+    }
+    return pszValue;
+}
+
 /************************************************************************/
 /*                        swq_select_summarize()                        */
 /************************************************************************/
@@ -385,8 +410,8 @@ const char *swq_select_summarize(swq_select *select_info, int dest_column,
                 {
                     oComparator.eType = SWQ_STRING;
                 }
-                select_info->column_summary[i].oSetDistinctValues =
-                    std::set<CPLString, swq_summary::Comparator>(oComparator);
+                select_info->column_summary[i].oDistinctComparator =
+                    oComparator;
             }
             select_info->column_summary[i].min =
                 std::numeric_limits<double>::infinity();
@@ -409,14 +434,15 @@ const char *swq_select_summarize(swq_select *select_info, int dest_column,
             pszValue = SZ_OGR_NULL;
         try
         {
-            if (!cpl::contains(summary.oSetDistinctValues, pszValue))
+            if (summary.oHashDistinctValues
+                    .insert(GetDistinctKey(summary.oDistinctComparator.eType,
+                                           pszValue))
+                    .second)
             {
-                summary.oSetDistinctValues.insert(pszValue);
-                if (select_info->order_specs == 0)
-                {
-                    // If not sorted, keep values in their original order
-                    summary.oVectorDistinctValues.emplace_back(pszValue);
-                }
+                // Values are kept in their original order. They are sorted
+                // (in a stable way) once all of them have been collected if
+                // there is an ORDER BY.
+                summary.oVectorDistinctValues.emplace_back(pszValue);
                 summary.count++;
             }
         }
@@ -599,8 +625,8 @@ const char *swq_select_summarize(swq_select *select_info, int dest_column,
 /*                      sort comparison functions.                      */
 /************************************************************************/
 
-static bool Compare(swq_field_type eType, const CPLString &a,
-                    const CPLString &b)
+static bool Compare(swq_field_type eType, const std::string &a,
+                    const std::string &b)
 {
     if (a == SZ_OGR_NULL)
         return b != SZ_OGR_NULL;
@@ -609,9 +635,9 @@ static bool Compare(swq_field_type eType, const CPLString &a,
     else
     {
         if (eType == SWQ_INTEGER64)
-            return CPLAtoGIntBig(a) < CPLAtoGIntBig(b);
+            return CPLAtoGIntBig(a.c_str()) < CPLAtoGIntBig(b.c_str());
         else if (eType == SWQ_FLOAT)
-            return CPLAtof(a) < CPLAtof(b);
+            return CPLAtof(a.c_str()) < CPLAtof(b.c_str());
         else if (eType == SWQ_STRING)
             return a < b;
         else
@@ -623,8 +649,8 @@ static bool Compare(swq_field_type eType, const CPLString &a,
 }
 
 #ifndef DOXYGEN_SKIP
-bool swq_summary::Comparator::operator()(const CPLString &a,
-                                         const CPLString &b) const
+bool swq_summary::Comparator::operator()(const std::string &a,
+                                         const std::string &b) const
 {
     if (bSortAsc)
     {
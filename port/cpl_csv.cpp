@@ -25,6 +25,12 @@
 #include "gdal_csv.h"
 
 #include <algorithm>
+#include <string>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#define CPL_CSV_USE_SSE2
+#include <emmintrin.h>
+#endif
 
 /* ==================================================================== */
 /*      The CSVTable is a persistent set of info about an open CSV      */
@@ -248,6 +254,38 @@ void CSVDeaccess(const char *pszFilename)
     CSVDeaccessInternal(ppsCSVTableList, true, pszFilename);
 }
 
+/************************************************************************/
+/*                         CSVFindSpecialChar()                         */
+/*                                                                      */
+/*      Return a pointer to the first occurrence of ch1 or ch2 in       */
+/*      [pszIter, pszEnd), or pszEnd if there is none. 16 bytes are     */
+/*      classified at a time when SSE2 is available.                    */
+/************************************************************************/
+
+static const char *CSVFindSpecialChar(const char *pszIter,
+                                      const char *pszEnd, char ch1, char ch2)
+{
+#ifdef CPL_CSV_USE_SSE2
+    const __m128i xmm_ch1 = _mm_set1_epi8(ch1);
+    const __m128i xmm_ch2 = _mm_set1_epi8(ch2);
+    while (pszEnd - pszIter >= 16)
+    {
+        const __m128i xmm =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(pszIter));
+        if (_mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(xmm, xmm_ch1),
+                                           _mm_cmpeq_epi8(xmm, xmm_ch2))) != 0)
+        {
+            // The scalar loop below will locate it within these 16 bytes
+            break;
+        }
+        pszIter += 16;
+    }
+#endif
+    while (pszIter < pszEnd && *pszIter != ch1 && *pszIter != ch2)
+        ++pszIter;
+    return pszIter;
+}
+
 /************************************************************************/
 /*                            CSVSplitLine()                            */
 /*                                                                      */
@@ -266,20 +304,30 @@ static char **CSVSplitLine(const char *pszString, const char *pszDelimiter,
     if (pszString == nullptr)
         return static_cast<char **>(CPLCalloc(sizeof(char *), 1));
 
-    char *pszToken = static_cast<char *>(CPLCalloc(10, 1));
-    int nTokenMax = 10;
+    std::string osToken;
     const size_t nDelimiterLength = strlen(pszDelimiter);
 
     const char *pszIter = pszString;
-    while (*pszIter != '\0')
+    const char *const pszEnd = pszString + strlen(pszString);
+    while (pszIter != pszEnd)
     {
         bool bInString = false;
 
-        int nTokenLen = 0;
+        osToken.clear();
 
         // Try to find the next delimiter, marking end of token.
-        do
+        while (true)
         {
+            // Copy at once the characters that have no special meaning:
+            // anything but a double quote within a string, and anything but
+            // a double quote or the start of a delimiter outside of it.
+            const char *pszSpecial = CSVFindSpecialChar(
+                pszIter, pszEnd, bInString ? '"' : pszDelimiter[0], '"');
+            osToken.append(pszIter, pszSpecial - pszIter);
+            pszIter = pszSpecial;
+            if (pszIter == pszEnd)
+                break;
+
             // End if this is a delimiter skip it and break.
             if (!bInString &&
                 strncmp(pszIter, pszDelimiter, nDelimiterLength) == 0)
@@ -296,7 +344,7 @@ static char **CSVSplitLine(const char *pszString, const char *pszDelimiter,
 
             if (*pszIter == '"')
             {
-                if (!bInString && nTokenLen > 0)
+                if (!bInString && !osToken.empty())
                 {
                     // do not treat in a special way double quotes that appear
                     // in the middle of a field (similarly to OpenOffice)
@@ -306,7 +354,10 @@ static char **CSVSplitLine(const char *pszString, const char *pszDelimiter,
                 {
                     bInString = !bInString;
                     if (!bKeepLeadingAndClosingQuotes)
+                    {
+                        ++pszIter;
                         continue;
+                    }
                 }
                 else  // Doubled quotes in string resolve to one quote.
                 {
@@ -314,22 +365,15 @@ static char **CSVSplitLine(const char *pszString, const char *pszDelimiter,
                 }
             }
 
-            if (nTokenLen >= nTokenMax - 2)
-            {
-                nTokenMax = nTokenMax * 2 + 10;
-                pszToken = static_cast<char *>(CPLRealloc(pszToken, nTokenMax));
-            }
-
-            pszToken[nTokenLen] = *pszIter;
-            nTokenLen++;
-        } while (*(++pszIter) != '\0');
+            osToken += *pszIter;
+            ++pszIter;
+        }
 
-        pszToken[nTokenLen] = '\0';
-        aosRetList.AddString(pszToken);
+        aosRetList.AddString(osToken.c_str());
 
         // If the last token is an empty token, then we have to catch
         // it now, otherwise we won't reenter the loop and it will be lost.
-        if (*pszIter == '\0' &&
+        if (pszIter == pszEnd &&
             pszIter - pszString >= static_cast<int>(nDelimiterLength) &&
             strncmp(pszIter - nDelimiterLength, pszDelimiter,
                     nDelimiterLength) == 0)
@@ -338,8 +382,6 @@ static char **CSVSplitLine(const char *pszString, const char *pszDelimiter,
         }
     }
 
-    CPLFree(pszToken);
-
     if (aosRetList.Count() == 0)
         return static_cast<char **>(CPLCalloc(sizeof(char *), 1));
     else
@@ -656,33 +698,38 @@ CSVReadParseLineGeneric(void *fp, const char *(*pfnReadLine)(void *, size_t),
         {
             for (; i < osWorkLine.size(); ++i)
             {
-                if (osWorkLine[i] == '\"')
+                // Jump to the next double quote, as no other character
+                // changes the quoting state
+                i = osWorkLine.find('"', i);
+                if (i == std::string::npos)
                 {
-                    if (!bInString)
-                    {
-                        // Only consider " as the start of a quoted string
-                        // if it is the first character of the line, or
-                        // if it is immediately after the field delimiter.
-                        if (i == 0 ||
-                            (i >= nDelimiterLength &&
-                             osWorkLine.compare(i - nDelimiterLength,
-                                                nDelimiterLength, pszDelimiter,
-                                                nDelimiterLength) == 0))
-                        {
-                            bInString = true;
-                        }
-                    }
-                    else if (i + 1 < osWorkLine.size() &&
-                             osWorkLine[i + 1] == '"')
-                    {
-                        // Escaped double quote in a quoted string
-                        ++i;
-                    }
-                    else
+                    i = osWorkLine.size();
+                    break;
+                }
+
+                if (!bInString)
+                {
+                    // Only consider " as the start of a quoted string
+                    // if it is the first character of the line, or
+                    // if it is immediately after the field delimiter.
+                    if (i == 0 ||
+                        (i >= nDelimiterLength &&
+                         osWorkLine.compare(i - nDelimiterLength,
+                                            nDelimiterLength, pszDelimiter,
+                                            nDelimiterLength) == 0))
                     {
-                        bInString = false;
+                        bInString = true;
                     }
                 }
+                else if (i + 1 < osWorkLine.size() && osWorkLine[i + 1] == '"')
+                {
+                    // Escaped double quote in a quoted string
+                    ++i;
+                }
+                else
+                {
+                    bInString = false;
+                }
             }
 
             if (!bInString)
@@ -69,6 +69,7 @@ void CPLJSonStreamingParser::Reset()
     m_nLastChar = 0;
     m_nLineCounter = 1;
     m_nCharCounter = 1;
+    m_nCurrentOffset = 0;
     m_aState.clear();
     m_aState.push_back(INIT);
     m_osToken.clear();
@@ -100,6 +101,7 @@ void CPLJSonStreamingParser::AdvanceChar(const char *&pStr, size_t &nLength)
     pStr++;
     nLength--;
     m_nCharCounter++;
+    m_nCurrentOffset++;
 }
 
 /************************************************************************/
@@ -460,6 +462,7 @@ bool CPLJSonStreamingParser::Parse(std::string_view sStr, bool bFinished)
                     m_aState.pop_back();
                     pStr += nPos;
                     nLength -= nPos;
+                    m_nCurrentOffset += nPos;
                     SkipSpace(pStr, nLength);
                     continue;
                 }
@@ -576,6 +579,7 @@ bool CPLJSonStreamingParser::Parse(std::string_view sStr, bool bFinished)
                     m_aState.pop_back();
                     pStr += nPos + 1;
                     nLength -= nPos + 1;
+                    m_nCurrentOffset += nPos + 1;
                     SkipSpace(pStr, nLength);
                     if (nLength != 0)
                         continue;
@@ -41,6 +41,14 @@ class CPL_DLL CPLJSonStreamingParser /* non final */
     virtual void Reset();
     virtual bool Parse(std::string_view sStr, bool bFinished);
 
+    /** Return the number of bytes consumed since the start of the stream
+     * (or the last Reset()). Within the StartObject() and EndObject()
+     * callbacks, this is the offset of the '{' / '}' character. */
+    GUIntBig GetCurrentOffset() const
+    {
+        return m_nCurrentOffset;
+    }
+
   protected:
     bool EmitException(const char *pszMessage);
     void StopParsing();
@@ -110,6 +118,7 @@ class CPL_DLL CPLJSonStreamingParser /* non final */
     int m_nLastChar = 0;
     int m_nLineCounter = 1;
     int m_nCharCounter = 1;
+    GUIntBig m_nCurrentOffset = 0;
     std::vector<State> m_aState{};
     std::string m_osToken{};
     enum class ArrayState
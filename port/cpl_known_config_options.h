@@ -230,8 +230,11 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_ALLOW_REMOTE_RESOURCE_TO_ACCESS_LOCAL_FILE", // from vsikerchunk.cpp
    "GDAL_BAG_BLOCK_SIZE", // from bagdataset.cpp
    "GDAL_BAG_MAX_SIZE_VARRES_MAP", // from bagdataset.cpp
+   "GDAL_BAND_ARITHMETIC_FUSION", // from gdalcomputedrasterband.cpp
    "GDAL_BAND_BLOCK_CACHE", // from gdalrasterband.cpp
+   "GDAL_BAND_BLOCK_CACHE_SPILL_SIZE", // from gdalradixtablebandblockcache.cpp
    "GDAL_CACHE_DIRECTORY", // from gdal_misc.cpp
+   "GDAL_CACHE_WRITE_BEHIND_THRESHOLD", // from gdalrasterblock.cpp
    "GDAL_CACHEMAX", // from gdalrasterblock.cpp, nearblack_bin.cpp
    "GDAL_CONFIG_FILE", // from cpl_conv.cpp
    "GDAL_CURL_CA_BUNDLE", // from cpl_http.cpp
@@ -261,7 +264,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_ECW_WRITE_COMPRESSION_SOFTWARE", // from ecwcreatecopy.cpp
    "GDAL_ENABLE_PYTHON_PATH", // from gdalpython.cpp
    "GDAL_ENABLE_PYTHON_SYMLINK", // from gdalpython.cpp
-   "GDAL_ENABLE_READ_WRITE_MUTEX", // from gdaldataset.cpp
+   "GDAL_ENABLE_READ_WRITE_MUTEX", // from gdaldataset.cpp, gdalrasterblock.cpp
    "GDAL_ENABLE_TIFF_SPLIT", // from gtiffdataset_read.cpp
    "GDAL_ENABLE_WMS_CACHE", // from gdalwmsdataset.cpp
    "GDAL_ERROR_ON_LIBJPEG_WARNING", // from jpgdataset.cpp
@@ -345,7 +348,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_NETCDF_REPORT_EXTRA_DIM_VALUES", // from netcdfdataset.cpp
    "GDAL_NETCDF_VERIFY_DIMS", // from netcdfdataset.cpp
    "GDAL_NO_COSTLY_OVERVIEW", // from rasterio.cpp
-   "GDAL_NUM_THREADS", // from avifdataset.cpp, common.cpp, cpl_vsil_gzip.cpp, gdal_tps.cpp, gdalalgorithm.cpp, gdalgrid.cpp, gdalpansharpen.cpp, gdaltileindexdataset.cpp, gdalwarpkernel.cpp, gtiffdataset_write.cpp, jpegxl.cpp, libertiffdataset.cpp, ogr2ogr_lib.cpp, ogrmvtdataset.cpp, ogrparquetlayer.cpp, osm_parser.cpp, overview.cpp, rmfdataset.cpp, vrtdataset.cpp, zarr_array.cpp
+   "GDAL_NUM_THREADS", // from avifdataset.cpp, common.cpp, cpl_vsil_gzip.cpp, filegdbindex_write.cpp, gdal_tps.cpp, gdalalgorithm.cpp, gdalgeopackagerasterband.cpp, gdalgrid.cpp, gdalpansharpen.cpp, gdalrasterband.cpp, gdaltileindexdataset.cpp, gdalwarpkernel.cpp, gtiffdataset_write.cpp, jpegxl.cpp, libertiffdataset.cpp, ogr2ogr_lib.cpp, ogrcsvlayer.cpp, ogrflatgeobuflayer.cpp, ogrgeojsondatasource.cpp, ogrgeojsonseqdriver.cpp, ogrmvtdataset.cpp, ogrparquetlayer.cpp, ogrshapelayer.cpp, osm_parser.cpp, overview.cpp, rasterio.cpp, rmfdataset.cpp, vrtdataset.cpp, zarr_array.cpp
    "GDAL_OGCAPI_TILEMATRIXSET_LIMITS", // from gdalogcapidataset.cpp
    "GDAL_ONE_BIG_READ", // from jp2kakdataset.cpp, jpipkakdataset.cpp, mrsiddataset.cpp, rawdataset.cpp, wcsdataset.cpp
    "GDAL_OPEN_AFTER_COPY", // from jpgdataset.cpp, pngdataset.cpp
@@ -407,6 +410,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_SWATH_SIZE", // from gdalmultidim.cpp, rasterio.cpp
    "GDAL_TEMP_DRIVER_NAME", // from nearblack_lib_floodfill.cpp
    "GDAL_TERM_PROGRESS_OSC_9_4", // from cpl_progress.cpp
+   "GDAL_THREAD_SAFE_SHARED_READ", // from gdalthreadsafedataset.cpp
    "GDAL_THRESHOLD_MIN_THREADS_FOR_SPAWN", // from gdalalg_raster_tile.cpp
    "GDAL_THRESHOLD_MIN_TILES_PER_JOB", // from gdalalg_raster_tile.cpp
    "GDAL_TIFF_DEFLATE_SUBCODEC", // from gtiffdataset.cpp
@@ -424,9 +428,11 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_VECTOR_CONCAT_MAX_OPENED_DATASETS", // from gdalalg_vector_concat.cpp
    "GDAL_VRT_ENABLE_PYTHON", // from vrtderivedrasterband.cpp
    "GDAL_VRT_ENABLE_RAWRASTERBAND", // from vrtdataset.cpp
+   "GDAL_VRT_EXPRESSION_BATCH", // from pixelfunctions.cpp
    "GDAL_VRT_PYTHON_EXCLUSIVE_LOCK", // from vrtderivedrasterband.cpp
    "GDAL_VRT_PYTHON_TRUSTED_MODULES", // from vrtderivedrasterband.cpp
    "GDAL_VRT_RAWRASTERBAND_ALLOWED_SOURCE", // from vrtrawrasterband.cpp
+   "GDAL_VRT_TILED_MULTITHREADING", // from vrtsourcedrasterband.cpp
    "GDAL_VRT_WARP_USE_DATASET_RASTERIO", // from vrtwarped.cpp
    "GDAL_WARP_USE_AFFINE_OPTIMIZATION", // from gdalwarpkernel.cpp
    "GDAL_WARP_USE_TRANSLATION_OPTIM", // from gdalwarpoperation.cpp
@@ -740,6 +746,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "OGR_GMLAS_XERCES_MAX_MEMORY", // from ogrgmlasreader.cpp
    "OGR_GMLAS_XERCES_MAX_TIME", // from ogrgmlasreader.cpp
    "OGR_GPKG_ALLOW_THREADED_RTREE", // from ogrgeopackagetablelayer.cpp
+   "OGR_GPKG_BULK_INSERT_BATCH_SIZE", // from ogrgeopackagetablelayer.cpp
    "OGR_GPKG_CHECK_SRS", // from ogrgeopackagedatasource.cpp
    "OGR_GPKG_DEFERRED_SPI_UPDATE_THRESHOLD", // from ogrgeopackagetablelayer.cpp
    "OGR_GPKG_FOREIGN_KEY_CHECK", // from ogrgeopackagedatasource.cpp
@@ -769,6 +776,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "OGR_ODS_HEADERS", // from ogrodsdatasource.cpp
    "OGR_ODS_MAX_FIELD_COUNT", // from ogrodsdatasource.cpp
    "OGR_OPENFILEGDB_ERROR_ON_INCONSISTENT_BUFFER_MAX_SIZE", // from filegdbtable.cpp
+   "OGR_OPENFILEGDB_STREAM_BASE_IMPL", // from ogropenfilegdblayer.cpp
    "OGR_OPENFILEGDB_WRITE_EMPTY_GEOMETRY", // from ogropenfilegdblayer_write.cpp
    "OGR_ORGANIZE_POLYGONS", // from filegdbtable.cpp, ogrgeometryfactory.cpp
    "OGR_PARQUET_BATCH_READ_AHEAD", // from ogrparquetdatasetlayer.cpp
@@ -818,6 +826,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "OGR_SHAPE_USE_VSIMEM_FOR_TEMP", // from ogrshapedatasource.cpp
    "OGR_SKIP", // from gdaldrivermanager.cpp
    "OGR_SQL_LIKE_AS_ILIKE", // from ogrwfsfilter.cpp, swq_op_general.cpp
+   "OGR_SQL_ORDER_BY_MAX_MEMORY", // from ogr_gensql.cpp
    "OGR_SQL_STRICT", // from swq.cpp
    "OGR_SQLITE_ALLOW_EXTERNAL_ACCESS", // from ogrsqlitesqlfunctionscommon.cpp
    "OGR_SQLITE_CACHE", // from ogrgmldatasource.cpp, ogrsqlitedatasource.cpp
@@ -1002,6 +1011,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "SENTINEL2_USE_MAIN_MTD", // from sentinel2dataset.cpp
    "SHAPE_2GB_LIMIT", // from ogrshapedatasource.cpp
    "SHAPE_ENCODING", // from ogrshapelayer.cpp
+   "SHAPE_QIX_BULK_LOAD", // from ogrshapelayer.cpp
    "SHAPE_RESTORE_SHX", // from ogrshapedatasource.cpp
    "SHAPE_REWIND_ON_WRITE", // from ogrshapelayer.cpp
    "SPARSE_OK_OVERVIEW", // from gt_overview.cpp
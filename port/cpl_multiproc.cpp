@@ -538,6 +538,16 @@ int CPLAcquireMutex(CPLMutex *hMutex, double /*dfWaitInSeconds*/)
 }
 #endif  // ! MUTEX_NONE
 
+/************************************************************************/
+/*                        CPLTryAcquireMutex()                          */
+/************************************************************************/
+
+int CPLTryAcquireMutex(CPLMutex *hMutex)
+{
+    // There is no contention in the stub implementation.
+    return CPLAcquireMutex(hMutex, 0.0);
+}
+
 /************************************************************************/
 /*                          CPLReleaseMutex()                           */
 /************************************************************************/
@@ -880,6 +890,15 @@ int CPLAcquireMutex(CPLMutex *hMutexIn, double dfWaitInSeconds)
 #endif
 }
 
+/************************************************************************/
+/*                        CPLTryAcquireMutex()                          */
+/************************************************************************/
+
+int CPLTryAcquireMutex(CPLMutex *hMutex)
+{
+    return CPLAcquireMutex(hMutex, 0.0);
+}
+
 /************************************************************************/
 /*                          CPLReleaseMutex()                           */
 /************************************************************************/
@@ -1606,6 +1625,16 @@ int CPLAcquireMutex(CPLMutex *hMutexIn, double /* dfWaitInSeconds */)
     return TRUE;
 }
 
+/************************************************************************/
+/*                        CPLTryAcquireMutex()                          */
+/************************************************************************/
+
+int CPLTryAcquireMutex(CPLMutex *hMutexIn)
+{
+    MutexLinkedElt *psItem = reinterpret_cast<MutexLinkedElt *>(hMutexIn);
+    return pthread_mutex_trylock(&(psItem->sMutex)) == 0;
+}
+
 /************************************************************************/
 /*                          CPLReleaseMutex()                           */
 /************************************************************************/
@@ -57,6 +57,7 @@ int CPL_DLL CPLCreateOrAcquireMutex(CPLMutex **, double dfWaitInSeconds);
 int CPL_DLL CPLCreateOrAcquireMutexEx(CPLMutex **, double dfWaitInSeconds,
                                       int nOptions);
 int CPL_DLL CPLAcquireMutex(CPLMutex *hMutex, double dfWaitInSeconds);
+int CPL_DLL CPLTryAcquireMutex(CPLMutex *hMutex); /* does not wait */
 void CPL_DLL CPLReleaseMutex(CPLMutex *hMutex);
 void CPL_DLL CPLDestroyMutex(CPLMutex *hMutex);
 void CPL_DLL CPLCleanupMasterMutex(void);